@@ -12,9 +12,9 @@
  * @author   insert authors names here
  * @brief    Solution to Lab1 of ELF74/CSW41 - UTFPR. \n 
  *           Tools instalation and validation procedure.\n 
- *           Show messages on terminal using std::cout. \n 
+ *           Show messages on terminal using fmt_print() (common/fmt.h). \n 
  *           Show current value of some predefined macros (preprocessor symbols).\n 
- *           Read float value from terminal using std::cin.
+ *           Read float value from terminal using fmt_scan_line().
  * @version  
  * @date     
  ******************************************************************************/
@@ -44,16 +44,25 @@
  *------------------------------------------------------------------------------*/
 #include <stdint.h>
 
-#include <iostream>
-using std::cout;
-
 #include "template.h"
+#include "common/fmt.h"
+#include "common/profile.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include "driverlib/sysctl.h"
+#include "common/uart_stdio.h"
+#endif
 
 /*------------------------------------------------------------------------------
  *
  *      Typedefs and constants
  *
  *------------------------------------------------------------------------------*/
+/** Profiling zone ids (common/profile.h, build with PROF_ENABLE=1). */
+enum : uint16_t
+{
+    ZONE_MAIN = 1
+};
 
 /*------------------------------------------------------------------------------
  *
@@ -81,7 +90,44 @@ using std::cout;
  */
 int main(int argc, char ** argv)
 {
+#if defined(__IAR_SYSTEMS_ICC__)
+    /* console on UART0 (ICDI virtual COM port), 115200 8N1 */
+    uint32_t clock = SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                                        SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240,
+                                        120000000);
+    uart_stdio_init(clock, NULL);
+#endif
+    PROF_ZONE(ZONE_MAIN);
+    float value;
+
+    (void)argc;
+    (void)argv;
+
+    fmt_print(FMT("Lab1 - built {} {}\n"), __DATE__, __TIME__);
+    fmt_print(FMT("__FILE__    = {}\n"), __FILE__);
+    fmt_print(FMT("__LINE__    = {}\n"), __LINE__);
+    fmt_print(FMT("__cplusplus = {}\n"), __cplusplus);
+    fmt_print(FMT("__STDC_HOSTED__ = {}\n"), __STDC_HOSTED__);
+#if defined(__IAR_SYSTEMS_ICC__)
+    fmt_print(FMT("__IAR_SYSTEMS_ICC__ = {}\n"), __IAR_SYSTEMS_ICC__);
+    fmt_print(FMT("__VER__     = {}\n"), __VER__);
+    fmt_print(FMT("__CORE__    = {}\n"), __CORE__);
+#if defined(__ARMVFP__)
+    fmt_print(FMT("__ARMVFP__  = {}\n"), __ARMVFP__);
+#endif
+#endif
 
- 
+    fmt_print(FMT("Enter a float: "));
+    if (fmt_scan_line(FMT("{}"), value) == 1u)
+    {
+        fmt_print(FMT("read {} ({:.3f}, {:e})\n"), value, value, value);
+    }
+    else
+    {
+        fmt_print(FMT("not a number\n"));
+    }
+#if defined(__IAR_SYSTEMS_ICC__)
+    uart_stdio_flush();
+#endif
     return 0;
 }
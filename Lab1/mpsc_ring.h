@@ -0,0 +1,147 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Lab 1
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     mpsc_ring.h
+ * @author   insert authors names here
+ * @brief    Multi-producer single-consumer ring buffer, e.g. from several
+ *           ISRs of different priorities to one thread. \n
+ *           Producers reserve a slot by advancing the shared head with a
+ *           compare-and-swap (LDREX/STREX on the Cortex-M4; exception entry
+ *           clears the monitor, so a preempted reservation just retries),
+ *           then publish it through the slot's sequence number. The
+ *           consumer takes slots in reservation order: a producer preempted
+ *           between reserving and publishing holds back the slots after its
+ *           own until it resumes, it never loses them.\n
+ *           Elements live next to their sequence number, so there is no
+ *           zero-copy span API as in SpscRing (spsc_ring.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _MPSC_RING_H_
+#define _MPSC_RING_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include <atomic>
+
+/*------------------------------------------------------------------------------
+ *
+ *      Classes
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * @tparam T - element, copied by assignment
+ * @tparam N - capacity, a power of two
+ */
+template <typename T, uint32_t N>
+class MpscRing
+{
+    static_assert(N >= 2u && (N & (N - 1u)) == 0u, "N must be a power of two");
+
+public:
+    MpscRing() : head(0u), tail(0u)
+    {
+        for (uint32_t i = 0u; i < N; i++)
+        {
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing &) = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    static constexpr uint32_t capacity() { return N; }
+
+    /*--------------------------------------------------------------------------
+     *      Producer side, any number of contexts
+     *------------------------------------------------------------------------*/
+    /** @returns bool - false if the ring is full */
+    bool push(const T &value)
+    {
+        uint32_t pos = head.load(std::memory_order_relaxed);
+        Cell *cell;
+
+        for (;;)
+        {
+            cell = &cells[pos & (N - 1u)];
+            int32_t diff = (int32_t)(cell->seq.load(std::memory_order_acquire) - pos);
+
+            if (diff == 0)
+            {
+                /* a failed exchange reloads pos */
+                if (head.compare_exchange_weak(pos, pos + 1u,
+                                               std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                /* the consumer has not freed this slot yet */
+                return false;
+            }
+            else
+            {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->seq.store(pos + 1u, std::memory_order_release);
+        return true;
+    }
+
+    /*--------------------------------------------------------------------------
+     *      Consumer side, one context
+     *------------------------------------------------------------------------*/
+    /** @returns bool - false if the next element is not published yet */
+    bool pop(T &value)
+    {
+        Cell *cell = &cells[tail & (N - 1u)];
+
+        if (cell->seq.load(std::memory_order_acquire) != tail + 1u)
+        {
+            return false;
+        }
+        value = cell->value;
+        cell->seq.store(tail + N, std::memory_order_release);
+        tail++;
+        return true;
+    }
+
+    /** Copies up to @p count elements out. @returns uint32_t - copied */
+    uint32_t pop(T *values, uint32_t count)
+    {
+        uint32_t done = 0u;
+
+        while (done < count && pop(values[done]))
+        {
+            done++;
+        }
+        return done;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<uint32_t> seq;  /**< pos: free, pos + 1: published */
+        T                     value;
+    };
+
+    std::atomic<uint32_t> head;     /**< next slot to reserve */
+    uint32_t              tail;     /**< next slot to read, consumer only */
+    Cell                  cells[N];
+};
+
+#endif
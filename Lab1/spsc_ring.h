@@ -0,0 +1,232 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Lab 1
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     spsc_ring.h
+ * @author   insert authors names here
+ * @brief    Single-producer single-consumer ring buffer, e.g. from one ISR
+ *           to a thread, without disabling interrupts. \n
+ *           Each index is written by one side only (head by the producer,
+ *           tail by the consumer), so plain loads and stores with
+ *           acquire/release ordering suffice: no LDREX/STREX, no critical
+ *           section. The indices run freely and are masked with N - 1, so N
+ *           must be a power of two and all N slots are usable.\n
+ *           The bulk API hands out contiguous spans of the storage so that
+ *           data can be produced or consumed in place (e.g. by memcpy or
+ *           DMA): push_n()/pop_n() return the span, commit_push()/
+ *           commit_pop() publish what was used. A span stops at the end of
+ *           the storage; call again for the part that wrapped.\n
+ *           No padding separates the indices: the Cortex-M4 has no data
+ *           cache. On a multi-core host they share a cache line.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _SPSC_RING_H_
+#define _SPSC_RING_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include <atomic>
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Contiguous run of ring slots. */
+template <typename T>
+struct RingSpan
+{
+    T       *data;
+    uint32_t size;
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Classes
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * @tparam T - element, copied by assignment
+ * @tparam N - capacity, a power of two
+ */
+template <typename T, uint32_t N>
+class SpscRing
+{
+    static_assert(N >= 2u && (N & (N - 1u)) == 0u, "N must be a power of two");
+
+public:
+    SpscRing() : head(0u), tail(0u) {}
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    static constexpr uint32_t capacity() { return N; }
+
+    /** Elements in the ring; exact for either side, a snapshot for others. */
+    uint32_t size() const
+    {
+        return head.load(std::memory_order_acquire) -
+               tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0u; }
+
+    /*--------------------------------------------------------------------------
+     *      Producer side
+     *------------------------------------------------------------------------*/
+    /** @returns bool - false if the ring is full */
+    bool push(const T &value)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+
+        if (h - tail.load(std::memory_order_acquire) == N)
+        {
+            return false;
+        }
+        slots[h & (N - 1u)] = value;
+        head.store(h + 1u, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Free slots to write in place, at most @p max, contiguous.
+     *
+     * @returns RingSpan<T> - size 0 if the ring is full
+     */
+    RingSpan<T> push_n(uint32_t max)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t free = N - (h - tail.load(std::memory_order_acquire));
+        uint32_t index = h & (N - 1u);
+        uint32_t n = N - index;
+
+        if (n > free)
+        {
+            n = free;
+        }
+        if (n > max)
+        {
+            n = max;
+        }
+        return RingSpan<T>{ &slots[index], n };
+    }
+
+    /** Publishes the first @p count slots of the last push_n() span. */
+    void commit_push(uint32_t count)
+    {
+        head.store(head.load(std::memory_order_relaxed) + count,
+                   std::memory_order_release);
+    }
+
+    /** Copies up to @p count elements in. @returns uint32_t - copied */
+    uint32_t push(const T *values, uint32_t count)
+    {
+        uint32_t done = 0u;
+
+        while (done < count)
+        {
+            RingSpan<T> span = push_n(count - done);
+
+            if (span.size == 0u)
+            {
+                break;
+            }
+            for (uint32_t i = 0u; i < span.size; i++)
+            {
+                span.data[i] = values[done + i];
+            }
+            commit_push(span.size);
+            done += span.size;
+        }
+        return done;
+    }
+
+    /*--------------------------------------------------------------------------
+     *      Consumer side
+     *------------------------------------------------------------------------*/
+    /** @returns bool - false if the ring is empty */
+    bool pop(T &value)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+
+        if (head.load(std::memory_order_acquire) == t)
+        {
+            return false;
+        }
+        value = slots[t & (N - 1u)];
+        tail.store(t + 1u, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Elements to read in place, at most @p max, contiguous.
+     *
+     * @returns RingSpan<const T> - size 0 if the ring is empty
+     */
+    RingSpan<const T> pop_n(uint32_t max)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t used = head.load(std::memory_order_acquire) - t;
+        uint32_t index = t & (N - 1u);
+        uint32_t n = N - index;
+
+        if (n > used)
+        {
+            n = used;
+        }
+        if (n > max)
+        {
+            n = max;
+        }
+        return RingSpan<const T>{ &slots[index], n };
+    }
+
+    /** Frees the first @p count slots of the last pop_n() span. */
+    void commit_pop(uint32_t count)
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + count,
+                   std::memory_order_release);
+    }
+
+    /** Copies up to @p count elements out. @returns uint32_t - copied */
+    uint32_t pop(T *values, uint32_t count)
+    {
+        uint32_t done = 0u;
+
+        while (done < count)
+        {
+            RingSpan<const T> span = pop_n(count - done);
+
+            if (span.size == 0u)
+            {
+                break;
+            }
+            for (uint32_t i = 0u; i < span.size; i++)
+            {
+                values[done + i] = span.data[i];
+            }
+            commit_pop(span.size);
+            done += span.size;
+        }
+        return done;
+    }
+
+private:
+    std::atomic<uint32_t> head;     /**< next slot to write, producer only */
+    std::atomic<uint32_t> tail;     /**< next slot to read, consumer only  */
+    T                     slots[N];
+};
+
+#endif
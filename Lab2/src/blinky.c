@@ -28,6 +28,15 @@
 #include "inc/hw_memmap.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
+#include "common/timer_service.h"
+#include "common/profile.h"
+#include "common/boot.h"
+#include "common/power.h"
+#include "common/tlog.h"
+#include "common/wave.h"
+#if PROF_ENABLE
+#include "inc/hw_ints.h"
+#endif
 
 //*****************************************************************************
 //
@@ -43,12 +52,67 @@
 //! This example demonstrates the use of TivaWare to setup the clocks and
 //! toggle GPIO pins to make the LED blink. This is a good place to start
 //! understanding your launchpad and the tools that can be used to program it.
+//!
+//! By default (WAVE_OUTPUT=1) timer 0 and the uDMA toggle the LEDs: the
+//! timer requests a uDMA transfer every half period, which writes the next
+//! LED pattern to the port (common/wave.h).  After set-up the core only
+//! sleeps; no interrupt is taken.
+//!
+//! Built with WAVE_OUTPUT=0, the LEDs are toggled from a periodic software
+//! timer; between toggles the core sleeps in WFI.  Built with
+//! POWER_GOVERNOR=1 as well, the power governor picks the clock and sleeps
+//! in deep-sleep between toggles instead.  Each toggle is logged with
+//! TLOG1() and sent over SWO (ITM port 1) from the background loop;
+//! host/tools/tlog_decode prints the capture.
 //
 //*****************************************************************************
 
 #define USER_LED1  GPIO_PIN_0
 #define USER_LED2  GPIO_PIN_1
 
+//*****************************************************************************
+//
+// Time each LED stays on, in milliseconds.
+//
+//*****************************************************************************
+#define BLINK_HALF_PERIOD_MS    500
+
+//*****************************************************************************
+//
+// Profiling zone ids (common/profile.h, build with PROF_ENABLE=1).
+//
+//*****************************************************************************
+#define PROF_ZONE_BLINK         1
+
+//*****************************************************************************
+//
+// Deep-sleep stops the timer and the uDMA that play the pattern.
+//
+//*****************************************************************************
+#if WAVE_OUTPUT && POWER_GOVERNOR
+#error "POWER_GOVERNOR=1 needs WAVE_OUTPUT=0"
+#endif
+
+#if WAVE_OUTPUT
+//*****************************************************************************
+//
+// The LED pattern: LED1 on for a half period, then LED2.
+//
+//*****************************************************************************
+static const wave_step_t g_psBlinkSteps[] =
+{
+    { USER_LED1, 1 },
+    { USER_LED2, 1 },
+};
+#else
+//*****************************************************************************
+//
+// The software timer that toggles the LEDs.
+//
+//*****************************************************************************
+static tw_timer_t g_sBlinkTimer;
+#endif
+
 //*****************************************************************************
 //
 // The error routine that is called if the driver library encounters an error.
@@ -61,6 +125,28 @@ __error__(char *pcFilename, uint32_t ui32Line)
 }
 #endif
 
+#if !WAVE_OUTPUT
+//*****************************************************************************
+//
+// Timer callback, runs in the SysTick handler.  Lights the other LED.
+//
+//*****************************************************************************
+static void
+BlinkToggle(void *pvArg)
+{
+    static bool bLed1;
+
+    (void)pvArg;
+
+    PROF_BEGIN(PROF_ZONE_BLINK);
+    bLed1 = !bLed1;
+    GPIOPinWrite(GPIO_PORTN_BASE, (USER_LED1|USER_LED2),
+                 bLed1 ? USER_LED1 : USER_LED2);
+    TLOG1("blink: LED%u on", bLed1 ? 1u : 2u);
+    PROF_END(PROF_ZONE_BLINK);
+}
+#endif
+
 //*****************************************************************************
 //
 // Main 'C' Language entry point.  Toggle an LED using TivaWare.
@@ -71,6 +157,17 @@ main(void)
 {
     uint32_t ui32SysClock;
 
+    boot_mark(BOOT_MAIN);
+
+#if BOOT_FAST
+    //
+    // Enable the port first: its clock gate opens while the PLL locks.
+    // Then run from the PLL at 120 MHz with precomputed register values.
+    //
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPION);
+    ui32SysClock = boot_clock_120mhz();
+    boot_mark_clock(BOOT_CLOCK, ui32SysClock);
+#else
     //
     // Run from the PLL at 120 MHz.
     // Note: SYSCTL_CFG_VCO_240 is a new setting provided in TivaWare 2.2.x and
@@ -80,11 +177,17 @@ main(void)
                                        SYSCTL_OSC_MAIN |
                                        SYSCTL_USE_PLL |
                                        SYSCTL_CFG_VCO_240), 120000000);
+    boot_mark_clock(BOOT_CLOCK, ui32SysClock);
 
     //
-    // Enable and wait for the port to be ready for access
+    // Enable the port
     //
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPION);
+#endif
+
+    //
+    // Wait for the port to be ready for access
+    //
     while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPION))
     {
     }
@@ -93,6 +196,44 @@ main(void)
     // Configure the GPIO port for the LED operation.
     //
     GPIOPinTypeGPIOOutput(GPIO_PORTN_BASE, (USER_LED1|USER_LED2));
+    boot_mark(BOOT_PERIPH);
+
+#if PROF_ENABLE
+    //
+    // Start the trace and time the SysTick handler as well.
+    //
+    prof_init(ui32SysClock);
+    prof_wrap_isr(FAULT_SYSTICK);
+#endif
+
+#if WAVE_OUTPUT
+    //
+    // Light the first LED now and let timer 0 and the uDMA play the pattern
+    // from here on, a step every half period.
+    //
+    wave_pattern_start(TIMER0_BASE, ui32SysClock, GPIO_PORTN_BASE,
+                       (USER_LED1|USER_LED2), g_psBlinkSteps,
+                       sizeof(g_psBlinkSteps) / sizeof(g_psBlinkSteps[0]),
+                       BLINK_HALF_PERIOD_MS * 1000);
+#else
+    //
+    // Light the first LED now and toggle every half period from the timer
+    // service, which only wakes the core up on the timer deadlines.
+    //
+    timer_service_init(ui32SysClock, true);
+    tw_timer_init(&g_sBlinkTimer, BlinkToggle, 0);
+    BlinkToggle(0);
+    timer_start(&g_sBlinkTimer, TIMER_MS(BLINK_HALF_PERIOD_MS),
+                TIMER_MS(BLINK_HALF_PERIOD_MS));
+#endif
+    boot_mark(BOOT_READY);
+
+#if POWER_GOVERNOR
+    //
+    // Let the governor lower the clock while the load is light.
+    //
+    power_init(ui32SysClock, 0);
+#endif
 
     //
     // Loop Forever
@@ -100,23 +241,19 @@ main(void)
     while(1)
     {
         //
-        // Turn on the LED
-        //
-        GPIOPinWrite(GPIO_PORTN_BASE, (USER_LED1|USER_LED2), USER_LED1);
-
-        //
-        // Delay for a bit
+        // Send what the handlers logged (common/tlog.h) over SWO.
         //
-        SysCtlDelay(ui32SysClock/6);
+        (void)tlog_drain(tlog_itm_sink);
 
         //
-        // Turn on the LED
+        // Sleep until the next interrupt
         //
-        GPIOPinWrite(GPIO_PORTN_BASE, (USER_LED1|USER_LED2), USER_LED2);
-
-        //
-        // Delay for a bit
-        //
-        SysCtlDelay(ui32SysClock/6);
+#if POWER_GOVERNOR
+        power_idle();
+#elif WAVE_OUTPUT
+        SysCtlSleep();
+#else
+        timer_idle();
+#endif
     }
 }
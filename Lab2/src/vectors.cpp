@@ -0,0 +1,108 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Lab2 - vector table
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     vectors.cpp
+ * @author   insert authors names here
+ * @brief    The vector table of Lab2, built at compile time from kBindings
+ *           (common/vector_table.h) and placed in .intvec. To give an
+ *           interrupt its own handler, add a bind<Irq::x, priority>() line;
+ *           everything else goes to vector_trap() (startup_ewarm.c). The
+ *           priorities of the list are written once, by
+ *           vector_priorities_init(), from __low_level_init().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "common/vector_table.h"
+#include "common/timer_service.h"
+#include "common/kernel.h"
+
+#pragma segment="CSTACK"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** SysTick drives the timer service; above PendSV (kernel, lowest). */
+#define PRIO_SYSTICK    6u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+/* startup_ewarm.c (weak), kernel_port_cm4.s, IAR C run-time */
+extern "C" void NMI_Handler(void);
+extern "C" void HardFault_Handler(void);
+extern "C" void MemManage_Handler(void);
+extern "C" void BusFault_Handler(void);
+extern "C" void UsageFault_Handler(void);
+extern "C" void SVC_Handler(void);
+extern "C" void DebugMon_Handler(void);
+extern "C" void PendSV_Handler(void);
+extern "C" void __iar_program_start(void);
+
+extern "C" void vector_priorities_init(void);
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static constexpr Binding kBindings[] =
+{
+    bind<Irq::NMI>(NMI_Handler),
+    bind<Irq::HardFault>(HardFault_Handler),
+    bind<Irq::MemManage>(MemManage_Handler),
+    bind<Irq::BusFault>(BusFault_Handler),
+    bind<Irq::UsageFault>(UsageFault_Handler),
+    bind<Irq::SVCall>(SVC_Handler),
+    bind<Irq::DebugMon>(DebugMon_Handler),
+    bind<Irq::PendSV>(PendSV_Handler),
+    bind<Irq::SysTick, PRIO_SYSTICK>(SysTick_Handler),
+};
+
+static constexpr VectorPriorities kPriorities = vector_priorities(kBindings);
+
+/* K_FPU_CHECK turns the FPU off under K_FPU_NONE tasks, for handlers too */
+static_assert(K_FPU_CHECK == 0 || vector_fpu_users(kBindings) == 0u,
+              "K_FPU_CHECK needs handlers without Fpu::Uses");
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+/** Must end up at 0x0000.0000: the linker places .intvec there. */
+#pragma location = ".intvec"
+extern "C" __root const VectorImage __vector_table =
+{
+    __sfe("CSTACK"),
+    vector_handlers(__iar_program_start, kBindings)
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** Writes the priorities of kBindings. Start-up, interrupts disabled. */
+void vector_priorities_init(void)
+{
+    vector_priorities_apply(kPriorities);
+}
@@ -0,0 +1,373 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - ADC streaming
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     adc_stream.c
+ * @author   insert authors names here
+ * @brief    ADC sample sequencers into uDMA ping-pong buffers (see
+ *           adc_stream.h). \n
+ *           Half 0 of the buffer is the primary structure of the channel,
+ *           half 1 the alternate. The uDMA alternates between them on its
+ *           own; the interrupt of a completed half re-arms it at once and
+ *           then hands it to the consumer, so the uDMA never waits for the
+ *           consumer. The price is that a block still held when the uDMA
+ *           comes back to its half is overwritten: that is an overrun. If
+ *           the interrupt is held off for longer than a block, the uDMA
+ *           finds the next half still stopped and disables the channel; the
+ *           interrupt then re-enables it and counts a stall, and results
+ *           are lost in the sequencer FIFO meanwhile.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "inc/hw_adc.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/adc.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/udma.h"
+
+#include "common/adc_stream.h"
+#include "common/dma.h"
+#include "common/vtable.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define ADCS                2u
+#define SEQUENCERS          4u
+
+/** Control word of both halves; the arbitration size is added per stream. */
+#define DMA_CONTROL         (UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16)
+
+static const uint32_t s_depth[SEQUENCERS] = { 8u, 4u, 4u, 1u };
+
+static const uint32_t s_fifo[SEQUENCERS] =
+{
+    ADC_O_SSFIFO0, ADC_O_SSFIFO1, ADC_O_SSFIFO2, ADC_O_SSFIFO3
+};
+
+static const uint32_t s_mapping[ADCS][SEQUENCERS] =
+{
+    { UDMA_CH14_ADC0_0, UDMA_CH15_ADC0_1, UDMA_CH16_ADC0_2, UDMA_CH17_ADC0_3 },
+    { UDMA_CH24_ADC1_0, UDMA_CH25_ADC1_1, UDMA_CH26_ADC1_2, UDMA_CH27_ADC1_3 },
+};
+
+static const uint32_t s_channel[ADCS][SEQUENCERS] =
+{
+    { UDMA_CHANNEL_ADC0, UDMA_CHANNEL_ADC1, UDMA_CHANNEL_ADC2, UDMA_CHANNEL_ADC3 },
+    { UDMA_SEC_CHANNEL_ADC10, UDMA_SEC_CHANNEL_ADC11, UDMA_SEC_CHANNEL_ADC12,
+      UDMA_SEC_CHANNEL_ADC13 },
+};
+
+static const uint32_t s_interrupt[ADCS][SEQUENCERS] =
+{
+    { INT_ADC0SS0, INT_ADC0SS1, INT_ADC0SS2, INT_ADC0SS3 },
+    { INT_ADC1SS0, INT_ADC1SS1, INT_ADC1SS2, INT_ADC1SS3 },
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static adc_stream_t *s_streams[ADCS][SEQUENCERS];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** One handler per sequencer for register_isr(); each finds its stream. */
+#define STREAM_ISR(adc, ss)                                 \
+    static void stream_isr_##adc##_##ss(void)              \
+    {                                                       \
+        adc_stream_isr(s_streams[adc][ss]);                 \
+    }
+
+STREAM_ISR(0, 0)
+STREAM_ISR(0, 1)
+STREAM_ISR(0, 2)
+STREAM_ISR(0, 3)
+STREAM_ISR(1, 0)
+STREAM_ISR(1, 1)
+STREAM_ISR(1, 2)
+STREAM_ISR(1, 3)
+
+static const vtable_handler_t s_isr[ADCS][SEQUENCERS] =
+{
+    { stream_isr_0_0, stream_isr_0_1, stream_isr_0_2, stream_isr_0_3 },
+    { stream_isr_1_0, stream_isr_1_1, stream_isr_1_2, stream_isr_1_3 },
+};
+
+static uint32_t adc_index(uint32_t base)
+{
+    return (base == ADC1_BASE) ? 1u : 0u;
+}
+
+static uint32_t half_select(uint32_t half)
+{
+    return (half != 0u) ? UDMA_ALT_SELECT : UDMA_PRI_SELECT;
+}
+
+/** Points half @p half of the buffer at the sequencer FIFO again. */
+static void arm(const adc_stream_t *stream, uint32_t half)
+{
+    const adc_stream_config_t *c = &stream->config;
+
+    uDMAChannelTransferSet(stream->channel | half_select(half),
+                           UDMA_MODE_PINGPONG,
+                           (void *)(uintptr_t)(c->adc_base + s_fifo[c->sequencer]),
+                           &c->buffer[half * c->block], c->block);
+}
+
+/** Arbitration size: one sequence per request when it is a power of two. */
+static uint32_t arbitration(uint32_t steps)
+{
+    switch (steps)
+    {
+    case 2u: return UDMA_ARB_2;
+    case 4u: return UDMA_ARB_4;
+    case 8u: return UDMA_ARB_8;
+    default: return UDMA_ARB_1;
+    }
+}
+
+static uint32_t timer_periph(uint32_t base)
+{
+    if (base >= TIMER6_BASE)
+    {
+        return SYSCTL_PERIPH_TIMER6 + ((base - TIMER6_BASE) >> 12);
+    }
+    return SYSCTL_PERIPH_TIMER0 + ((base - TIMER0_BASE) >> 12);
+}
+
+static void periph_enable(uint32_t periph)
+{
+    SysCtlPeripheralEnable(periph);
+    while (!SysCtlPeripheralReady(periph))
+    {
+    }
+}
+
+/**
+ * Sets up a sequencer, its uDMA channel and its interrupt. The sequencer
+ * runs at once but converts only on timer triggers, see
+ * adc_stream_trigger_start().
+ *
+ * @param[out] stream - caller-owned, stays in use until adc_stream_close()
+ * @param[in]  config - copied; the channels and buffer it points to are not
+ * @returns bool      - false if the configuration is invalid or the
+ *                      sequencer is in use
+ */
+bool adc_stream_open(adc_stream_t *stream, const adc_stream_config_t *config)
+{
+    uint32_t adc = adc_index(config->adc_base);
+    uint32_t ss = config->sequencer;
+    uint32_t base = config->adc_base;
+    uint32_t div;
+    uint32_t i;
+
+    if (ss >= SEQUENCERS || s_streams[adc][ss] != NULL ||
+        config->channel_count == 0u || config->channel_count > s_depth[ss] ||
+        config->block == 0u || config->block > ADC_STREAM_BLOCK_MAX ||
+        config->block % config->channel_count != 0u ||
+        config->buffer == NULL || config->on_block == NULL)
+    {
+        return false;
+    }
+    memset(stream, 0, sizeof(*stream));
+    stream->config = *config;
+    stream->channel = s_channel[adc][ss];
+    stream->interrupt = s_interrupt[adc][ss];
+
+    /* the ADC clock is shared and set through ADC0 */
+    periph_enable(SYSCTL_PERIPH_ADC0);
+    periph_enable((adc != 0u) ? SYSCTL_PERIPH_ADC1 : SYSCTL_PERIPH_ADC0);
+    div = (config->vco_hz + ADC_STREAM_ADC_CLOCK_HZ - 1u) / ADC_STREAM_ADC_CLOCK_HZ;
+    ADCClockConfigSet(ADC0_BASE, ADC_CLOCK_SRC_PLL | ADC_CLOCK_RATE_FULL, div);
+
+    ADCSequenceDisable(base, ss);
+    ADCSequenceConfigure(base, ss, ADC_TRIGGER_TIMER, ss);
+    for (i = 0; i < config->channel_count; i++)
+    {
+        ADCSequenceStepConfigure(base, ss, i, config->channels[i] |
+            ((i + 1u == config->channel_count) ? ADC_CTL_IE | ADC_CTL_END : 0u));
+    }
+
+    dma_init();
+    uDMAChannelAssign(s_mapping[adc][ss]);
+    uDMAChannelAttributeDisable(stream->channel, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(stream->channel | UDMA_PRI_SELECT,
+                          DMA_CONTROL | arbitration(config->channel_count));
+    uDMAChannelControlSet(stream->channel | UDMA_ALT_SELECT,
+                          DMA_CONTROL | arbitration(config->channel_count));
+    arm(stream, 0u);
+    arm(stream, 1u);
+    uDMAChannelEnable(stream->channel);
+
+    s_streams[adc][ss] = stream;
+    (void)register_isr(stream->interrupt, s_isr[adc][ss]);
+    ADCIntClearEx(base, ADC_INT_DMA_SS0 << ss);
+    ADCIntEnableEx(base, ADC_INT_DMA_SS0 << ss);
+    IntEnable(stream->interrupt);
+
+    ADCSequenceOverflowClear(base, ss);
+    ADCSequenceDMAEnable(base, ss);
+    ADCSequenceEnable(base, ss);
+    return true;
+}
+
+/**
+ * Stops the sequencer and its channel. Blocks still held are no longer
+ * written; the buffer may be reused once the consumer is done with them.
+ */
+void adc_stream_close(adc_stream_t *stream)
+{
+    const adc_stream_config_t *c = &stream->config;
+
+    ADCSequenceDisable(c->adc_base, c->sequencer);
+    ADCSequenceDMADisable(c->adc_base, c->sequencer);
+    ADCIntDisableEx(c->adc_base, ADC_INT_DMA_SS0 << c->sequencer);
+    IntDisable(stream->interrupt);
+    uDMAChannelDisable(stream->channel);
+    s_streams[adc_index(c->adc_base)][c->sequencer] = NULL;
+}
+
+/**
+ * Returns a block kept by on_block(). Releasing a block that was overrun
+ * meanwhile is harmless.
+ */
+void adc_stream_release(adc_stream_t *stream, const uint16_t *block)
+{
+    uint32_t half = (block == stream->config.buffer) ? 0u : 1u;
+    bool masked = IntMasterDisable();
+
+    stream->held &= ~(1u << half);
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/**
+ * Starts @p timer_base as the trigger of every open stream, on both ADCs.
+ *
+ * @param[in] timer_base - TIMERn_BASE, used as a full-width periodic timer A
+ * @param[in] clock_hz   - system clock
+ * @param[in] rate_hz    - sequences per second; each converts channel_count
+ *                         results
+ * @returns bool         - false if an ADC would exceed ADC_STREAM_MAX_SPS
+ */
+bool adc_stream_trigger_start(uint32_t timer_base, uint32_t clock_hz,
+                              uint32_t rate_hz)
+{
+    uint32_t adc;
+    uint32_t ss;
+
+    if (rate_hz == 0u || rate_hz > clock_hz)
+    {
+        return false;
+    }
+    for (adc = 0; adc < ADCS; adc++)
+    {
+        uint64_t sps = 0u;
+
+        for (ss = 0; ss < SEQUENCERS; ss++)
+        {
+            if (s_streams[adc][ss] != NULL)
+            {
+                sps += (uint64_t)rate_hz * s_streams[adc][ss]->config.channel_count;
+            }
+        }
+        if (sps > ADC_STREAM_MAX_SPS)
+        {
+            return false;
+        }
+    }
+
+    periph_enable(timer_periph(timer_base));
+    TimerConfigure(timer_base, TIMER_CFG_PERIODIC);
+    TimerLoadSet(timer_base, TIMER_A, clock_hz / rate_hz - 1u);
+    TimerControlTrigger(timer_base, TIMER_A, true);
+    TimerADCEventSet(timer_base, TIMER_ADC_TIMEOUT_A);
+    TimerEnable(timer_base, TIMER_A);
+    return true;
+}
+
+void adc_stream_trigger_stop(uint32_t timer_base)
+{
+    TimerDisable(timer_base, TIMER_A);
+    TimerControlTrigger(timer_base, TIMER_A, false);
+}
+
+/**
+ * ADC sequencer interrupt: one or, after a long latency, both halves are
+ * complete. Installed by adc_stream_open(); an application with its own
+ * vector table entry calls it from there.
+ */
+void adc_stream_isr(adc_stream_t *stream)
+{
+    const adc_stream_config_t *c = &stream->config;
+    uint32_t handled = 0u;
+
+    ADCIntClearEx(c->adc_base, ADC_INT_DMA_SS0 << c->sequencer);
+    if (ADCSequenceOverflow(c->adc_base, c->sequencer) != 0)
+    {
+        stream->stats.fifo_overflows++;
+        ADCSequenceOverflowClear(c->adc_base, c->sequencer);
+    }
+
+    while (handled < 2u &&
+           uDMAChannelModeGet(stream->channel | half_select(stream->next)) ==
+               UDMA_MODE_STOP)
+    {
+        uint32_t half = stream->next;
+        const uint16_t *block = &c->buffer[half * c->block];
+
+        /* the uDMA moved on to the other half: a block held there is lost */
+        if ((stream->held & (2u >> half)) != 0u)
+        {
+            stream->stats.overruns++;
+            stream->held &= ~(2u >> half);
+        }
+        arm(stream, half);
+        stream->next = half ^ 1u;
+        handled++;
+
+        stream->stats.blocks++;
+        stream->stats.samples += c->block;
+        if (!c->on_block(stream, block, c->block))
+        {
+            stream->held |= 1u << half;
+        }
+    }
+
+    /* the uDMA found the next half stopped before it was re-armed */
+    if (!uDMAChannelIsEnabled(stream->channel))
+    {
+        stream->stats.stalls++;
+        uDMAChannelEnable(stream->channel);
+    }
+}
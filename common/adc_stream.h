@@ -0,0 +1,132 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - ADC streaming
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     adc_stream.h
+ * @author   insert authors names here
+ * @brief    Continuous ADC sampling into uDMA ping-pong buffers. \n
+ *           A sample sequencer, started by a general-purpose timer, converts
+ *           its channels at a fixed rate; the uDMA moves every result into
+ *           one half of a caller-owned buffer while the other half is with
+ *           the consumer. When a half is full its block is passed to
+ *           on_block() from the interrupt, in place: no copy is made. The
+ *           consumer either finishes with it there (returns true) or keeps
+ *           it and calls adc_stream_release() later; it has one block time
+ *           before the uDMA comes back to that half.\n
+ *           Usage:
+ *           @code
+ *           static uint16_t buf[2 * 256];
+ *           static adc_stream_t s;
+ *           static const uint32_t ch[] = { ADC_CTL_CH0, ADC_CTL_CH1 };
+ *           adc_stream_config_t c = { ADC0_BASE, 0, ch, 2, 480000000,
+ *                                     buf, 256, on_block, NULL };
+ *
+ *           adc_stream_open(&s, &c);
+ *           adc_stream_trigger_start(TIMER0_BASE, clock_hz, 500000);
+ *           @endcode
+ *           The analog pins (GPIOPinTypeADC()) are left to the application.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _ADC_STREAM_H_
+#define _ADC_STREAM_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Largest block: one uDMA transfer. */
+#define ADC_STREAM_BLOCK_MAX    1024u
+
+/** Conversions per second of one ADC, at the 32 MHz ADC clock. */
+#define ADC_STREAM_MAX_SPS      2000000u
+
+/** ADC clock the divider of ADCClockConfigSet() is chosen for. */
+#define ADC_STREAM_ADC_CLOCK_HZ 32000000u
+
+typedef struct adc_stream adc_stream_t;
+
+/**
+ * A block is ready. Runs in the ADC interrupt.
+ *
+ * @returns bool - true if the consumer is done with @p block, false if it
+ *                 keeps it until adc_stream_release()
+ */
+typedef bool (*adc_stream_fn_t)(adc_stream_t *stream, const uint16_t *block,
+                                uint32_t count);
+
+typedef struct
+{
+    uint32_t        adc_base;       /**< ADC0_BASE or ADC1_BASE                */
+    uint32_t        sequencer;      /**< 0..3                                  */
+    const uint32_t *channels;       /**< ADC_CTL_CHn, one per step             */
+    uint32_t        channel_count;  /**< at most the FIFO depth: 8, 4, 4, 1    */
+    uint32_t        vco_hz;         /**< PLL VCO, the ADC clock source         */
+    uint16_t       *buffer;         /**< 2 * block results                     */
+    uint32_t        block;          /**< results per block, a multiple of
+                                         channel_count, at most 1024           */
+    adc_stream_fn_t on_block;
+    void           *ctx;            /**< for the consumer                      */
+} adc_stream_config_t;
+
+/** Counters, for the debugger and the benchmarks. */
+typedef struct
+{
+    uint32_t blocks;            /**< blocks passed to on_block()             */
+    uint32_t samples;           /**< results in those blocks                 */
+    uint32_t overruns;          /**< a held block was overwritten            */
+    uint32_t stalls;            /**< both halves filled before the interrupt
+                                     ran; the uDMA stopped                    */
+    uint32_t fifo_overflows;    /**< results lost in the sequencer FIFO      */
+} adc_stream_stats_t;
+
+/** Caller-owned stream; the fields are private to adc_stream.c. */
+struct adc_stream
+{
+    adc_stream_config_t config;
+    adc_stream_stats_t  stats;
+    uint32_t            channel;    /**< uDMA channel number               */
+    uint32_t            interrupt;  /**< INT_ADCnSSm                        */
+    volatile uint32_t   next;       /**< half the uDMA completes next      */
+    volatile uint32_t   held;       /**< bit n: half n is with the consumer */
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool adc_stream_open(adc_stream_t *stream, const adc_stream_config_t *config);
+void adc_stream_close(adc_stream_t *stream);
+void adc_stream_release(adc_stream_t *stream, const uint16_t *block);
+
+bool adc_stream_trigger_start(uint32_t timer_base, uint32_t clock_hz,
+                              uint32_t rate_hz);
+void adc_stream_trigger_stop(uint32_t timer_base);
+
+void adc_stream_isr(adc_stream_t *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
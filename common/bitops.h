@@ -0,0 +1,71 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - bit operations
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bitops.h
+ * @author   insert authors names here
+ * @brief    Bit scans that compile to CLZ/RBIT on the Cortex-M4 (IAR) and to
+ *           the GCC builtins on the host. Arguments must be non-zero.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _BITOPS_H_
+#define _BITOPS_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+/** Number of leading zero bits of a non-zero word. */
+static inline uint32_t clz32(uint32_t v)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return __CLZ(v);
+#else
+    return (uint32_t)__builtin_clz(v);
+#endif
+}
+
+/** Number of trailing zero bits of a non-zero word. */
+static inline uint32_t ctz32(uint32_t v)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return __CLZ(__RBIT(v));
+#else
+    return (uint32_t)__builtin_ctz(v);
+#endif
+}
+
+/** Number of trailing zero bits of a non-zero double word. */
+static inline uint32_t ctz64(uint64_t v)
+{
+    uint32_t lo = (uint32_t)v;
+
+    return (lo != 0u) ? ctz32(lo) : 32u + ctz32((uint32_t)(v >> 32));
+}
+
+/** Rotates a double word right by n (0..63) bits. */
+static inline uint64_t ror64(uint64_t v, uint32_t n)
+{
+    return (n == 0u) ? v : ((v >> n) | (v << (64u - n)));
+}
+
+#endif
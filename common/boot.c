@@ -0,0 +1,227 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - boot
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     boot.c
+ * @author   insert authors names here
+ * @brief    Boot timeline and precomputed clock set-up (see boot.h). \n
+ *           Time since reset is accumulated mark by mark at the clock that
+ *           was running since the previous mark; the cycles between the
+ *           clock switch and boot_mark_clock() are counted at the old
+ *           clock, an error of a few cycles. On the host the cycle counter
+ *           is that of the simulator.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "boot.h"
+#include "cycles.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define LINE_SIZE               48u
+
+/** Target clock of boot_clock_120mhz(). */
+#define BOOT_SYSCLK_HZ          120000000u
+
+/** System control registers used by boot_clock_120mhz(). */
+#define SYSCTL_RIS_R            (*(volatile uint32_t *)0x400FE050u)
+#define SYSCTL_MOSCCTL_R        (*(volatile uint32_t *)0x400FE07Cu)
+#define SYSCTL_RSCLKCFG_R       (*(volatile uint32_t *)0x400FE0B0u)
+#define SYSCTL_MEMTIM0_R        (*(volatile uint32_t *)0x400FE0C0u)
+#define SYSCTL_PLLFREQ0_R       (*(volatile uint32_t *)0x400FE160u)
+#define SYSCTL_PLLFREQ1_R       (*(volatile uint32_t *)0x400FE164u)
+#define SYSCTL_PLLSTAT_R        (*(volatile uint32_t *)0x400FE168u)
+
+#define RIS_MOSCPUPRIS          0x00000100u
+#define MOSCCTL_OSCRNG          0x00000010u     /**< crystal above 10 MHz */
+#define MOSCCTL_PWRDN           0x00000008u
+#define MOSCCTL_NOXTAL          0x00000004u
+#define RSCLKCFG_MEMTIMU        0x80000000u
+#define RSCLKCFG_NEWFREQ        0x40000000u
+#define RSCLKCFG_USEPLL         0x10000000u
+#define RSCLKCFG_PLLSRC_MOSC    0x03000000u
+#define RSCLKCFG_OSCSRC_MOSC    0x00300000u
+#define PLLFREQ0_PLLPWR         0x00800000u
+#define PLLSTAT_LOCK            0x00000001u
+
+/**
+ * What SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+ * SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240, 120000000) computes with TivaWare
+ * 2.2.0.295: 25 MHz / (N + 1) * MINT, VCO named 240 MHz, PSYSDIV =
+ * 240 / 120 - 1; 5 wait states and 3.5 cycles bank hold time for flash
+ * and EEPROM above 100 MHz.
+ */
+#define PLL_N                   4u
+#define PLL_MINT                96u
+#define PLL_PSYSDIV             1u
+#define MEMTIM0_120MHZ          0x01850185u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+#pragma location=".noinit"
+__no_init boot_timeline_t g_boot;
+#else
+boot_timeline_t g_boot;
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const char *const s_phaseNames[BOOT_PHASES] =
+{
+    "reset", "main", "clock", "periph", "ready"
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Starts the cycle counter and the timeline. Runs before the data sections
+ * are initialised, so it only touches g_boot (.noinit) and the DWT.
+ */
+void boot_start(void)
+{
+    uint32_t i;
+
+    cycles_init();
+    for (i = 0; i < BOOT_PHASES; i++)
+    {
+        g_boot.cycles[i] = 0u;
+        g_boot.ns[i] = 0u;
+    }
+    g_boot.marked = 0u;
+    g_boot.clock_hz = BOOT_RESET_CLOCK_HZ;
+    g_boot.start_cycles = cycles_now();
+    g_boot.last_cycles = g_boot.start_cycles;
+    g_boot.last_ns = 0u;
+    boot_mark(BOOT_RESET);
+}
+
+/**
+ * Records the end of a phase. No effect unless boot_start() ran.
+ *
+ * @param[in] phase - BOOT_x
+ */
+void boot_mark(boot_phase_t phase)
+{
+    uint32_t now = cycles_now();
+
+    if (g_boot.clock_hz == 0u)
+    {
+        return;     /* boot_start() did not run, e.g. on the host */
+    }
+
+    g_boot.last_ns += (uint64_t)(now - g_boot.last_cycles) * 1000000000u /
+                      g_boot.clock_hz;
+    g_boot.last_cycles = now;
+    g_boot.cycles[phase] = now - g_boot.start_cycles;
+    g_boot.ns[phase] = g_boot.last_ns;
+    g_boot.marked |= 1u << phase;
+}
+
+/**
+ * Records the end of a phase that changed the core clock.
+ *
+ * @param[in] phase    - BOOT_x
+ * @param[in] clock_hz - core clock from now on
+ */
+void boot_mark_clock(boot_phase_t phase, uint32_t clock_hz)
+{
+    boot_mark(phase);
+    g_boot.clock_hz = clock_hz;
+}
+
+const char *boot_phase_name(boot_phase_t phase)
+{
+    return (phase < BOOT_PHASES) ? s_phaseNames[phase] : "?";
+}
+
+/**
+ * Writes the recorded phases in the format of boot.h.
+ *
+ * @param[in] sink   - receives the report text
+ * @param[in] config - configuration name, e.g. BOOT_CONFIG_NAME
+ */
+void boot_report(boot_sink_t sink, const char *config)
+{
+    char line[LINE_SIZE];
+    uint32_t phases = 0;
+    uint32_t i;
+
+    snprintf(line, sizeof(line), "boot,%u,%s\n", BOOT_FORMAT, config);
+    sink(line, (uint32_t)strlen(line));
+    for (i = 0; i < BOOT_PHASES; i++)
+    {
+        if ((g_boot.marked & (1u << i)) == 0u)
+        {
+            continue;
+        }
+        snprintf(line, sizeof(line), "%s,%u,%u.%03u\n", s_phaseNames[i],
+                 (unsigned)g_boot.cycles[i],
+                 (unsigned)(g_boot.ns[i] / 1000u),
+                 (unsigned)(g_boot.ns[i] % 1000u));
+        sink(line, (uint32_t)strlen(line));
+        phases++;
+    }
+    snprintf(line, sizeof(line), "end,%u\n", (unsigned)phases);
+    sink(line, (uint32_t)strlen(line));
+}
+
+/**
+ * Runs the core at 120 MHz from the PLL fed by the 25 MHz crystal, with
+ * the register values of SysCtlClockFreqSet() written directly. Waits for
+ * the crystal and the PLL lock like SysCtlClockFreqSet() does.
+ *
+ * @returns uint32_t - the new core clock, 120000000
+ */
+uint32_t boot_clock_120mhz(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    SYSCTL_MOSCCTL_R = (SYSCTL_MOSCCTL_R & ~(MOSCCTL_PWRDN | MOSCCTL_NOXTAL)) |
+                       MOSCCTL_OSCRNG;
+    while ((SYSCTL_RIS_R & RIS_MOSCPUPRIS) == 0u)
+    {
+    }
+    SYSCTL_RSCLKCFG_R = RSCLKCFG_PLLSRC_MOSC | RSCLKCFG_OSCSRC_MOSC;
+    SYSCTL_MEMTIM0_R = MEMTIM0_120MHZ;
+    SYSCTL_PLLFREQ1_R = PLL_N;
+    SYSCTL_PLLFREQ0_R = PLL_MINT | PLLFREQ0_PLLPWR;
+    SYSCTL_RSCLKCFG_R = RSCLKCFG_PLLSRC_MOSC | RSCLKCFG_OSCSRC_MOSC |
+                        RSCLKCFG_NEWFREQ;
+    while ((SYSCTL_PLLSTAT_R & PLLSTAT_LOCK) == 0u)
+    {
+    }
+    SYSCTL_RSCLKCFG_R = RSCLKCFG_MEMTIMU | RSCLKCFG_USEPLL |
+                        RSCLKCFG_PLLSRC_MOSC | RSCLKCFG_OSCSRC_MOSC |
+                        PLL_PSYSDIV;
+#else
+    sim_clock_direct(BOOT_SYSCLK_HZ);
+#endif
+    return BOOT_SYSCLK_HZ;
+}
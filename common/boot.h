@@ -0,0 +1,135 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - boot
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     boot.h
+ * @author   insert authors names here
+ * @brief    Boot timeline and fast-boot helpers. \n
+ *           boot_start(), called first thing by __low_level_init() in
+ *           startup_ewarm.c, starts the DWT cycle counter; boot_mark() then
+ *           records the cycle count and the time since reset at the end of
+ *           each phase:
+ *               reset  - __low_level_init() (the counter starts here)
+ *               main   - data sections copied/zeroed, static constructors
+ *               clock  - system clock running from the PLL
+ *               periph - peripherals enabled and ready
+ *               ready  - first useful work done (e.g. first LED lit)
+ *           The timeline is in .noinit (it is started before the data
+ *           sections are initialised) and is written by boot_report() as
+ *           CSV:
+ *               boot,<format>,<configuration>
+ *               <phase>,<cycles>,<us since reset>
+ *               end,<number of phases>
+ *
+ *           Fast boot (build with BOOT_FAST=1):
+ *           - boot_clock_120mhz() writes the PLL and flash/EEPROM timing
+ *             values SysCtlClockFreqSet() would compute for a 25 MHz
+ *             crystal and 120 MHz, without its table search;
+ *           - the stack is not painted at reset (see stack_watch.h);
+ *           - buffers declared BOOT_NOINIT are left out of the zeroing of
+ *             .bss;
+ *           - peripherals are enabled before the clock switch, so they are
+ *             ready once the PLL has locked.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _BOOT_H_
+#define _BOOT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#ifndef BOOT_FAST
+#define BOOT_FAST           0
+#endif
+
+#define BOOT_FORMAT         1u
+
+/** Name of the boot configuration, for boot_report(). */
+#if BOOT_FAST
+#define BOOT_CONFIG_NAME    "fast"
+#else
+#define BOOT_CONFIG_NAME    "standard"
+#endif
+
+/**
+ * Buffers whose initial content does not matter: not zeroed at start-up in
+ * fast-boot builds (IAR places __no_init data in .noinit, see Tiva.icf).
+ */
+#if BOOT_FAST && defined(__IAR_SYSTEMS_ICC__)
+#define BOOT_NOINIT         __no_init
+#else
+#define BOOT_NOINIT
+#endif
+
+/** Core clock out of reset (PIOSC). */
+#define BOOT_RESET_CLOCK_HZ 16000000u
+
+typedef enum
+{
+    BOOT_RESET,
+    BOOT_MAIN,
+    BOOT_CLOCK,
+    BOOT_PERIPH,
+    BOOT_READY,
+    BOOT_PHASES
+} boot_phase_t;
+
+typedef struct
+{
+    uint32_t cycles[BOOT_PHASES];   /**< DWT count at the end of the phase */
+    uint64_t ns[BOOT_PHASES];       /**< time since reset at that point    */
+    uint32_t marked;                /**< bit n: phase n recorded           */
+    uint32_t clock_hz;              /**< core clock since the last mark    */
+    uint32_t start_cycles;
+    uint32_t last_cycles;
+    uint64_t last_ns;
+} boot_timeline_t;
+
+/** Receives report text; e.g. prof_itm_sink, or a UART writer. */
+typedef void (*boot_sink_t)(const void *data, uint32_t length);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern boot_timeline_t g_boot;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void        boot_start(void);
+void        boot_mark(boot_phase_t phase);
+void        boot_mark_clock(boot_phase_t phase, uint32_t clock_hz);
+const char *boot_phase_name(boot_phase_t phase);
+void        boot_report(boot_sink_t sink, const char *config);
+
+uint32_t    boot_clock_120mhz(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
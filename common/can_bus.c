@@ -0,0 +1,723 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - CAN
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     can_bus.c
+ * @author   insert authors names here
+ * @brief    Message object map, interrupt and queues (see can_bus.h). \n
+ *           RX ring: the interrupt is the only producer (head), can_recv()
+ *           the only consumer (tail); each index is published after the
+ *           slots it covers, so neither side masks interrupts.\n
+ *           TX queue: a binary heap ordered by arbitration key, then by a
+ *           send sequence number. can_send() and the interrupt both take
+ *           from it, with interrupts masked. The controller sends the
+ *           lowest-numbered pending object first, so a frame goes into the
+ *           lowest free object above every object holding a frame of the
+ *           same or a higher priority: no frame is overtaken by one of
+ *           lower priority loaded after it, nor by a later one of its
+ *           identifier. Refilling the lowest object alone would starve a
+ *           frame waiting in a higher one.
+
+ *           RX groups: the controller gives a frame to the first object
+ *           that matches, so a merged group may take a frame of a filter
+ *           of a group in higher objects; the software check looks at
+ *           those filters too.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#include "inc/hw_can.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/can.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+#include "common/can_bus.h"
+#include "common/bitops.h"
+#include "common/cycles.h"
+#include "common/vtable.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define STD_MASK            0x000007FFu
+#define EXT_MASK            0x1FFFFFFFu
+
+#define RX_OBJECTS          (CAN_BUS_OBJECTS - CAN_BUS_TX_OBJECTS)
+#define TX_OBJ_MASK         ((1u << CAN_BUS_TX_OBJECTS) - 1u)
+#define RX_OBJ_MASK         (~TX_OBJ_MASK)
+
+#if (CAN_BUS_RX_RING & (CAN_BUS_RX_RING - 1u)) != 0u
+#error "CAN_BUS_RX_RING must be a power of two"
+#endif
+#if CAN_BUS_TX_OBJECTS < 1u || CAN_BUS_TX_OBJECTS >= CAN_BUS_OBJECTS
+#error "CAN_BUS_TX_OBJECTS out of range"
+#endif
+#if CAN_BUS_MAX_FILTERS > 64u
+#error "filter groups keep their members in 64 bits"
+#endif
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;
+    bool     ext;
+    bool     any;               /**< no filter given: every frame          */
+    uint64_t members;           /**< bit n: filter n                       */
+    uint64_t later;             /**< members of the groups in higher objects */
+} can_group_t;
+
+typedef struct
+{
+    can_frame_t frame;
+    uint32_t    key;
+    uint32_t    seq;
+} can_tx_entry_t;
+
+typedef struct
+{
+    uint32_t     base;
+    bool         open;
+    /* RX */
+    can_filter_t filters[CAN_BUS_MAX_FILTERS];
+    can_group_t  groups[CAN_BUS_MAX_FILTERS];   /**< one per filter first */
+    uint32_t     groupCount;
+    uint8_t      objGroup[CAN_BUS_OBJECTS + 1u];   /**< by object number  */
+    can_frame_t  ring[CAN_BUS_RX_RING];
+    uint32_t     head;          /**< written by the interrupt only         */
+    uint32_t     tail;          /**< written by can_recv() only            */
+    /* TX */
+    can_tx_entry_t heap[CAN_BUS_TX_QUEUE];
+    uint32_t     queued;
+    uint32_t     seq;
+    uint32_t     txBusy;        /**< bit n: object n + 1 holds a frame     */
+    uint32_t     txKey[CAN_BUS_TX_OBJECTS];
+} can_bus_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+can_stats_t g_can[CAN_BUS_CONTROLLERS];
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static can_bus_t s_bus[CAN_BUS_CONTROLLERS];
+
+static const uint32_t s_base[CAN_BUS_CONTROLLERS] = { CAN0_BASE, CAN1_BASE };
+static const uint32_t s_int[CAN_BUS_CONTROLLERS] = { INT_CAN0, INT_CAN1 };
+static const uint32_t s_periph[CAN_BUS_CONTROLLERS] =
+    { SYSCTL_PERIPH_CAN0, SYSCTL_PERIPH_CAN1 };
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t load_index(const uint32_t *at)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t index = *(volatile const uint32_t *)at;
+
+    __DMB();
+    return index;
+#else
+    return __atomic_load_n(at, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void store_index(uint32_t *at, uint32_t index)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __DMB();
+    *(volatile uint32_t *)at = index;
+#else
+    __atomic_store_n(at, index, __ATOMIC_RELEASE);
+#endif
+}
+
+static uint32_t bit_count(uint32_t v)
+{
+    uint32_t n = 0u;
+
+    while (v != 0u)
+    {
+        v &= v - 1u;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * Arbitration order on the bus: base identifier, then SRR/IDE (recessive
+ * for an extended frame), then the 18 low bits of an extended identifier.
+ */
+static uint32_t arb_key(const can_frame_t *frame)
+{
+    if ((frame->flags & CAN_FRAME_EXT) != 0u)
+    {
+        return ((frame->id >> 18) << 19) | (1u << 18) | (frame->id & 0x3FFFFu);
+    }
+    return (frame->id & STD_MASK) << 19;
+}
+
+/*------------------------------------------------------------------------------
+ *      Filter map
+ *------------------------------------------------------------------------------*/
+/** Mask of a group holding @p a and @p b: the bits both check and agree on. */
+static uint32_t merged_mask(const can_group_t *a, const can_group_t *b)
+{
+    return a->mask & b->mask & ~(a->id ^ b->id);
+}
+
+/**
+ * Merges groups until there are at most @p max, always the pair of the same
+ * identifier type whose merged mask keeps the most bits.
+ * @returns bool - false if the groups left cannot be merged
+ */
+static bool groups_reduce(can_bus_t *s, uint32_t max)
+{
+    while (s->groupCount > max)
+    {
+        uint32_t bestBits = 0u;
+        uint32_t bestA = 0u;
+        uint32_t bestB = 0u;
+        bool found = false;
+        uint32_t a;
+        uint32_t b;
+
+        for (a = 0; a < s->groupCount; a++)
+        {
+            for (b = a + 1u; b < s->groupCount; b++)
+            {
+                uint32_t bits;
+
+                if (s->groups[a].ext != s->groups[b].ext)
+                {
+                    continue;
+                }
+                bits = bit_count(merged_mask(&s->groups[a], &s->groups[b]));
+                if (!found || bits > bestBits)
+                {
+                    bestBits = bits;
+                    bestA = a;
+                    bestB = b;
+                    found = true;
+                }
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+        s->groups[bestA].mask = merged_mask(&s->groups[bestA], &s->groups[bestB]);
+        s->groups[bestA].id &= s->groups[bestA].mask;
+        s->groups[bestA].members |= s->groups[bestB].members;
+        s->groupCount--;
+        s->groups[bestB] = s->groups[s->groupCount];
+    }
+    return true;
+}
+
+/** Builds the groups of @p count filters; no filter makes one open group. */
+static bool groups_build(can_bus_t *s, const can_filter_t *filters,
+                         uint32_t count)
+{
+    uint32_t max = RX_OBJECTS / CAN_BUS_RX_DEPTH;
+    uint32_t i;
+
+    if (count == 0u)
+    {
+        memset(&s->groups[0], 0, sizeof(s->groups[0]));
+        s->groups[0].any = true;
+        s->groupCount = 1u;
+        return true;
+    }
+    for (i = 0; i < count; i++)
+    {
+        can_filter_t *f = &s->filters[i];
+        can_group_t *g = &s->groups[i];
+        uint32_t width = ((filters[i].flags & CAN_FRAME_EXT) != 0u) ?
+                         EXT_MASK : STD_MASK;
+
+        f->flags = filters[i].flags & CAN_FRAME_EXT;
+        f->mask = filters[i].mask & width;
+        f->id = filters[i].id & f->mask;
+        g->id = f->id;
+        g->mask = f->mask;
+        g->ext = (f->flags != 0u);
+        g->any = false;
+        g->members = 1ull << i;
+    }
+    s->groupCount = count;
+    return groups_reduce(s, (max == 0u) ? 1u : max);
+}
+
+/**
+ * Gives each group a block of consecutive receive objects, the remainder
+ * to the first groups, and loads them: all but the last of a block are
+ * FIFO objects.
+ */
+static void groups_load(can_bus_t *s)
+{
+    uint32_t per = RX_OBJECTS / s->groupCount;
+    uint32_t extra = RX_OBJECTS % s->groupCount;
+    uint32_t obj = CAN_BUS_TX_OBJECTS + 1u;
+    uint64_t later = 0u;
+    uint32_t g;
+
+    for (g = s->groupCount; g-- > 0u;)
+    {
+        s->groups[g].later = later;
+        later |= s->groups[g].members;
+    }
+
+    for (g = 0; g < s->groupCount; g++)
+    {
+        const can_group_t *group = &s->groups[g];
+        uint32_t n = per + ((g < extra) ? 1u : 0u);
+        tCANMsgObject msg;
+        uint32_t k;
+
+        msg.ui32MsgID = group->id;
+        msg.ui32MsgIDMask = group->mask;
+        msg.ui32MsgLen = 0u;
+        msg.pui8MsgData = NULL;
+        for (k = 0; k < n; k++, obj++)
+        {
+            msg.ui32Flags = MSG_OBJ_RX_INT_ENABLE |
+                            (group->any ? MSG_OBJ_USE_ID_FILTER :
+                                          MSG_OBJ_USE_EXT_FILTER) |
+                            (group->ext ? MSG_OBJ_EXTENDED_ID : 0u) |
+                            ((k + 1u < n) ? MSG_OBJ_FIFO : 0u);
+            s->objGroup[obj] = (uint8_t)g;
+            CANMessageSet(s->base, obj, &msg, MSG_OBJ_TYPE_RX);
+        }
+    }
+}
+
+/**
+ * @returns uint32_t - index of the first filter of group @p g, or of a
+ *                     group in higher objects, that takes the frame, CAN_FILTER_NONE for the open group,
+ *                     CAN_BUS_MAX_FILTERS for none
+ */
+static uint32_t group_filter(const can_bus_t *s, uint32_t g, uint32_t id,
+                             uint8_t flags)
+{
+    const can_group_t *group = &s->groups[g];
+    uint64_t members = group->members;
+
+    if (group->any)
+    {
+        return CAN_FILTER_NONE;
+    }
+    if ((members & (members - 1u)) == 0u)
+    {
+        /* a group of one filter is exact in the controller */
+        return ctz64(members);
+    }
+    members |= group->later;
+    while (members != 0u)
+    {
+        uint32_t i = ctz64(members);
+        const can_filter_t *f = &s->filters[i];
+
+        if (f->flags == (flags & CAN_FRAME_EXT) && ((id ^ f->id) & f->mask) == 0u)
+        {
+            return i;
+        }
+        members &= members - 1u;
+    }
+    return CAN_BUS_MAX_FILTERS;
+}
+
+/*------------------------------------------------------------------------------
+ *      TX queue, interrupts masked
+ *------------------------------------------------------------------------------*/
+static bool entry_before(const can_tx_entry_t *a, const can_tx_entry_t *b)
+{
+    return (a->key != b->key) ? (a->key < b->key) :
+                                ((int32_t)(a->seq - b->seq) < 0);
+}
+
+static void heap_push(can_bus_t *s, const can_tx_entry_t *e)
+{
+    uint32_t i = s->queued++;
+
+    while (i > 0u)
+    {
+        uint32_t parent = (i - 1u) / 2u;
+
+        if (!entry_before(e, &s->heap[parent]))
+        {
+            break;
+        }
+        s->heap[i] = s->heap[parent];
+        i = parent;
+    }
+    s->heap[i] = *e;
+}
+
+static void heap_pop(can_bus_t *s)
+{
+    can_tx_entry_t last = s->heap[--s->queued];
+    uint32_t i = 0u;
+
+    for (;;)
+    {
+        uint32_t child = 2u * i + 1u;
+
+        if (child >= s->queued)
+        {
+            break;
+        }
+        if (child + 1u < s->queued &&
+            entry_before(&s->heap[child + 1u], &s->heap[child]))
+        {
+            child++;
+        }
+        if (!entry_before(&s->heap[child], &last))
+        {
+            break;
+        }
+        s->heap[i] = s->heap[child];
+        i = child;
+    }
+    s->heap[i] = last;
+}
+
+/** Moves frames from the queue into free TX objects, best first. */
+static void tx_refill(can_bus_t *s)
+{
+    while (s->queued != 0u && s->txBusy != TX_OBJ_MASK)
+    {
+        const can_tx_entry_t *e = &s->heap[0];
+        uint32_t free = ~s->txBusy & TX_OBJ_MASK;
+        uint32_t busy = s->txBusy;
+        uint32_t i;
+        tCANMsgObject msg;
+
+        /* only above the objects holding a frame that must go first */
+        while (busy != 0u)
+        {
+            i = ctz32(busy);
+            if (s->txKey[i] <= e->key)
+            {
+                free &= ~((2u << i) - 1u);
+            }
+            busy &= busy - 1u;
+        }
+        if (free == 0u)
+        {
+            break;
+        }
+        i = ctz32(free);
+        msg.ui32MsgID = e->frame.id;
+        msg.ui32MsgIDMask = 0u;
+        msg.ui32Flags = MSG_OBJ_TX_INT_ENABLE |
+                        (((e->frame.flags & CAN_FRAME_EXT) != 0u) ?
+                         MSG_OBJ_EXTENDED_ID : 0u);
+        msg.ui32MsgLen = e->frame.len;
+        msg.pui8MsgData = (uint8_t *)e->frame.data;
+        s->txBusy |= 1u << i;
+        s->txKey[i] = e->key;
+        CANMessageSet(s->base, i + 1u, &msg, MSG_OBJ_TYPE_TX);
+        heap_pop(s);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ *      Interrupt
+ *------------------------------------------------------------------------------*/
+/** Takes the frame of receive object @p obj into the ring. */
+static bool rx_take(uint32_t can, uint32_t obj)
+{
+    can_bus_t *s = &s_bus[can];
+    can_stats_t *st = &g_can[can];
+    can_frame_t *slot = &s->ring[s->head & (CAN_BUS_RX_RING - 1u)];
+    can_frame_t frame;
+    tCANMsgObject msg;
+    uint32_t filter;
+    bool full = (s->head - load_index(&s->tail)) == CAN_BUS_RX_RING;
+
+    /* read into the slot when there is one: no second copy */
+    msg.pui8MsgData = full ? frame.data : slot->data;
+    CANMessageGet(s->base, obj, &msg, true);
+    if ((msg.ui32Flags & MSG_OBJ_NEW_DATA) == 0u)
+    {
+        return false;
+    }
+    if ((msg.ui32Flags & MSG_OBJ_DATA_LOST) != 0u)
+    {
+        st->rx_lost++;
+    }
+    frame.flags = (uint8_t)((((msg.ui32Flags & MSG_OBJ_EXTENDED_ID) != 0u) ?
+                             CAN_FRAME_EXT : 0u) |
+                            (((msg.ui32Flags & MSG_OBJ_DATA_LOST) != 0u) ?
+                             CAN_FRAME_LOST : 0u));
+    filter = group_filter(s, s->objGroup[obj], msg.ui32MsgID, frame.flags);
+    if (filter == CAN_BUS_MAX_FILTERS)
+    {
+        st->rx_rejected++;
+        return true;
+    }
+    if (full)
+    {
+        st->rx_ring_full++;
+        return true;
+    }
+    slot->id = msg.ui32MsgID;
+    slot->stamp = cycles_now();
+    slot->len = (uint8_t)msg.ui32MsgLen;
+    slot->flags = frame.flags;
+    slot->filter = (uint8_t)filter;
+    store_index(&s->head, s->head + 1u);
+    st->rx_frames++;
+    return true;
+}
+
+static void can_isr(uint32_t can)
+{
+    can_bus_t *s = &s_bus[can];
+    can_stats_t *st = &g_can[can];
+    uint32_t batch = 0u;
+    uint32_t pending;
+
+    st->irqs++;
+    if (CANIntStatus(s->base, CAN_INT_STS_CAUSE) == CAN_INT_INTID_STATUS)
+    {
+        if ((CANStatusGet(s->base, CAN_STS_CONTROL) & CAN_STATUS_BUS_OFF) != 0u)
+        {
+            /* the controller stopped in init mode: start the recovery */
+            st->bus_off++;
+            CANEnable(s->base);
+        }
+    }
+
+    while ((pending = CANIntStatus(s->base, CAN_INT_STS_OBJECT)) != 0u)
+    {
+        uint32_t rx = pending & RX_OBJ_MASK;
+        uint32_t tx = pending & TX_OBJ_MASK;
+
+        while (rx != 0u)
+        {
+            if (rx_take(can, ctz32(rx) + 1u))
+            {
+                batch++;
+            }
+            rx &= rx - 1u;
+        }
+        if (tx != 0u)
+        {
+            while (tx != 0u)
+            {
+                uint32_t i = ctz32(tx);
+
+                CANIntClear(s->base, i + 1u);
+                s->txBusy &= ~(1u << i);
+                st->tx_frames++;
+                tx &= tx - 1u;
+            }
+            tx_refill(s);
+        }
+    }
+    if (batch > st->rx_batch_max)
+    {
+        st->rx_batch_max = batch;
+    }
+}
+
+void can0_isr(void)
+{
+    can_isr(0u);
+}
+
+void can1_isr(void)
+{
+    can_isr(1u);
+}
+
+/*------------------------------------------------------------------------------
+ *      API
+ *------------------------------------------------------------------------------*/
+/**
+ * Starts a controller: bit rate, filters, interrupt.
+ *
+ * @param[in] can      - 0 or 1
+ * @param[in] clock_hz - system clock
+ * @param[in] bitrate  - e.g. 500000
+ * @param[in] filters  - frames to receive, or NULL with @p count 0 for all
+ * @param[in] count    - at most CAN_BUS_MAX_FILTERS
+ * @returns bool       - false on a bad argument, or filters of both
+ *                       identifier types with room for one group only
+ */
+bool can_open(uint32_t can, uint32_t clock_hz, uint32_t bitrate,
+              const can_filter_t *filters, uint32_t count)
+{
+    can_bus_t *s;
+
+    if (can >= CAN_BUS_CONTROLLERS || count > CAN_BUS_MAX_FILTERS ||
+        (count != 0u && filters == NULL))
+    {
+        return false;
+    }
+    s = &s_bus[can];
+    memset(s, 0, sizeof(*s));
+    memset(&g_can[can], 0, sizeof(g_can[can]));
+    s->base = s_base[can];
+    if (!groups_build(s, filters, count))
+    {
+        return false;
+    }
+    g_can[can].rx_groups = s->groupCount;
+
+    SysCtlPeripheralEnable(s_periph[can]);
+    while (!SysCtlPeripheralReady(s_periph[can]))
+    {
+    }
+    CANInit(s->base);
+    CANBitRateSet(s->base, clock_hz, bitrate);
+    groups_load(s);
+
+    (void)register_isr(s_int[can], (can == 0u) ? can0_isr : can1_isr);
+    CANIntEnable(s->base, CAN_INT_MASTER | CAN_INT_ERROR);
+    IntEnable(s_int[can]);
+    s->open = true;
+    CANEnable(s->base);
+    return true;
+}
+
+void can_close(uint32_t can)
+{
+    can_bus_t *s = &s_bus[can];
+
+    if (can >= CAN_BUS_CONTROLLERS || !s->open)
+    {
+        return;
+    }
+    IntDisable(s_int[can]);
+    CANIntDisable(s->base, CAN_INT_MASTER | CAN_INT_ERROR);
+    CANDisable(s->base);
+    s->open = false;
+}
+
+/**
+ * Queues a frame by priority. Safe from tasks and handlers.
+ *
+ * @returns bool - false if the controller is closed, len > 8, or the queue
+ *                 is full (tx_full)
+ */
+bool can_send(uint32_t can, const can_frame_t *frame)
+{
+    can_bus_t *s = &s_bus[can];
+    can_tx_entry_t e;
+    bool masked;
+
+    if (can >= CAN_BUS_CONTROLLERS || !s->open || frame->len > 8u)
+    {
+        return false;
+    }
+    e.frame = *frame;
+    e.frame.id &= ((frame->flags & CAN_FRAME_EXT) != 0u) ? EXT_MASK : STD_MASK;
+    e.key = arb_key(&e.frame);
+
+    masked = IntMasterDisable();
+    if (s->queued == CAN_BUS_TX_QUEUE)
+    {
+        g_can[can].tx_full++;
+        if (!masked)
+        {
+            IntMasterEnable();
+        }
+        return false;
+    }
+    e.seq = s->seq++;
+    heap_push(s, &e);
+    if (s->queued > g_can[can].tx_queue_max)
+    {
+        g_can[can].tx_queue_max = s->queued;
+    }
+    tx_refill(s);
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+    return true;
+}
+
+/**
+ * Takes up to @p max received frames, oldest first. Single consumer per
+ * controller.
+ *
+ * @returns uint32_t - frames copied to @p frames, 0 for a bad @p can
+ */
+uint32_t can_recv_n(uint32_t can, can_frame_t *frames, uint32_t max)
+{
+    can_bus_t *s;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t n = 0u;
+
+    if (can >= CAN_BUS_CONTROLLERS)
+    {
+        return 0u;
+    }
+    s = &s_bus[can];
+    head = load_index(&s->head);
+    tail = s->tail;
+    while (tail != head && n < max)
+    {
+        frames[n++] = s->ring[tail & (CAN_BUS_RX_RING - 1u)];
+        tail++;
+    }
+    store_index(&s->tail, tail);
+    return n;
+}
+
+bool can_recv(uint32_t can, can_frame_t *frame)
+{
+    return can_recv_n(can, frame, 1u) == 1u;
+}
+
+/**
+ * @returns uint32_t - frames queued or in the controller, not yet sent; 0
+ *          for a bad @p can
+ */
+uint32_t can_tx_pending(uint32_t can)
+{
+    const can_bus_t *s;
+
+    if (can >= CAN_BUS_CONTROLLERS)
+    {
+        return 0u;
+    }
+    s = &s_bus[can];
+    return s->queued + bit_count(s->txBusy);
+}
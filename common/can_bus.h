@@ -0,0 +1,157 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - CAN
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     can_bus.h
+ * @author   insert authors names here
+ * @brief    CAN0/CAN1 driver for a busy bus: identifier filtering by the
+ *           message objects, several frames per interrupt, transmission by
+ *           priority. \n
+ *           RX: can_open() maps the filters onto the message objects that
+ *           are not kept for TX. Filters are merged, the pair that loses
+ *           the fewest mask bits first, until each group gets at least
+ *           CAN_BUS_RX_DEPTH objects; the objects of a group form a
+ *           hardware FIFO, so a burst on one group waits in the controller
+ *           instead of overwriting itself. Frames of other identifiers
+ *           never reach the core. Frames a merged group lets through are
+ *           checked against its own filters, and those that match none are
+ *           dropped (rx_rejected), so software sees exactly the filters it
+ *           gave. The interrupt takes every object that holds a frame, as
+ *           long as any does, into a lock-free single-consumer ring read by
+ *           can_recv()/can_recv_n().\n
+ *           TX: can_send() queues the frame by arbitration priority (lower
+ *           identifier first, send order among equal ones) and the
+ *           CAN_BUS_TX_OBJECTS lowest objects are refilled from the queue
+ *           as they complete. The controller sends the lowest-numbered
+ *           pending object first, not the lowest identifier, so a frame may
+ *           wait for the frame on the bus and for at most
+ *           CAN_BUS_TX_OBJECTS - 1 frames of lower priority already in the
+ *           controller; frames with the same identifier go out in send
+ *           order.\n
+ *           The application configures the CAN pins (GPIO alternate
+ *           function) before can_open().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _CAN_BUS_H_
+#define _CAN_BUS_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define CAN_BUS_CONTROLLERS     2u
+#define CAN_BUS_OBJECTS         32u
+
+/** Message objects 1 to n transmit; the others receive. */
+#ifndef CAN_BUS_TX_OBJECTS
+#define CAN_BUS_TX_OBJECTS      4u
+#endif
+
+/** Least objects per filter group: the depth of its hardware FIFO. */
+#ifndef CAN_BUS_RX_DEPTH
+#define CAN_BUS_RX_DEPTH        2u
+#endif
+
+/** Frames between the interrupt and can_recv(), a power of two. */
+#ifndef CAN_BUS_RX_RING
+#define CAN_BUS_RX_RING         64u
+#endif
+
+/** Frames can_send() holds until an object is free. */
+#ifndef CAN_BUS_TX_QUEUE
+#define CAN_BUS_TX_QUEUE        32u
+#endif
+
+#ifndef CAN_BUS_MAX_FILTERS
+#define CAN_BUS_MAX_FILTERS     64u
+#endif
+
+/** can_frame_t.flags and can_filter_t.flags */
+#define CAN_FRAME_EXT           0x01u   /**< 29-bit identifier              */
+#define CAN_FRAME_LOST          0x02u   /**< a frame before it was lost in
+                                             the controller                 */
+
+/** can_frame_t.filter of a frame taken with no filter given. */
+#define CAN_FILTER_NONE         0xFFu
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;              /**< 1: bit of id must match; 0: any        */
+    uint8_t  flags;             /**< CAN_FRAME_EXT                          */
+} can_filter_t;
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t stamp;             /**< cycles_now() when taken from the
+                                     controller (RX)                        */
+    uint8_t  len;               /**< 0 to 8                                 */
+    uint8_t  flags;             /**< CAN_FRAME_x                            */
+    uint8_t  filter;            /**< index of the filter it matched (RX)    */
+    uint8_t  data[8];
+} can_frame_t;
+
+typedef struct
+{
+    uint32_t irqs;
+    uint32_t rx_frames;         /**< put in the ring                        */
+    uint32_t rx_batch_max;      /**< most frames taken by one interrupt     */
+    uint32_t rx_lost;           /**< overwritten in the controller          */
+    uint32_t rx_ring_full;      /**< dropped: can_recv() too slow           */
+    uint32_t rx_rejected;       /**< let in by a merged group only          */
+    uint32_t rx_groups;         /**< filter groups after merging            */
+    uint32_t tx_frames;         /**< sent                                   */
+    uint32_t tx_full;           /**< refused by can_send()                  */
+    uint32_t tx_queue_max;
+    uint32_t bus_off;
+} can_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern can_stats_t g_can[CAN_BUS_CONTROLLERS];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool     can_open(uint32_t can, uint32_t clock_hz, uint32_t bitrate,
+                  const can_filter_t *filters, uint32_t count);
+void     can_close(uint32_t can);
+bool     can_send(uint32_t can, const can_frame_t *frame);
+bool     can_recv(uint32_t can, can_frame_t *frame);
+uint32_t can_recv_n(uint32_t can, can_frame_t *frames, uint32_t max);
+uint32_t can_tx_pending(uint32_t can);
+
+void can0_isr(void);
+void can1_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
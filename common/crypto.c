@@ -0,0 +1,539 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - Crypto
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     crypto.c
+ * @author   insert authors names here
+ * @brief    Crypto requests on the CCM engines or the CPU, see crypto.h. \n
+ *           Each engine has a queue of requests linked through link; the
+ *           head is the one running. A request's input (and for AES its
+ *           output) is described to the uDMA as a peripheral scatter-gather
+ *           list of 32 bit items, so a round needs no interrupt before the
+ *           engine's own "done". The queues are only touched with
+ *           interrupts masked.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+#include "common/crypto.h"
+
+#if defined(__IAR_SYSTEMS_ICC__) && CRYPTO_HW
+#define ENGINE              1
+#else
+#define ENGINE              0
+#endif
+
+#if ENGINE
+#include "inc/hw_memmap.h"
+#include "inc/hw_aes.h"
+#include "inc/hw_shamd5.h"
+#include "driverlib/aes.h"
+#include "driverlib/shamd5.h"
+#include "driverlib/udma.h"
+
+#include "common/dma.h"
+#include "common/vtable.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+typedef enum
+{
+    UNIT_SHA,
+    UNIT_AES,
+    UNITS
+} unit_t;
+
+typedef struct
+{
+    crypto_req_t *head;         /**< running */
+    crypto_req_t *tail;
+} queue_t;
+
+#if ENGINE
+/** uDMA transfer size field (10 bits). */
+#define MAX_ITEMS           1024u
+#define CHANNEL(x)          ((x) & 0x1Fu)
+#define AES_DATA            ((void *)(AES_BASE + AES_O_DATA_IN_0))
+#define SHA_DATA            ((void *)(SHAMD5_BASE + SHAMD5_O_DATA_0_IN))
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+crypto_stats_t g_crypto;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static queue_t  s_queues[UNITS];
+static uint32_t s_minBytes = CRYPTO_HW_MIN_BYTES;
+
+#if ENGINE
+static tDMAControlTable s_shaTasks[CRYPTO_HW_TASKS];
+static tDMAControlTable s_aesInTasks[CRYPTO_HW_TASKS];
+static tDMAControlTable s_aesOutTasks[CRYPTO_HW_TASKS];
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static bool valid(const crypto_req_t *req)
+{
+    if (req->len != 0u && (req->in == NULL || req->out == NULL))
+    {
+        return false;
+    }
+    switch (req->op)
+    {
+    case CRYPTO_SHA256:
+    case CRYPTO_MD5:
+        return req->out != NULL;
+    case CRYPTO_AES_ECB:
+    case CRYPTO_AES_CBC:
+    case CRYPTO_AES_CTR:
+        break;
+    default:
+        return false;
+    }
+    if (req->key == NULL ||
+        (req->key_bytes != 16u && req->key_bytes != 24u && req->key_bytes != 32u))
+    {
+        return false;
+    }
+    if (req->op != CRYPTO_AES_ECB && req->iv == NULL)
+    {
+        return false;
+    }
+    return req->op == CRYPTO_AES_CTR || (req->len % CRYPTO_AES_BLOCK) == 0u;
+}
+
+/** The software reference. */
+static void cpu_run(crypto_req_t *req)
+{
+    union
+    {
+        crypto_hash_sw_t hash;
+        crypto_aes_sw_t  aes;
+    } ctx;
+
+    switch (req->op)
+    {
+    case CRYPTO_SHA256:
+        crypto_sha256_init(&ctx.hash);
+        crypto_sha256_update(&ctx.hash, req->in, req->len);
+        crypto_sha256_final(&ctx.hash, req->out);
+        break;
+    case CRYPTO_MD5:
+        crypto_md5_init(&ctx.hash);
+        crypto_md5_update(&ctx.hash, req->in, req->len);
+        crypto_md5_final(&ctx.hash, req->out);
+        break;
+    default:
+        (void)crypto_aes_sw_key(&ctx.aes, req->key, req->key_bytes);
+        if (req->op == CRYPTO_AES_ECB)
+        {
+            crypto_aes_sw_ecb(&ctx.aes, req->decrypt, req->in, req->out, req->len);
+        }
+        else if (req->op == CRYPTO_AES_CBC)
+        {
+            crypto_aes_sw_cbc(&ctx.aes, req->decrypt, req->iv, req->in, req->out,
+                              req->len);
+        }
+        else
+        {
+            crypto_aes_sw_ctr(&ctx.aes, req->iv, req->in, req->out, req->len);
+        }
+        break;
+    }
+    g_crypto.cpu_reqs++;
+    g_crypto.cpu_bytes += req->len;
+}
+
+static void finish(crypto_req_t *req)
+{
+    req->pending = false;
+    if (req->done != NULL)
+    {
+        req->done(req->arg);
+    }
+}
+
+#if ENGINE
+static bool is_aes(crypto_op_t op)
+{
+    return op == CRYPTO_AES_ECB || op == CRYPTO_AES_CBC || op == CRYPTO_AES_CTR;
+}
+
+/** @returns bool - the engine can take @p req */
+static bool engine_fits(const crypto_req_t *req)
+{
+    uintptr_t align = (uintptr_t)req->in | (uintptr_t)req->out;
+
+    if (req->len < s_minBytes || req->len == 0u ||
+        req->len > CRYPTO_HW_MAX_BYTES)
+    {
+        return false;
+    }
+    if (!is_aes(req->op))
+    {
+        return ((uintptr_t)req->in & 3u) == 0u;
+    }
+    return (align & 3u) == 0u && (req->len % CRYPTO_AES_BLOCK) == 0u;
+}
+
+/**
+ * Describes @p words 32 bit items from or to an engine register as a
+ * peripheral scatter-gather list and hands it to @p channel.
+ */
+static void dma_start(uint32_t channel, tDMAControlTable *tasks, uint32_t words,
+                      void *src, uint32_t srcInc, void *dst, uint32_t dstInc,
+                      uint32_t arb)
+{
+    uint8_t *s = (uint8_t *)src;
+    uint8_t *d = (uint8_t *)dst;
+    uint32_t count = 0u;
+
+    while (words > 0u)
+    {
+        uint32_t items = (words < MAX_ITEMS) ? words : MAX_ITEMS;
+
+        words -= items;
+        tasks[count] = (tDMAControlTable)uDMATaskStructEntry(
+            items, UDMA_SIZE_32, srcInc, s, dstInc, d, arb,
+            (words == 0u) ? UDMA_MODE_BASIC : UDMA_MODE_PER_SCATTER_GATHER);
+        if (srcInc != UDMA_SRC_INC_NONE)
+        {
+            s += 4u * items;
+        }
+        if (dstInc != UDMA_DST_INC_NONE)
+        {
+            d += 4u * items;
+        }
+        count++;
+    }
+    uDMAChannelScatterGatherSet(CHANNEL(channel), count, tasks, 1);
+    uDMAChannelEnable(CHANNEL(channel));
+}
+
+static void sha_start(crypto_req_t *req)
+{
+    SHAMD5Reset(SHAMD5_BASE);
+    SHAMD5ConfigSet(SHAMD5_BASE, (req->op == CRYPTO_SHA256) ? SHAMD5_ALGO_SHA256
+                                                            : SHAMD5_ALGO_MD5);
+    SHAMD5HashLengthSet(SHAMD5_BASE, req->len);
+    SHAMD5IntClear(SHAMD5_BASE, SHAMD5_INT_OUTPUT_READY);
+    SHAMD5IntEnable(SHAMD5_BASE, SHAMD5_INT_OUTPUT_READY);
+    /* a tail of 1-3 bytes is read as a whole word; the length set above
+       tells the engine where the message ends */
+    dma_start(CRYPTO_SHA_DMA_IN, s_shaTasks, (req->len + 3u) / 4u,
+              (void *)req->in, UDMA_SRC_INC_32, SHA_DATA, UDMA_DST_INC_NONE,
+              UDMA_ARB_16);
+    SHAMD5DMAEnable(SHAMD5_BASE);
+}
+
+static void aes_start(crypto_req_t *req)
+{
+    uint32_t key[8];
+    uint32_t iv[4];
+    uint32_t size;
+    uint32_t config;
+
+    size = (req->key_bytes == 16u) ? AES_CFG_KEY_SIZE_128BIT :
+           (req->key_bytes == 24u) ? AES_CFG_KEY_SIZE_192BIT :
+                                     AES_CFG_KEY_SIZE_256BIT;
+    config = size | ((req->decrypt && req->op != CRYPTO_AES_CTR)
+                         ? AES_CFG_DIR_DECRYPT : AES_CFG_DIR_ENCRYPT);
+    config |= (req->op == CRYPTO_AES_ECB) ? AES_CFG_MODE_ECB :
+              (req->op == CRYPTO_AES_CBC) ? AES_CFG_MODE_CBC :
+                                            (AES_CFG_MODE_CTR |
+                                             AES_CFG_CTR_WIDTH_128BIT);
+    memcpy(key, req->key, req->key_bytes);
+
+    AESReset(AES_BASE);
+    AESConfigSet(AES_BASE, config);
+    AESKey1Set(AES_BASE, key, size);
+    if (req->op != CRYPTO_AES_ECB)
+    {
+        memcpy(iv, req->iv, sizeof(iv));
+        AESIVSet(AES_BASE, iv);
+    }
+    AESLengthSet(AES_BASE, (uint64_t)req->len);
+    AESIntClear(AES_BASE, AES_INT_DMA_DATA_OUT);
+    AESIntEnable(AES_BASE, AES_INT_DMA_DATA_OUT);
+    dma_start(CRYPTO_AES_DMA_OUT, s_aesOutTasks, req->len / 4u,
+              AES_DATA, UDMA_SRC_INC_NONE, req->out, UDMA_DST_INC_32,
+              UDMA_ARB_4);
+    dma_start(CRYPTO_AES_DMA_IN, s_aesInTasks, req->len / 4u,
+              (void *)req->in, UDMA_SRC_INC_32, AES_DATA, UDMA_DST_INC_NONE,
+              UDMA_ARB_4);
+    AESDMAEnable(AES_BASE, AES_DMA_DATA_IN | AES_DMA_DATA_OUT);
+}
+
+static void unit_start(unit_t unit, crypto_req_t *req)
+{
+    g_crypto.hw_reqs++;
+    g_crypto.hw_bytes += req->len;
+    if (unit == UNIT_SHA)
+    {
+        sha_start(req);
+    }
+    else
+    {
+        aes_start(req);
+    }
+}
+
+/** Queues @p req on its engine, starting it if idle. */
+static void enqueue(crypto_req_t *req)
+{
+    unit_t unit = is_aes(req->op) ? UNIT_AES : UNIT_SHA;
+    queue_t *q = &s_queues[unit];
+    bool masked = IntMasterDisable();
+
+    req->link = NULL;
+    if (q->head == NULL)
+    {
+        q->head = req;
+        q->tail = req;
+        unit_start(unit, req);
+    }
+    else
+    {
+        q->tail->link = req;
+        q->tail = req;
+    }
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/** Ends the running request of @p unit and starts the next one. */
+static void unit_done(unit_t unit)
+{
+    queue_t *q = &s_queues[unit];
+    crypto_req_t *req = q->head;
+
+    q->head = req->link;
+    if (q->head == NULL)
+    {
+        q->tail = NULL;
+    }
+    else
+    {
+        unit_start(unit, q->head);
+    }
+    finish(req);
+}
+#endif
+
+/**
+ * Enables the CCM, assigns the engines' uDMA channels and installs their
+ * interrupts. Without CRYPTO_HW it only resets the queues.
+ */
+void crypto_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < UNITS; i++)
+    {
+        s_queues[i].head = NULL;
+        s_queues[i].tail = NULL;
+    }
+#if ENGINE
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_CCM0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_CCM0))
+    {
+    }
+    dma_init();
+    uDMAChannelAssign(CRYPTO_SHA_DMA_IN);
+    uDMAChannelAssign(CRYPTO_AES_DMA_IN);
+    uDMAChannelAssign(CRYPTO_AES_DMA_OUT);
+    uDMAChannelAttributeDisable(CHANNEL(CRYPTO_SHA_DMA_IN), UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(CHANNEL(CRYPTO_AES_DMA_IN), UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(CHANNEL(CRYPTO_AES_DMA_OUT), UDMA_ATTR_ALL);
+
+    (void)register_isr(INT_SHA0, crypto_sha_isr);
+    (void)register_isr(INT_AES0, crypto_aes_isr);
+    IntEnable(INT_SHA0);
+    IntEnable(INT_AES0);
+#endif
+}
+
+/**
+ * Starts a batch of requests.
+ *
+ * @param[in] batch - first request; the rest follow through next
+ * @returns int     - CRYPTO_CPU, CRYPTO_STARTED or CRYPTO_INVALID (no
+ *                    request of the batch was run)
+ */
+int crypto_submit(crypto_req_t *batch)
+{
+    crypto_req_t *req;
+    crypto_req_t *next;
+    int result = CRYPTO_CPU;
+
+    for (req = batch; req != NULL; req = req->next)
+    {
+        if (!valid(req))
+        {
+            g_crypto.invalid++;
+            return CRYPTO_INVALID;
+        }
+    }
+    g_crypto.batches++;
+
+    for (req = batch; req != NULL; req = next)
+    {
+        next = req->next;           /* done() may reuse the request */
+        req->pending = true;
+#if ENGINE
+        if (engine_fits(req))
+        {
+            enqueue(req);
+            result = CRYPTO_STARTED;
+            continue;
+        }
+#endif
+        cpu_run(req);
+        finish(req);
+    }
+    return result;
+}
+
+/**
+ * Runs a batch and returns when all of it is done, asleep meanwhile. Not
+ * from handlers at or above the priority of INT_SHA0 / INT_AES0.
+ * The requests are not read once submitted, since done() may reuse them:
+ * the wait lasts until both engine queues are empty, so it also covers
+ * requests queued meanwhile by others.
+ *
+ * @returns bool - false if the batch was refused (CRYPTO_INVALID)
+ */
+bool crypto_run(crypto_req_t *batch)
+{
+    int result = crypto_submit(batch);
+    bool masked;
+
+    if (result == CRYPTO_INVALID)
+    {
+        return false;
+    }
+    if (result == CRYPTO_CPU)
+    {
+        return true;
+    }
+    masked = IntMasterDisable();
+    while (crypto_busy())
+    {
+        /* WFI wakes up on the pending interrupt even with PRIMASK set */
+        SysCtlSleep();
+        IntMasterEnable();
+        IntMasterDisable();
+    }
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+    return true;
+}
+
+/** @returns bool - true while an engine request runs or waits */
+bool crypto_busy(void)
+{
+    return s_queues[UNIT_SHA].head != NULL || s_queues[UNIT_AES].head != NULL;
+}
+
+/**
+ * Sets the size below which the CPU does the work, e.g. 0 to send
+ * everything the engines can take to them when measuring.
+ *
+ * @returns uint32_t - the previous size
+ */
+uint32_t crypto_set_min(uint32_t bytes)
+{
+    uint32_t previous = s_minBytes;
+
+    s_minBytes = bytes;
+    return previous;
+}
+
+/**
+ * SHA/MD5 interrupt: the digest of the running request is ready.
+ */
+void crypto_sha_isr(void)
+{
+#if ENGINE
+    uint32_t status = SHAMD5IntStatus(SHAMD5_BASE, true);
+    uint32_t digest[CRYPTO_SHA256_BYTES / 4u];
+    crypto_req_t *req = s_queues[UNIT_SHA].head;
+
+    SHAMD5IntClear(SHAMD5_BASE, status);
+    if ((status & SHAMD5_INT_OUTPUT_READY) == 0u || req == NULL)
+    {
+        return;
+    }
+    SHAMD5DMADisable(SHAMD5_BASE);
+    SHAMD5ResultRead(SHAMD5_BASE, digest);
+    memcpy(req->out, digest, (req->op == CRYPTO_SHA256) ? CRYPTO_SHA256_BYTES
+                                                        : CRYPTO_MD5_BYTES);
+    unit_done(UNIT_SHA);
+#endif
+}
+
+/**
+ * AES interrupt: the uDMA wrote the last output block of the running
+ * request.
+ */
+void crypto_aes_isr(void)
+{
+#if ENGINE
+    uint32_t status = AESIntStatus(AES_BASE, true);
+    uint32_t iv[4];
+    crypto_req_t *req = s_queues[UNIT_AES].head;
+
+    AESIntClear(AES_BASE, status);
+    if ((status & AES_INT_DMA_DATA_OUT) == 0u || req == NULL)
+    {
+        return;
+    }
+    AESDMADisable(AES_BASE, AES_DMA_DATA_IN | AES_DMA_DATA_OUT);
+    if (req->op != CRYPTO_AES_ECB)
+    {
+        /* the chaining value after the last block, as crypto_sw.h leaves it */
+        AESIVRead(AES_BASE, iv);
+        memcpy(req->iv, iv, sizeof(iv));
+    }
+    unit_done(UNIT_AES);
+#endif
+}
@@ -0,0 +1,155 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - Crypto
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     crypto.h
+ * @author   insert authors names here
+ * @brief    SHA-256, MD5 and AES (ECB, CBC, CTR) requests, completed by
+ *           callback. \n
+ *           crypto_submit() takes a batch: requests linked by next. With
+ *           CRYPTO_HW the engine requests are queued for the SHA/MD5 and
+ *           AES modules of the CCM, which read and write the buffers
+ *           through the uDMA; each completion interrupt (INT_SHA0,
+ *           INT_AES0) calls done(arg) and starts the next queued
+ *           request, so a batch runs back to back without the core.
+ *           Requests the engines cannot take run on the CPU (crypto_sw.h)
+ *           before crypto_submit() returns, done() included:
+ *           - every request, without CRYPTO_HW or on the host;
+ *           - shorter than CRYPTO_HW_MIN_BYTES (crypto_set_min()): set-up
+ *             and interrupt cost more than the work, see crypto_bench.h;
+ *           - longer than CRYPTO_HW_MAX_BYTES, buffers not word aligned,
+ *             or AES lengths that are not whole blocks.
+ *           So done() calls follow the batch order only among the requests
+ *           of one engine; the SHA/MD5 and AES engines run in parallel.
+ *           crypto_run() is the blocking form: it returns when both engines
+ *           are idle, without reading the requests after submitting them.\n
+ *           Buffers, key, iv and the request itself must stay valid until
+ *           done(). For CBC and CTR, iv is updated as by crypto_sw.h so the
+ *           next piece of a message continues the chain.\n
+ *           The TM4C1294NCPDT of the LaunchPad has no SHA/MD5, AES nor DES
+ *           module (only the TM4C129E parts do), so CRYPTO_HW defaults to
+ *           0. DES/3DES is not offered.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _CRYPTO_H_
+#define _CRYPTO_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/crypto_sw.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** 1 on a TM4C129E part: use the SHA/MD5 and AES modules. */
+#ifndef CRYPTO_HW
+#define CRYPTO_HW               0
+#endif
+
+/** Shorter requests are done by the CPU; the default of crypto_set_min(). */
+#ifndef CRYPTO_HW_MIN_BYTES
+#define CRYPTO_HW_MIN_BYTES     64u
+#endif
+
+/** uDMA tasks per direction of a request, 4 KiB each (peripheral
+    scatter-gather); longer requests are done by the CPU. */
+#ifndef CRYPTO_HW_TASKS
+#define CRYPTO_HW_TASKS         4u
+#endif
+#define CRYPTO_HW_MAX_BYTES     (CRYPTO_HW_TASKS * 4096u)
+
+/** uDMA channels of the engines (channel | encoding, as driverlib/udma.h). */
+#ifndef CRYPTO_AES_DMA_IN
+#define CRYPTO_AES_DMA_IN       UDMA_CH16_AES0DIN
+#define CRYPTO_AES_DMA_OUT      UDMA_CH17_AES0DOUT
+#define CRYPTO_SHA_DMA_IN       UDMA_CH5_SHAMD50DIN
+#endif
+
+/** Return values of crypto_submit(). */
+#define CRYPTO_CPU              0       /**< all done by the CPU, done() called */
+#define CRYPTO_STARTED          1       /**< some on the engines or queued      */
+#define CRYPTO_INVALID          (-1)    /**< a bad request, nothing done        */
+
+typedef enum
+{
+    CRYPTO_SHA256,
+    CRYPTO_MD5,
+    CRYPTO_AES_ECB,
+    CRYPTO_AES_CBC,
+    CRYPTO_AES_CTR,
+} crypto_op_t;
+
+typedef void (*crypto_done_t)(void *arg);
+
+typedef struct crypto_req
+{
+    struct crypto_req *next;    /**< next of the batch, NULL ends it */
+    struct crypto_req *link;    /**< engine queue, owned by crypto.c */
+    crypto_op_t        op;
+    bool               decrypt; /**< AES ECB and CBC */
+    const uint8_t     *key;     /**< AES */
+    uint32_t           key_bytes; /**< 16, 24 or 32 */
+    uint8_t           *iv;      /**< CBC IV or CTR counter, 16 bytes */
+    const uint8_t     *in;
+    uint8_t           *out;     /**< AES: len bytes (may be in); hash: digest */
+    uint32_t           len;     /**< bytes of in */
+    crypto_done_t      done;    /**< may be NULL */
+    void              *arg;
+    volatile bool      pending; /**< set by crypto_submit(), cleared at done */
+} crypto_req_t;
+
+typedef struct
+{
+    uint32_t cpu_reqs;
+    uint32_t hw_reqs;
+    uint32_t batches;
+    uint32_t invalid;
+    uint64_t cpu_bytes;
+    uint64_t hw_bytes;
+} crypto_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern crypto_stats_t g_crypto;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void crypto_init(void);
+int  crypto_submit(crypto_req_t *batch);
+bool crypto_run(crypto_req_t *batch);
+bool crypto_busy(void);
+uint32_t crypto_set_min(uint32_t bytes);
+
+void crypto_sha_isr(void);
+void crypto_aes_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
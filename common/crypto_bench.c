@@ -0,0 +1,151 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - Crypto
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     crypto_bench.c
+ * @author   insert authors names here
+ * @brief    Cycles per byte of the crypto.h operations (see crypto_bench.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common/crypto_bench.h"
+#include "common/crypto.h"
+#include "common/cycles.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define BYTES               CRYPTO_BENCH_BYTES
+#define SMALLEST            16u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+crypto_bench_t g_crypto_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const char *const s_names[CRYPTO_BENCH_OPS] =
+{
+    "sha256", "md5", "aes128_ecb", "aes128_cbc", "aes128_ctr", "aes256_cbc"
+};
+
+/* words, so the engines can take them */
+static uint32_t s_in[BYTES / 4u];
+static uint32_t s_out[BYTES / 4u];
+static uint8_t  s_key[32];
+static uint8_t  s_iv[CRYPTO_AES_BLOCK];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void make_req(crypto_req_t *req, crypto_bench_op_t op, uint32_t len)
+{
+    static const crypto_op_t ops[CRYPTO_BENCH_OPS] =
+    {
+        CRYPTO_SHA256, CRYPTO_MD5, CRYPTO_AES_ECB,
+        CRYPTO_AES_CBC, CRYPTO_AES_CTR, CRYPTO_AES_CBC
+    };
+
+    memset(req, 0, sizeof(*req));
+    req->op = ops[op];
+    req->key = s_key;
+    req->key_bytes = (op == CRYPTO_BENCH_AES256_CBC) ? 32u : 16u;
+    req->iv = s_iv;
+    req->in = (const uint8_t *)s_in;
+    req->out = (uint8_t *)s_out;
+    req->len = len;
+}
+
+/** @returns uint32_t - best of CRYPTO_BENCH_RUNS, on the engine or the CPU */
+static uint32_t best_cycles(crypto_bench_op_t op, uint32_t len, bool engine)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t previous = crypto_set_min(engine ? 0u : UINT32_MAX);
+    uint32_t run;
+
+    for (run = 0; run < CRYPTO_BENCH_RUNS; run++)
+    {
+        crypto_req_t req;
+        uint32_t start;
+        uint32_t elapsed;
+
+        make_req(&req, op, len);
+        start = cycles_now();
+        (void)crypto_run(&req);
+        elapsed = cycles_now() - start;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    (void)crypto_set_min(previous);
+    return best;
+}
+
+/**
+ * Times every operation; results in g_crypto_bench. Calls crypto_init().
+ */
+void crypto_bench_run(void)
+{
+    uint32_t seed = 12345u;
+    uint32_t op;
+    uint32_t i;
+
+    for (i = 0; i < BYTES / 4u; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        s_in[i] = seed;
+    }
+    for (i = 0; i < sizeof(s_key); i++)
+    {
+        s_key[i] = (uint8_t)i;
+    }
+    crypto_init();
+    cycles_init();
+
+    for (op = 0; op < CRYPTO_BENCH_OPS; op++)
+    {
+        g_crypto_bench.name[op] = s_names[op];
+        g_crypto_bench.cpu[op] = best_cycles((crypto_bench_op_t)op, BYTES, false);
+        g_crypto_bench.hw[op] = 0u;
+        g_crypto_bench.hw_min[op] = 0u;
+#if CRYPTO_HW
+        g_crypto_bench.hw[op] = best_cycles((crypto_bench_op_t)op, BYTES, true);
+        for (i = SMALLEST; i <= BYTES; i *= 2u)
+        {
+            if (best_cycles((crypto_bench_op_t)op, i, true) <
+                best_cycles((crypto_bench_op_t)op, i, false))
+            {
+                g_crypto_bench.hw_min[op] = i;
+                break;
+            }
+        }
+#endif
+    }
+}
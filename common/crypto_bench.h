@@ -0,0 +1,88 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - Crypto
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     crypto_bench.h
+ * @author   insert authors names here
+ * @brief    Cycles per byte of the crypto.h operations. \n
+ *           Each operation runs on CRYPTO_BENCH_BYTES bytes
+ *           CRYPTO_BENCH_RUNS times, timed with the DWT cycle counter; the
+ *           best run is kept. cpu[] is the software reference
+ *           (crypto_sw.h); with CRYPTO_HW, hw[] is crypto_run() on the
+ *           engines, from the call to the last done(), and hw_min[] the
+ *           smallest power of two from 16 bytes up at which the engine
+ *           beats the CPU: a value for CRYPTO_HW_MIN_BYTES. On the board,
+ *           call crypto_bench_run() and read g_crypto_bench in the debugger
+ *           (cycles per byte = cycles / CRYPTO_BENCH_BYTES). On the host the
+ *           code is plain C, which the simulator does not charge;
+ *           host/bench/bench_crypto.c checks the test vectors and reports
+ *           the host's own MB/s instead.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _CRYPTO_BENCH_H_
+#define _CRYPTO_BENCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define CRYPTO_BENCH_BYTES      1024u
+#define CRYPTO_BENCH_RUNS       4u
+
+typedef enum
+{
+    CRYPTO_BENCH_SHA256,
+    CRYPTO_BENCH_MD5,
+    CRYPTO_BENCH_AES128_ECB,
+    CRYPTO_BENCH_AES128_CBC,
+    CRYPTO_BENCH_AES128_CTR,
+    CRYPTO_BENCH_AES256_CBC,
+    CRYPTO_BENCH_OPS
+} crypto_bench_op_t;
+
+typedef struct
+{
+    const char *name[CRYPTO_BENCH_OPS];
+    uint32_t    cpu[CRYPTO_BENCH_OPS];      /**< best, per CRYPTO_BENCH_BYTES */
+    uint32_t    hw[CRYPTO_BENCH_OPS];       /**< 0 without CRYPTO_HW */
+    uint32_t    hw_min[CRYPTO_BENCH_OPS];   /**< 0: the engine never wins */
+} crypto_bench_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern crypto_bench_t g_crypto_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void crypto_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,648 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - Crypto
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     crypto_sw.c
+ * @author   insert authors names here
+ * @brief    Software SHA-256 (FIPS 180-4), MD5 (RFC 1321) and AES
+ *           (FIPS 197), see crypto_sw.h. \n
+ *           The AES state is kept as four big-endian column words, so
+ *           MixColumns is a handful of word operations per column.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common/crypto_sw.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define BLOCK               CRYPTO_HASH_BLOCK
+/** Where the bit length goes in the last block. */
+#define LENGTH_AT           (BLOCK - 8u)
+
+#define ROTL(x, n)          (((x) << (n)) | ((x) >> (32u - (n))))
+#define ROTR(x, n)          (((x) >> (n)) | ((x) << (32u - (n))))
+
+typedef void (*hash_block_t)(uint32_t *state, const uint8_t *block);
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const uint32_t s_sha256K[64] =
+{
+    0x428A2F98u, 0x71374491u, 0xB5C0FBCFu, 0xE9B5DBA5u,
+    0x3956C25Bu, 0x59F111F1u, 0x923F82A4u, 0xAB1C5ED5u,
+    0xD807AA98u, 0x12835B01u, 0x243185BEu, 0x550C7DC3u,
+    0x72BE5D74u, 0x80DEB1FEu, 0x9BDC06A7u, 0xC19BF174u,
+    0xE49B69C1u, 0xEFBE4786u, 0x0FC19DC6u, 0x240CA1CCu,
+    0x2DE92C6Fu, 0x4A7484AAu, 0x5CB0A9DCu, 0x76F988DAu,
+    0x983E5152u, 0xA831C66Du, 0xB00327C8u, 0xBF597FC7u,
+    0xC6E00BF3u, 0xD5A79147u, 0x06CA6351u, 0x14292967u,
+    0x27B70A85u, 0x2E1B2138u, 0x4D2C6DFCu, 0x53380D13u,
+    0x650A7354u, 0x766A0ABBu, 0x81C2C92Eu, 0x92722C85u,
+    0xA2BFE8A1u, 0xA81A664Bu, 0xC24B8B70u, 0xC76C51A3u,
+    0xD192E819u, 0xD6990624u, 0xF40E3585u, 0x106AA070u,
+    0x19A4C116u, 0x1E376C08u, 0x2748774Cu, 0x34B0BCB5u,
+    0x391C0CB3u, 0x4ED8AA4Au, 0x5B9CCA4Fu, 0x682E6FF3u,
+    0x748F82EEu, 0x78A5636Fu, 0x84C87814u, 0x8CC70208u,
+    0x90BEFFFAu, 0xA4506CEBu, 0xBEF9A3F7u, 0xC67178F2u,
+};
+
+static const uint32_t s_md5T[64] =
+{
+    0xD76AA478u, 0xE8C7B756u, 0x242070DBu, 0xC1BDCEEEu,
+    0xF57C0FAFu, 0x4787C62Au, 0xA8304613u, 0xFD469501u,
+    0x698098D8u, 0x8B44F7AFu, 0xFFFF5BB1u, 0x895CD7BEu,
+    0x6B901122u, 0xFD987193u, 0xA679438Eu, 0x49B40821u,
+    0xF61E2562u, 0xC040B340u, 0x265E5A51u, 0xE9B6C7AAu,
+    0xD62F105Du, 0x02441453u, 0xD8A1E681u, 0xE7D3FBC8u,
+    0x21E1CDE6u, 0xC33707D6u, 0xF4D50D87u, 0x455A14EDu,
+    0xA9E3E905u, 0xFCEFA3F8u, 0x676F02D9u, 0x8D2A4C8Au,
+    0xFFFA3942u, 0x8771F681u, 0x6D9D6122u, 0xFDE5380Cu,
+    0xA4BEEA44u, 0x4BDECFA9u, 0xF6BB4B60u, 0xBEBFBC70u,
+    0x289B7EC6u, 0xEAA127FAu, 0xD4EF3085u, 0x04881D05u,
+    0xD9D4D039u, 0xE6DB99E5u, 0x1FA27CF8u, 0xC4AC5665u,
+    0xF4292244u, 0x432AFF97u, 0xAB9423A7u, 0xFC93A039u,
+    0x655B59C3u, 0x8F0CCC92u, 0xFFEFF47Du, 0x85845DD1u,
+    0x6FA87E4Fu, 0xFE2CE6E0u, 0xA3014314u, 0x4E0811A1u,
+    0xF7537E82u, 0xBD3AF235u, 0x2AD7D2BBu, 0xEB86D391u,
+};
+
+static const uint8_t s_md5Shift[4][4] =
+{
+    { 7u, 12u, 17u, 22u },
+    { 5u,  9u, 14u, 20u },
+    { 4u, 11u, 16u, 23u },
+    { 6u, 10u, 15u, 21u },
+};
+
+static const uint8_t s_sbox[256] =
+{
+    0x63u, 0x7Cu, 0x77u, 0x7Bu, 0xF2u, 0x6Bu, 0x6Fu, 0xC5u,
+    0x30u, 0x01u, 0x67u, 0x2Bu, 0xFEu, 0xD7u, 0xABu, 0x76u,
+    0xCAu, 0x82u, 0xC9u, 0x7Du, 0xFAu, 0x59u, 0x47u, 0xF0u,
+    0xADu, 0xD4u, 0xA2u, 0xAFu, 0x9Cu, 0xA4u, 0x72u, 0xC0u,
+    0xB7u, 0xFDu, 0x93u, 0x26u, 0x36u, 0x3Fu, 0xF7u, 0xCCu,
+    0x34u, 0xA5u, 0xE5u, 0xF1u, 0x71u, 0xD8u, 0x31u, 0x15u,
+    0x04u, 0xC7u, 0x23u, 0xC3u, 0x18u, 0x96u, 0x05u, 0x9Au,
+    0x07u, 0x12u, 0x80u, 0xE2u, 0xEBu, 0x27u, 0xB2u, 0x75u,
+    0x09u, 0x83u, 0x2Cu, 0x1Au, 0x1Bu, 0x6Eu, 0x5Au, 0xA0u,
+    0x52u, 0x3Bu, 0xD6u, 0xB3u, 0x29u, 0xE3u, 0x2Fu, 0x84u,
+    0x53u, 0xD1u, 0x00u, 0xEDu, 0x20u, 0xFCu, 0xB1u, 0x5Bu,
+    0x6Au, 0xCBu, 0xBEu, 0x39u, 0x4Au, 0x4Cu, 0x58u, 0xCFu,
+    0xD0u, 0xEFu, 0xAAu, 0xFBu, 0x43u, 0x4Du, 0x33u, 0x85u,
+    0x45u, 0xF9u, 0x02u, 0x7Fu, 0x50u, 0x3Cu, 0x9Fu, 0xA8u,
+    0x51u, 0xA3u, 0x40u, 0x8Fu, 0x92u, 0x9Du, 0x38u, 0xF5u,
+    0xBCu, 0xB6u, 0xDAu, 0x21u, 0x10u, 0xFFu, 0xF3u, 0xD2u,
+    0xCDu, 0x0Cu, 0x13u, 0xECu, 0x5Fu, 0x97u, 0x44u, 0x17u,
+    0xC4u, 0xA7u, 0x7Eu, 0x3Du, 0x64u, 0x5Du, 0x19u, 0x73u,
+    0x60u, 0x81u, 0x4Fu, 0xDCu, 0x22u, 0x2Au, 0x90u, 0x88u,
+    0x46u, 0xEEu, 0xB8u, 0x14u, 0xDEu, 0x5Eu, 0x0Bu, 0xDBu,
+    0xE0u, 0x32u, 0x3Au, 0x0Au, 0x49u, 0x06u, 0x24u, 0x5Cu,
+    0xC2u, 0xD3u, 0xACu, 0x62u, 0x91u, 0x95u, 0xE4u, 0x79u,
+    0xE7u, 0xC8u, 0x37u, 0x6Du, 0x8Du, 0xD5u, 0x4Eu, 0xA9u,
+    0x6Cu, 0x56u, 0xF4u, 0xEAu, 0x65u, 0x7Au, 0xAEu, 0x08u,
+    0xBAu, 0x78u, 0x25u, 0x2Eu, 0x1Cu, 0xA6u, 0xB4u, 0xC6u,
+    0xE8u, 0xDDu, 0x74u, 0x1Fu, 0x4Bu, 0xBDu, 0x8Bu, 0x8Au,
+    0x70u, 0x3Eu, 0xB5u, 0x66u, 0x48u, 0x03u, 0xF6u, 0x0Eu,
+    0x61u, 0x35u, 0x57u, 0xB9u, 0x86u, 0xC1u, 0x1Du, 0x9Eu,
+    0xE1u, 0xF8u, 0x98u, 0x11u, 0x69u, 0xD9u, 0x8Eu, 0x94u,
+    0x9Bu, 0x1Eu, 0x87u, 0xE9u, 0xCEu, 0x55u, 0x28u, 0xDFu,
+    0x8Cu, 0xA1u, 0x89u, 0x0Du, 0xBFu, 0xE6u, 0x42u, 0x68u,
+    0x41u, 0x99u, 0x2Du, 0x0Fu, 0xB0u, 0x54u, 0xBBu, 0x16u,
+};
+
+static const uint8_t s_invSbox[256] =
+{
+    0x52u, 0x09u, 0x6Au, 0xD5u, 0x30u, 0x36u, 0xA5u, 0x38u,
+    0xBFu, 0x40u, 0xA3u, 0x9Eu, 0x81u, 0xF3u, 0xD7u, 0xFBu,
+    0x7Cu, 0xE3u, 0x39u, 0x82u, 0x9Bu, 0x2Fu, 0xFFu, 0x87u,
+    0x34u, 0x8Eu, 0x43u, 0x44u, 0xC4u, 0xDEu, 0xE9u, 0xCBu,
+    0x54u, 0x7Bu, 0x94u, 0x32u, 0xA6u, 0xC2u, 0x23u, 0x3Du,
+    0xEEu, 0x4Cu, 0x95u, 0x0Bu, 0x42u, 0xFAu, 0xC3u, 0x4Eu,
+    0x08u, 0x2Eu, 0xA1u, 0x66u, 0x28u, 0xD9u, 0x24u, 0xB2u,
+    0x76u, 0x5Bu, 0xA2u, 0x49u, 0x6Du, 0x8Bu, 0xD1u, 0x25u,
+    0x72u, 0xF8u, 0xF6u, 0x64u, 0x86u, 0x68u, 0x98u, 0x16u,
+    0xD4u, 0xA4u, 0x5Cu, 0xCCu, 0x5Du, 0x65u, 0xB6u, 0x92u,
+    0x6Cu, 0x70u, 0x48u, 0x50u, 0xFDu, 0xEDu, 0xB9u, 0xDAu,
+    0x5Eu, 0x15u, 0x46u, 0x57u, 0xA7u, 0x8Du, 0x9Du, 0x84u,
+    0x90u, 0xD8u, 0xABu, 0x00u, 0x8Cu, 0xBCu, 0xD3u, 0x0Au,
+    0xF7u, 0xE4u, 0x58u, 0x05u, 0xB8u, 0xB3u, 0x45u, 0x06u,
+    0xD0u, 0x2Cu, 0x1Eu, 0x8Fu, 0xCAu, 0x3Fu, 0x0Fu, 0x02u,
+    0xC1u, 0xAFu, 0xBDu, 0x03u, 0x01u, 0x13u, 0x8Au, 0x6Bu,
+    0x3Au, 0x91u, 0x11u, 0x41u, 0x4Fu, 0x67u, 0xDCu, 0xEAu,
+    0x97u, 0xF2u, 0xCFu, 0xCEu, 0xF0u, 0xB4u, 0xE6u, 0x73u,
+    0x96u, 0xACu, 0x74u, 0x22u, 0xE7u, 0xADu, 0x35u, 0x85u,
+    0xE2u, 0xF9u, 0x37u, 0xE8u, 0x1Cu, 0x75u, 0xDFu, 0x6Eu,
+    0x47u, 0xF1u, 0x1Au, 0x71u, 0x1Du, 0x29u, 0xC5u, 0x89u,
+    0x6Fu, 0xB7u, 0x62u, 0x0Eu, 0xAAu, 0x18u, 0xBEu, 0x1Bu,
+    0xFCu, 0x56u, 0x3Eu, 0x4Bu, 0xC6u, 0xD2u, 0x79u, 0x20u,
+    0x9Au, 0xDBu, 0xC0u, 0xFEu, 0x78u, 0xCDu, 0x5Au, 0xF4u,
+    0x1Fu, 0xDDu, 0xA8u, 0x33u, 0x88u, 0x07u, 0xC7u, 0x31u,
+    0xB1u, 0x12u, 0x10u, 0x59u, 0x27u, 0x80u, 0xECu, 0x5Fu,
+    0x60u, 0x51u, 0x7Fu, 0xA9u, 0x19u, 0xB5u, 0x4Au, 0x0Du,
+    0x2Du, 0xE5u, 0x7Au, 0x9Fu, 0x93u, 0xC9u, 0x9Cu, 0xEFu,
+    0xA0u, 0xE0u, 0x3Bu, 0x4Du, 0xAEu, 0x2Au, 0xF5u, 0xB0u,
+    0xC8u, 0xEBu, 0xBBu, 0x3Cu, 0x83u, 0x53u, 0x99u, 0x61u,
+    0x17u, 0x2Bu, 0x04u, 0x7Eu, 0xBAu, 0x77u, 0xD6u, 0x26u,
+    0xE1u, 0x69u, 0x14u, 0x63u, 0x55u, 0x21u, 0x0Cu, 0x7Du,
+};
+
+static const uint8_t s_rcon[10] =
+{
+    0x01u, 0x02u, 0x04u, 0x08u, 0x10u, 0x20u, 0x40u, 0x80u, 0x1Bu, 0x36u,
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t load_be(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void store_be(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static uint32_t load_le(const uint8_t *p)
+{
+    return ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[1] << 8) | (uint32_t)p[0];
+}
+
+static void store_le(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/*------------------------------------------------------------------------------
+ *      Hashes
+ *------------------------------------------------------------------------------*/
+static void hash_update(crypto_hash_sw_t *ctx, hash_block_t fn,
+                        const uint8_t *data, uint32_t len)
+{
+    ctx->bytes += len;
+    if (ctx->used != 0u)
+    {
+        uint32_t take = BLOCK - ctx->used;
+
+        if (take > len)
+        {
+            take = len;
+        }
+        memcpy(&ctx->block[ctx->used], data, take);
+        ctx->used += take;
+        data += take;
+        len -= take;
+        if (ctx->used < BLOCK)
+        {
+            return;
+        }
+        fn(ctx->state, ctx->block);
+        ctx->used = 0u;
+    }
+    while (len >= BLOCK)
+    {
+        fn(ctx->state, data);
+        data += BLOCK;
+        len -= BLOCK;
+    }
+    memcpy(ctx->block, data, len);
+    ctx->used = len;
+}
+
+/** Appends 0x80, zeros and the bit length, and hashes the last block(s). */
+static void hash_pad(crypto_hash_sw_t *ctx, hash_block_t fn, bool bigEndian)
+{
+    uint64_t bits = ctx->bytes * 8u;
+    uint32_t i;
+
+    ctx->block[ctx->used++] = 0x80u;
+    if (ctx->used > LENGTH_AT)
+    {
+        memset(&ctx->block[ctx->used], 0, BLOCK - ctx->used);
+        fn(ctx->state, ctx->block);
+        ctx->used = 0u;
+    }
+    memset(&ctx->block[ctx->used], 0, LENGTH_AT - ctx->used);
+    for (i = 0; i < 8u; i++)
+    {
+        ctx->block[LENGTH_AT + i] = (uint8_t)(bigEndian ? (bits >> (56u - 8u * i))
+                                                        : (bits >> (8u * i)));
+    }
+    fn(ctx->state, ctx->block);
+    ctx->used = 0u;
+}
+
+/** One SHA-256 block, with the message schedule in a 16 word ring. */
+static void sha256_block(uint32_t *state, const uint8_t *block)
+{
+    uint32_t w[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    uint32_t i;
+
+    for (i = 0; i < 64u; i++)
+    {
+        uint32_t t1;
+        uint32_t t2;
+
+        if (i < 16u)
+        {
+            w[i] = load_be(&block[4u * i]);
+        }
+        else
+        {
+            uint32_t w15 = w[(i - 15u) & 15u];
+            uint32_t w2 = w[(i - 2u) & 15u];
+
+            w[i & 15u] += (ROTR(w15, 7u) ^ ROTR(w15, 18u) ^ (w15 >> 3)) +
+                          w[(i - 7u) & 15u] +
+                          (ROTR(w2, 17u) ^ ROTR(w2, 19u) ^ (w2 >> 10));
+        }
+        t1 = h + (ROTR(e, 6u) ^ ROTR(e, 11u) ^ ROTR(e, 25u)) +
+             ((e & f) ^ (~e & g)) + s_sha256K[i] + w[i & 15u];
+        t2 = (ROTR(a, 2u) ^ ROTR(a, 13u) ^ ROTR(a, 22u)) +
+             ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void md5_block(uint32_t *state, const uint8_t *block)
+{
+    uint32_t x[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t i;
+
+    for (i = 0; i < 16u; i++)
+    {
+        x[i] = load_le(&block[4u * i]);
+    }
+    for (i = 0; i < 64u; i++)
+    {
+        uint32_t round = i / 16u;
+        uint32_t f;
+        uint32_t k;
+        uint32_t t;
+
+        switch (round)
+        {
+        case 0:
+            f = (b & c) | (~b & d);
+            k = i;
+            break;
+        case 1:
+            f = (d & b) | (~d & c);
+            k = (5u * i + 1u) & 15u;
+            break;
+        case 2:
+            f = b ^ c ^ d;
+            k = (3u * i + 5u) & 15u;
+            break;
+        default:
+            f = c ^ (b | ~d);
+            k = (7u * i) & 15u;
+            break;
+        }
+        t = a + f + s_md5T[i] + x[k];
+        a = d;
+        d = c;
+        c = b;
+        b += ROTL(t, (uint32_t)s_md5Shift[round][i & 3u]);
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+void crypto_sha256_init(crypto_hash_sw_t *ctx)
+{
+    static const uint32_t h0[8] =
+    {
+        0x6A09E667u, 0xBB67AE85u, 0x3C6EF372u, 0xA54FF53Au,
+        0x510E527Fu, 0x9B05688Cu, 0x1F83D9ABu, 0x5BE0CD19u,
+    };
+
+    memcpy(ctx->state, h0, sizeof(h0));
+    ctx->bytes = 0u;
+    ctx->used = 0u;
+}
+
+void crypto_sha256_update(crypto_hash_sw_t *ctx, const void *data, uint32_t len)
+{
+    hash_update(ctx, sha256_block, (const uint8_t *)data, len);
+}
+
+void crypto_sha256_final(crypto_hash_sw_t *ctx, uint8_t digest[CRYPTO_SHA256_BYTES])
+{
+    uint32_t i;
+
+    hash_pad(ctx, sha256_block, true);
+    for (i = 0; i < 8u; i++)
+    {
+        store_be(&digest[4u * i], ctx->state[i]);
+    }
+}
+
+void crypto_md5_init(crypto_hash_sw_t *ctx)
+{
+    ctx->state[0] = 0x67452301u;
+    ctx->state[1] = 0xEFCDAB89u;
+    ctx->state[2] = 0x98BADCFEu;
+    ctx->state[3] = 0x10325476u;
+    ctx->bytes = 0u;
+    ctx->used = 0u;
+}
+
+void crypto_md5_update(crypto_hash_sw_t *ctx, const void *data, uint32_t len)
+{
+    hash_update(ctx, md5_block, (const uint8_t *)data, len);
+}
+
+void crypto_md5_final(crypto_hash_sw_t *ctx, uint8_t digest[CRYPTO_MD5_BYTES])
+{
+    uint32_t i;
+
+    hash_pad(ctx, md5_block, false);
+    for (i = 0; i < 4u; i++)
+    {
+        store_le(&digest[4u * i], ctx->state[i]);
+    }
+}
+
+/*------------------------------------------------------------------------------
+ *      AES
+ *------------------------------------------------------------------------------*/
+static uint32_t sub_word(uint32_t w)
+{
+    return ((uint32_t)s_sbox[w >> 24] << 24) |
+           ((uint32_t)s_sbox[(w >> 16) & 0xFFu] << 16) |
+           ((uint32_t)s_sbox[(w >> 8) & 0xFFu] << 8) |
+           (uint32_t)s_sbox[w & 0xFFu];
+}
+
+/** Doubles the four bytes of @p x in GF(2^8). */
+static uint32_t xtime4(uint32_t x)
+{
+    return ((x & 0x7F7F7F7Fu) << 1) ^ (((x >> 7) & 0x01010101u) * 0x1Bu);
+}
+
+/** MixColumns of one column (first row in the top byte). */
+static uint32_t mix_column(uint32_t w)
+{
+    uint32_t r = ROTL(w, 8u);
+
+    return xtime4(w ^ r) ^ r ^ ROTL(w, 16u) ^ ROTL(w, 24u);
+}
+
+/** InvMixColumns: a multiply by {04}{00}{05}{00} turns it into MixColumns. */
+static uint32_t inv_mix_column(uint32_t w)
+{
+    return mix_column(w ^ xtime4(xtime4(w ^ ROTL(w, 16u))));
+}
+
+/**
+ * Expands an AES key.
+ *
+ * @param[in] keyBytes - 16, 24 or 32
+ * @returns bool - false for any other key length
+ */
+bool crypto_aes_sw_key(crypto_aes_sw_t *ctx, const uint8_t *key, uint32_t keyBytes)
+{
+    uint32_t nk = keyBytes / 4u;
+    uint32_t words;
+    uint32_t i;
+
+    if (keyBytes != 16u && keyBytes != 24u && keyBytes != 32u)
+    {
+        return false;
+    }
+    ctx->rounds = nk + 6u;
+    words = 4u * (ctx->rounds + 1u);
+    for (i = 0; i < nk; i++)
+    {
+        ctx->rk[i] = load_be(&key[4u * i]);
+    }
+    for (; i < words; i++)
+    {
+        uint32_t t = ctx->rk[i - 1u];
+
+        if (i % nk == 0u)
+        {
+            t = sub_word(ROTL(t, 8u)) ^ ((uint32_t)s_rcon[i / nk - 1u] << 24);
+        }
+        else if (nk > 6u && i % nk == 4u)
+        {
+            t = sub_word(t);
+        }
+        ctx->rk[i] = ctx->rk[i - nk] ^ t;
+    }
+    return true;
+}
+
+void crypto_aes_sw_encrypt(const crypto_aes_sw_t *ctx, const uint8_t in[16],
+                           uint8_t out[16])
+{
+    const uint32_t *rk = ctx->rk;
+    uint32_t s[4];
+    uint32_t t[4];
+    uint32_t round;
+    uint32_t c;
+
+    for (c = 0; c < 4u; c++)
+    {
+        s[c] = load_be(&in[4u * c]) ^ rk[c];
+    }
+    for (round = 1u; round <= ctx->rounds; round++)
+    {
+        rk += 4;
+        for (c = 0; c < 4u; c++)
+        {
+            /* SubBytes and ShiftRows: row r comes from column c + r */
+            t[c] = ((uint32_t)s_sbox[s[c] >> 24] << 24) |
+                   ((uint32_t)s_sbox[(s[(c + 1u) & 3u] >> 16) & 0xFFu] << 16) |
+                   ((uint32_t)s_sbox[(s[(c + 2u) & 3u] >> 8) & 0xFFu] << 8) |
+                   (uint32_t)s_sbox[s[(c + 3u) & 3u] & 0xFFu];
+        }
+        for (c = 0; c < 4u; c++)
+        {
+            s[c] = (round < ctx->rounds ? mix_column(t[c]) : t[c]) ^ rk[c];
+        }
+    }
+    for (c = 0; c < 4u; c++)
+    {
+        store_be(&out[4u * c], s[c]);
+    }
+}
+
+void crypto_aes_sw_decrypt(const crypto_aes_sw_t *ctx, const uint8_t in[16],
+                           uint8_t out[16])
+{
+    const uint32_t *rk = &ctx->rk[4u * ctx->rounds];
+    uint32_t s[4];
+    uint32_t t[4];
+    uint32_t round;
+    uint32_t c;
+
+    for (c = 0; c < 4u; c++)
+    {
+        s[c] = load_be(&in[4u * c]) ^ rk[c];
+    }
+    for (round = ctx->rounds; round >= 1u; round--)
+    {
+        rk -= 4;
+        for (c = 0; c < 4u; c++)
+        {
+            /* InvShiftRows and InvSubBytes: row r comes from column c - r */
+            t[c] = ((uint32_t)s_invSbox[s[c] >> 24] << 24) |
+                   ((uint32_t)s_invSbox[(s[(c + 3u) & 3u] >> 16) & 0xFFu] << 16) |
+                   ((uint32_t)s_invSbox[(s[(c + 2u) & 3u] >> 8) & 0xFFu] << 8) |
+                   (uint32_t)s_invSbox[s[(c + 1u) & 3u] & 0xFFu];
+        }
+        for (c = 0; c < 4u; c++)
+        {
+            s[c] = t[c] ^ rk[c];
+            if (round > 1u)
+            {
+                s[c] = inv_mix_column(s[c]);
+            }
+        }
+    }
+    for (c = 0; c < 4u; c++)
+    {
+        store_be(&out[4u * c], s[c]);
+    }
+}
+
+/** @param[in] len - a multiple of CRYPTO_AES_BLOCK */
+void crypto_aes_sw_ecb(const crypto_aes_sw_t *ctx, bool decrypt,
+                       const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i + CRYPTO_AES_BLOCK <= len; i += CRYPTO_AES_BLOCK)
+    {
+        if (decrypt)
+        {
+            crypto_aes_sw_decrypt(ctx, &in[i], &out[i]);
+        }
+        else
+        {
+            crypto_aes_sw_encrypt(ctx, &in[i], &out[i]);
+        }
+    }
+}
+
+/**
+ * @param[in,out] iv  - left at the last ciphertext block, for the next piece
+ * @param[in]     len - a multiple of CRYPTO_AES_BLOCK; in may equal out
+ */
+void crypto_aes_sw_cbc(const crypto_aes_sw_t *ctx, bool decrypt, uint8_t iv[16],
+                       const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint8_t block[CRYPTO_AES_BLOCK];
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i + CRYPTO_AES_BLOCK <= len; i += CRYPTO_AES_BLOCK)
+    {
+        if (decrypt)
+        {
+            memcpy(block, &in[i], CRYPTO_AES_BLOCK);
+            crypto_aes_sw_decrypt(ctx, block, &out[i]);
+            for (j = 0; j < CRYPTO_AES_BLOCK; j++)
+            {
+                out[i + j] ^= iv[j];
+            }
+            memcpy(iv, block, CRYPTO_AES_BLOCK);
+        }
+        else
+        {
+            for (j = 0; j < CRYPTO_AES_BLOCK; j++)
+            {
+                block[j] = in[i + j] ^ iv[j];
+            }
+            crypto_aes_sw_encrypt(ctx, block, &out[i]);
+            memcpy(iv, &out[i], CRYPTO_AES_BLOCK);
+        }
+    }
+}
+
+/**
+ * Counter mode with a 128 bit big-endian counter; encrypts and decrypts.
+ *
+ * @param[in,out] counter - left at the next unused block; a tail shorter
+ *                          than a block uses up its whole block
+ */
+void crypto_aes_sw_ctr(const crypto_aes_sw_t *ctx, uint8_t counter[16],
+                       const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint8_t stream[CRYPTO_AES_BLOCK];
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < len; i += CRYPTO_AES_BLOCK)
+    {
+        uint32_t n = (len - i < CRYPTO_AES_BLOCK) ? len - i : CRYPTO_AES_BLOCK;
+
+        crypto_aes_sw_encrypt(ctx, counter, stream);
+        for (j = 0; j < n; j++)
+        {
+            out[i + j] = in[i + j] ^ stream[j];
+        }
+        for (j = CRYPTO_AES_BLOCK; j > 0u; j--)
+        {
+            if (++counter[j - 1u] != 0u)
+            {
+                break;
+            }
+        }
+    }
+}
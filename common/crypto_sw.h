@@ -0,0 +1,95 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - Crypto
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     crypto_sw.h
+ * @author   insert authors names here
+ * @brief    Portable SHA-256, MD5 and AES (128, 192 and 256 bit keys). \n
+ *           The reference the crypto.h engine falls back to, plain C that
+ *           also builds on the host for the test vectors. Hashes are
+ *           streamed: init, update with any number of bytes, final. AES
+ *           works on 16 byte blocks; the ECB, CBC and CTR helpers take
+ *           whole blocks except CTR, which takes any length. The CBC and
+ *           CTR helpers update iv, so a message may be cut into pieces.
+ *           No table is larger than the 256 byte S-boxes: slower than a
+ *           T-table AES, but it fits any RAM and runs from flash.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _CRYPTO_SW_H_
+#define _CRYPTO_SW_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define CRYPTO_SHA256_BYTES     32u     /**< digest */
+#define CRYPTO_MD5_BYTES        16u     /**< digest */
+#define CRYPTO_HASH_BLOCK       64u     /**< both hashes */
+#define CRYPTO_AES_BLOCK        16u
+#define CRYPTO_AES_MAX_ROUNDS   14u
+
+typedef struct
+{
+    uint32_t state[8];          /**< MD5 uses the first 4 */
+    uint64_t bytes;             /**< hashed so far */
+    uint32_t used;              /**< bytes waiting in block */
+    uint8_t  block[CRYPTO_HASH_BLOCK];
+} crypto_hash_sw_t;
+
+typedef struct
+{
+    uint32_t rounds;            /**< 10, 12 or 14 */
+    uint32_t rk[4u * (CRYPTO_AES_MAX_ROUNDS + 1u)];   /**< round keys */
+} crypto_aes_sw_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void crypto_sha256_init(crypto_hash_sw_t *ctx);
+void crypto_sha256_update(crypto_hash_sw_t *ctx, const void *data, uint32_t len);
+void crypto_sha256_final(crypto_hash_sw_t *ctx, uint8_t digest[CRYPTO_SHA256_BYTES]);
+
+void crypto_md5_init(crypto_hash_sw_t *ctx);
+void crypto_md5_update(crypto_hash_sw_t *ctx, const void *data, uint32_t len);
+void crypto_md5_final(crypto_hash_sw_t *ctx, uint8_t digest[CRYPTO_MD5_BYTES]);
+
+bool crypto_aes_sw_key(crypto_aes_sw_t *ctx, const uint8_t *key, uint32_t keyBytes);
+void crypto_aes_sw_encrypt(const crypto_aes_sw_t *ctx, const uint8_t in[16],
+                           uint8_t out[16]);
+void crypto_aes_sw_decrypt(const crypto_aes_sw_t *ctx, const uint8_t in[16],
+                           uint8_t out[16]);
+
+void crypto_aes_sw_ecb(const crypto_aes_sw_t *ctx, bool decrypt,
+                       const uint8_t *in, uint8_t *out, uint32_t len);
+void crypto_aes_sw_cbc(const crypto_aes_sw_t *ctx, bool decrypt, uint8_t iv[16],
+                       const uint8_t *in, uint8_t *out, uint32_t len);
+void crypto_aes_sw_ctr(const crypto_aes_sw_t *ctx, uint8_t counter[16],
+                       const uint8_t *in, uint8_t *out, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
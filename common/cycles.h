@@ -0,0 +1,70 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - cycle counter
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     cycles.h
+ * @author   insert authors names here
+ * @brief    Core cycle counter for benchmarks. \n
+ *           On the target it is the DWT cycle counter (CYCCNT); on the host
+ *           build it is the simulated cycle count, so the same benchmark code
+ *           reports measured cycles on the board and modelled ones on Linux.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _CYCLES_H_
+#define _CYCLES_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+#include "host/sim/sim.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define CYC_DEMCR           (*(volatile uint32_t *)0xE000EDFCu)
+#define CYC_DEMCR_TRCENA    0x01000000u
+#define CYC_DWT_CTRL        (*(volatile uint32_t *)0xE0001000u)
+#define CYC_DWT_CTRL_CYCENA 0x00000001u
+#define CYC_DWT_CYCCNT      (*(volatile uint32_t *)0xE0001004u)
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+/** Enables and clears the cycle counter. */
+static inline void cycles_init(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    CYC_DEMCR |= CYC_DEMCR_TRCENA;
+    CYC_DWT_CYCCNT = 0u;
+    CYC_DWT_CTRL |= CYC_DWT_CTRL_CYCENA;
+#endif
+}
+
+/** Current cycle count; wraps every 2^32 cycles (35.8 s at 120 MHz). */
+static inline uint32_t cycles_now(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return CYC_DWT_CYCCNT;
+#else
+    return (uint32_t)g_sim.cycles;
+#endif
+}
+
+#endif
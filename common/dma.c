@@ -0,0 +1,75 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - uDMA
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dma.c
+ * @author   insert authors names here
+ * @brief    Shared uDMA control table and controller start-up (see dma.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+#include "common/dma.h"
+#include "common/boot.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * The controller needs the table aligned to its 1 KiB size. Only the
+ * entries of enabled channels are read, and those are written first.
+ */
+#if defined(__IAR_SYSTEMS_ICC__)
+#pragma data_alignment=1024
+#endif
+BOOT_NOINIT tDMAControlTable g_dma_table[DMA_TABLE_ENTRIES];
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static bool s_ready;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Enables the uDMA controller with g_dma_table. Only the first call does
+ * anything; later ones return at once.
+ */
+void dma_init(void)
+{
+    if (s_ready)
+    {
+        return;
+    }
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA))
+    {
+    }
+    uDMAEnable();
+    uDMAControlBaseSet(g_dma_table);
+    s_ready = true;
+}
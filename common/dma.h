@@ -0,0 +1,64 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - uDMA
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dma.h
+ * @author   insert authors names here
+ * @brief    Shared uDMA set-up. \n
+ *           The uDMA has one control table for all channels; every driver
+ *           that uses a channel calls dma_init() first, which enables the
+ *           controller and points it at g_dma_table once. Drivers then
+ *           configure their own channels with the driverlib uDMA API.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _DMA_H_
+#define _DMA_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "driverlib/udma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Primary and alternate structures of 32 channels. */
+#define DMA_TABLE_ENTRIES   64u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern tDMAControlTable g_dma_table[DMA_TABLE_ENTRIES];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void dma_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
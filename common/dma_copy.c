@@ -0,0 +1,592 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - uDMA copy engine
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dma_copy.c
+ * @author   insert authors names here
+ * @brief    Asynchronous copies and fills on the uDMA, see dma_copy.h. \n
+ *           Each pooled channel owns a job and a task list. A round cuts
+ *           up to DMA_COPY_TASKS pieces off the job: one piece is sent as
+ *           an AUTO transfer, more as a memory scatter-gather list. The
+ *           completion interrupt starts the next round, or calls done() and
+ *           gives the channel to the oldest queued job. Jobs are copied
+ *           into the pool, so the caller's job needs no storage; the job
+ *           lists and the queue are only touched with interrupts masked.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+#include "common/dma.h"
+#include "common/dma_copy.h"
+#include "common/vtable.h"
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+#include "host/sim/sim.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Items of one uDMA transfer (XFERSIZE is 10 bits). */
+#define MAX_ITEMS           1024u
+#define ARB                 UDMA_ARB_8
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+/** Modelled cost of the library memcpy()/memset(): call and return, then
+    LDM/STM bursts of 8 words, or one byte per 4 cycles when source and
+    destination are not mutually word aligned. */
+#define CPU_CALL_CYCLES     12u
+#define CPU_COPY_32B_CYCLES 20u
+#define CPU_FILL_32B_CYCLES 10u
+#define CPU_BYTE_CYCLES     4u
+#endif
+
+/** A job: the segments still to copy, or a fill. */
+typedef struct
+{
+    dma_copy_done_t  done;
+    void            *arg;
+    const dma_seg_t *segs;      /**< NULL: the single segment one */
+    uint32_t         count;
+    uint32_t         seg;       /**< segment in progress */
+    uint32_t         offset;    /**< its bytes already handed to the uDMA */
+    dma_seg_t        one;
+    uint32_t         pattern;   /**< dma_fill(): the byte, 4 times; uDMA source */
+    bool             fill;
+} job_t;
+
+/** One transfer of a round. */
+typedef struct
+{
+    uint32_t  items;
+    uint32_t  size;             /**< UDMA_SIZE_x */
+    uint32_t  srcInc;           /**< UDMA_SRC_INC_x */
+    uint32_t  dstInc;           /**< UDMA_DST_INC_x */
+    void     *src;
+    void     *dst;
+} piece_t;
+
+typedef struct
+{
+    uint32_t         channel;
+    bool             busy;
+    job_t            job;
+    tDMAControlTable tasks[DMA_COPY_TASKS];
+} slot_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+dma_copy_stats_t g_dma_copy;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const uint32_t s_channels[DMA_COPY_CHANNELS] = DMA_COPY_CHANNEL_LIST;
+
+static slot_t   s_slots[DMA_COPY_CHANNELS];
+static uint32_t s_poolMask;
+static job_t    s_queue[DMA_COPY_QUEUE];
+static uint32_t s_queueHead;            /**< jobs ever queued */
+static uint32_t s_queueTail;            /**< jobs ever dequeued */
+static uint32_t s_minBytes = DMA_COPY_MIN_BYTES;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** The CPU path; on the host, charges the modelled library cost. */
+static void cpu_copy(void *dst, const void *src, uint8_t value, uint32_t len,
+                     bool fill)
+{
+#if !defined(__IAR_SYSTEMS_ICC__)
+    uint32_t cycles = CPU_CALL_CYCLES;
+
+    if (fill)
+    {
+        cycles += (len / 32u) * CPU_FILL_32B_CYCLES + (len % 32u);
+    }
+    else if ((((uintptr_t)dst ^ (uintptr_t)src) & 3u) == 0u)
+    {
+        cycles += (len / 32u) * CPU_COPY_32B_CYCLES + 2u * (len % 32u);
+    }
+    else
+    {
+        cycles += len * CPU_BYTE_CYCLES;
+    }
+    sim_charge(cycles, 0, 0);
+#endif
+    if (fill)
+    {
+        memset(dst, value, len);
+    }
+    else
+    {
+        memcpy(dst, src, len);
+    }
+    g_dma_copy.cpu_jobs++;
+    g_dma_copy.cpu_bytes += len;
+}
+
+static const dma_seg_t *job_segs(const job_t *job)
+{
+    return (job->segs != NULL) ? job->segs : &job->one;
+}
+
+/** @returns bool - true when every byte of @p job was handed to the uDMA */
+static bool job_finished(job_t *job)
+{
+    const dma_seg_t *segs = job_segs(job);
+
+    while (job->seg < job->count && job->offset == segs[job->seg].len)
+    {
+        job->seg++;
+        job->offset = 0u;
+    }
+    return job->seg == job->count;
+}
+
+/**
+ * Cuts the next piece off @p job: the widest items that source and
+ * destination alignment allow, a byte or halfword first when that brings
+ * both to a wider alignment.
+ */
+static void next_piece(job_t *job, piece_t *piece)
+{
+    const dma_seg_t *seg = &job_segs(job)[job->seg];
+    uint32_t rem = seg->len - job->offset;
+    uintptr_t d = (uintptr_t)seg->dst + job->offset;
+    uintptr_t s = job->fill ? d : (uintptr_t)seg->src + job->offset;
+    uint32_t mis = (uint32_t)(d ^ s) & 3u;
+    uint32_t bytes;
+
+    if ((d & 3u) == 0u && mis == 0u && rem >= 4u)
+    {
+        bytes = 4u;
+        piece->items = rem / 4u;
+        piece->size = UDMA_SIZE_32;
+        piece->srcInc = UDMA_SRC_INC_32;
+        piece->dstInc = UDMA_DST_INC_32;
+    }
+    else if ((d & 1u) == 0u && (mis & 1u) == 0u && rem >= 2u)
+    {
+        bytes = 2u;
+        piece->items = (mis == 0u) ? 1u : rem / 2u;
+        piece->size = UDMA_SIZE_16;
+        piece->srcInc = UDMA_SRC_INC_16;
+        piece->dstInc = UDMA_DST_INC_16;
+    }
+    else
+    {
+        bytes = 1u;
+        piece->items = ((mis & 1u) == 0u) ? 1u : rem;
+        piece->size = UDMA_SIZE_8;
+        piece->srcInc = UDMA_SRC_INC_8;
+        piece->dstInc = UDMA_DST_INC_8;
+    }
+    if (piece->items > MAX_ITEMS)
+    {
+        piece->items = MAX_ITEMS;
+    }
+    piece->dst = (void *)d;
+    if (job->fill)
+    {
+        piece->src = &job->pattern;
+        piece->srcInc = UDMA_SRC_INC_NONE;
+    }
+    else
+    {
+        piece->src = (void *)s;
+    }
+    job->offset += piece->items * bytes;
+}
+
+/** Hands the next round of the slot's job to its channel. */
+static void start_round(slot_t *slot)
+{
+    piece_t pieces[DMA_COPY_TASKS];
+    uint32_t count = 0u;
+    uint32_t i;
+
+    while (count < DMA_COPY_TASKS && !job_finished(&slot->job))
+    {
+        next_piece(&slot->job, &pieces[count]);
+        g_dma_copy.dma_bytes += pieces[count].items *
+                                (1u << (pieces[count].size >> 28));
+        count++;
+    }
+    g_dma_copy.rounds++;
+
+    if (count == 1u)
+    {
+        uDMAChannelControlSet(slot->channel | UDMA_PRI_SELECT,
+                              pieces[0].size | pieces[0].srcInc |
+                              pieces[0].dstInc | ARB);
+        uDMAChannelTransferSet(slot->channel | UDMA_PRI_SELECT,
+                               UDMA_MODE_AUTO, pieces[0].src, pieces[0].dst,
+                               pieces[0].items);
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+        {
+            slot->tasks[i] = (tDMAControlTable)uDMATaskStructEntry(
+                pieces[i].items, pieces[i].size, pieces[i].srcInc,
+                pieces[i].src, pieces[i].dstInc, pieces[i].dst, ARB,
+                (i + 1u == count) ? UDMA_MODE_AUTO
+                                  : UDMA_MODE_MEM_SCATTER_GATHER);
+        }
+        uDMAChannelScatterGatherSet(slot->channel, count, slot->tasks, 0);
+    }
+    uDMAChannelEnable(slot->channel);
+    uDMAChannelRequest(slot->channel);
+}
+
+/**
+ * Ends the slot's job, gives the slot to the oldest queued job, then
+ * calls done(): it may start another copy. Interrupts masked.
+ */
+static void finish(slot_t *slot, bool ok)
+{
+    dma_copy_done_t done = slot->job.done;
+    void *arg = slot->job.arg;
+
+    if (s_queueTail != s_queueHead)
+    {
+        slot->job = s_queue[s_queueTail % DMA_COPY_QUEUE];
+        s_queueTail++;
+        start_round(slot);
+    }
+    else
+    {
+        slot->busy = false;
+    }
+    if (done != NULL)
+    {
+        done(arg, ok);
+    }
+}
+
+/** Puts a job on a free channel or in the queue. */
+static int submit(const job_t *job)
+{
+    bool masked = IntMasterDisable();
+    int result = DMA_COPY_STARTED;
+    uint32_t i;
+
+    for (i = 0; i < DMA_COPY_CHANNELS && s_slots[i].busy; i++)
+    {
+    }
+    if (i < DMA_COPY_CHANNELS)
+    {
+        s_slots[i].busy = true;
+        s_slots[i].job = *job;
+        g_dma_copy.dma_jobs++;
+        start_round(&s_slots[i]);
+    }
+    else if (s_queueHead - s_queueTail < DMA_COPY_QUEUE)
+    {
+        s_queue[s_queueHead % DMA_COPY_QUEUE] = *job;
+        s_queueHead++;
+        g_dma_copy.dma_jobs++;
+        g_dma_copy.queued++;
+    }
+    else
+    {
+        g_dma_copy.full++;
+        result = DMA_COPY_FULL;
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+    return result;
+}
+
+/**
+ * Enables the uDMA, takes the pooled channels off their peripherals and
+ * installs the two uDMA handlers.
+ */
+void dma_copy_init(void)
+{
+    uint32_t i;
+
+    dma_init();
+    s_poolMask = 0u;
+    for (i = 0; i < DMA_COPY_CHANNELS; i++)
+    {
+        s_slots[i].channel = s_channels[i];
+        s_slots[i].busy = false;
+        uDMAChannelAttributeDisable(s_channels[i], UDMA_ATTR_ALL);
+        uDMAChannelAttributeEnable(s_channels[i], UDMA_ATTR_REQMASK);
+        s_poolMask |= 1u << s_channels[i];
+    }
+    s_queueHead = 0u;
+    s_queueTail = 0u;
+
+    (void)register_isr(INT_UDMA, dma_copy_isr);
+    (void)register_isr(INT_UDMAERR, dma_copy_error_isr);
+    IntEnable(INT_UDMA);
+    IntEnable(INT_UDMAERR);
+}
+
+/**
+ * Copies @p len bytes; the areas must not overlap.
+ *
+ * @param[out] dst  - destination
+ * @param[in]  src  - source
+ * @param[in]  len  - bytes
+ * @param[in]  done - called when the copy ends, may be NULL
+ * @param[in]  arg  - passed to @p done
+ * @returns int     - DMA_COPY_CPU, DMA_COPY_STARTED or DMA_COPY_FULL
+ */
+int dma_copy(void *dst, const void *src, uint32_t len, dma_copy_done_t done,
+             void *arg)
+{
+    job_t job;
+
+    if (len < s_minBytes || len == 0u)
+    {
+        cpu_copy(dst, src, 0u, len, false);
+        if (done != NULL)
+        {
+            done(arg, true);
+        }
+        return DMA_COPY_CPU;
+    }
+    memset(&job, 0, sizeof(job));
+    job.done = done;
+    job.arg = arg;
+    job.count = 1u;
+    job.one.dst = dst;
+    job.one.src = src;
+    job.one.len = len;
+    return submit(&job);
+}
+
+/**
+ * Sets @p len bytes to @p value.
+ *
+ * @returns int - as dma_copy()
+ */
+int dma_fill(void *dst, uint8_t value, uint32_t len, dma_copy_done_t done,
+             void *arg)
+{
+    job_t job;
+
+    if (len < s_minBytes || len == 0u)
+    {
+        cpu_copy(dst, NULL, value, len, true);
+        if (done != NULL)
+        {
+            done(arg, true);
+        }
+        return DMA_COPY_CPU;
+    }
+    memset(&job, 0, sizeof(job));
+    job.done = done;
+    job.arg = arg;
+    job.count = 1u;
+    job.one.dst = dst;
+    job.one.len = len;
+    job.pattern = 0x01010101u * value;
+    job.fill = true;
+    return submit(&job);
+}
+
+/**
+ * Copies @p count segments as one job: done() once, after the last. The
+ * list is read while the job runs. The CPU does it when the segments add
+ * up to less than the dma_copy_set_min() size.
+ *
+ * @returns int - as dma_copy()
+ */
+int dma_copy_sg(const dma_seg_t *segs, uint32_t count, dma_copy_done_t done,
+                void *arg)
+{
+    job_t job;
+    uint32_t total = 0u;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        total += segs[i].len;
+    }
+    if (total < s_minBytes || total == 0u)
+    {
+        for (i = 0; i < count; i++)
+        {
+            cpu_copy(segs[i].dst, segs[i].src, 0u, segs[i].len, false);
+        }
+        if (done != NULL)
+        {
+            done(arg, true);
+        }
+        return DMA_COPY_CPU;
+    }
+    memset(&job, 0, sizeof(job));
+    job.done = done;
+    job.arg = arg;
+    job.segs = segs;
+    job.count = count;
+    return submit(&job);
+}
+
+static void wait_done(void *arg, bool ok)
+{
+    volatile int8_t *result = (volatile int8_t *)arg;
+
+    *result = ok ? 1 : 0;
+}
+
+/**
+ * Copies and returns when done, asleep meanwhile. With interrupts masked,
+ * or when the pool and queue are full, the CPU copies. Not from handlers
+ * at or above the priority of INT_UDMA.
+ *
+ * @returns bool - false if the uDMA reported a bus error
+ */
+bool dma_copy_wait(void *dst, const void *src, uint32_t len)
+{
+    volatile int8_t result = -1;
+    bool masked = IntMasterDisable();
+
+    if (masked)
+    {
+        cpu_copy(dst, src, 0u, len, false);
+        return true;
+    }
+    IntMasterEnable();
+
+    switch (dma_copy(dst, src, len, wait_done, (void *)&result))
+    {
+    case DMA_COPY_CPU:
+        return true;
+    case DMA_COPY_FULL:
+        cpu_copy(dst, src, 0u, len, false);
+        return true;
+    default:
+        break;
+    }
+
+    (void)IntMasterDisable();
+    while (result < 0)
+    {
+        /* WFI wakes up on the pending interrupt even with PRIMASK set */
+        SysCtlSleep();
+        IntMasterEnable();
+        IntMasterDisable();
+    }
+    IntMasterEnable();
+    return result > 0;
+}
+
+/** @returns bool - true while a job runs or waits */
+bool dma_copy_busy(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < DMA_COPY_CHANNELS; i++)
+    {
+        if (s_slots[i].busy)
+        {
+            return true;
+        }
+    }
+    return s_queueHead != s_queueTail;
+}
+
+/**
+ * Sets the size below which the CPU copies, e.g. 0 to send everything to
+ * the uDMA when measuring.
+ *
+ * @returns uint32_t - the previous value
+ */
+uint32_t dma_copy_set_min(uint32_t bytes)
+{
+    uint32_t previous = s_minBytes;
+
+    s_minBytes = bytes;
+    return previous;
+}
+
+/**
+ * uDMA software interrupt: a round ended on one or more pooled channels.
+ */
+void dma_copy_isr(void)
+{
+    uint32_t status = uDMAIntStatus() & s_poolMask;
+    uint32_t i;
+
+    uDMAIntClear(status);
+    for (i = 0; i < DMA_COPY_CHANNELS; i++)
+    {
+        slot_t *slot = &s_slots[i];
+
+        if (!slot->busy || (status & (1u << slot->channel)) == 0u)
+        {
+            continue;
+        }
+        if (job_finished(&slot->job))
+        {
+            finish(slot, true);
+        }
+        else
+        {
+            start_round(slot);
+        }
+    }
+}
+
+/**
+ * uDMA error interrupt: the controller stopped the channel whose access
+ * faulted. Fails the jobs of pooled channels that stopped without
+ * completing; the rest of such a job is not copied.
+ */
+void dma_copy_error_isr(void)
+{
+    uint32_t completed = uDMAIntStatus();
+    uint32_t i;
+
+    uDMAErrorStatusClear();
+    for (i = 0; i < DMA_COPY_CHANNELS; i++)
+    {
+        slot_t *slot = &s_slots[i];
+
+        if (slot->busy && (completed & (1u << slot->channel)) == 0u &&
+            !uDMAChannelIsEnabled(slot->channel))
+        {
+            g_dma_copy.errors++;
+            finish(slot, false);
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - uDMA copy engine
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dma_copy.h
+ * @author   insert authors names here
+ * @brief    Memory copies and fills on the uDMA, completed by callback. \n
+ *           dma_copy() / dma_fill() / dma_copy_sg() hand the work to one of
+ *           DMA_COPY_CHANNELS software channels and return; done(arg, ok)
+ *           runs in the uDMA software interrupt (INT_UDMA) when the last
+ *           byte is written, or with ok false from the uDMA error interrupt
+ *           (INT_UDMAERR). While a copy runs the core is free: it may work
+ *           or sleep. Jobs that find every channel busy wait in a queue of
+ *           DMA_COPY_QUEUE; when that is full the call returns
+ *           DMA_COPY_FULL and nothing is done.\n
+ *           - Transfers use the widest items the mutual alignment of source
+ *             and destination allows (32, 16 or 8 bits), with byte tasks for
+ *             unaligned heads and tails. Each channel runs up to
+ *             DMA_COPY_TASKS tasks of at most 1024 items per round
+ *             (memory scatter-gather); longer jobs continue from the
+ *             interrupt, so any length works.
+ *           - dma_copy_sg() copies a list of segments as one job, e.g. the
+ *             lines of a rectangle inside a frame buffer.
+ *           - Below DMA_COPY_MIN_BYTES (dma_copy_set_min()) the set-up and
+ *             the interrupt cost more core cycles than the copy: the CPU
+ *             does it with memcpy() / memset() and done() is called before
+ *             the call returns. The crossover is measured by the "dma"
+ *             benchmark.
+ *           - dma_copy_wait() is the blocking form; it sleeps until done.
+ *           Buffers (and the segment list) must stay valid until done().
+ *           Pooled channels are masked from their peripherals
+ *           (UDMA_ATTR_REQMASK), so they must not be used by a driver.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _DMA_COPY_H_
+#define _DMA_COPY_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Software channels of the pool (the dedicated one, 30, first). */
+#ifndef DMA_COPY_CHANNEL_LIST
+#define DMA_COPY_CHANNEL_LIST   { 30u, 31u, 29u, 28u }
+#endif
+#define DMA_COPY_CHANNELS       4u
+
+/** Tasks per round of a channel; the task list is 16 bytes per task. */
+#ifndef DMA_COPY_TASKS
+#define DMA_COPY_TASKS          8u
+#endif
+
+/** Jobs waiting for a channel. */
+#ifndef DMA_COPY_QUEUE
+#define DMA_COPY_QUEUE          8u
+#endif
+
+/** Shorter copies and fills are done by the CPU (see the "dma" bench);
+    the default of dma_copy_set_min(). */
+#ifndef DMA_COPY_MIN_BYTES
+#define DMA_COPY_MIN_BYTES      256u
+#endif
+
+/** Return values of dma_copy(), dma_fill() and dma_copy_sg(). */
+#define DMA_COPY_CPU            0       /**< done by the CPU, done() called */
+#define DMA_COPY_STARTED        1       /**< on a channel or queued         */
+#define DMA_COPY_FULL           (-1)    /**< no channel nor queue slot      */
+
+typedef void (*dma_copy_done_t)(void *arg, bool ok);
+
+/** One piece of a scatter-gather copy. */
+typedef struct
+{
+    void       *dst;
+    const void *src;
+    uint32_t    len;
+} dma_seg_t;
+
+typedef struct
+{
+    uint32_t cpu_jobs;          /**< below DMA_COPY_MIN_BYTES */
+    uint32_t dma_jobs;
+    uint32_t queued;            /**< had to wait for a channel */
+    uint32_t full;              /**< refused, queue full */
+    uint32_t rounds;            /**< channel (re)starts */
+    uint32_t errors;            /**< ended by a bus error */
+    uint64_t dma_bytes;
+    uint64_t cpu_bytes;
+} dma_copy_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern dma_copy_stats_t g_dma_copy;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void dma_copy_init(void);
+int  dma_copy(void *dst, const void *src, uint32_t len, dma_copy_done_t done,
+              void *arg);
+int  dma_fill(void *dst, uint8_t value, uint32_t len, dma_copy_done_t done,
+              void *arg);
+int  dma_copy_sg(const dma_seg_t *segs, uint32_t count, dma_copy_done_t done,
+                 void *arg);
+bool dma_copy_wait(void *dst, const void *src, uint32_t len);
+bool dma_copy_busy(void);
+uint32_t dma_copy_set_min(uint32_t bytes);
+
+void dma_copy_isr(void);
+void dma_copy_error_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,555 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - DSP
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dsp.c
+ * @author   insert authors names here
+ * @brief    Block filters (see dsp.h). \n
+ *           FIR filters and decimators share one loop per format: the new
+ *           block is appended to the history in the state buffer, every
+ *           step-th output is a dot product over a window of that buffer,
+ *           and the last taps-1 samples are moved to the front for the next
+ *           block. The decimator only computes the outputs it keeps.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <string.h>
+
+#include "dsp.h"
+#include "dsp_simd.h"
+#include "bitops.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Filters @p count samples, keeping one output in @p step (the last of each
+ * group of @p step inputs).
+ */
+static void fir_q15_run(const dsp_fir_q15_t *f, const int16_t *in,
+                        int16_t *out, uint32_t count, uint16_t step)
+{
+    const uint32_t history = f->taps - 1u;
+    int16_t *state = f->state;
+    uint32_t i;
+
+    memcpy(&state[history], in, count * sizeof(*in));
+    for (i = step - 1u; i < count; i += step)
+    {
+        const int16_t *x = &state[i];
+        const int16_t *h = f->coeffs;
+        int64_t acc = 0;
+        uint32_t k;
+
+        /* two taps per SMLALD */
+        for (k = 0; k + 1u < f->taps; k += 2u)
+        {
+            acc = dsp_smlald(dsp_read_q15x2(&h[k]), dsp_read_q15x2(&x[k]), acc);
+        }
+        if (k < f->taps)
+        {
+            acc += (int32_t)h[k] * x[k];
+        }
+        *out++ = dsp_ssat16(dsp_sat32(acc >> 15));
+    }
+    memmove(state, &state[count], history * sizeof(*state));
+}
+
+static void fir_q31_run(const dsp_fir_q31_t *f, const int32_t *in,
+                        int32_t *out, uint32_t count, uint16_t step)
+{
+    const uint32_t history = f->taps - 1u;
+    int32_t *state = f->state;
+    uint32_t i;
+
+    memcpy(&state[history], in, count * sizeof(*in));
+    for (i = step - 1u; i < count; i += step)
+    {
+        const int32_t *x = &state[i];
+        const int32_t *h = f->coeffs;
+        int64_t acc = 0;
+        uint32_t k;
+
+        for (k = 0; k < f->taps; k++)
+        {
+            acc = dsp_smlal(h[k], x[k], acc);
+        }
+        *out++ = dsp_sat32(acc >> 31);
+    }
+    memmove(state, &state[count], history * sizeof(*state));
+}
+
+static void fir_f32_run(const dsp_fir_f32_t *f, const float *in,
+                        float *out, uint32_t count, uint16_t step)
+{
+    const uint32_t history = f->taps - 1u;
+    float *state = f->state;
+    uint32_t i;
+
+    memcpy(&state[history], in, count * sizeof(*in));
+    for (i = step - 1u; i < count; i += step)
+    {
+        const float *x = &state[i];
+        const float *h = f->coeffs;
+        float acc = 0.0f;
+        uint32_t k;
+
+        for (k = 0; k < f->taps; k++)
+        {
+            acc += h[k] * x[k];
+        }
+        *out++ = acc;
+    }
+    memmove(state, &state[count], history * sizeof(*state));
+}
+
+/**
+ * Prepares a Q15 FIR filter; the history starts at zero.
+ *
+ * @param[out] f      - filter
+ * @param[in]  coeffs - @p taps coefficients, reverse time order, Q15
+ * @param[in]  taps   - at least 1
+ * @param[in]  state  - DSP_FIR_STATE(taps, largest block) samples
+ */
+void dsp_fir_q15_init(dsp_fir_q15_t *f, const int16_t *coeffs, uint16_t taps,
+                      int16_t *state)
+{
+    f->coeffs = coeffs;
+    f->state = state;
+    f->taps = taps;
+    memset(state, 0, (taps - 1u) * sizeof(*state));
+}
+
+/**
+ * Filters a block.
+ *
+ * @param[in]  f     - filter
+ * @param[in]  in    - @p count samples
+ * @param[out] out   - @p count samples; may not overlap @p in
+ * @param[in]  count - at most the block size the state was sized for
+ */
+void dsp_fir_q15(dsp_fir_q15_t *f, const int16_t *in, int16_t *out,
+                 uint32_t count)
+{
+    fir_q15_run(f, in, out, count, 1u);
+}
+
+void dsp_fir_q31_init(dsp_fir_q31_t *f, const int32_t *coeffs, uint16_t taps,
+                      int32_t *state)
+{
+    f->coeffs = coeffs;
+    f->state = state;
+    f->taps = taps;
+    memset(state, 0, (taps - 1u) * sizeof(*state));
+}
+
+void dsp_fir_q31(dsp_fir_q31_t *f, const int32_t *in, int32_t *out,
+                 uint32_t count)
+{
+    fir_q31_run(f, in, out, count, 1u);
+}
+
+void dsp_fir_f32_init(dsp_fir_f32_t *f, const float *coeffs, uint16_t taps,
+                      float *state)
+{
+    f->coeffs = coeffs;
+    f->state = state;
+    f->taps = taps;
+    memset(state, 0, (taps - 1u) * sizeof(*state));
+}
+
+void dsp_fir_f32(dsp_fir_f32_t *f, const float *in, float *out,
+                 uint32_t count)
+{
+    fir_f32_run(f, in, out, count, 1u);
+}
+
+/**
+ * Prepares a Q15 decimator: anti-aliasing FIR, then one sample kept in
+ * @p factor.
+ *
+ * @param[out] d      - decimator
+ * @param[in]  factor - at least 1
+ * @param[in]  coeffs - as for dsp_fir_q15_init()
+ * @param[in]  taps   - at least 1
+ * @param[in]  state  - DSP_FIR_STATE(taps, largest input block) samples
+ */
+void dsp_decim_q15_init(dsp_decim_q15_t *d, uint16_t factor,
+                        const int16_t *coeffs, uint16_t taps, int16_t *state)
+{
+    dsp_fir_q15_init(&d->fir, coeffs, taps, state);
+    d->factor = factor;
+}
+
+/**
+ * Decimates a block.
+ *
+ * @param[in]  d     - decimator
+ * @param[in]  in    - @p count samples
+ * @param[out] out   - @p count / factor samples
+ * @param[in]  count - a multiple of the factor
+ */
+void dsp_decim_q15(dsp_decim_q15_t *d, const int16_t *in, int16_t *out,
+                   uint32_t count)
+{
+    fir_q15_run(&d->fir, in, out, count, d->factor);
+}
+
+void dsp_decim_q31_init(dsp_decim_q31_t *d, uint16_t factor,
+                        const int32_t *coeffs, uint16_t taps, int32_t *state)
+{
+    dsp_fir_q31_init(&d->fir, coeffs, taps, state);
+    d->factor = factor;
+}
+
+void dsp_decim_q31(dsp_decim_q31_t *d, const int32_t *in, int32_t *out,
+                   uint32_t count)
+{
+    fir_q31_run(&d->fir, in, out, count, d->factor);
+}
+
+void dsp_decim_f32_init(dsp_decim_f32_t *d, uint16_t factor,
+                        const float *coeffs, uint16_t taps, float *state)
+{
+    dsp_fir_f32_init(&d->fir, coeffs, taps, state);
+    d->factor = factor;
+}
+
+void dsp_decim_f32(dsp_decim_f32_t *d, const float *in, float *out,
+                   uint32_t count)
+{
+    fir_f32_run(&d->fir, in, out, count, d->factor);
+}
+
+/**
+ * Prepares a cascade of Q15 biquads; the state starts at zero.
+ *
+ * @param[out] b      - filter
+ * @param[in]  coeffs - DSP_BIQUAD_COEFFS per stage, Q14
+ * @param[in]  stages - at least 1
+ * @param[in]  state  - DSP_BIQUAD_STATE per stage
+ */
+void dsp_biquad_q15_init(dsp_biquad_q15_t *b, const int16_t *coeffs,
+                         uint8_t stages, int16_t *state)
+{
+    b->coeffs = coeffs;
+    b->state = state;
+    b->stages = stages;
+    memset(state, 0, stages * DSP_BIQUAD_STATE * sizeof(*state));
+}
+
+/**
+ * Filters a block through every stage, in place in @p out after the first.
+ *
+ * @param[in]  b     - filter
+ * @param[in]  in    - @p count samples
+ * @param[out] out   - @p count samples; may be @p in
+ * @param[in]  count - any
+ */
+void dsp_biquad_q15(dsp_biquad_q15_t *b, const int16_t *in, int16_t *out,
+                    uint32_t count)
+{
+    const int16_t *src = in;
+    uint32_t s;
+
+    for (s = 0; s < b->stages; s++)
+    {
+        const int16_t *c = &b->coeffs[s * DSP_BIQUAD_COEFFS];
+        int16_t *st = &b->state[s * DSP_BIQUAD_STATE];
+        const uint32_t b01 = dsp_read_q15x2(&c[0]);
+        const uint32_t b2a1 = dsp_read_q15x2(&c[2]);
+        const int32_t a2 = c[4];
+        int16_t x1 = st[0];
+        int16_t x2 = st[1];
+        int16_t y1 = st[2];
+        int16_t y2 = st[3];
+        uint32_t n;
+
+        for (n = 0; n < count; n++)
+        {
+            int16_t x = src[n];
+            int64_t acc;
+
+            acc = dsp_smlald(b01, dsp_pack_q15x2(x, x1), 0);
+            acc = dsp_smlald(b2a1, dsp_pack_q15x2(x2, y1), acc);
+            acc += a2 * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = dsp_ssat16(dsp_sat32(acc >> 14));
+            out[n] = y1;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        src = out;
+    }
+}
+
+void dsp_biquad_q31_init(dsp_biquad_q31_t *b, const int32_t *coeffs,
+                         uint8_t stages, int32_t *state)
+{
+    b->coeffs = coeffs;
+    b->state = state;
+    b->stages = stages;
+    memset(state, 0, stages * DSP_BIQUAD_STATE * sizeof(*state));
+}
+
+void dsp_biquad_q31(dsp_biquad_q31_t *b, const int32_t *in, int32_t *out,
+                    uint32_t count)
+{
+    const int32_t *src = in;
+    uint32_t s;
+
+    for (s = 0; s < b->stages; s++)
+    {
+        const int32_t *c = &b->coeffs[s * DSP_BIQUAD_COEFFS];
+        int32_t *st = &b->state[s * DSP_BIQUAD_STATE];
+        int32_t x1 = st[0];
+        int32_t x2 = st[1];
+        int32_t y1 = st[2];
+        int32_t y2 = st[3];
+        uint32_t n;
+
+        for (n = 0; n < count; n++)
+        {
+            int32_t x = src[n];
+            int64_t acc;
+
+            acc = dsp_smlal(c[0], x, 0);
+            acc = dsp_smlal(c[1], x1, acc);
+            acc = dsp_smlal(c[2], x2, acc);
+            acc = dsp_smlal(c[3], y1, acc);
+            acc = dsp_smlal(c[4], y2, acc);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = dsp_sat32(acc >> 30);
+            out[n] = y1;
+        }
+        st[0] = x1;
+        st[1] = x2;
+        st[2] = y1;
+        st[3] = y2;
+        src = out;
+    }
+}
+
+void dsp_biquad_f32_init(dsp_biquad_f32_t *b, const float *coeffs,
+                         uint8_t stages, float *state)
+{
+    b->coeffs = coeffs;
+    b->state = state;
+    b->stages = stages;
+    memset(state, 0, stages * DSP_BIQUAD_STATE_F32 * sizeof(*state));
+}
+
+void dsp_biquad_f32(dsp_biquad_f32_t *b, const float *in, float *out,
+                    uint32_t count)
+{
+    const float *src = in;
+    uint32_t s;
+
+    for (s = 0; s < b->stages; s++)
+    {
+        const float *c = &b->coeffs[s * DSP_BIQUAD_COEFFS];
+        float *st = &b->state[s * DSP_BIQUAD_STATE_F32];
+        float d1 = st[0];
+        float d2 = st[1];
+        uint32_t n;
+
+        for (n = 0; n < count; n++)
+        {
+            float x = src[n];
+            float y = c[0] * x + d1;
+
+            d1 = c[1] * x + c[3] * y + d2;
+            d2 = c[2] * x + c[4] * y;
+            out[n] = y;
+        }
+        st[0] = d1;
+        st[1] = d2;
+        src = out;
+    }
+}
+
+/**
+ * Prepares a Q15 moving average; the window starts at zero.
+ *
+ * @param[out] m      - filter
+ * @param[in]  window - @p length samples
+ * @param[in]  length - power of two
+ * @returns bool      - false if @p length is not a power of two
+ */
+bool dsp_mavg_q15_init(dsp_mavg_q15_t *m, int16_t *window, uint16_t length)
+{
+    if (length == 0u || (length & (length - 1u)) != 0u)
+    {
+        return false;
+    }
+    m->window = window;
+    m->sum = 0;
+    m->index = 0;
+    m->length = length;
+    m->shift = (uint8_t)ctz32(length);
+    memset(window, 0, length * sizeof(*window));
+    return true;
+}
+
+/**
+ * Averages a block: each output is the mean of the last length inputs,
+ * rounded down.
+ *
+ * @param[in]  m     - filter
+ * @param[in]  in    - @p count samples
+ * @param[out] out   - @p count samples; may be @p in
+ * @param[in]  count - any
+ */
+void dsp_mavg_q15(dsp_mavg_q15_t *m, const int16_t *in, int16_t *out,
+                  uint32_t count)
+{
+    const uint32_t wrap = m->length - 1u;
+    int32_t sum = m->sum;
+    uint32_t index = m->index;
+    uint32_t n;
+
+    for (n = 0; n < count; n++)
+    {
+        int16_t x = in[n];
+
+        sum += x - m->window[index];
+        m->window[index] = x;
+        index = (index + 1u) & wrap;
+        out[n] = (int16_t)(sum >> m->shift);
+    }
+    m->sum = sum;
+    m->index = (uint16_t)index;
+}
+
+bool dsp_mavg_q31_init(dsp_mavg_q31_t *m, int32_t *window, uint16_t length)
+{
+    if (length == 0u || (length & (length - 1u)) != 0u)
+    {
+        return false;
+    }
+    m->window = window;
+    m->sum = 0;
+    m->index = 0;
+    m->length = length;
+    m->shift = (uint8_t)ctz32(length);
+    memset(window, 0, length * sizeof(*window));
+    return true;
+}
+
+void dsp_mavg_q31(dsp_mavg_q31_t *m, const int32_t *in, int32_t *out,
+                  uint32_t count)
+{
+    const uint32_t wrap = m->length - 1u;
+    int64_t sum = m->sum;
+    uint32_t index = m->index;
+    uint32_t n;
+
+    for (n = 0; n < count; n++)
+    {
+        int32_t x = in[n];
+
+        sum += (int64_t)x - m->window[index];
+        m->window[index] = x;
+        index = (index + 1u) & wrap;
+        out[n] = (int32_t)(sum >> m->shift);
+    }
+    m->sum = sum;
+    m->index = (uint16_t)index;
+}
+
+/**
+ * Prepares a float moving average of any length.
+ *
+ * @returns bool - false if @p length is 0
+ */
+bool dsp_mavg_f32_init(dsp_mavg_f32_t *m, float *window, uint16_t length)
+{
+    if (length == 0u)
+    {
+        return false;
+    }
+    m->window = window;
+    m->sum = 0.0f;
+    m->scale = 1.0f / length;
+    m->index = 0;
+    m->length = length;
+    memset(window, 0, length * sizeof(*window));
+    return true;
+}
+
+/**
+ * As dsp_mavg_q15(). The running sum is recomputed from the window each
+ * time it wraps, so rounding errors do not accumulate.
+ */
+void dsp_mavg_f32(dsp_mavg_f32_t *m, const float *in, float *out,
+                  uint32_t count)
+{
+    float sum = m->sum;
+    uint32_t index = m->index;
+    uint32_t n;
+
+    for (n = 0; n < count; n++)
+    {
+        float x = in[n];
+
+        sum += x - m->window[index];
+        m->window[index] = x;
+        if (++index == m->length)
+        {
+            uint32_t k;
+
+            index = 0;
+            sum = 0.0f;
+            for (k = 0; k < m->length; k++)
+            {
+                sum += m->window[k];
+            }
+        }
+        out[n] = sum * m->scale;
+    }
+    m->sum = sum;
+    m->index = (uint16_t)index;
+}
+
+/**
+ * Saturating sum of two Q15 blocks, two samples per QADD16.
+ *
+ * @param[in]  a, b  - @p count samples each
+ * @param[out] out   - @p count samples; may be @p a or @p b
+ * @param[in]  count - any
+ */
+void dsp_add_q15(const int16_t *a, const int16_t *b, int16_t *out,
+                 uint32_t count)
+{
+    uint32_t n;
+
+    for (n = 0; n + 1u < count; n += 2u)
+    {
+        dsp_write_q15x2(&out[n], dsp_qadd16(dsp_read_q15x2(&a[n]),
+                                            dsp_read_q15x2(&b[n])));
+    }
+    if (n < count)
+    {
+        out[n] = dsp_ssat16((int32_t)a[n] + b[n]);
+    }
+}
@@ -0,0 +1,226 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - DSP
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dsp.h
+ * @author   insert authors names here
+ * @brief    Block filters for sensor data: FIR, biquad cascade, moving
+ *           average and FIR decimator, each in Q15, Q31 and float. \n
+ *           Fixed-point kernels use the M4 DSP instructions (dsp_simd.h):
+ *           Q15 taps two at a time with SMLALD, saturation with SSAT, Q15
+ *           mixing with QADD16. Results are truncated, not rounded, and are
+ *           the same bit for bit on the target and on the host. Float
+ *           kernels use the FPU; the compiler may fuse multiply-adds on the
+ *           target, so their results may differ from the host in the last
+ *           bits.
+ *
+ *           Formats and conventions:
+ *           - FIR coefficients are in reverse time order, h[taps-1] first
+ *             (as in CMSIS-DSP; symmetric filters are unaffected). The state
+ *             buffer holds DSP_FIR_STATE(taps, block) samples, block being
+ *             the largest block passed to the process function.
+ *           - Q15/Q31 FIR accumulators are 64 bits. Q31 products are 2.62,
+ *             so the input must be scaled down by log2(taps) bits to rule
+ *             out overflow (the sum wraps like SMLAL does).
+ *           - Biquad stages take 5 coefficients {b0, b1, b2, a1, a2} with
+ *             y = b0*x + b1*x1 + b2*x2 + a1*y1 + a2*y2 (feedback signs
+ *             already negated), in Q14 for Q15 data, Q30 for Q31 data, so
+ *             that |coefficient| < 2; the magnitudes of a Q31 stage must add
+ *             up to less than 4 for its 64-bit sum not to wrap. The state is 4 values per stage
+ *             {x1, x2, y1, y2} (float: 2 values, transposed direct form II).
+ *           - Moving averages of Q15/Q31 data have a length that is a power
+ *             of two; the float one any length.
+ *           - Decimators take blocks that are a multiple of the factor and
+ *             produce one output per factor inputs.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _DSP_H_
+#define _DSP_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Constant conversions from real values, rounded to nearest. */
+#define DSP_ROUND(x, scale)     ((x) * (scale) + (((x) >= 0) ? 0.5 : -0.5))
+#define DSP_Q15(x)              ((int16_t)DSP_ROUND(x, 32768.0))
+#define DSP_Q14(x)              ((int16_t)DSP_ROUND(x, 16384.0))
+#define DSP_Q31(x)              ((int32_t)DSP_ROUND(x, 2147483648.0))
+#define DSP_Q30(x)              ((int32_t)DSP_ROUND(x, 1073741824.0))
+
+/** Samples in the state buffer of a FIR or decimator. */
+#define DSP_FIR_STATE(taps, block)  ((taps) + (block) - 1u)
+
+#define DSP_BIQUAD_COEFFS       5u      /**< per stage */
+#define DSP_BIQUAD_STATE        4u      /**< per stage, fixed point */
+#define DSP_BIQUAD_STATE_F32    2u      /**< per stage, float */
+
+typedef struct
+{
+    const int16_t *coeffs;
+    int16_t       *state;
+    uint16_t       taps;
+} dsp_fir_q15_t;
+
+typedef struct
+{
+    const int32_t *coeffs;
+    int32_t       *state;
+    uint16_t       taps;
+} dsp_fir_q31_t;
+
+typedef struct
+{
+    const float *coeffs;
+    float       *state;
+    uint16_t     taps;
+} dsp_fir_f32_t;
+
+typedef struct
+{
+    dsp_fir_q15_t fir;
+    uint16_t      factor;
+} dsp_decim_q15_t;
+
+typedef struct
+{
+    dsp_fir_q31_t fir;
+    uint16_t      factor;
+} dsp_decim_q31_t;
+
+typedef struct
+{
+    dsp_fir_f32_t fir;
+    uint16_t      factor;
+} dsp_decim_f32_t;
+
+typedef struct
+{
+    const int16_t *coeffs;
+    int16_t       *state;
+    uint8_t        stages;
+} dsp_biquad_q15_t;
+
+typedef struct
+{
+    const int32_t *coeffs;
+    int32_t       *state;
+    uint8_t        stages;
+} dsp_biquad_q31_t;
+
+typedef struct
+{
+    const float *coeffs;
+    float       *state;
+    uint8_t      stages;
+} dsp_biquad_f32_t;
+
+typedef struct
+{
+    int16_t *window;
+    int32_t  sum;
+    uint16_t index;
+    uint16_t length;
+    uint8_t  shift;         /**< log2(length) */
+} dsp_mavg_q15_t;
+
+typedef struct
+{
+    int32_t *window;
+    int64_t  sum;
+    uint16_t index;
+    uint16_t length;
+    uint8_t  shift;
+} dsp_mavg_q31_t;
+
+typedef struct
+{
+    float   *window;
+    float    sum;           /**< re-summed each time the window wraps */
+    float    scale;         /**< 1 / length */
+    uint16_t index;
+    uint16_t length;
+} dsp_mavg_f32_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void dsp_fir_q15_init(dsp_fir_q15_t *f, const int16_t *coeffs, uint16_t taps,
+                      int16_t *state);
+void dsp_fir_q15(dsp_fir_q15_t *f, const int16_t *in, int16_t *out,
+                 uint32_t count);
+void dsp_fir_q31_init(dsp_fir_q31_t *f, const int32_t *coeffs, uint16_t taps,
+                      int32_t *state);
+void dsp_fir_q31(dsp_fir_q31_t *f, const int32_t *in, int32_t *out,
+                 uint32_t count);
+void dsp_fir_f32_init(dsp_fir_f32_t *f, const float *coeffs, uint16_t taps,
+                      float *state);
+void dsp_fir_f32(dsp_fir_f32_t *f, const float *in, float *out,
+                 uint32_t count);
+
+void dsp_decim_q15_init(dsp_decim_q15_t *d, uint16_t factor,
+                        const int16_t *coeffs, uint16_t taps, int16_t *state);
+void dsp_decim_q15(dsp_decim_q15_t *d, const int16_t *in, int16_t *out,
+                   uint32_t count);
+void dsp_decim_q31_init(dsp_decim_q31_t *d, uint16_t factor,
+                        const int32_t *coeffs, uint16_t taps, int32_t *state);
+void dsp_decim_q31(dsp_decim_q31_t *d, const int32_t *in, int32_t *out,
+                   uint32_t count);
+void dsp_decim_f32_init(dsp_decim_f32_t *d, uint16_t factor,
+                        const float *coeffs, uint16_t taps, float *state);
+void dsp_decim_f32(dsp_decim_f32_t *d, const float *in, float *out,
+                   uint32_t count);
+
+void dsp_biquad_q15_init(dsp_biquad_q15_t *b, const int16_t *coeffs,
+                         uint8_t stages, int16_t *state);
+void dsp_biquad_q15(dsp_biquad_q15_t *b, const int16_t *in, int16_t *out,
+                    uint32_t count);
+void dsp_biquad_q31_init(dsp_biquad_q31_t *b, const int32_t *coeffs,
+                         uint8_t stages, int32_t *state);
+void dsp_biquad_q31(dsp_biquad_q31_t *b, const int32_t *in, int32_t *out,
+                    uint32_t count);
+void dsp_biquad_f32_init(dsp_biquad_f32_t *b, const float *coeffs,
+                         uint8_t stages, float *state);
+void dsp_biquad_f32(dsp_biquad_f32_t *b, const float *in, float *out,
+                    uint32_t count);
+
+bool dsp_mavg_q15_init(dsp_mavg_q15_t *m, int16_t *window, uint16_t length);
+void dsp_mavg_q15(dsp_mavg_q15_t *m, const int16_t *in, int16_t *out,
+                  uint32_t count);
+bool dsp_mavg_q31_init(dsp_mavg_q31_t *m, int32_t *window, uint16_t length);
+void dsp_mavg_q31(dsp_mavg_q31_t *m, const int32_t *in, int32_t *out,
+                  uint32_t count);
+bool dsp_mavg_f32_init(dsp_mavg_f32_t *m, float *window, uint16_t length);
+void dsp_mavg_f32(dsp_mavg_f32_t *m, const float *in, float *out,
+                  uint32_t count);
+
+void dsp_add_q15(const int16_t *a, const int16_t *b, int16_t *out,
+                 uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,208 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - DSP
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dsp_bench.c
+ * @author   insert authors names here
+ * @brief    Cycles per sample of the dsp.c kernels (see dsp_bench.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include "common/dsp_bench.h"
+#include "common/dsp.h"
+#include "common/cycles.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define BLOCK               DSP_BENCH_BLOCK
+#define TAPS                DSP_BENCH_FIR_TAPS
+#define STAGES              DSP_BENCH_BIQUADS
+
+/** Butterworth low-pass at fs/8, in the sign convention of dsp.h. */
+#define LP_B0               0.0976310729
+#define LP_B1               0.1952621459
+#define LP_B2               0.0976310729
+#define LP_A1               0.9428090416
+#define LP_A2               (-0.3333333333)
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+dsp_bench_t g_dsp_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const int16_t s_biquadQ15[STAGES * DSP_BIQUAD_COEFFS] =
+{
+    DSP_Q14(LP_B0), DSP_Q14(LP_B1), DSP_Q14(LP_B2), DSP_Q14(LP_A1), DSP_Q14(LP_A2),
+    DSP_Q14(LP_B0), DSP_Q14(LP_B1), DSP_Q14(LP_B2), DSP_Q14(LP_A1), DSP_Q14(LP_A2),
+};
+static const int32_t s_biquadQ31[STAGES * DSP_BIQUAD_COEFFS] =
+{
+    DSP_Q30(LP_B0), DSP_Q30(LP_B1), DSP_Q30(LP_B2), DSP_Q30(LP_A1), DSP_Q30(LP_A2),
+    DSP_Q30(LP_B0), DSP_Q30(LP_B1), DSP_Q30(LP_B2), DSP_Q30(LP_A1), DSP_Q30(LP_A2),
+};
+static const float s_biquadF32[STAGES * DSP_BIQUAD_COEFFS] =
+{
+    LP_B0, LP_B1, LP_B2, LP_A1, LP_A2,
+    LP_B0, LP_B1, LP_B2, LP_A1, LP_A2,
+};
+
+static const char *const s_names[DSP_BENCH_KERNELS] =
+{
+    "fir_q15", "fir_q31", "fir_f32",
+    "biquad_q15", "biquad_q31", "biquad_f32",
+    "mavg_q15", "mavg_q31", "mavg_f32",
+    "decim_q15", "decim_q31", "decim_f32",
+    "add_q15"
+};
+
+static int16_t s_firQ15[TAPS];
+static int32_t s_firQ31[TAPS];
+static float   s_firF32[TAPS];
+
+static int16_t s_inQ15[BLOCK];
+static int32_t s_inQ31[BLOCK];
+static float   s_inF32[BLOCK];
+static int16_t s_outQ15[BLOCK];
+static int32_t s_outQ31[BLOCK];
+static float   s_outF32[BLOCK];
+
+static int16_t s_stateQ15[DSP_FIR_STATE(TAPS, BLOCK)];
+static int32_t s_stateQ31[DSP_FIR_STATE(TAPS, BLOCK)];
+static float   s_stateF32[DSP_FIR_STATE(TAPS, BLOCK)];
+
+static dsp_fir_q15_t    s_fq15;
+static dsp_fir_q31_t    s_fq31;
+static dsp_fir_f32_t    s_ff32;
+static dsp_biquad_q15_t s_bq15;
+static dsp_biquad_q31_t s_bq31;
+static dsp_biquad_f32_t s_bf32;
+static dsp_mavg_q15_t   s_mq15;
+static dsp_mavg_q31_t   s_mq31;
+static dsp_mavg_f32_t   s_mf32;
+static dsp_decim_q15_t  s_dq15;
+static dsp_decim_q31_t  s_dq31;
+static dsp_decim_f32_t  s_df32;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Triangular low-pass taps with a DC gain of about 1 and noise input at
+ * half scale. The values do not change the timing; they only keep the
+ * fixed-point kernels out of saturation.
+ */
+static void fill_data(void)
+{
+    uint32_t seed = 12345u;
+    uint32_t i;
+
+    for (i = 0; i < TAPS; i++)
+    {
+        uint32_t w = (i < TAPS / 2u) ? i + 1u : TAPS - i;
+        float h = (float)w / (float)((TAPS / 2u) * (TAPS / 2u + 1u));
+
+        s_firF32[i] = h;
+        s_firQ15[i] = (int16_t)(h * 32767.0f);
+        s_firQ31[i] = (int32_t)(h * 2147483520.0f);
+    }
+    for (i = 0; i < BLOCK; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        s_inQ15[i] = (int16_t)((int32_t)seed >> 17);
+        s_inQ31[i] = (int32_t)seed >> 1;
+        s_inF32[i] = (float)s_inQ15[i] / 32768.0f;
+    }
+}
+
+static void run_kernel(dsp_bench_kernel_t k)
+{
+    switch (k)
+    {
+    case DSP_BENCH_FIR_Q15:    dsp_fir_q15(&s_fq15, s_inQ15, s_outQ15, BLOCK); break;
+    case DSP_BENCH_FIR_Q31:    dsp_fir_q31(&s_fq31, s_inQ31, s_outQ31, BLOCK); break;
+    case DSP_BENCH_FIR_F32:    dsp_fir_f32(&s_ff32, s_inF32, s_outF32, BLOCK); break;
+    case DSP_BENCH_BIQUAD_Q15: dsp_biquad_q15(&s_bq15, s_inQ15, s_outQ15, BLOCK); break;
+    case DSP_BENCH_BIQUAD_Q31: dsp_biquad_q31(&s_bq31, s_inQ31, s_outQ31, BLOCK); break;
+    case DSP_BENCH_BIQUAD_F32: dsp_biquad_f32(&s_bf32, s_inF32, s_outF32, BLOCK); break;
+    case DSP_BENCH_MAVG_Q15:   dsp_mavg_q15(&s_mq15, s_inQ15, s_outQ15, BLOCK); break;
+    case DSP_BENCH_MAVG_Q31:   dsp_mavg_q31(&s_mq31, s_inQ31, s_outQ31, BLOCK); break;
+    case DSP_BENCH_MAVG_F32:   dsp_mavg_f32(&s_mf32, s_inF32, s_outF32, BLOCK); break;
+    case DSP_BENCH_DECIM_Q15:  dsp_decim_q15(&s_dq15, s_inQ15, s_outQ15, BLOCK); break;
+    case DSP_BENCH_DECIM_Q31:  dsp_decim_q31(&s_dq31, s_inQ31, s_outQ31, BLOCK); break;
+    case DSP_BENCH_DECIM_F32:  dsp_decim_f32(&s_df32, s_inF32, s_outF32, BLOCK); break;
+    case DSP_BENCH_ADD_Q15:    dsp_add_q15(s_inQ15, s_outQ15, s_outQ15, BLOCK); break;
+    default:                   break;
+    }
+}
+
+/**
+ * Times every kernel; results in g_dsp_bench. The filters share the state
+ * buffers, so each one is initialised just before it is timed.
+ */
+void dsp_bench_run(void)
+{
+    static int16_t mavgQ15[DSP_BENCH_MAVG];
+    static int32_t mavgQ31[DSP_BENCH_MAVG];
+    static float   mavgF32[DSP_BENCH_MAVG];
+    uint32_t k;
+
+    fill_data();
+    cycles_init();
+    for (k = 0; k < DSP_BENCH_KERNELS; k++)
+    {
+        uint32_t best = UINT32_MAX;
+        uint32_t run;
+
+        dsp_fir_q15_init(&s_fq15, s_firQ15, TAPS, s_stateQ15);
+        dsp_fir_q31_init(&s_fq31, s_firQ31, TAPS, s_stateQ31);
+        dsp_fir_f32_init(&s_ff32, s_firF32, TAPS, s_stateF32);
+        dsp_decim_q15_init(&s_dq15, DSP_BENCH_DECIM, s_firQ15, TAPS, s_stateQ15);
+        dsp_decim_q31_init(&s_dq31, DSP_BENCH_DECIM, s_firQ31, TAPS, s_stateQ31);
+        dsp_decim_f32_init(&s_df32, DSP_BENCH_DECIM, s_firF32, TAPS, s_stateF32);
+        dsp_biquad_q15_init(&s_bq15, s_biquadQ15, STAGES, s_stateQ15);
+        dsp_biquad_q31_init(&s_bq31, s_biquadQ31, STAGES, s_stateQ31);
+        dsp_biquad_f32_init(&s_bf32, s_biquadF32, STAGES, s_stateF32);
+        (void)dsp_mavg_q15_init(&s_mq15, mavgQ15, DSP_BENCH_MAVG);
+        (void)dsp_mavg_q31_init(&s_mq31, mavgQ31, DSP_BENCH_MAVG);
+        (void)dsp_mavg_f32_init(&s_mf32, mavgF32, DSP_BENCH_MAVG);
+
+        for (run = 0; run < DSP_BENCH_RUNS; run++)
+        {
+            uint32_t start = cycles_now();
+            uint32_t elapsed;
+
+            run_kernel((dsp_bench_kernel_t)k);
+            elapsed = cycles_now() - start;
+            if (elapsed < best)
+            {
+                best = elapsed;
+            }
+        }
+        g_dsp_bench.name[k] = s_names[k];
+        g_dsp_bench.cycles[k] = best;
+    }
+}
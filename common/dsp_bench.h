@@ -0,0 +1,92 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - DSP
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dsp_bench.h
+ * @author   insert authors names here
+ * @brief    Cycles per sample of the dsp.c kernels. \n
+ *           Each kernel filters DSP_BENCH_BLOCK samples of noise
+ *           DSP_BENCH_RUNS times, timed with the DWT cycle counter; the
+ *           best run is kept. On the board, call dsp_bench_run() and read
+ *           g_dsp_bench in the debugger (cycles per sample = cycles /
+ *           DSP_BENCH_BLOCK). On the host the kernels are plain C, which the
+ *           simulator does not charge; host/bench/bench_dsp.c checks them
+ *           against a scalar reference instead.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _DSP_BENCH_H_
+#define _DSP_BENCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define DSP_BENCH_BLOCK         64u     /**< input samples per call */
+#define DSP_BENCH_RUNS          8u
+#define DSP_BENCH_FIR_TAPS      32u
+#define DSP_BENCH_BIQUADS       2u      /**< stages */
+#define DSP_BENCH_MAVG          16u     /**< window length */
+#define DSP_BENCH_DECIM         4u      /**< factor */
+
+typedef enum
+{
+    DSP_BENCH_FIR_Q15,
+    DSP_BENCH_FIR_Q31,
+    DSP_BENCH_FIR_F32,
+    DSP_BENCH_BIQUAD_Q15,
+    DSP_BENCH_BIQUAD_Q31,
+    DSP_BENCH_BIQUAD_F32,
+    DSP_BENCH_MAVG_Q15,
+    DSP_BENCH_MAVG_Q31,
+    DSP_BENCH_MAVG_F32,
+    DSP_BENCH_DECIM_Q15,
+    DSP_BENCH_DECIM_Q31,
+    DSP_BENCH_DECIM_F32,
+    DSP_BENCH_ADD_Q15,
+    DSP_BENCH_KERNELS
+} dsp_bench_kernel_t;
+
+typedef struct
+{
+    const char *name[DSP_BENCH_KERNELS];
+    uint32_t    cycles[DSP_BENCH_KERNELS];  /**< best, per DSP_BENCH_BLOCK */
+} dsp_bench_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern dsp_bench_t g_dsp_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void dsp_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - DSP
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     dsp_simd.h
+ * @author   insert authors names here
+ * @brief    Cortex-M4 DSP instructions used by the kernels of dsp.c. \n
+ *           On the target they are the IAR intrinsics (one instruction
+ *           each); on the host they are C with the same results, bit for
+ *           bit, so dsp.c is the same code in both builds. Two Q15 values
+ *           are packed in a word as on the M4: the first one (lower address)
+ *           in bits 15:0.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _DSP_SIMD_H_
+#define _DSP_SIMD_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Two Q15 values from a possibly unaligned address; a single LDR on the M4,
+ * which allows unaligned word loads.
+ */
+static inline uint32_t dsp_read_q15x2(const int16_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/** Stores two Q15 values to a possibly unaligned address (STR). */
+static inline void dsp_write_q15x2(int16_t *p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+/** Packs two Q15 values, @p lo in bits 15:0 (PKHBT). */
+static inline uint32_t dsp_pack_q15x2(int16_t lo, int16_t hi)
+{
+    return (uint32_t)(uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+/** SMLALD: acc + x.lo * y.lo + x.hi * y.hi, 64-bit accumulator. */
+static inline int64_t dsp_smlald(uint32_t x, uint32_t y, int64_t acc)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return (int64_t)__SMLALD(x, y, (unsigned long long)acc);
+#else
+    return acc + (int32_t)(int16_t)x * (int16_t)y +
+           (int32_t)(int16_t)(x >> 16) * (int16_t)(y >> 16);
+#endif
+}
+
+/** SMLAL: acc + x * y; wraps like the instruction on overflow. */
+static inline int64_t dsp_smlal(int32_t x, int32_t y, int64_t acc)
+{
+    return (int64_t)((uint64_t)acc + (uint64_t)((int64_t)x * y));
+}
+
+/** Saturates a value to Q15 (SSAT #16). */
+static inline int16_t dsp_ssat16(int32_t v)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return (int16_t)__SSAT(v, 16);
+#else
+    return (int16_t)((v > INT16_MAX) ? INT16_MAX : (v < INT16_MIN) ? INT16_MIN : v);
+#endif
+}
+
+/** Saturates a 64-bit value to Q31. */
+static inline int32_t dsp_sat32(int64_t v)
+{
+    return (int32_t)((v > INT32_MAX) ? INT32_MAX : (v < INT32_MIN) ? INT32_MIN : v);
+}
+
+/** QADD16: two saturating Q15 additions. */
+static inline uint32_t dsp_qadd16(uint32_t x, uint32_t y)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return __QADD16(x, y);
+#else
+    int16_t lo = dsp_ssat16((int32_t)(int16_t)x + (int16_t)y);
+    int16_t hi = dsp_ssat16((int32_t)(int16_t)(x >> 16) + (int16_t)(y >> 16));
+
+    return dsp_pack_q15x2(lo, hi);
+#endif
+}
+
+#endif
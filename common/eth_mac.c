@@ -0,0 +1,369 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     eth_mac.c
+ * @author   insert authors names here
+ * @brief    EMAC0 descriptor rings and interrupt (see eth_mac.h). \n
+ *           RX: s_rxNext is the next descriptor the DMA completes; the
+ *           interrupt takes every descriptor it has given back, swaps in a
+ *           fresh buffer and returns the descriptor to the DMA. With no
+ *           fresh buffer the frame is dropped and its buffer stays in the
+ *           ring, so the ring never runs dry because of the consumer.\n
+ *           TX: s_txBuf[i] is the buffer of descriptor i until it is freed;
+ *           send() fills s_txHead, the reclaim walks s_txTail. Both run
+ *           with interrupts masked, so the interrupt and a send() from a
+ *           task do not interleave.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/emac.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+#include "common/eth_mac.h"
+#include "common/vtable.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Unit of the receive watchdog, in system clock cycles. */
+#define RIWT_CYCLES         256u
+#define RIWT_MAX            255u
+
+#define MAC_CONFIG          (EMAC_CONFIG_FULL_DUPLEX | EMAC_CONFIG_100MBPS |     \
+                             EMAC_CONFIG_CHECKSUM_OFFLOAD |                      \
+                             EMAC_CONFIG_7BYTE_PREAMBLE |                        \
+                             EMAC_CONFIG_IF_GAP_96BITS |                         \
+                             EMAC_CONFIG_USE_MACADDR0 |                          \
+                             EMAC_CONFIG_SA_FROM_DESCRIPTOR |                    \
+                             EMAC_CONFIG_BO_LIMIT_1024 | EMAC_CONFIG_STRIP_CRC)
+
+/** Store and forward: required by the checksum insertion. */
+#define MAC_MODE            (EMAC_MODE_RX_STORE_FORWARD |                        \
+                             EMAC_MODE_TX_STORE_FORWARD |                        \
+                             EMAC_MODE_TX_THRESHOLD_64_BYTES |                   \
+                             EMAC_MODE_RX_THRESHOLD_64_BYTES)
+
+#define MAC_INTS            (EMAC_INT_RECEIVE | EMAC_INT_TRANSMIT |              \
+                             EMAC_INT_RX_NO_BUFFER | EMAC_INT_NORMAL_INT |       \
+                             EMAC_INT_ABNORMAL_INT)
+
+#define TX_CTRL             (DES0_TX_CTRL_FIRST_SEG | DES0_TX_CTRL_LAST_SEG |    \
+                             DES0_TX_CTRL_CHAINED | DES0_TX_CTRL_IP_ALL_CKHSUMS)
+
+#define RX_WHOLE_FRAME      (DES0_RX_STAT_FIRST_DESC | DES0_RX_STAT_LAST_DESC)
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static tEMACDMADescriptor s_rx[ETH_MAC_RX_DESC];
+static tEMACDMADescriptor s_tx[ETH_MAC_TX_DESC];
+static net_buf_t         *s_rxBuf[ETH_MAC_RX_DESC];
+static net_buf_t         *s_txBuf[ETH_MAC_TX_DESC];
+
+static uint32_t  s_rxNext;
+static uint32_t  s_txHead;
+static uint32_t  s_txTail;
+static uint32_t  s_txCount;
+static uint32_t  s_txFrames;
+static net_if_t *s_netif;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Masks interrupts around a ring update. The simulator only takes
+ * exceptions at HAL calls, and there are none in between, so the host build
+ * needs no mask.
+ */
+static inline uint32_t lock(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_interrupt();
+    return primask;
+#else
+    return 0u;
+#endif
+}
+
+static inline void unlock(uint32_t primask)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __set_PRIMASK(primask);
+#else
+    (void)primask;
+#endif
+}
+
+/** Frees the buffers of the frames the DMA has sent. Interrupts masked. */
+static void tx_reclaim(void)
+{
+    while (s_txBuf[s_txTail] != NULL &&
+           (s_tx[s_txTail].ui32CtrlStatus & DES0_TX_CTRL_OWN) == 0u)
+    {
+        net_buf_free(s_txBuf[s_txTail]);
+        s_txBuf[s_txTail] = NULL;
+        s_txTail = (s_txTail + 1u) % ETH_MAC_TX_DESC;
+    }
+}
+
+/** Hands the completed RX descriptors up and back to the DMA. */
+static void rx_process(net_if_t *netif)
+{
+    while ((s_rx[s_rxNext].ui32CtrlStatus & DES0_RX_CTRL_OWN) == 0u)
+    {
+        tEMACDMADescriptor *d = &s_rx[s_rxNext];
+        uint32_t status = d->ui32CtrlStatus;
+        net_buf_t *buf = s_rxBuf[s_rxNext];
+        net_buf_t *fresh = NULL;
+
+        if ((status & (RX_WHOLE_FRAME | DES0_RX_STAT_ERR)) == RX_WHOLE_FRAME)
+        {
+            fresh = net_buf_alloc();
+        }
+        if (fresh != NULL)
+        {
+            buf->len = (uint16_t)((status & DES0_RX_STAT_FRAME_LENGTH_M) >>
+                                  DES0_RX_STAT_FRAME_LENGTH_S);
+            s_rxBuf[s_rxNext] = fresh;
+            d->pvBuffer1 = fresh->data;
+        }
+        else
+        {
+            netif->stats.rx_dropped++;
+            buf = NULL;
+        }
+        d->ui32CtrlStatus = DES0_RX_CTRL_OWN;
+        s_rxNext = (s_rxNext + 1u) % ETH_MAC_RX_DESC;
+
+        if (buf != NULL)
+        {
+            netif->stats.rx_frames++;
+            netif->stats.rx_bytes += buf->len;
+            if (netif->rx != NULL)
+            {
+                netif->rx(netif, buf);
+            }
+            else
+            {
+                net_buf_free(buf);
+            }
+        }
+    }
+}
+
+static bool eth_send(net_if_t *netif, net_buf_t *buf)
+{
+    uint32_t primask = lock();
+    tEMACDMADescriptor *d;
+    uint32_t ctrl = TX_CTRL | DES0_TX_CTRL_OWN;
+
+    if (s_txBuf[s_txHead] != NULL)
+    {
+        tx_reclaim();
+    }
+    if (s_txBuf[s_txHead] != NULL)
+    {
+        netif->stats.tx_full++;
+        unlock(primask);
+        return false;
+    }
+    if (++s_txCount == s_txFrames)
+    {
+        s_txCount = 0u;
+        ctrl |= DES0_TX_CTRL_INTERRUPT;
+    }
+    d = &s_tx[s_txHead];
+    s_txBuf[s_txHead] = buf;
+    d->pvBuffer1 = buf->data;
+    d->ui32Count = ((uint32_t)buf->len << DES1_TX_CTRL_BUFF1_SIZE_S) &
+                   DES1_TX_CTRL_BUFF1_SIZE_M;
+    d->ui32CtrlStatus = ctrl;
+    s_txHead = (s_txHead + 1u) % ETH_MAC_TX_DESC;
+    netif->stats.tx_frames++;
+    netif->stats.tx_bytes += buf->len;
+    unlock(primask);
+
+    EMACTxDMAPollDemand(EMAC0_BASE);
+    return true;
+}
+
+/** Services both rings with the MAC interrupt held off. */
+static void eth_poll(net_if_t *netif)
+{
+    uint32_t primask;
+
+    IntDisable(INT_EMAC0);
+    rx_process(netif);
+    primask = lock();
+    tx_reclaim();
+    unlock(primask);
+    IntEnable(INT_EMAC0);
+}
+
+static const net_if_ops_t s_ops = { eth_send, eth_poll };
+
+/**
+ * Sets up EMAC0 with the internal PHY at 100 Mbit/s full duplex, both
+ * descriptor rings and the interrupt. Call net_buf_init() first; the RX
+ * ring takes ETH_MAC_RX_DESC buffers.
+ *
+ * @param[out] netif    - filled in; set netif->rx before frames arrive
+ * @param[in]  clock_hz - system clock
+ * @param[in]  mac      - station address
+ * @param[in]  config   - NULL for ETH_MAC_CONFIG_DEFAULT
+ * @returns bool        - false if @p config is invalid or the pool is short
+ */
+bool eth_mac_init(net_if_t *netif, uint32_t clock_hz,
+                  const uint8_t mac[NET_MAC_LEN],
+                  const eth_mac_config_t *config)
+{
+    static const eth_mac_config_t defaults = ETH_MAC_CONFIG_DEFAULT;
+    uint64_t riwt;
+    uint32_t i;
+
+    if (config == NULL)
+    {
+        config = &defaults;
+    }
+    if (config->rx_frames == 0u || ETH_MAC_RX_DESC % config->rx_frames != 0u ||
+        (config->rx_frames > 1u && config->rx_timeout_us == 0u) ||
+        config->tx_frames == 0u || config->tx_frames > ETH_MAC_TX_DESC)
+    {
+        return false;
+    }
+    riwt = ((uint64_t)config->rx_timeout_us * clock_hz / 1000000u +
+            RIWT_CYCLES - 1u) / RIWT_CYCLES;
+    if (riwt > RIWT_MAX)
+    {
+        return false;
+    }
+
+    memset(netif, 0, sizeof(*netif));
+    netif->ops = &s_ops;
+    memcpy(netif->mac, mac, NET_MAC_LEN);
+    netif->flags = NET_IF_TX_CSUM | NET_IF_RX_CSUM;
+    s_netif = netif;
+
+    for (i = 0; i < ETH_MAC_RX_DESC; i++)
+    {
+        s_rxBuf[i] = net_buf_alloc();
+        if (s_rxBuf[i] == NULL)
+        {
+            while (i > 0u)
+            {
+                net_buf_free(s_rxBuf[--i]);
+            }
+            return false;
+        }
+        s_rx[i].ui32Count = DES1_RX_CTRL_CHAINED |
+                            (NET_BUF_SIZE << DES1_RX_CTRL_BUFF1_SIZE_S) |
+                            (((i + 1u) % config->rx_frames != 0u)
+                                 ? DES1_RX_CTRL_DISABLE_INT : 0u);
+        s_rx[i].pvBuffer1 = s_rxBuf[i]->data;
+        s_rx[i].DES3.pLink = &s_rx[(i + 1u) % ETH_MAC_RX_DESC];
+        s_rx[i].ui32CtrlStatus = DES0_RX_CTRL_OWN;
+    }
+    for (i = 0; i < ETH_MAC_TX_DESC; i++)
+    {
+        s_txBuf[i] = NULL;
+        s_tx[i].ui32Count = 0u;
+        s_tx[i].pvBuffer1 = NULL;
+        s_tx[i].DES3.pLink = &s_tx[(i + 1u) % ETH_MAC_TX_DESC];
+        s_tx[i].ui32CtrlStatus = DES0_TX_CTRL_CHAINED;
+    }
+    s_rxNext = 0u;
+    s_txHead = 0u;
+    s_txTail = 0u;
+    s_txCount = 0u;
+    s_txFrames = config->tx_frames;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_EMAC0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_EPHY0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_EMAC0) ||
+           !SysCtlPeripheralReady(SYSCTL_PERIPH_EPHY0))
+    {
+    }
+    EMACPHYConfigSet(EMAC0_BASE, EMAC_PHY_TYPE_INTERNAL | EMAC_PHY_INT_MDIX_EN |
+                                 EMAC_PHY_AN_100B_T_FULL_DUPLEX);
+    EMACReset(EMAC0_BASE);
+    EMACInit(EMAC0_BASE, clock_hz,
+             EMAC_BCONFIG_MIXED_BURST | EMAC_BCONFIG_PRIORITY_FIXED, 4, 4, 0);
+    EMACConfigSet(EMAC0_BASE,
+                  MAC_CONFIG | (config->loopback ? EMAC_CONFIG_LOOPBACK : 0u),
+                  MAC_MODE, 0);
+    EMACAddrSet(EMAC0_BASE, 0, mac);
+    EMACFrameFilterSet(EMAC0_BASE, 0);
+    EMACRxDMADescriptorListSet(EMAC0_BASE, s_rx);
+    EMACTxDMADescriptorListSet(EMAC0_BASE, s_tx);
+    EMACRxWatchdogTimerSet(EMAC0_BASE, (uint8_t)riwt);
+
+    (void)register_isr(INT_EMAC0, eth_mac_isr);
+    EMACIntClear(EMAC0_BASE, EMACIntStatus(EMAC0_BASE, false));
+    EMACIntEnable(EMAC0_BASE, MAC_INTS);
+    EMACTxEnable(EMAC0_BASE);
+    EMACRxEnable(EMAC0_BASE);
+    IntEnable(INT_EMAC0);
+    return true;
+}
+
+/**
+ * EMAC0 interrupt: frames received, frames sent, RX ring ran out of
+ * descriptors.
+ */
+void eth_mac_isr(void)
+{
+    uint32_t status = EMACIntStatus(EMAC0_BASE, true);
+    uint32_t primask;
+
+    EMACIntClear(EMAC0_BASE, status);
+    s_netif->stats.irqs++;
+
+    if ((status & (EMAC_INT_RECEIVE | EMAC_INT_RX_NO_BUFFER)) != 0u)
+    {
+        rx_process(s_netif);
+    }
+    if ((status & EMAC_INT_TRANSMIT) != 0u)
+    {
+        primask = lock();
+        tx_reclaim();
+        unlock(primask);
+    }
+    /* the RX DMA suspended on a descriptor it did not own; it owns it now */
+    if ((status & EMAC_INT_RX_NO_BUFFER) != 0u)
+    {
+        EMACRxDMAPollDemand(EMAC0_BASE);
+    }
+}
@@ -0,0 +1,93 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     eth_mac.h
+ * @author   insert authors names here
+ * @brief    Ethernet MAC (EMAC0 and the internal PHY) as a net_if_t
+ *           transport. \n
+ *           The DMA works on two chained descriptor rings whose buffers
+ *           are net_buf_t from net_buf.h: a received frame is handed to
+ *           net_if_t.rx() in the buffer the DMA wrote, and a fresh buffer
+ *           takes its place in the ring; a frame given to net_if_send() is
+ *           sent from its buffer, which is freed once the DMA is done.\n
+ *           Interrupt coalescing, both directions:
+ *           - RX: only every rx_frames-th descriptor raises the receive
+ *             interrupt; the others arm the receive watchdog, which raises
+ *             it rx_timeout_us after a frame if no interrupt came sooner.
+ *           - TX: only every tx_frames-th frame asks for the transmit
+ *             interrupt; buffers of the others are freed at that interrupt
+ *             or by the next net_if_send() that needs their descriptor.
+ *           The IPv4 and UDP checksums are computed and checked by the MAC
+ *           (NET_IF_TX_CSUM, NET_IF_RX_CSUM).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _ETH_MAC_H_
+#define _ETH_MAC_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/net_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Descriptors per ring; each RX descriptor holds a buffer at all times. */
+#ifndef ETH_MAC_RX_DESC
+#define ETH_MAC_RX_DESC     8u
+#endif
+
+#ifndef ETH_MAC_TX_DESC
+#define ETH_MAC_TX_DESC     8u
+#endif
+
+typedef struct
+{
+    bool     loopback;      /**< MAC loopback: sent frames come back in   */
+    uint32_t rx_frames;     /**< receive interrupt every n frames; divides
+                                 ETH_MAC_RX_DESC                          */
+    uint32_t rx_timeout_us; /**< latest receive interrupt after a frame;
+                                 needed if rx_frames > 1, at most
+                                 255 * 256 clock cycles                   */
+    uint32_t tx_frames;     /**< transmit interrupt every n frames, at most
+                                 ETH_MAC_TX_DESC                          */
+} eth_mac_config_t;
+
+/** One interrupt per frame in each direction, no loopback. */
+#define ETH_MAC_CONFIG_DEFAULT  { false, 1u, 0u, 1u }
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool eth_mac_init(net_if_t *netif, uint32_t clock_hz,
+                  const uint8_t mac[NET_MAC_LEN],
+                  const eth_mac_config_t *config);
+
+void eth_mac_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1253 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - formatted I/O
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     fmt.cpp
+ * @author   insert authors names here
+ * @brief    Run-time side of fmt.h: walks the compiled pieces. \n
+ *           Integers are converted two digits per division (table of
+ *           "00".."99"); 64-bit values are split in 9-digit chunks, one
+ *           64-bit division each. The shortest float digits use the Ryu
+ *           algorithm (Ulf Adams, PLDI 2018) for binary32: 32x64-bit
+ *           multiplications by tabulated powers of 5, no loop over digits
+ *           of the exact value, no floating point. Fixed point is computed
+ *           exactly from the mantissa, in 64 bits, or 128 bits for values
+ *           of 2^64 and above.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "common/fmt.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include "common/uart_stdio.h"
+#else
+#include <stdio.h>
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define FLOAT_MANTISSA_BITS     23
+#define FLOAT_BIAS              127
+#define FLOAT_EXP_MAX           0xFFu
+
+/** Ryu: bits of the tabulated 5^-q and 5^i. */
+#define POW5_INV_BITCOUNT       59
+#define POW5_BITCOUNT           61
+
+/** Shortest float output: at most 9 digits. */
+#define FLOAT_DIGITS            9
+/** Shortest output in fixed point for decimal exponents -4..8, as %g. */
+#define FIXED_EXP_MIN           (-4)
+#define FIXED_EXP_MAX           9
+
+/** Largest text of one field, before padding. */
+#define FIELD_MAX               48u
+
+/** Significant digits kept when scanning a float. */
+#define SCAN_DIGITS_MAX         19
+#define SCAN_EXP_LIMIT          400
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const char s_digits2[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char s_hexLower[] = "0123456789abcdef";
+static const char s_hexUpper[] = "0123456789ABCDEF";
+
+static const uint32_t s_pow10[10] =
+{
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u,
+    100000000u, 1000000000u
+};
+
+/** Exact in binary32. */
+static const float s_pow10f[11] =
+{
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+/** Exact in binary64. */
+static const double s_pow10d[23] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/** Ryu: floor(2^(pow5bits(q) - 1 + 59) / 5^q) + 1. */
+static const uint64_t s_pow5InvSplit[31] =
+{
+    576460752303423489ull, 461168601842738791ull,
+    368934881474191033ull, 295147905179352826ull,
+    472236648286964522ull, 377789318629571618ull,
+    302231454903657294ull, 483570327845851670ull,
+    386856262276681336ull, 309485009821345069ull,
+    495176015714152110ull, 396140812571321688ull,
+    316912650057057351ull, 507060240091291761ull,
+    405648192073033409ull, 324518553658426727ull,
+    519229685853482763ull, 415383748682786211ull,
+    332306998946228969ull, 531691198313966350ull,
+    425352958651173080ull, 340282366920938464ull,
+    544451787073501542ull, 435561429658801234ull,
+    348449143727040987ull, 557518629963265579ull,
+    446014903970612463ull, 356811923176489971ull,
+    570899077082383953ull, 456719261665907162ull,
+    365375409332725730ull
+};
+
+/** Ryu: 5^i scaled to 61 bits. */
+static const uint64_t s_pow5Split[48] =
+{
+    1152921504606846976ull, 1441151880758558720ull,
+    1801439850948198400ull, 2251799813685248000ull,
+    1407374883553280000ull, 1759218604441600000ull,
+    2199023255552000000ull, 1374389534720000000ull,
+    1717986918400000000ull, 2147483648000000000ull,
+    1342177280000000000ull, 1677721600000000000ull,
+    2097152000000000000ull, 1310720000000000000ull,
+    1638400000000000000ull, 2048000000000000000ull,
+    1280000000000000000ull, 1600000000000000000ull,
+    2000000000000000000ull, 1250000000000000000ull,
+    1562500000000000000ull, 1953125000000000000ull,
+    1220703125000000000ull, 1525878906250000000ull,
+    1907348632812500000ull, 1192092895507812500ull,
+    1490116119384765625ull, 1862645149230957031ull,
+    1164153218269348144ull, 1455191522836685180ull,
+    1818989403545856475ull, 2273736754432320594ull,
+    1421085471520200371ull, 1776356839400250464ull,
+    2220446049250313080ull, 1387778780781445675ull,
+    1734723475976807094ull, 2168404344971008868ull,
+    1355252715606880542ull, 1694065894508600678ull,
+    2117582368135750847ull, 1323488980084844279ull,
+    1654361225106055349ull, 2067951531382569187ull,
+    1292469707114105741ull, 1615587133892632177ull,
+    2019483917365790221ull, 1262177448353618888ull
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------
+ *      Output
+ *------------------------------------------------------------------------*/
+static void put(FmtWriter *w, const char *data, size_t n)
+{
+    w->total += n;
+    while (n != 0u)
+    {
+        size_t room = w->size - w->len;
+
+        if (room == 0u)
+        {
+            if (w->flush == NULL || w->len == 0u)
+            {
+                return;
+            }
+            w->flush(w->buf, w->len);
+            w->len = 0u;
+            room = w->size;
+        }
+        if (room > n)
+        {
+            room = n;
+        }
+        memcpy(w->buf + w->len, data, room);
+        w->len += room;
+        data += room;
+        n -= room;
+    }
+}
+
+static void pad(FmtWriter *w, char c, size_t n)
+{
+    while (n-- != 0u)
+    {
+        put(w, &c, 1u);
+    }
+}
+
+/**
+ * Writes a field: sign, then @p text, padded to the piece's width.
+ *
+ * @param[in] sign    - '-', '+' or 0
+ * @param[in] numeric - right aligned and zero padded by default
+ */
+static void emit(FmtWriter *w, const FmtPiece *piece, char sign,
+                 const char *text, size_t n, bool numeric)
+{
+    size_t len = n + ((sign != 0) ? 1u : 0u);
+    size_t fill = (piece->width > len) ? piece->width - len : 0u;
+    bool left = (piece->flags & FMT_LEFT) != 0u ||
+                (!numeric && (piece->flags & FMT_RIGHT) == 0u);
+
+    if (fill != 0u && !left && !(numeric && (piece->flags & FMT_ZERO) != 0u))
+    {
+        pad(w, ' ', fill);
+        fill = 0u;
+    }
+    if (sign != 0)
+    {
+        put(w, &sign, 1u);
+    }
+    if (fill != 0u && !left)
+    {
+        pad(w, '0', fill);
+        fill = 0u;
+    }
+    put(w, text, n);
+    pad(w, ' ', fill);
+}
+
+/*--------------------------------------------------------------------------
+ *      Integers
+ *------------------------------------------------------------------------*/
+/** Decimal digits of @p v, ending at @p end. @returns size_t - count */
+static size_t dec32(char *end, uint32_t v)
+{
+    char *p = end;
+
+    while (v >= 100u)
+    {
+        uint32_t q = v / 100u;
+        uint32_t r = (v - q * 100u) * 2u;
+
+        p -= 2;
+        p[0] = s_digits2[r];
+        p[1] = s_digits2[r + 1u];
+        v = q;
+    }
+    if (v >= 10u)
+    {
+        p -= 2;
+        p[0] = s_digits2[v * 2u];
+        p[1] = s_digits2[v * 2u + 1u];
+    }
+    else
+    {
+        *--p = static_cast<char>('0' + v);
+    }
+    return static_cast<size_t>(end - p);
+}
+
+/** As dec32(), zero padded to @p digits. */
+static void dec32_fixed(char *end, uint32_t v, size_t digits)
+{
+    size_t n = dec32(end, v);
+
+    while (n < digits)
+    {
+        end[-static_cast<ptrdiff_t>(++n)] = '0';
+    }
+}
+
+static size_t dec64(char *end, uint64_t v)
+{
+    size_t n = 0u;
+
+    while (v > UINT32_MAX)
+    {
+        uint64_t q = v / 1000000000u;
+
+        dec32_fixed(end - n, static_cast<uint32_t>(v - q * 1000000000u), 9u);
+        n += 9u;
+        v = q;
+    }
+    return n + dec32(end - n, static_cast<uint32_t>(v));
+}
+
+/** Digits in base 2^@p shift. */
+static size_t radix(char *end, uint64_t v, uint32_t shift, const char *digits)
+{
+    char *p = end;
+    uint32_t mask = (1u << shift) - 1u;
+
+    do
+    {
+        *--p = digits[v & mask];
+        v >>= shift;
+    } while (v != 0u);
+    return static_cast<size_t>(end - p);
+}
+
+static void format_int(FmtWriter *w, const FmtPiece *piece, uint64_t magnitude,
+                       bool negative)
+{
+    char text[FIELD_MAX];
+    char *end = text + sizeof(text);
+    size_t n;
+    char sign = negative ? '-' : (((piece->flags & FMT_PLUS) != 0u) ? '+' : 0);
+
+    switch (piece->type)
+    {
+    case 'x':
+        n = radix(end, magnitude, 4u, s_hexLower);
+        break;
+    case 'X':
+        n = radix(end, magnitude, 4u, s_hexUpper);
+        break;
+    case 'o':
+        n = radix(end, magnitude, 3u, s_hexLower);
+        break;
+    case 'b':
+        n = radix(end, magnitude, 1u, s_hexLower);
+        break;
+    default:
+        n = (magnitude <= UINT32_MAX) ? dec32(end, static_cast<uint32_t>(magnitude))
+                                      : dec64(end, magnitude);
+        break;
+    }
+    emit(w, piece, sign, end - n, n, true);
+}
+
+/*--------------------------------------------------------------------------
+ *      Shortest float digits (Ryu, binary32)
+ *------------------------------------------------------------------------*/
+/** ceil(log2(5^e)), e > 0; 1 for e = 0. */
+static int32_t pow5bits(int32_t e)
+{
+    return ((e * 1217359) >> 19) + 1;
+}
+
+/** floor(log10(2^e)) */
+static uint32_t log10_pow2(int32_t e)
+{
+    return static_cast<uint32_t>((e * 78913) >> 18);
+}
+
+/** floor(log10(5^e)) */
+static uint32_t log10_pow5(int32_t e)
+{
+    return static_cast<uint32_t>((e * 732923) >> 20);
+}
+
+static bool multiple_of_pow5(uint32_t v, uint32_t p)
+{
+    uint32_t count = 0u;
+
+    while (v % 5u == 0u)
+    {
+        v /= 5u;
+        count++;
+    }
+    return count >= p;
+}
+
+static bool multiple_of_pow2(uint32_t v, uint32_t p)
+{
+    return (v & ((1u << p) - 1u)) == 0u;
+}
+
+/** (m * factor) >> shift, shift >= 32. */
+static uint32_t mul_shift(uint32_t m, uint64_t factor, int32_t shift)
+{
+    uint64_t lo = static_cast<uint64_t>(m) * static_cast<uint32_t>(factor);
+    uint64_t hi = static_cast<uint64_t>(m) * static_cast<uint32_t>(factor >> 32);
+
+    return static_cast<uint32_t>(((lo >> 32) + hi) >> (shift - 32));
+}
+
+/**
+ * Shortest decimal that reads back as @p value: digits * 10^exp10.
+ *
+ * @param[in]  value  - finite
+ * @param[out] digits - at least 9 chars, not terminated
+ * @param[out] exp10  - decimal exponent of the last digit
+ * @returns size_t - number of digits
+ */
+size_t fmt_float_shortest(float value, char *digits, int32_t *exp10)
+{
+    uint32_t bits;
+    uint32_t mantissa;
+    uint32_t exponent;
+    int32_t e2;
+    uint32_t m2;
+    bool even;
+    uint32_t mv;
+    uint32_t mp;
+    uint32_t mm;
+    uint32_t mmShift;
+    uint32_t vr;
+    uint32_t vp;
+    uint32_t vm;
+    int32_t e10;
+    bool vmTrailingZeros = false;
+    bool vrTrailingZeros = false;
+    uint32_t lastRemoved = 0u;
+    int32_t removed = 0;
+    uint32_t output;
+    char buf[FLOAT_DIGITS + 1];
+    size_t n;
+
+    memcpy(&bits, &value, sizeof(bits));
+    mantissa = bits & ((1u << FLOAT_MANTISSA_BITS) - 1u);
+    exponent = (bits >> FLOAT_MANTISSA_BITS) & FLOAT_EXP_MAX;
+    if (exponent == 0u && mantissa == 0u)
+    {
+        digits[0] = '0';
+        *exp10 = 0;
+        return 1u;
+    }
+
+    /* the interval of values that round to this float, times 4 */
+    if (exponent == 0u)
+    {
+        e2 = 1 - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+        m2 = mantissa;
+    }
+    else
+    {
+        e2 = static_cast<int32_t>(exponent) - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+        m2 = (1u << FLOAT_MANTISSA_BITS) | mantissa;
+    }
+    even = (m2 & 1u) == 0u;
+    mv = 4u * m2;
+    mp = 4u * m2 + 2u;
+    mmShift = (mantissa != 0u || exponent <= 1u) ? 1u : 0u;
+    mm = 4u * m2 - 1u - mmShift;
+
+    /* to decimal: vr, vp, vm = mv, mp, mm * 2^e2 / 10^e10 */
+    if (e2 >= 0)
+    {
+        uint32_t q = log10_pow2(e2);
+        int32_t k = POW5_INV_BITCOUNT + pow5bits(static_cast<int32_t>(q)) - 1;
+        int32_t i = -e2 + static_cast<int32_t>(q) + k;
+
+        e10 = static_cast<int32_t>(q);
+        vr = mul_shift(mv, s_pow5InvSplit[q], i);
+        vp = mul_shift(mp, s_pow5InvSplit[q], i);
+        vm = mul_shift(mm, s_pow5InvSplit[q], i);
+        if (q != 0u && (vp - 1u) / 10u <= vm / 10u)
+        {
+            int32_t l = POW5_INV_BITCOUNT + pow5bits(static_cast<int32_t>(q) - 1) - 1;
+
+            lastRemoved = mul_shift(mv, s_pow5InvSplit[q - 1u],
+                                    -e2 + static_cast<int32_t>(q) - 1 + l) % 10u;
+        }
+        if (q <= 9u)
+        {
+            if (mv % 5u == 0u)
+            {
+                vrTrailingZeros = multiple_of_pow5(mv, q);
+            }
+            else if (even)
+            {
+                vmTrailingZeros = multiple_of_pow5(mm, q);
+            }
+            else
+            {
+                vp -= multiple_of_pow5(mp, q) ? 1u : 0u;
+            }
+        }
+    }
+    else
+    {
+        uint32_t q = log10_pow5(-e2);
+        int32_t i = -e2 - static_cast<int32_t>(q);
+        int32_t k = pow5bits(i) - POW5_BITCOUNT;
+        int32_t j = static_cast<int32_t>(q) - k;
+
+        e10 = static_cast<int32_t>(q) + e2;
+        vr = mul_shift(mv, s_pow5Split[i], j);
+        vp = mul_shift(mp, s_pow5Split[i], j);
+        vm = mul_shift(mm, s_pow5Split[i], j);
+        if (q != 0u && (vp - 1u) / 10u <= vm / 10u)
+        {
+            j = static_cast<int32_t>(q) - 1 - (pow5bits(i + 1) - POW5_BITCOUNT);
+            lastRemoved = mul_shift(mv, s_pow5Split[i + 1], j) % 10u;
+        }
+        if (q <= 1u)
+        {
+            vrTrailingZeros = true;
+            if (even)
+            {
+                vmTrailingZeros = mmShift == 1u;
+            }
+            else
+            {
+                vp--;
+            }
+        }
+        else if (q < 31u)
+        {
+            vrTrailingZeros = multiple_of_pow2(mv, q - 1u);
+        }
+    }
+
+    /* drop digits while the interval still holds a shorter number */
+    if (vmTrailingZeros || vrTrailingZeros)
+    {
+        while (vp / 10u > vm / 10u)
+        {
+            vmTrailingZeros = vmTrailingZeros && vm % 10u == 0u;
+            vrTrailingZeros = vrTrailingZeros && lastRemoved == 0u;
+            lastRemoved = vr % 10u;
+            vr /= 10u;
+            vp /= 10u;
+            vm /= 10u;
+            removed++;
+        }
+        if (vmTrailingZeros)
+        {
+            while (vm % 10u == 0u)
+            {
+                vrTrailingZeros = vrTrailingZeros && lastRemoved == 0u;
+                lastRemoved = vr % 10u;
+                vr /= 10u;
+                vp /= 10u;
+                vm /= 10u;
+                removed++;
+            }
+        }
+        if (vrTrailingZeros && lastRemoved == 5u && vr % 2u == 0u)
+        {
+            /* exactly halfway: round to even */
+            lastRemoved = 4u;
+        }
+        output = vr + (((vr == vm && (!even || !vmTrailingZeros)) ||
+                        lastRemoved >= 5u) ? 1u : 0u);
+    }
+    else
+    {
+        while (vp / 10u > vm / 10u)
+        {
+            lastRemoved = vr % 10u;
+            vr /= 10u;
+            vp /= 10u;
+            vm /= 10u;
+            removed++;
+        }
+        output = vr + ((vr == vm || lastRemoved >= 5u) ? 1u : 0u);
+    }
+
+    n = dec32(buf + sizeof(buf), output);
+    memcpy(digits, buf + sizeof(buf) - n, n);
+    *exp10 = e10 + removed;
+    return n;
+}
+
+/*--------------------------------------------------------------------------
+ *      Floats
+ *------------------------------------------------------------------------*/
+/** Exponent part: e+XX, e-XX. @returns size_t - chars */
+static size_t exponent_text(char *p, int32_t exp)
+{
+    char end[4];
+    size_t n;
+
+    p[0] = 'e';
+    p[1] = (exp < 0) ? '-' : '+';
+    if (exp < 0)
+    {
+        exp = -exp;
+    }
+    n = dec32(end + sizeof(end), static_cast<uint32_t>(exp));
+    if (n < 2u)
+    {
+        p[2] = '0';
+        p[3] = end[sizeof(end) - 1u];
+        return 4u;
+    }
+    memcpy(p + 2, end + sizeof(end) - n, n);
+    return 2u + n;
+}
+
+/** Shortest digits, in fixed point or scientific notation. */
+static size_t float_shortest_text(char *text, float value, char type)
+{
+    char digits[FLOAT_DIGITS];
+    int32_t exp10;
+    size_t n = fmt_float_shortest(value, digits, &exp10);
+    int32_t sci = exp10 + static_cast<int32_t>(n) - 1;
+    size_t len = 0u;
+
+    if (type == 'e' || sci < FIXED_EXP_MIN || sci >= FIXED_EXP_MAX)
+    {
+        text[len++] = digits[0];
+        if (n > 1u)
+        {
+            text[len++] = '.';
+            memcpy(text + len, digits + 1, n - 1u);
+            len += n - 1u;
+        }
+        return len + exponent_text(text + len, sci);
+    }
+    if (sci < 0)
+    {
+        text[len++] = '0';
+        text[len++] = '.';
+        for (int32_t z = -1; z > sci; z--)
+        {
+            text[len++] = '0';
+        }
+        memcpy(text + len, digits, n);
+        return len + n;
+    }
+    for (size_t i = 0u; i < n || static_cast<int32_t>(i) <= sci; i++)
+    {
+        if (static_cast<int32_t>(i) == sci + 1)
+        {
+            text[len++] = '.';
+        }
+        text[len++] = (i < n) ? digits[i] : '0';
+    }
+    return len;
+}
+
+/**
+ * Decimal digits of m * 2^e2 >= 2^64 (e2 <= 104): 128-bit value divided
+ * by 10^9 repeatedly.
+ */
+static size_t dec_wide(char *end, uint32_t m, int32_t e2)
+{
+    uint32_t limb[5] = { 0u, 0u, 0u, 0u, 0u };     /* most significant first */
+    uint64_t wide = static_cast<uint64_t>(m) << (e2 % 32);
+    size_t n = 0u;
+    bool nonzero = true;
+
+    limb[4 - e2 / 32] = static_cast<uint32_t>(wide);
+    limb[3 - e2 / 32] = static_cast<uint32_t>(wide >> 32);
+    while (nonzero)
+    {
+        uint64_t rem = 0u;
+
+        nonzero = false;
+        for (size_t i = 0u; i < 5u; i++)
+        {
+            uint64_t cur = (rem << 32) | limb[i];
+
+            limb[i] = static_cast<uint32_t>(cur / 1000000000u);
+            rem = cur % 1000000000u;
+            nonzero = nonzero || limb[i] != 0u;
+        }
+        if (nonzero)
+        {
+            dec32_fixed(end - n, static_cast<uint32_t>(rem), 9u);
+            n += 9u;
+        }
+        else
+        {
+            n += dec32(end - n, static_cast<uint32_t>(rem));
+        }
+    }
+    return n;
+}
+
+/** Fixed point with @p precision decimals, exactly rounded (to even). */
+static size_t float_fixed_text(char *end, uint32_t bits, uint32_t precision)
+{
+    uint32_t exponent = (bits >> FLOAT_MANTISSA_BITS) & FLOAT_EXP_MAX;
+    uint32_t m = bits & ((1u << FLOAT_MANTISSA_BITS) - 1u);
+    int32_t e2 = 1 - FLOAT_BIAS - FLOAT_MANTISSA_BITS;
+    uint64_t scaled;
+    size_t n = 0u;
+
+    if (exponent != 0u)
+    {
+        m |= 1u << FLOAT_MANTISSA_BITS;
+        e2 = static_cast<int32_t>(exponent) - FLOAT_BIAS - FLOAT_MANTISSA_BITS;
+    }
+
+    if (e2 >= 0)
+    {
+        /* an integer: the decimals are zeros */
+        for (n = 0u; n < precision; n++)
+        {
+            end[-1 - static_cast<ptrdiff_t>(n)] = '0';
+        }
+        if (precision != 0u)
+        {
+            end[-1 - static_cast<ptrdiff_t>(n++)] = '.';
+        }
+        if (e2 <= 40)
+        {
+            return n + dec64(end - n, static_cast<uint64_t>(m) << e2);
+        }
+        return n + dec_wide(end - n, m, e2);
+    }
+
+    /* round(m * 10^p / 2^-e2), m * 10^p < 2^54 */
+    scaled = static_cast<uint64_t>(m) * s_pow10[precision];
+    if (-e2 >= 63)
+    {
+        scaled = 0u;
+    }
+    else
+    {
+        uint32_t shift = static_cast<uint32_t>(-e2);
+        uint64_t rem = scaled & ((1ull << shift) - 1u);
+        uint64_t half = 1ull << (shift - 1u);
+
+        scaled >>= shift;
+        if (rem > half || (rem == half && (scaled & 1u) != 0u))
+        {
+            scaled++;
+        }
+    }
+    if (precision != 0u)
+    {
+        uint64_t whole = scaled / s_pow10[precision];
+
+        dec32_fixed(end, static_cast<uint32_t>(scaled - whole * s_pow10[precision]),
+                    precision);
+        n = precision;
+        end[-1 - static_cast<ptrdiff_t>(n++)] = '.';
+        scaled = whole;
+    }
+    return n + dec64(end - n, scaled);
+}
+
+static void format_float(FmtWriter *w, const FmtPiece *piece, float value)
+{
+    char text[FIELD_MAX];
+    uint32_t bits;
+    char sign;
+    size_t n;
+    FmtPiece spec = *piece;
+
+    memcpy(&bits, &value, sizeof(bits));
+    sign = ((bits >> 31) != 0u) ? '-' : (((piece->flags & FMT_PLUS) != 0u) ? '+' : 0);
+    bits &= 0x7FFFFFFFu;
+
+    if ((bits >> FLOAT_MANTISSA_BITS) == FLOAT_EXP_MAX)
+    {
+        bool nan = (bits & ((1u << FLOAT_MANTISSA_BITS) - 1u)) != 0u;
+
+        spec.flags &= static_cast<uint8_t>(~FMT_ZERO);
+        emit(w, &spec, nan ? 0 : sign, nan ? "nan" : "inf", 3u, true);
+        return;
+    }
+    if (piece->type == 'f')
+    {
+        uint32_t precision = (piece->precision == FMT_NO_PRECISION) ? 6u
+                                                                    : piece->precision;
+
+        n = float_fixed_text(text + sizeof(text), bits, precision);
+        emit(w, piece, sign, text + sizeof(text) - n, n, true);
+        return;
+    }
+    memcpy(&value, &bits, sizeof(value));
+    n = float_shortest_text(text, value, piece->type);
+    emit(w, piece, sign, text, n, true);
+}
+
+/**
+ * Formats the arguments as the compiled pieces say (called by the
+ * templates of fmt.h).
+ */
+void fmt_vformat(FmtWriter *writer, const char *str, const FmtPiece *pieces,
+                 size_t count, const FmtArg *args)
+{
+    for (size_t i = 0u; i < count; i++)
+    {
+        const FmtPiece *piece = &pieces[i];
+        const FmtArg *arg;
+
+        put(writer, str + piece->pos, piece->len);
+        if (piece->field == FMT_NO_FIELD)
+        {
+            continue;
+        }
+        arg = &args[piece->field];
+        switch (piece->kind)
+        {
+        case FMT_KIND_INT:
+            format_int(writer, piece,
+                       (arg->i < 0) ? 0u - static_cast<uint64_t>(static_cast<int64_t>(arg->i))
+                                    : static_cast<uint64_t>(arg->i),
+                       arg->i < 0);
+            break;
+        case FMT_KIND_UINT:
+            format_int(writer, piece, arg->u, false);
+            break;
+        case FMT_KIND_INT64:
+            format_int(writer, piece,
+                       (arg->i64 < 0) ? 0u - static_cast<uint64_t>(arg->i64)
+                                      : static_cast<uint64_t>(arg->i64),
+                       arg->i64 < 0);
+            break;
+        case FMT_KIND_UINT64:
+            format_int(writer, piece, arg->u64, false);
+            break;
+        case FMT_KIND_CHAR:
+            if (piece->type == 0 || piece->type == 'c')
+            {
+                char c = static_cast<char>(arg->u);
+
+                emit(writer, piece, 0, &c, 1u, false);
+            }
+            else
+            {
+                format_int(writer, piece, arg->u, false);
+            }
+            break;
+        case FMT_KIND_BOOL:
+            emit(writer, piece, 0, (arg->u != 0u) ? "true" : "false",
+                 (arg->u != 0u) ? 4u : 5u, false);
+            break;
+        case FMT_KIND_FLOAT:
+            format_float(writer, piece, arg->f);
+            break;
+        case FMT_KIND_STR:
+        {
+            const char *s = (arg->s != NULL) ? arg->s : "(null)";
+            size_t n = 0u;
+
+            while (s[n] != '\0' && (piece->precision == FMT_NO_PRECISION ||
+                                    n < piece->precision))
+            {
+                n++;
+            }
+            emit(writer, piece, 0, s, n, false);
+            break;
+        }
+        case FMT_KIND_PTR:
+        {
+            char text[FIELD_MAX];
+            size_t n = radix(text + sizeof(text),
+                             static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg->p)),
+                             4u, s_hexLower);
+
+            text[sizeof(text) - n - 1u] = 'x';
+            text[sizeof(text) - n - 2u] = '0';
+            emit(writer, piece, 0, text + sizeof(text) - n - 2u, n + 2u, true);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------
+ *      Scan
+ *------------------------------------------------------------------------*/
+static bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' ||
+           c == '\v';
+}
+
+static const char *skip_space(const char *s)
+{
+    while (is_space(*s))
+    {
+        s++;
+    }
+    return s;
+}
+
+/** @returns int32_t - value of @p c in base @p base, -1 if not a digit */
+static int32_t digit_value(char c, uint32_t base)
+{
+    int32_t v = -1;
+
+    if (c >= '0' && c <= '9')
+    {
+        v = c - '0';
+    }
+    else if (c >= 'a' && c <= 'f')
+    {
+        v = c - 'a' + 10;
+    }
+    else if (c >= 'A' && c <= 'F')
+    {
+        v = c - 'A' + 10;
+    }
+    return (v >= 0 && static_cast<uint32_t>(v) < base) ? v : -1;
+}
+
+/**
+ * Reads an integer into the variable of @p ref, range checked.
+ *
+ * @returns const char * - after the number, NULL if none or out of range
+ */
+static const char *scan_int(const char *s, const FmtPiece *piece,
+                            const FmtRef *ref)
+{
+    bool is_signed = piece->kind == FMT_KIND_INT || piece->kind == FMT_KIND_INT64;
+    uint32_t base = (piece->type == 'x') ? 16u : ((piece->type == 'b') ? 2u : 10u);
+    uint64_t max = (ref->size >= 8u) ? UINT64_MAX
+                                     : (1ull << (8u * ref->size)) - 1u;
+    bool negative = false;
+    uint64_t v = 0u;
+    bool any = false;
+
+    if (*s == '-' || *s == '+')
+    {
+        negative = (*s++ == '-');
+        if (negative && !is_signed)
+        {
+            return NULL;
+        }
+    }
+    if (base == 16u && s[0] == '0' && (s[1] == 'x' || s[1] == 'X') &&
+        digit_value(s[2], 16u) >= 0)
+    {
+        s += 2;
+    }
+    if (is_signed)
+    {
+        /* magnitude: up to 2^(bits-1), the negative limit */
+        max = max / 2u + (negative ? 1u : 0u);
+    }
+    for (int32_t d = digit_value(*s, base); d >= 0; d = digit_value(*++s, base))
+    {
+        if (v > (max - static_cast<uint32_t>(d)) / base)
+        {
+            return NULL;
+        }
+        v = v * base + static_cast<uint32_t>(d);
+        any = true;
+    }
+    if (!any)
+    {
+        return NULL;
+    }
+    if (negative)
+    {
+        v = 0u - v;
+    }
+    switch (ref->size)
+    {
+    case 1u:
+        *static_cast<uint8_t *>(ref->p) = static_cast<uint8_t>(v);
+        break;
+    case 2u:
+        *static_cast<uint16_t *>(ref->p) = static_cast<uint16_t>(v);
+        break;
+    case 4u:
+        *static_cast<uint32_t *>(ref->p) = static_cast<uint32_t>(v);
+        break;
+    default:
+        *static_cast<uint64_t *>(ref->p) = v;
+        break;
+    }
+    return s;
+}
+
+/** @returns bool - @p s starts with @p word, any case */
+static bool match_word(const char *s, const char *word)
+{
+    for (; *word != '\0'; s++, word++)
+    {
+        if ((*s | 0x20) != *word)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * digits * 10^q as the nearest float. Exact in the fast paths; the
+ * product/quotient in binary64 is nudged when it lands on a binary32 tie,
+ * so that the second rounding goes the right way.
+ */
+static float to_float(uint64_t digits, int32_t q)
+{
+    double x;
+    double r;
+
+    if (digits == 0u)
+    {
+        return 0.0f;
+    }
+    if (digits <= (1u << 24) && q >= -10 && q <= 10)
+    {
+        float f = static_cast<float>(digits);
+
+        return (q < 0) ? f / s_pow10f[-q] : f * s_pow10f[q];
+    }
+    x = static_cast<double>(digits);
+    if (digits < (1ull << 53) && q >= -22 && q <= 22)
+    {
+        double p = s_pow10d[(q < 0) ? -q : q];
+        uint64_t bits;
+        double error;
+
+        r = (q < 0) ? x / p : x * p;
+        memcpy(&bits, &r, sizeof(bits));
+        if ((bits & 0x1FFFFFFFu) == 0x10000000u)
+        {
+            /* sign of (exact - r) */
+            error = (q < 0) ? -fma(r, p, -x) : fma(x, p, -r);
+            if (error != 0.0)
+            {
+                r = nextafter(r, (error > 0.0) ? HUGE_VAL : 0.0);
+            }
+        }
+        return static_cast<float>(r);
+    }
+
+    /* outside the fast paths: within an ulp */
+    r = x;
+    for (; q > 22; q -= 22)
+    {
+        r *= 1e22;
+    }
+    for (; q < -22; q += 22)
+    {
+        r /= 1e22;
+    }
+    r = (q < 0) ? r / s_pow10d[-q] : r * s_pow10d[q];
+    return static_cast<float>(r);
+}
+
+/** @returns const char * - after the number, NULL if none */
+static const char *scan_float(const char *s, float *out)
+{
+    bool negative = false;
+    uint64_t digits = 0u;
+    int32_t kept = 0;
+    int32_t q = 0;
+    bool any = false;
+
+    if (*s == '-' || *s == '+')
+    {
+        negative = (*s++ == '-');
+    }
+    if (match_word(s, "inf") || match_word(s, "nan"))
+    {
+        bool nan = (s[0] | 0x20) == 'n';
+
+        *out = nan ? NAN : (negative ? -HUGE_VALF : HUGE_VALF);
+        return s + (match_word(s, "infinity") ? 8 : 3);
+    }
+    for (; *s >= '0' && *s <= '9'; s++)
+    {
+        any = true;
+        if (kept < SCAN_DIGITS_MAX)
+        {
+            digits = digits * 10u + static_cast<uint32_t>(*s - '0');
+            kept += (digits != 0u) ? 1 : 0;
+        }
+        else
+        {
+            q++;
+        }
+    }
+    if (*s == '.')
+    {
+        for (s++; *s >= '0' && *s <= '9'; s++)
+        {
+            any = true;
+            if (kept < SCAN_DIGITS_MAX)
+            {
+                digits = digits * 10u + static_cast<uint32_t>(*s - '0');
+                kept += (digits != 0u) ? 1 : 0;
+                q--;
+            }
+        }
+    }
+    if (!any)
+    {
+        return NULL;
+    }
+    if ((*s == 'e' || *s == 'E') &&
+        ((s[1] >= '0' && s[1] <= '9') ||
+         ((s[1] == '-' || s[1] == '+') && s[2] >= '0' && s[2] <= '9')))
+    {
+        bool minus = false;
+        int32_t e = 0;
+
+        s++;
+        if (*s == '-' || *s == '+')
+        {
+            minus = (*s++ == '-');
+        }
+        for (; *s >= '0' && *s <= '9'; s++)
+        {
+            if (e < SCAN_EXP_LIMIT)
+            {
+                e = e * 10 + (*s - '0');
+            }
+        }
+        q += minus ? -e : e;
+    }
+    if (q > SCAN_EXP_LIMIT)
+    {
+        q = SCAN_EXP_LIMIT;
+    }
+    if (q < -SCAN_EXP_LIMIT)
+    {
+        q = -SCAN_EXP_LIMIT;
+    }
+    *out = to_float(digits, q);
+    if (negative)
+    {
+        *out = -*out;
+    }
+    return s;
+}
+
+/**
+ * Reads the fields of the compiled pieces from @p input (called by the
+ * templates of fmt.h).
+ *
+ * @returns size_t - fields assigned
+ */
+size_t fmt_vscan(const char *input, const char *str, const FmtPiece *pieces,
+                 size_t count, const FmtRef *refs)
+{
+    const char *s = input;
+    size_t assigned = 0u;
+
+    for (size_t i = 0u; i < count; i++)
+    {
+        const FmtPiece *piece = &pieces[i];
+        const FmtRef *ref;
+
+        for (size_t k = 0u; k < piece->len; k++)
+        {
+            char c = str[piece->pos + k];
+
+            if (is_space(c))
+            {
+                s = skip_space(s);
+            }
+            else if (*s++ != c)
+            {
+                return assigned;
+            }
+        }
+        if (piece->field == FMT_NO_FIELD)
+        {
+            continue;
+        }
+        ref = &refs[piece->field];
+        if (piece->kind != FMT_KIND_CHAR)
+        {
+            s = skip_space(s);
+        }
+        switch (piece->kind)
+        {
+        case FMT_KIND_FLOAT:
+            s = scan_float(s, static_cast<float *>(ref->p));
+            break;
+        case FMT_KIND_CHAR:
+            if (*s == '\0')
+            {
+                return assigned;
+            }
+            *static_cast<char *>(ref->p) = *s++;
+            break;
+        case FMT_KIND_STR:
+        {
+            char *dst = static_cast<char *>(ref->p);
+            size_t n = 0u;
+
+            while (*s != '\0' && !is_space(*s) && n + 1u < ref->size)
+            {
+                dst[n++] = *s++;
+            }
+            dst[n] = '\0';
+            if (n == 0u)
+            {
+                return assigned;
+            }
+            break;
+        }
+        default:
+            s = scan_int(s, piece, ref);
+            break;
+        }
+        if (s == NULL)
+        {
+            return assigned;
+        }
+        assigned++;
+    }
+    return assigned;
+}
+
+/*--------------------------------------------------------------------------
+ *      Console
+ *------------------------------------------------------------------------*/
+/** Sink of fmt_print(). */
+void fmt_console_write(const char *data, size_t size)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    (void)uart_stdio_write(data, size);
+#else
+    (void)fwrite(data, 1u, size, stdout);
+#endif
+}
+
+/**
+ * Reads a line from the console, without its newline; the rest of a line
+ * longer than @p size - 1 is discarded.
+ *
+ * @returns size_t - characters stored, terminator not counted
+ */
+size_t fmt_read_line(char *line, size_t size)
+{
+    size_t n = 0u;
+
+    if (size == 0u)
+    {
+        return 0u;
+    }
+#if defined(__IAR_SYSTEMS_ICC__)
+    char c = '\0';
+
+    uart_stdio_flush();
+    while (c != '\n')
+    {
+        if (uart_stdio_read(&c, 1u) == 0u)
+        {
+            break;
+        }
+        if (c != '\n' && n + 1u < size)
+        {
+            line[n++] = c;
+        }
+    }
+#else
+    int ch;
+
+    fflush(stdout);
+    while ((ch = getchar()) != EOF && ch != '\n')
+    {
+        if (n + 1u < size)
+        {
+            line[n++] = static_cast<char>(ch);
+        }
+    }
+#endif
+    line[n] = '\0';
+    return n;
+}
@@ -0,0 +1,575 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - formatted I/O
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     fmt.h
+ * @author   insert authors names here
+ * @brief    Type-safe print/scan without iostream, locale or heap (C++). \n
+ *               char line[32];
+ *               fmt_format(line, sizeof(line), FMT("{:08x} {}"), id, volts);
+ *               fmt_print(FMT("t = {:.3f} s\n"), t);
+ *               fmt_scan(line, FMT("{} {:x}"), volts, id);
+ *           The format string is parsed by the compiler: FMT() gives it a
+ *           type, fmt_format() & co. turn it into a table of pieces (a
+ *           literal and the field after it) and a format that does not
+ *           match the arguments stops the build. At run time only the table
+ *           is walked.
+ *
+ *           Fields: {} or {:spec}, spec = [<|>][+][0][width][.precision][type]
+ *           - integers: d (default), x, X, o, b; char: c (default), d, x;
+ *           - bool: "true"/"false"; const char *: s, precision = max length;
+ *           - pointers: p (0x...);
+ *           - float: g (default), the shortest digits that read back as the
+ *             same float; e, the same in scientific notation; f, fixed
+ *             point, exactly rounded, precision 0..9 (default 6).
+ *           {{ and }} are literal braces. Numbers are right aligned, text
+ *           left aligned, unless < or > say otherwise. double is refused:
+ *           the FPU of the TM4C1294 is single precision.
+ *
+ *           Scan fields take no spec except the type (d, x, b for integers);
+ *           whitespace in the format matches any amount of whitespace, other
+ *           characters must match. Integers are range checked against the
+ *           target type; floats are correctly rounded when the digits fit
+ *           in 53 bits and the decimal exponent is within +-22, the usual
+ *           case, and within an ulp otherwise.
+ *
+ *           Output goes to a caller's buffer (fmt_format(), which returns
+ *           the length the whole output needs, as snprintf() does) or, in
+ *           chunks of FMT_PRINT_BUFFER bytes of stack, to the console
+ *           (fmt_print(): uart_stdio on the target, stdout on the host).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _FMT_H_
+#define _FMT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Stack buffer of fmt_print(); output is written out when it fills up. */
+#ifndef FMT_PRINT_BUFFER
+#define FMT_PRINT_BUFFER        64u
+#endif
+
+/** Longest line fmt_scan_line() reads, terminator included. */
+#ifndef FMT_LINE_MAX
+#define FMT_LINE_MAX            64u
+#endif
+
+/**
+ * A format string with a type of its own, so that templates can parse it:
+ * FMT("x = {}").
+ */
+#define FMT(s)                                                                \
+    ([] {                                                                     \
+        struct FmtLiteral                                                     \
+        {                                                                     \
+            static constexpr const char *str() { return s; }                  \
+        };                                                                    \
+        return FmtLiteral{};                                                  \
+    }())
+
+/** Argument kinds, as the compiled format records them. */
+enum FmtKind : uint8_t
+{
+    FMT_KIND_NONE,
+    FMT_KIND_INT,           /**< up to 32 bits, signed                 */
+    FMT_KIND_UINT,
+    FMT_KIND_INT64,
+    FMT_KIND_UINT64,
+    FMT_KIND_CHAR,
+    FMT_KIND_BOOL,
+    FMT_KIND_FLOAT,
+    FMT_KIND_STR,
+    FMT_KIND_PTR
+};
+
+/** Spec flags. */
+enum : uint8_t
+{
+    FMT_LEFT  = 0x01u,
+    FMT_RIGHT = 0x02u,
+    FMT_PLUS  = 0x04u,
+    FMT_ZERO  = 0x08u
+};
+
+/** Piece without a field (the literal at the end, or before "{{"). */
+constexpr uint8_t  FMT_NO_FIELD      = 0xFFu;
+constexpr uint8_t  FMT_NO_PRECISION  = 0xFFu;
+constexpr uint8_t  FMT_MAX_PRECISION = 9u;
+constexpr uint8_t  FMT_MAX_WIDTH     = 64u;
+
+/** A literal, then optionally a field. */
+struct FmtPiece
+{
+    uint16_t pos;           /**< literal: offset in the format string  */
+    uint16_t len;           /**< literal: length                       */
+    uint8_t  field;         /**< argument index, or FMT_NO_FIELD       */
+    uint8_t  kind;          /**< FmtKind of the argument               */
+    char     type;          /**< spec type, 0 for the default          */
+    uint8_t  flags;
+    uint8_t  width;
+    uint8_t  precision;     /**< FMT_NO_PRECISION if not given         */
+};
+
+/** Errors found in a format string. */
+enum FmtError : uint8_t
+{
+    FMT_OK,
+    FMT_ERR_SYNTAX,         /**< unbalanced brace, bad spec             */
+    FMT_ERR_COUNT,          /**< fields and arguments differ in number  */
+    FMT_ERR_TYPE            /**< spec not valid for the argument        */
+};
+
+struct FmtParsed
+{
+    FmtError error;
+    uint16_t pieces;
+};
+
+template <size_t N>
+struct FmtPieces
+{
+    FmtPiece piece[N];
+};
+
+/** An argument to print; its kind is in the compiled format. */
+union FmtArg
+{
+    int32_t     i;
+    uint32_t    u;
+    int64_t     i64;
+    uint64_t    u64;
+    float       f;
+    const char *s;
+    const void *p;
+};
+
+/** An argument to scan into. */
+struct FmtRef
+{
+    void  *p;
+    size_t size;            /**< of the integer, or of the char array  */
+};
+
+/** Where formatted output goes. */
+struct FmtWriter
+{
+    char   *buf;
+    size_t  size;           /**< capacity of buf                       */
+    size_t  len;            /**< bytes in buf                          */
+    size_t  total;          /**< bytes produced, including any dropped */
+    void  (*flush)(const char *data, size_t size);  /**< NULL: drop    */
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Argument kinds
+ *
+ *------------------------------------------------------------------------------*/
+template <typename T> struct FmtIsDouble         { static constexpr bool value = false; };
+template <>           struct FmtIsDouble<double> { static constexpr bool value = true; };
+
+template <typename T, size_t Size = sizeof(T)>
+struct FmtKindOf
+{
+    static_assert(!FmtIsDouble<T>::value,
+                  "fmt: double is not supported, the FPU is single precision");
+    static_assert(FmtIsDouble<T>::value, "fmt: argument type not supported");
+};
+
+template <> struct FmtKindOf<bool>        { static constexpr uint8_t value = FMT_KIND_BOOL; };
+template <> struct FmtKindOf<char>        { static constexpr uint8_t value = FMT_KIND_CHAR; };
+template <> struct FmtKindOf<signed char> { static constexpr uint8_t value = FMT_KIND_INT; };
+template <> struct FmtKindOf<short>       { static constexpr uint8_t value = FMT_KIND_INT; };
+template <> struct FmtKindOf<int>         { static constexpr uint8_t value = FMT_KIND_INT; };
+template <> struct FmtKindOf<unsigned char>  { static constexpr uint8_t value = FMT_KIND_UINT; };
+template <> struct FmtKindOf<unsigned short> { static constexpr uint8_t value = FMT_KIND_UINT; };
+template <> struct FmtKindOf<unsigned int>   { static constexpr uint8_t value = FMT_KIND_UINT; };
+template <> struct FmtKindOf<long>
+{
+    static constexpr uint8_t value = (sizeof(long) == 4u) ? FMT_KIND_INT : FMT_KIND_INT64;
+};
+template <> struct FmtKindOf<unsigned long>
+{
+    static constexpr uint8_t value = (sizeof(long) == 4u) ? FMT_KIND_UINT : FMT_KIND_UINT64;
+};
+template <> struct FmtKindOf<long long>          { static constexpr uint8_t value = FMT_KIND_INT64; };
+template <> struct FmtKindOf<unsigned long long> { static constexpr uint8_t value = FMT_KIND_UINT64; };
+template <> struct FmtKindOf<float>       { static constexpr uint8_t value = FMT_KIND_FLOAT; };
+template <> struct FmtKindOf<const char *> { static constexpr uint8_t value = FMT_KIND_STR; };
+template <> struct FmtKindOf<char *>       { static constexpr uint8_t value = FMT_KIND_STR; };
+template <size_t N, size_t S> struct FmtKindOf<char[N], S>       { static constexpr uint8_t value = FMT_KIND_STR; };
+template <size_t N, size_t S> struct FmtKindOf<const char[N], S> { static constexpr uint8_t value = FMT_KIND_STR; };
+template <typename T, size_t S> struct FmtKindOf<T *, S>         { static constexpr uint8_t value = FMT_KIND_PTR; };
+template <typename T, size_t S> struct FmtKindOf<const T *, S>   { static constexpr uint8_t value = FMT_KIND_PTR; };
+
+/*------------------------------------------------------------------------------
+ *
+ *      Format string parser (compile time)
+ *
+ *------------------------------------------------------------------------------*/
+constexpr bool fmt_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/** @returns bool - @p type may format an argument of @p kind */
+constexpr bool fmt_type_ok(uint8_t kind, char type, uint8_t precision,
+                           bool scan)
+{
+    bool integer = kind == FMT_KIND_INT || kind == FMT_KIND_UINT ||
+                   kind == FMT_KIND_INT64 || kind == FMT_KIND_UINT64;
+
+    if (scan)
+    {
+        return (integer && (type == 0 || type == 'd' || type == 'x' || type == 'b')) ||
+               ((kind == FMT_KIND_FLOAT || kind == FMT_KIND_STR ||
+                 kind == FMT_KIND_CHAR) && type == 0);
+    }
+    switch (kind)
+    {
+    case FMT_KIND_INT:
+    case FMT_KIND_UINT:
+    case FMT_KIND_INT64:
+    case FMT_KIND_UINT64:
+        return precision == FMT_NO_PRECISION &&
+               (type == 0 || type == 'd' || type == 'x' || type == 'X' ||
+                type == 'o' || type == 'b');
+    case FMT_KIND_CHAR:
+        return precision == FMT_NO_PRECISION &&
+               (type == 0 || type == 'c' || type == 'd' || type == 'x');
+    case FMT_KIND_BOOL:
+        return precision == FMT_NO_PRECISION && (type == 0 || type == 's');
+    case FMT_KIND_FLOAT:
+        return (type == 0 || type == 'g' || type == 'e')
+                   ? precision == FMT_NO_PRECISION
+                   : type == 'f' && (precision == FMT_NO_PRECISION ||
+                                     precision <= FMT_MAX_PRECISION);
+    case FMT_KIND_STR:
+        return type == 0 || type == 's';
+    case FMT_KIND_PTR:
+        return precision == FMT_NO_PRECISION && (type == 0 || type == 'p');
+    default:
+        return false;
+    }
+}
+
+/**
+ * Parses a format string; fills @p out when it is not NULL.
+ *
+ * @param[in]  str   - the format string
+ * @param[in]  kinds - FmtKind of each argument
+ * @param[in]  count - number of arguments
+ * @param[in]  scan  - fields of fmt_scan(): type only
+ * @param[out] out   - the pieces, NULL to count them
+ * @returns FmtParsed - error and number of pieces
+ */
+constexpr FmtParsed fmt_parse(const char *str, const uint8_t *kinds,
+                              size_t count, bool scan, FmtPiece *out)
+{
+    FmtParsed parsed{ FMT_OK, 0u };
+    size_t fields = 0u;
+    size_t i = 0u;
+    size_t start = 0u;
+
+    while (true)
+    {
+        char c = str[i];
+        FmtPiece piece{ static_cast<uint16_t>(start), 0u, FMT_NO_FIELD,
+                        FMT_KIND_NONE, 0, 0u, 0u, FMT_NO_PRECISION };
+
+        if (c != '\0' && c != '{' && c != '}')
+        {
+            i++;
+            continue;
+        }
+        piece.len = static_cast<uint16_t>(i - start);
+        if (c == '\0')
+        {
+            if (piece.len != 0u || parsed.pieces == 0u)
+            {
+                if (out != nullptr)
+                {
+                    out[parsed.pieces] = piece;
+                }
+                parsed.pieces++;
+            }
+            break;
+        }
+        if (str[i + 1u] == c)
+        {
+            /* "{{" or "}}": the literal keeps one brace */
+            piece.len++;
+            i += 2u;
+        }
+        else if (c == '}')
+        {
+            parsed.error = FMT_ERR_SYNTAX;
+            return parsed;
+        }
+        else
+        {
+            i++;
+            if (str[i] == ':')
+            {
+                i++;
+                if (str[i] == '<' || str[i] == '>')
+                {
+                    piece.flags |= (str[i] == '<') ? FMT_LEFT : FMT_RIGHT;
+                    i++;
+                }
+                if (str[i] == '+')
+                {
+                    piece.flags |= FMT_PLUS;
+                    i++;
+                }
+                if (str[i] == '0')
+                {
+                    piece.flags |= FMT_ZERO;
+                    i++;
+                }
+                while (fmt_is_digit(str[i]))
+                {
+                    piece.width = static_cast<uint8_t>(piece.width * 10u +
+                                                       (str[i++] - '0'));
+                    if (piece.width > FMT_MAX_WIDTH)
+                    {
+                        parsed.error = FMT_ERR_SYNTAX;
+                        return parsed;
+                    }
+                }
+                if (str[i] == '.')
+                {
+                    i++;
+                    if (!fmt_is_digit(str[i]))
+                    {
+                        parsed.error = FMT_ERR_SYNTAX;
+                        return parsed;
+                    }
+                    piece.precision = 0u;
+                    while (fmt_is_digit(str[i]))
+                    {
+                        piece.precision = static_cast<uint8_t>(
+                            piece.precision * 10u + (str[i++] - '0'));
+                        if (piece.precision > FMT_MAX_WIDTH)
+                        {
+                            parsed.error = FMT_ERR_SYNTAX;
+                            return parsed;
+                        }
+                    }
+                }
+                if (str[i] != '}' && str[i] != '\0')
+                {
+                    piece.type = str[i++];
+                }
+                if (scan && (piece.flags != 0u || piece.width != 0u ||
+                             piece.precision != FMT_NO_PRECISION))
+                {
+                    parsed.error = FMT_ERR_TYPE;
+                    return parsed;
+                }
+            }
+            if (str[i] != '}')
+            {
+                parsed.error = FMT_ERR_SYNTAX;
+                return parsed;
+            }
+            i++;
+            if (fields == count)
+            {
+                parsed.error = FMT_ERR_COUNT;
+                return parsed;
+            }
+            piece.field = static_cast<uint8_t>(fields);
+            piece.kind = kinds[fields];
+            if (!fmt_type_ok(piece.kind, piece.type, piece.precision, scan))
+            {
+                parsed.error = FMT_ERR_TYPE;
+                return parsed;
+            }
+            fields++;
+        }
+        if (out != nullptr)
+        {
+            out[parsed.pieces] = piece;
+        }
+        parsed.pieces++;
+        start = i;
+    }
+    if (fields != count)
+    {
+        parsed.error = FMT_ERR_COUNT;
+    }
+    return parsed;
+}
+
+template <size_t N>
+constexpr FmtPieces<N> fmt_compile(const char *str, const uint8_t *kinds,
+                                   size_t count, bool scan)
+{
+    FmtPieces<N> pieces{};
+
+    (void)fmt_parse(str, kinds, count, scan, pieces.piece);
+    return pieces;
+}
+
+/** The format string S parsed for arguments Args. */
+template <bool Scan, typename S, typename... Args>
+struct FmtCompiled
+{
+    static constexpr uint8_t kinds[] = { FmtKindOf<Args>::value..., FMT_KIND_NONE };
+    static constexpr FmtParsed parsed =
+        fmt_parse(S::str(), kinds, sizeof...(Args), Scan, nullptr);
+
+    static_assert(parsed.error != FMT_ERR_SYNTAX, "fmt: bad format string");
+    static_assert(parsed.error != FMT_ERR_COUNT,
+                  "fmt: the number of {} fields and of arguments differ");
+    static_assert(parsed.error != FMT_ERR_TYPE,
+                  "fmt: format spec not valid for the argument type");
+
+    static constexpr FmtPieces<parsed.pieces + 1u> table =
+        fmt_compile<parsed.pieces + 1u>(S::str(), kinds, sizeof...(Args), Scan);
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void   fmt_vformat(FmtWriter *writer, const char *str, const FmtPiece *pieces,
+                   size_t count, const FmtArg *args);
+size_t fmt_vscan(const char *input, const char *str, const FmtPiece *pieces,
+                 size_t count, const FmtRef *refs);
+size_t fmt_float_shortest(float value, char *digits, int32_t *exp10);
+
+void   fmt_console_write(const char *data, size_t size);
+size_t fmt_read_line(char *line, size_t size);
+
+inline FmtArg fmt_arg(bool v)                { FmtArg a; a.u = v ? 1u : 0u; return a; }
+inline FmtArg fmt_arg(char v)                { FmtArg a; a.u = static_cast<uint8_t>(v); return a; }
+inline FmtArg fmt_arg(signed char v)         { FmtArg a; a.i = v; return a; }
+inline FmtArg fmt_arg(short v)               { FmtArg a; a.i = v; return a; }
+inline FmtArg fmt_arg(int v)                 { FmtArg a; a.i = v; return a; }
+inline FmtArg fmt_arg(unsigned char v)       { FmtArg a; a.u = v; return a; }
+inline FmtArg fmt_arg(unsigned short v)      { FmtArg a; a.u = v; return a; }
+inline FmtArg fmt_arg(unsigned int v)        { FmtArg a; a.u = v; return a; }
+inline FmtArg fmt_arg(long v)
+{
+    FmtArg a;
+
+    if (sizeof(long) == 4u)
+    {
+        a.i = static_cast<int32_t>(v);
+    }
+    else
+    {
+        a.i64 = v;
+    }
+    return a;
+}
+inline FmtArg fmt_arg(unsigned long v)
+{
+    FmtArg a;
+
+    if (sizeof(long) == 4u)
+    {
+        a.u = static_cast<uint32_t>(v);
+    }
+    else
+    {
+        a.u64 = v;
+    }
+    return a;
+}
+inline FmtArg fmt_arg(long long v)           { FmtArg a; a.i64 = v; return a; }
+inline FmtArg fmt_arg(unsigned long long v)  { FmtArg a; a.u64 = v; return a; }
+inline FmtArg fmt_arg(float v)               { FmtArg a; a.f = v; return a; }
+inline FmtArg fmt_arg(const char *v)         { FmtArg a; a.s = v; return a; }
+inline FmtArg fmt_arg(const void *v)         { FmtArg a; a.p = v; return a; }
+
+template <typename T>
+inline FmtRef fmt_ref(T &v)
+{
+    return FmtRef{ &v, sizeof(T) };
+}
+
+/**
+ * Formats into @p buf, always NUL terminated when @p size is not 0.
+ *
+ * @returns size_t - length of the whole output; it was cut if >= @p size
+ */
+template <typename S, typename... Args>
+size_t fmt_format(char *buf, size_t size, S, const Args &...args)
+{
+    using F = FmtCompiled<false, S, Args...>;
+    const FmtArg values[] = { fmt_arg(args)..., FmtArg{} };
+    FmtWriter writer{ buf, (size != 0u) ? size - 1u : 0u, 0u, 0u, nullptr };
+
+    fmt_vformat(&writer, S::str(), F::table.piece, F::parsed.pieces, values);
+    if (size != 0u)
+    {
+        buf[writer.len] = '\0';
+    }
+    return writer.total;
+}
+
+/** Formats to the console. @returns size_t - bytes written */
+template <typename S, typename... Args>
+size_t fmt_print(S, const Args &...args)
+{
+    using F = FmtCompiled<false, S, Args...>;
+    const FmtArg values[] = { fmt_arg(args)..., FmtArg{} };
+    char buf[FMT_PRINT_BUFFER];
+    FmtWriter writer{ buf, sizeof(buf), 0u, 0u, fmt_console_write };
+
+    fmt_vformat(&writer, S::str(), F::table.piece, F::parsed.pieces, values);
+    if (writer.len != 0u)
+    {
+        fmt_console_write(buf, writer.len);
+    }
+    return writer.total;
+}
+
+/**
+ * Reads fields from @p input, in order, up to the first that does not
+ * match.
+ *
+ * @returns size_t - fields assigned
+ */
+template <typename S, typename... Args>
+size_t fmt_scan(const char *input, S, Args &...args)
+{
+    using F = FmtCompiled<true, S, Args...>;
+    const FmtRef refs[] = { fmt_ref(args)..., FmtRef{ nullptr, 0u } };
+
+    return fmt_vscan(input, S::str(), F::table.piece, F::parsed.pieces, refs);
+}
+
+/** Reads a line from the console and scans it (see fmt_scan()). */
+template <typename S, typename... Args>
+size_t fmt_scan_line(S format, Args &...args)
+{
+    char line[FMT_LINE_MAX];
+
+    (void)fmt_read_line(line, sizeof(line));
+    return fmt_scan(line, format, args...);
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - FPU context
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     fpu_ctx.c
+ * @author   insert authors names here
+ * @brief    FPU stacking policy and the FPU exception flag handler, see
+ *           fpu_ctx.h. On the target the handler is entered through
+ *           fpu_ctx_cm4.s, which passes the frame of the interrupted code.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "inc/hw_ints.h"
+#include "driverlib/fpu.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysexc.h"
+
+#include "common/fpu_ctx.h"
+#include "common/kernel.h"
+#include "common/vtable.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#if K_FPU_CHECK
+#error "fpu_ctx_isr reads FPSCR: it would fault under K_FPU_NONE tasks"
+#endif
+
+#define FLAGS_ALL           ((1u << FPU_CTX_FLAGS) - 1u)
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#define FPU_FPCCR           (*(volatile uint32_t *)0xE000EF34u)
+#define FPU_FPCAR           (*(volatile uint32_t *)0xE000EF38u)
+#define FPCCR_LSPACT        0x00000001u
+/** EXC_RETURN bit 4 clear: the frame has S0-S15 and FPSCR. */
+#define EXC_RETURN_STD_FRAME 0x00000010u
+/** FPSCR cumulative flags: IOC DZC OFC UFC IXC (bits 0-4) and IDC (bit 7). */
+#define FPSCR_FLAGS         0x0000009Fu
+/** FPSCR after R0-R3, R12, LR, PC, xPSR and S0-S15 in an extended frame. */
+#define FRAME_FPSCR_OFFSET  0x60u
+/** FPCAR points to the S0 slot of a frame not stacked yet. */
+#define FPCAR_FPSCR_OFFSET  0x40u
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+fpu_ctx_stats_t g_fpu_ctx;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static fpu_ctx_hook_t   s_hook;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+void fpu_ctx_isr_frame(uint32_t exc_return, uint32_t *frame);
+
+/**
+ * Clears the cumulative flags of FPSCR: those of the interrupted code, in
+ * its frame, and the live register.
+ *
+ * @param[in] exc_return - LR on entry to the handler
+ * @param[in] frame      - stack pointer of the interrupted code on entry
+ */
+static void clear_fpscr_flags(uint32_t exc_return, uint32_t *frame)
+{
+    if ((exc_return & EXC_RETURN_STD_FRAME) == 0u)
+    {
+        volatile uint32_t *stacked;
+
+        if ((FPU_FPCCR & FPCCR_LSPACT) != 0u)
+        {
+            /* lazy: the first FPU instruction makes the core fill the
+               room FPCAR points to */
+            (void)__get_FPSCR();
+            stacked = (volatile uint32_t *)(FPU_FPCAR + FPCAR_FPSCR_OFFSET);
+        }
+        else
+        {
+            stacked = (volatile uint32_t *)((uint8_t *)frame +
+                                            FRAME_FPSCR_OFFSET);
+        }
+        *stacked &= ~FPSCR_FLAGS;
+    }
+    __set_FPSCR(__get_FPSCR() & ~FPSCR_FLAGS);
+}
+#endif
+
+/**
+ * Enables the FPU with a stacking policy and the interrupt of the flags
+ * in FPU_CTX_TRAP_FLAGS. Call before any floating-point instruction runs.
+ *
+ * @param[in] policy - FPU_CTX_LAZY unless measuring
+ * @param[in] hook   - called with the raised flags, may be NULL
+ */
+void fpu_ctx_init(fpu_ctx_policy_t policy, fpu_ctx_hook_t hook)
+{
+    uint32_t i;
+
+    s_hook = hook;
+    g_fpu_ctx.interrupts = 0u;
+    g_fpu_ctx.last = 0u;
+    for (i = 0; i < FPU_CTX_FLAGS; i++)
+    {
+        g_fpu_ctx.count[i] = 0u;
+    }
+
+    FPUEnable();
+    switch (policy)
+    {
+    case FPU_CTX_EAGER:
+        FPUStackingEnable();
+        break;
+    case FPU_CTX_OFF:
+        FPUStackingDisable();
+        break;
+    default:
+        FPULazyStackingEnable();
+        break;
+    }
+
+    SysExcIntDisable(FLAGS_ALL);
+    SysExcIntClear(FLAGS_ALL);
+    SysExcIntEnable(FPU_CTX_TRAP_FLAGS);
+    (void)register_isr(INT_SYSEXC, fpu_ctx_isr);
+    IntEnable(INT_SYSEXC);
+}
+
+/**
+ * Counts the raised flags, clears them in the interrupt and calls the hook.
+ */
+static void take_flags(void)
+{
+    uint32_t flags = SysExcIntStatus(true);
+    uint32_t i;
+
+    SysExcIntClear(flags);
+
+    g_fpu_ctx.interrupts++;
+    g_fpu_ctx.last = flags;
+    for (i = 0; i < FPU_CTX_FLAGS; i++)
+    {
+        if ((flags & (1u << i)) != 0u)
+        {
+            g_fpu_ctx.count[i]++;
+        }
+    }
+    if (s_hook != NULL)
+    {
+        s_hook(flags);
+    }
+}
+
+#if defined(__IAR_SYSTEMS_ICC__)
+/**
+ * System exception interrupt, from fpu_ctx_isr in fpu_ctx_cm4.s: an FPU
+ * instruction raised a trapped flag.
+ *
+ * @param[in] exc_return - LR on entry to the handler
+ * @param[in] frame      - stack pointer of the interrupted code on entry
+ */
+void fpu_ctx_isr_frame(uint32_t exc_return, uint32_t *frame)
+{
+    clear_fpscr_flags(exc_return, frame);
+    take_flags();
+}
+#else
+/**
+ * System exception interrupt: an FPU instruction raised a trapped flag.
+ */
+void fpu_ctx_isr(void)
+{
+    take_flags();
+}
+#endif
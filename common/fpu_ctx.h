@@ -0,0 +1,108 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - FPU context
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     fpu_ctx.h
+ * @author   insert authors names here
+ * @brief    FPU state preservation policy and FPU exception flags. \n
+ *           fpu_ctx_init() enables the FPU, sets FPCCR to one policy and
+ *           takes the FPU exception flags (IRQ 67, INT_SYSEXC):
+ *           - FPU_CTX_LAZY (ASPEN + LSPEN, the reset value): an exception
+ *             that interrupts floating-point code only reserves room for
+ *             S0-S15/FPSCR; the registers are stacked by the handler's
+ *             first floating-point instruction. Integer-only handlers
+ *             (vector_table.h Fpu::Free) enter and leave as fast as from
+ *             integer code; Fpu::Uses handlers pay the save and restore.
+ *           - FPU_CTX_EAGER (ASPEN): every such exception stacks them, 17
+ *             cycles each way more on entry and exit.
+ *           - FPU_CTX_OFF: no preservation; only correct when no handler
+ *             uses the FPU (vector_fpu_users() == 0) and at most one
+ *             context does, so not with kernel tasks using it.
+ *           Set the policy before the first floating-point instruction.
+ *           The kernel saves S16-S31 per task only when the task left an
+ *           FPU frame (k_task_t fpu_saves, k_task_fpu()).\n
+ *           fpu_ctx_isr() counts the flags of FPU_CTX_TRAP_FLAGS in
+ *           g_fpu_ctx, passes them to the hook and clears them, including
+ *           in the FPSCR stacked for the interrupted code so that they do
+ *           not raise the interrupt again when it resumes. The interrupted
+ *           code is assumed to be the one that raised them. On the target
+ *           fpu_ctx_isr is the entry in fpu_ctx_cm4.s (add it to the
+ *           project with fpu_ctx.c): its frame is found on the MSP or PSP
+ *           from EXC_RETURN, and only through FPCAR while lazy stacking has
+ *           not filled it yet (LSPACT).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _FPU_CTX_H_
+#define _FPU_CTX_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "driverlib/sysexc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Flags that interrupt; inexact and underflow are routine in DSP code. */
+#ifndef FPU_CTX_TRAP_FLAGS
+#define FPU_CTX_TRAP_FLAGS  (SYSEXC_INT_FP_IOC | SYSEXC_INT_FP_DZC |          \
+                             SYSEXC_INT_FP_OFC)
+#endif
+
+/** SYSEXC_INT_FP_IDC .. SYSEXC_INT_FP_IXC, bits 0..5. */
+#define FPU_CTX_FLAGS       6u
+
+typedef enum
+{
+    FPU_CTX_LAZY,
+    FPU_CTX_EAGER,
+    FPU_CTX_OFF
+} fpu_ctx_policy_t;
+
+/** Called from fpu_ctx_isr() with the SYSEXC_INT_FP_x flags raised. */
+typedef void (*fpu_ctx_hook_t)(uint32_t flags);
+
+typedef struct
+{
+    uint32_t interrupts;
+    uint32_t count[FPU_CTX_FLAGS];  /**< per flag, index = bit of SYSEXC_INT_FP_x */
+    uint32_t last;                  /**< flags of the last interrupt */
+} fpu_ctx_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern fpu_ctx_stats_t g_fpu_ctx;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void fpu_ctx_init(fpu_ctx_policy_t policy, fpu_ctx_hook_t hook);
+void fpu_ctx_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
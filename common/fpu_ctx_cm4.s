@@ -0,0 +1,36 @@
+;__________________________________________________________________________________
+;       Disciplina de Sistemas Embarcados - 2023-1
+;       Prof. Douglas Renaux
+; __________________________________________________________________________________
+;
+;		Common - FPU context
+; __________________________________________________________________________________
+;
+; @file     fpu_ctx_cm4.s
+; @author   insert authors names here
+; @brief    fpu_ctx_isr: entry of the FPU exception flag interrupt (IAR
+;           EWARM). Passes EXC_RETURN and the stack pointer the interrupted
+;           code stacked its frame on - PSP if EXC_RETURN bit 2 is set, else
+;           MSP - to fpu_ctx_isr_frame() in fpu_ctx.c, before any push of
+;           its own. The tail call keeps EXC_RETURN in LR for the return.
+; @version  V1
+; @date     Oct, 2026
+;******************************************************************************
+
+        MODULE  fpu_ctx_cm4
+
+        EXTERN  fpu_ctx_isr_frame
+        PUBLIC  fpu_ctx_isr
+
+        SECTION .text:CODE:NOROOT(2)
+        THUMB
+
+fpu_ctx_isr:
+        MOV     R0, LR
+        TST     LR, #0x4                ; EXC_RETURN bit 2 set: process stack
+        ITE     EQ
+        MRSEQ   R1, MSP
+        MRSNE   R1, PSP
+        B       fpu_ctx_isr_frame
+
+        END
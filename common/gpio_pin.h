@@ -0,0 +1,165 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - GPIO pins
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     gpio_pin.h
+ * @author   insert authors names here
+ * @brief    GPIO pins as types: port and pin are template arguments, so
+ *           every access is a load or store to an address known at compile
+ *           time instead of a GPIOPinWrite() call with run-time arguments. \n
+ *           - Pin<Port::N, 1>: one pin. write()/set()/clear() store to the
+ *             masked GPIODATA alias (address bits 9:2 select the pins the
+ *             store may change), so no read-modify-write is needed.
+ *             write_bb() stores to the bit-band alias of that address
+ *             instead; same effect, one bit, value 0/1 without shifting.
+ *           - PinGroup<Led1, Led2>: pins of one port updated by a single
+ *             masked store, e.g. PinGroup<Led1, Led2>::assign<Led1>() sets
+ *             LED1 and clears LED2 at once.
+ *           The port must be enabled and the pins configured (e.g. with
+ *           GPIOPinTypeGPIOOutput()) before use. On the host the accesses go
+ *           to the simulated HAL (sim_gpio_store()/sim_gpio_load()), which
+ *           decodes the address the same way the GPIO block does.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _GPIO_PIN_H_
+#define _GPIO_PIN_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "inc/hw_memmap.h"
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+#include "host/sim/sim.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** GPIO ports of the TM4C1294, on the AHB aperture. */
+enum class Port : uint32_t
+{
+    A = GPIO_PORTA_AHB_BASE,
+    B = GPIO_PORTB_AHB_BASE,
+    C = GPIO_PORTC_AHB_BASE,
+    D = GPIO_PORTD_AHB_BASE,
+    E = GPIO_PORTE_AHB_BASE,
+    F = GPIO_PORTF_AHB_BASE,
+    G = GPIO_PORTG_AHB_BASE,
+    H = GPIO_PORTH_AHB_BASE,
+    J = GPIO_PORTJ_AHB_BASE,
+    K = GPIO_PORTK_BASE,
+    L = GPIO_PORTL_BASE,
+    M = GPIO_PORTM_BASE,
+    N = GPIO_PORTN_BASE,
+    P = GPIO_PORTP_BASE,
+    Q = GPIO_PORTQ_BASE
+};
+
+/** Peripheral bit-band region and its alias (Cortex-M4). */
+constexpr uint32_t GPIO_BITBAND_BASE  = 0x40000000u;
+constexpr uint32_t GPIO_BITBAND_ALIAS = 0x42000000u;
+
+/** Address of GPIODATA that only changes/returns the pins in @p mask. */
+constexpr uint32_t gpio_data_addr(Port port, uint8_t mask)
+{
+    return static_cast<uint32_t>(port) + (static_cast<uint32_t>(mask) << 2);
+}
+
+/** Bit-band alias of bit @p bit of the peripheral word at @p addr. */
+constexpr uint32_t gpio_bitband_addr(uint32_t addr, uint32_t bit)
+{
+    return GPIO_BITBAND_ALIAS + ((addr - GPIO_BITBAND_BASE) << 5) + (bit << 2);
+}
+
+/** One store to a peripheral register. */
+static inline void gpio_store(uint32_t addr, uint32_t value)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    *reinterpret_cast<volatile uint32_t *>(addr) = value;
+#else
+    sim_gpio_store(addr, value);
+#endif
+}
+
+/** One load from a peripheral register. */
+static inline uint32_t gpio_load(uint32_t addr)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return *reinterpret_cast<volatile uint32_t *>(addr);
+#else
+    return sim_gpio_load(addr);
+#endif
+}
+
+/*------------------------------------------------------------------------------
+ *
+ *      Classes
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * One GPIO pin. All members are static: the type is the pin.
+ */
+template <Port P, uint8_t N>
+struct Pin
+{
+    static_assert(N < 8u, "GPIO ports have pins 0 to 7");
+
+    static constexpr Port     port    = P;
+    static constexpr uint8_t  mask    = static_cast<uint8_t>(1u << N);
+    static constexpr uint32_t data    = gpio_data_addr(P, mask);
+    static constexpr uint32_t bitband = gpio_bitband_addr(data, N);
+
+    static void set()           { gpio_store(data, mask); }
+    static void clear()         { gpio_store(data, 0u); }
+    static void write(bool on)  { gpio_store(data, on ? mask : 0u); }
+    static bool read()          { return gpio_load(data) != 0u; }
+    static void toggle()        { gpio_store(data, gpio_load(data) ^ mask); }
+
+    /** Same as write(), through the bit-band alias. */
+    static void write_bb(bool on) { gpio_store(bitband, on ? 1u : 0u); }
+};
+
+/**
+ * Pins of one port, updated together by a single masked store.
+ */
+template <typename First, typename... Rest>
+struct PinGroup
+{
+    static_assert(((Rest::port == First::port) && ...),
+                  "a pin group is limited to one port");
+
+    static constexpr Port     port = First::port;
+    static constexpr uint8_t  mask = (First::mask | ... | Rest::mask);
+    static constexpr uint32_t data = gpio_data_addr(port, mask);
+
+    /** @param[in] value - pin levels, bit n for pin n; others are ignored */
+    static void write(uint8_t value) { gpio_store(data, value); }
+    static void set()                { gpio_store(data, mask); }
+    static void clear()              { gpio_store(data, 0u); }
+    static uint8_t read()            { return static_cast<uint8_t>(gpio_load(data)); }
+
+    /** Sets the pins listed in @p On and clears the other pins of the group. */
+    template <typename... On>
+    static void assign()
+    {
+        static_assert(((On::port == port) && ... && true),
+                      "pin not in the port of the group");
+        gpio_store(data, (0u | ... | On::mask));
+    }
+};
+
+#endif
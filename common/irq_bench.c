@@ -0,0 +1,372 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - interrupts
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     irq_bench.c
+ * @author   insert authors names here
+ * @brief    Interrupt latency and jitter benchmark (see irq_bench.h). \n
+ *           Samples include the cost of the trigger store (IntTrigger()) or
+ *           of reading the SysTick counter, and on the target the prologue
+ *           of the handler up to its time stamp. Late arrival (a higher
+ *           priority interrupt during the stacking of a lower one) needs an
+ *           asynchronous source and is not measured. The host build runs the
+ *           same code on the simulator, whose cycle costs are a model.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/fpu.h"
+#include "driverlib/systick.h"
+
+#include "common/irq_bench.h"
+#include "common/vtable.h"
+#include "common/cycles.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Peripherals the labs do not use; only their vectors are taken over. */
+#define IRQ_A               INT_SSI2
+#define IRQ_B               INT_SSI3
+#define IRQ_HIGH            INT_UART6
+
+#define PRIO_LOW            0x80u
+#define PRIO_HIGH           0x20u
+
+/** Short enough for many samples, long enough for the handler and a load. */
+#define SYSTICK_PERIOD      2000u
+
+#define CONTROL_FPCA        0x00000004u
+
+#define LINE_SIZE           48u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+irq_bench_t g_irq_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t          s_samples[IRQ_BENCH_SAMPLES];
+static volatile uint32_t s_count;
+static volatile uint32_t s_t0;
+static volatile uint32_t s_t1;
+static irq_fpu_t         s_fpu;
+static irq_bench_sink_t  s_sink;
+
+#if defined(__IAR_SYSTEMS_ICC__)
+static volatile uint32_t s_load[16] = { 1000000007u, 97u, 3u };
+static volatile float    s_fpuLoad = 1.0f;
+#else
+static uint32_t          s_lcg = 1u;
+#endif
+
+static const char *const s_caseNames[IRQ_CASES] =
+{
+    "entry", "tailchain", "nested", "systick_load"
+};
+
+static const char *const s_fpuNames[IRQ_FPU_MODES] =
+{
+    "nofpu", "lazy", "eager"
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+const char *irq_bench_case_name(irq_case_t c)
+{
+    return (c < IRQ_CASES) ? s_caseNames[c] : "?";
+}
+
+const char *irq_bench_fpu_name(irq_fpu_t fpu)
+{
+    return (fpu < IRQ_FPU_MODES) ? s_fpuNames[fpu] : "?";
+}
+
+static void emit(const char *line)
+{
+    if (s_sink != NULL)
+    {
+        s_sink(line, (uint32_t)strlen(line));
+    }
+}
+
+/**
+ * Gives the running context the FPU state of @p fpu: any floating-point
+ * instruction sets CONTROL.FPCA, exception entry clears it.
+ */
+static void fpu_context(irq_fpu_t fpu)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    if (fpu == IRQ_FPU_NONE)
+    {
+        __set_CONTROL(__get_CONTROL() & ~CONTROL_FPCA);
+        __ISB();
+    }
+    else
+    {
+        s_fpuLoad = s_fpuLoad * 1.5f;
+    }
+#else
+    sim_set_fpca(fpu != IRQ_FPU_NONE);
+#endif
+}
+
+/**
+ * Lets a just pended interrupt be taken before the next instruction: the
+ * STIR write of IntTrigger() completes (DSB) and the pipeline is refilled
+ * (ISB), so the sample read after it is this iteration's. The simulator
+ * takes the interrupt inside the HAL call.
+ */
+static inline void take_pending(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __DSB();
+    __ISB();
+#endif
+}
+
+/**
+ * One step of thread load with instructions of different lengths, so that
+ * SysTick arrives at varying points of them.
+ */
+static void load_step(irq_fpu_t fpu)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    s_load[3] = s_load[0] / s_load[1];                  /* UDIV, 2-12 cycles */
+    memcpy((void *)&s_load[8], (const void *)&s_load[0], 8 * sizeof(uint32_t));
+    if (fpu != IRQ_FPU_NONE)
+    {
+        s_fpuLoad = s_fpuLoad / 1.0001f;                /* VDIV, 14 cycles */
+    }
+#else
+    s_lcg = s_lcg * 1664525u + 1013904223u;
+    sim_set_fpca(fpu != IRQ_FPU_NONE);
+    sim_charge(1u + (s_lcg >> 24) % 12u, 0, 0);
+#endif
+}
+
+/*------------------------------------------------------------------------------
+ *      Handlers
+ *------------------------------------------------------------------------------*/
+static void isr_stamp(void)
+{
+    s_t1 = cycles_now();
+}
+
+static void isr_first(void)
+{
+    s_t0 = cycles_now();
+}
+
+static void isr_low(void)
+{
+    fpu_context(s_fpu);
+    s_t0 = cycles_now();
+    IntTrigger(IRQ_HIGH);
+    take_pending();
+}
+
+static void isr_systick(void)
+{
+    uint32_t value = SysTickValueGet();
+
+    if (s_count < IRQ_BENCH_SAMPLES)
+    {
+        s_samples[s_count++] = SYSTICK_PERIOD - 1u - value;
+    }
+}
+
+/*------------------------------------------------------------------------------
+ *      Cases
+ *------------------------------------------------------------------------------*/
+static void run_entry(void)
+{
+    (void)register_isr(IRQ_A, isr_stamp);
+    for (s_count = 0; s_count < IRQ_BENCH_SAMPLES; s_count++)
+    {
+        fpu_context(s_fpu);
+        s_t0 = cycles_now();
+        IntTrigger(IRQ_A);
+        take_pending();
+        s_samples[s_count] = s_t1 - s_t0;
+    }
+}
+
+static void run_tailchain(void)
+{
+    (void)register_isr(IRQ_A, isr_first);
+    (void)register_isr(IRQ_B, isr_stamp);
+    for (s_count = 0; s_count < IRQ_BENCH_SAMPLES; s_count++)
+    {
+        (void)IntMasterDisable();
+        IntTrigger(IRQ_A);
+        IntTrigger(IRQ_B);
+        fpu_context(s_fpu);
+        (void)IntMasterEnable();
+#if defined(__IAR_SYSTEMS_ICC__)
+        __ISB();
+#endif
+        s_samples[s_count] = s_t1 - s_t0;
+    }
+}
+
+static void run_nested(void)
+{
+    (void)register_isr(IRQ_A, isr_low);
+    (void)register_isr(IRQ_HIGH, isr_stamp);
+    for (s_count = 0; s_count < IRQ_BENCH_SAMPLES; s_count++)
+    {
+        IntTrigger(IRQ_A);
+        take_pending();
+        s_samples[s_count] = s_t1 - s_t0;
+    }
+}
+
+static void run_systick(void)
+{
+    vtable_handler_t previous = register_isr(FAULT_SYSTICK, isr_systick);
+
+    s_count = 0;
+    SysTickPeriodSet(SYSTICK_PERIOD);
+    SysTickIntEnable();
+    SysTickEnable();
+    while (s_count < IRQ_BENCH_SAMPLES)
+    {
+        load_step(s_fpu);
+    }
+    SysTickDisable();
+    SysTickIntDisable();
+    (void)register_isr(FAULT_SYSTICK, previous);
+}
+
+static void stat_and_emit(irq_case_t c, irq_fpu_t fpu)
+{
+    irq_bench_stat_t *stat = &g_irq_bench.stat[c][fpu];
+    char line[LINE_SIZE];
+    uint32_t i;
+
+    stat->min = UINT32_MAX;
+    stat->max = 0;
+    stat->total = 0;
+    stat->count = 0;
+    for (i = 0; i < IRQ_BENCH_SAMPLES; i++)
+    {
+        uint32_t cycles = s_samples[i];
+
+        if (cycles < stat->min)
+        {
+            stat->min = cycles;
+        }
+        if (cycles > stat->max)
+        {
+            stat->max = cycles;
+        }
+        stat->total += cycles;
+        stat->count++;
+        snprintf(line, sizeof(line), "%s,%s,%u\n", s_caseNames[c],
+                 s_fpuNames[fpu], (unsigned)cycles);
+        emit(line);
+    }
+}
+
+/**
+ * Runs every case in every FPU mode. Interrupts must be enabled; SysTick is
+ * left disabled and the three benchmark interrupts unregistered.
+ *
+ * @param[in] clock_hz - core clock, recorded in the CSV header
+ * @param[in] sink     - output of the samples, NULL for statistics only
+ */
+void irq_bench_run(uint32_t clock_hz, irq_bench_sink_t sink)
+{
+    static void (*const runs[IRQ_CASES])(void) =
+    {
+        run_entry, run_tailchain, run_nested, run_systick
+    };
+    vtable_handler_t saved[3];
+    char line[LINE_SIZE];
+    uint32_t c;
+    uint32_t fpu;
+
+    g_irq_bench.done = false;
+    g_irq_bench.clock_hz = clock_hz;
+    s_sink = sink;
+    cycles_init();
+    snprintf(line, sizeof(line), "irq_bench,%u,%u\n", IRQ_BENCH_FORMAT,
+             (unsigned)clock_hz);
+    emit(line);
+
+    saved[0] = register_isr(IRQ_A, isr_stamp);
+    saved[1] = register_isr(IRQ_B, isr_stamp);
+    saved[2] = register_isr(IRQ_HIGH, isr_stamp);
+    IntPrioritySet(IRQ_A, PRIO_LOW);
+    IntPrioritySet(IRQ_B, PRIO_LOW);
+    IntPrioritySet(IRQ_HIGH, PRIO_HIGH);
+    IntEnable(IRQ_A);
+    IntEnable(IRQ_B);
+    IntEnable(IRQ_HIGH);
+
+    for (fpu = 0; fpu < IRQ_FPU_MODES; fpu++)
+    {
+        s_fpu = (irq_fpu_t)fpu;
+        if (s_fpu == IRQ_FPU_EAGER)
+        {
+            FPUStackingEnable();
+        }
+        else
+        {
+            FPULazyStackingEnable();
+        }
+        for (c = 0; c < IRQ_CASES; c++)
+        {
+            runs[c]();
+            stat_and_emit((irq_case_t)c, s_fpu);
+        }
+    }
+
+    FPULazyStackingEnable();
+    fpu_context(IRQ_FPU_NONE);
+    IntDisable(IRQ_A);
+    IntDisable(IRQ_B);
+    IntDisable(IRQ_HIGH);
+    (void)register_isr(IRQ_A, saved[0]);
+    (void)register_isr(IRQ_B, saved[1]);
+    (void)register_isr(IRQ_HIGH, saved[2]);
+
+    snprintf(line, sizeof(line), "end,%u\n",
+             (unsigned)(IRQ_CASES * IRQ_FPU_MODES * IRQ_BENCH_SAMPLES));
+    emit(line);
+    g_irq_bench.done = true;
+}
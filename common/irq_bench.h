@@ -0,0 +1,112 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - interrupts
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     irq_bench.h
+ * @author   insert authors names here
+ * @brief    Interrupt latency and jitter benchmark. \n
+ *           Interrupts are raised from software (NVIC_SW_TRIG) and their
+ *           handlers time-stamp their entry with the cycle counter. Every
+ *           case runs with the interrupted context free of FPU state, with
+ *           FPU state and lazy stacking (the reset default), and with FPU
+ *           state and eager stacking. Statistics are kept in g_irq_bench for
+ *           the debugger; every sample is also written to a sink as CSV text,
+ *           which host/tools/irq_replay analyses off-line:
+ *
+ *               irq_bench,1,<clock_hz>
+ *               <case>,<fpu>,<cycles>          one line per sample
+ *               end,<samples>
+ *
+ *           The suite takes over INT_SSI2, INT_SSI3 and INT_UART6 and
+ *           SysTick while it runs, and needs the vector table in SRAM
+ *           (vtable_init()).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _IRQ_BENCH_H_
+#define _IRQ_BENCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define IRQ_BENCH_SAMPLES       256u    /**< per case and FPU mode */
+#define IRQ_BENCH_FORMAT        1u      /**< version in the CSV header */
+
+/** What a sample measures, in cycles. */
+typedef enum
+{
+    IRQ_CASE_ENTRY,         /**< trigger store to the handler, thread mode */
+    IRQ_CASE_TAILCHAIN,     /**< end of a handler to the next one          */
+    IRQ_CASE_NESTED,        /**< trigger from a handler to a higher one    */
+    IRQ_CASE_SYSTICK,       /**< SysTick wrap to its handler, under load   */
+    IRQ_CASES
+} irq_case_t;
+
+/** FPU state of the interrupted context. */
+typedef enum
+{
+    IRQ_FPU_NONE,           /**< CONTROL.FPCA clear: basic frame        */
+    IRQ_FPU_LAZY,           /**< FPCA set, lazy stacking (LSPEN)        */
+    IRQ_FPU_EAGER,          /**< FPCA set, S0-S15/FPSCR stacked on entry */
+    IRQ_FPU_MODES
+} irq_fpu_t;
+
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t count;
+} irq_bench_stat_t;
+
+typedef struct
+{
+    irq_bench_stat_t stat[IRQ_CASES][IRQ_FPU_MODES];
+    uint32_t         clock_hz;
+    bool             done;
+} irq_bench_t;
+
+/** Byte output of the samples, e.g. prof_itm_sink(). */
+typedef void (*irq_bench_sink_t)(const void *data, uint32_t length);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern irq_bench_t g_irq_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void        irq_bench_run(uint32_t clock_hz, irq_bench_sink_t sink);
+const char *irq_bench_case_name(irq_case_t c);
+const char *irq_bench_fpu_name(irq_fpu_t fpu);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,406 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - kernel
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel.c
+ * @author   insert authors names here
+ * @brief    Portable part of the kernel (see kernel.h). \n
+ *           The running task stays at the head of its ready list; blocking
+ *           removes it, yielding moves it to the tail. All list updates run
+ *           with interrupts masked.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+
+#include "common/kernel.h"
+#include "common/bitops.h"
+#include "common/timer_service.h"
+#include "common/stack_watch.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define IDLE_STACK_WORDS    128u
+
+typedef struct
+{
+    k_task_t *head;
+    k_task_t *tail;
+} k_list_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+k_task_t *volatile k_current_task;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static k_list_t s_ready[K_PRIORITIES];
+static uint32_t s_readyMap;             /**< bit p set: s_ready[p] non-empty */
+static uint32_t s_lockCount;
+static k_task_t s_idleTask;
+K_STACK(s_idleStack, IDLE_STACK_WORDS);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void ready_push_tail(k_task_t *task)
+{
+    k_list_t *list = &s_ready[task->prio];
+
+    task->next = NULL;
+    task->state = K_READY;
+    if (list->tail != NULL)
+    {
+        list->tail->next = task;
+    }
+    else
+    {
+        list->head = task;
+    }
+    list->tail = task;
+    s_readyMap |= 1u << task->prio;
+}
+
+/** Removes the head of a ready list; the running task is always a head. */
+static void ready_pop_head(uint32_t prio)
+{
+    k_list_t *list = &s_ready[prio];
+
+    list->head = list->head->next;
+    if (list->head == NULL)
+    {
+        list->tail = NULL;
+        s_readyMap &= ~(1u << prio);
+    }
+}
+
+/** Requests a context switch if a higher-priority task is ready. */
+static void preempt_check(void)
+{
+    k_task_t *current = k_current_task;
+
+    if (current == NULL || s_lockCount != 0u)
+    {
+        return;
+    }
+    if (current->state != K_READY || ctz32(s_readyMap) < current->prio)
+    {
+        port_request_switch();
+    }
+}
+
+/** Blocks the running task; the switch happens when interrupts unmask. */
+static void block_current(void)
+{
+    k_task_t *current = k_current_task;
+
+    ready_pop_head(current->prio);
+    current->state = K_BLOCKED;
+    port_request_switch();
+}
+
+static void make_ready(k_task_t *task)
+{
+    ready_push_tail(task);
+    preempt_check();
+}
+
+static void sleep_expired(void *arg)
+{
+    make_ready((k_task_t *)arg);
+}
+
+static void idle_entry(void *arg)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        timer_idle();
+    }
+}
+
+/**
+ * Resets the kernel and creates the idle task.
+ */
+void k_init(void)
+{
+    uint32_t prio;
+
+    for (prio = 0; prio < K_PRIORITIES; prio++)
+    {
+        s_ready[prio].head = NULL;
+        s_ready[prio].tail = NULL;
+    }
+    s_readyMap = 0;
+    s_lockCount = 0;
+    k_current_task = NULL;
+    k_task_create(&s_idleTask, "idle", idle_entry, NULL, K_PRIO_IDLE,
+                  s_idleStack, K_STACK_WORDS(s_idleStack));
+}
+
+/**
+ * Creates a ready task. May be called before or after k_start().
+ *
+ * @param[out] task        - control block, owned by the caller
+ * @param[in]  name        - for the debugger
+ * @param[in]  entry       - task function; returning ends the task
+ * @param[in]  arg         - passed to entry
+ * @param[in]  prio        - 0 (highest) .. K_PRIO_IDLE - 1
+ * @param[in]  stack       - stack declared with K_STACK()
+ * @param[in]  stack_words - K_STACK_WORDS() of that stack
+ */
+void k_task_create(k_task_t *task, const char *name, k_entry_t entry,
+                   void *arg, uint32_t prio, uint64_t *stack,
+                   uint32_t stack_words)
+{
+    uint32_t primask;
+
+    task->name = name;
+    task->entry = entry;
+    task->arg = arg;
+    task->prio = (uint8_t)prio;
+    task->stack = (uint32_t *)stack;
+    task->stack_words = stack_words;
+    task->tls = NULL;
+    task->switches = 0;
+    task->fpu_saves = 0;
+    task->fpu = K_FPU_ANY;
+    tw_timer_init(&task->sleep_timer, sleep_expired, task);
+    stack_paint(task->stack, stack_words);      /* for stack_task_used() */
+    port_stack_init(task);
+
+    primask = port_irq_save();
+    make_ready(task);
+    port_irq_restore(primask);
+}
+
+/**
+ * Declares the floating-point use of a task; call before k_start().
+ * K_FPU_NONE is a promise the port checks when K_FPU_CHECK is 1; either
+ * way fpu_saves counts the switches that had to save FPU state.
+ *
+ * @param[in,out] task - created with k_task_create()
+ * @param[in]     fpu  - K_FPU_ANY or K_FPU_NONE
+ */
+void k_task_fpu(k_task_t *task, k_fpu_t fpu)
+{
+    task->fpu = (uint8_t)fpu;
+}
+
+/**
+ * Starts scheduling; does not return. Call once, from main().
+ */
+void k_start(void)
+{
+    (void)port_irq_save();
+    port_start();
+}
+
+/**
+ * Picks the task to run; called by the port's context switch with
+ * interrupts masked. k_current_task is NULL on the first call (k_start()).
+ */
+void k_switch(void)
+{
+    k_task_t *current = k_current_task;
+    k_task_t *next;
+
+    if (current != NULL && s_lockCount != 0u && current->state == K_READY)
+    {
+        return;
+    }
+    next = s_ready[ctz32(s_readyMap)].head;
+    if (next != current)
+    {
+        if (current != NULL && port_fpu_saved(current))
+        {
+            current->fpu_saves++;
+        }
+        next->switches++;
+#if K_FPU_CHECK
+        port_fpu_access(next->fpu != K_FPU_NONE);
+#endif
+        k_current_task = next;
+    }
+}
+
+/**
+ * Lets the other ready tasks of the same priority run first. Does nothing
+ * under k_sched_lock(): the running task stays the head of its ready list,
+ * which block_current() relies on.
+ */
+void k_yield(void)
+{
+    uint32_t primask = port_irq_save();
+    k_task_t *current = k_current_task;
+
+    if (current->next != NULL && s_lockCount == 0u)
+    {
+        ready_pop_head(current->prio);
+        ready_push_tail(current);
+        port_request_switch();
+    }
+    port_irq_restore(primask);
+}
+
+/**
+ * Blocks the calling task for @p ticks timer ticks (see TIMER_MS()).
+ */
+void k_sleep(uint32_t ticks)
+{
+    uint32_t primask = port_irq_save();
+    k_task_t *current = k_current_task;
+
+    block_current();
+    timer_start(&current->sleep_timer, ticks, 0);
+    port_irq_restore(primask);
+}
+
+/**
+ * @returns k_task_t* - the calling task
+ */
+k_task_t *k_self(void)
+{
+    return k_current_task;
+}
+
+/**
+ * Returns here when a task function returns.
+ */
+void k_task_exit(void)
+{
+    (void)port_irq_save();
+    block_current();
+    k_current_task->state = K_DONE;
+    port_irq_restore(0);
+    for (;;)
+    {
+    }
+}
+
+/**
+ * Disables preemption (nestable). Interrupts keep running.
+ */
+void k_sched_lock(void)
+{
+    uint32_t primask = port_irq_save();
+
+    s_lockCount++;
+    port_irq_restore(primask);
+}
+
+/**
+ * Re-enables preemption, switching if a higher-priority task became ready.
+ */
+void k_sched_unlock(void)
+{
+    uint32_t primask = port_irq_save();
+
+    if (--s_lockCount == 0u)
+    {
+        preempt_check();
+    }
+    port_irq_restore(primask);
+}
+
+/*------------------------------------------------------------------------------
+ *
+ *      Semaphores
+ *
+ *------------------------------------------------------------------------------*/
+void k_sem_init(k_sem_t *sem, uint32_t count)
+{
+    sem->count = count;
+    sem->waiters = NULL;
+}
+
+/**
+ * Takes the semaphore, blocking while its count is zero. Tasks only.
+ */
+void k_sem_take(k_sem_t *sem)
+{
+    uint32_t primask = port_irq_save();
+
+    if (sem->count != 0u)
+    {
+        sem->count--;
+    }
+    else
+    {
+        k_task_t *current = k_current_task;
+        k_task_t **link = &sem->waiters;
+
+        /* waiters are kept in priority order, FIFO within a priority */
+        while (*link != NULL && (*link)->prio <= current->prio)
+        {
+            link = &(*link)->next;
+        }
+        block_current();
+        current->next = *link;
+        *link = current;
+    }
+    port_irq_restore(primask);
+}
+
+/**
+ * Takes the semaphore if its count is non-zero. Tasks and handlers.
+ *
+ * @returns bool - true if taken
+ */
+bool k_sem_try_take(k_sem_t *sem)
+{
+    uint32_t primask = port_irq_save();
+    bool taken = (sem->count != 0u);
+
+    if (taken)
+    {
+        sem->count--;
+    }
+    port_irq_restore(primask);
+    return taken;
+}
+
+/**
+ * Gives the semaphore: wakes the highest-priority waiter or increments the
+ * count. Tasks and handlers.
+ */
+void k_sem_give(k_sem_t *sem)
+{
+    uint32_t primask = port_irq_save();
+    k_task_t *waiter = sem->waiters;
+
+    if (waiter != NULL)
+    {
+        sem->waiters = waiter->next;
+        make_ready(waiter);
+    }
+    else
+    {
+        sem->count++;
+    }
+    port_irq_restore(primask);
+}
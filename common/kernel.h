@@ -0,0 +1,156 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - kernel
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel.h
+ * @author   insert authors names here
+ * @brief    Small fixed-priority preemptive kernel. \n
+ *           K_PRIORITIES levels, 0 is the highest. The ready queue is one FIFO
+ *           per level plus a bitmap of non-empty levels, so picking the next
+ *           task is a single count-trailing-zeros. Tasks of equal priority
+ *           run in turn only when they block or call k_yield().\n
+ *           Context switches are deferred to PendSV, which runs after every
+ *           other handler. Sleeping uses the timer service (timer_service.h),
+ *           which must be started before k_start().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _KERNEL_H_
+#define _KERNEL_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/kernel_port.h"
+#include "common/timer_wheel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define K_PRIORITIES        32u
+#define K_PRIO_IDLE         (K_PRIORITIES - 1u)
+
+/**
+ * 1: tasks marked K_FPU_NONE run with the FPU disabled (CPACR), so that a
+ * stray floating-point instruction faults (UsageFault NOCP) instead of
+ * silently adding the FPU state to each of the task's switches. Target only.
+ * CPACR is not per context: a handler that preempts such a task faults on
+ * its first floating-point instruction too. Only valid with no FPU handler,
+ * vector_fpu_users() == 0 (checked by the static_assert of
+ * Lab2/src/vectors.cpp) and none installed with register_isr() such as
+ * fpu_ctx_isr.
+ */
+#ifndef K_FPU_CHECK
+#define K_FPU_CHECK         0
+#endif
+
+/**
+ * Declares a statically allocated task stack of (at least) @p words words,
+ * 8-byte aligned as the AAPCS requires.
+ */
+#define K_STACK(name, words)                                                   \
+    PORT_STACK_ATTR static uint64_t                                            \
+        name[(((words) > PORT_STACK_MIN_WORDS) ? (words) : PORT_STACK_MIN_WORDS) / 2u]
+
+/** Number of words of a stack declared with K_STACK(). */
+#define K_STACK_WORDS(name) (sizeof(name) / (sizeof(uint32_t)))
+
+typedef void (*k_entry_t)(void *arg);
+
+typedef enum
+{
+    K_READY,
+    K_BLOCKED,
+    K_DONE
+} k_state_t;
+
+/** Floating-point use of a task, see k_task_fpu(). */
+typedef enum
+{
+    K_FPU_ANY,                      /**< the hardware tracks it (default)  */
+    K_FPU_NONE                      /**< integer only                      */
+} k_fpu_t;
+
+/** Task control block. */
+typedef struct k_task
+{
+    port_context_t  ctx;            /**< must be first (used by the port) */
+    struct k_task  *next;           /**< ready or wait list               */
+    k_entry_t       entry;
+    void           *arg;
+    uint32_t       *stack;
+    uint32_t        stack_words;
+    void           *tls;            /**< DLIB per-thread data, target only */
+    const char     *name;
+    tw_timer_t      sleep_timer;
+    uint32_t        switches;       /**< times switched in                */
+    uint32_t        fpu_saves;      /**< switched out with FPU state      */
+    uint8_t         prio;
+    uint8_t         state;
+    uint8_t         fpu;            /**< k_fpu_t                          */
+} k_task_t;
+
+/** Counting semaphore; waiters are woken in priority order. */
+typedef struct
+{
+    uint32_t  count;
+    k_task_t *waiters;
+} k_sem_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+/** Running task; read and written by the port's context switch. */
+extern k_task_t *volatile k_current_task;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void      k_init(void);
+void      k_task_create(k_task_t *task, const char *name, k_entry_t entry,
+                        void *arg, uint32_t prio, uint64_t *stack,
+                        uint32_t stack_words);
+void      k_task_fpu(k_task_t *task, k_fpu_t fpu);
+void      k_start(void);
+void      k_yield(void);
+void      k_sleep(uint32_t ticks);
+k_task_t *k_self(void);
+
+void      k_sem_init(k_sem_t *sem, uint32_t count);
+void      k_sem_take(k_sem_t *sem);
+bool      k_sem_try_take(k_sem_t *sem);
+void      k_sem_give(k_sem_t *sem);
+
+void      k_sched_lock(void);
+void      k_sched_unlock(void);
+
+/* For the ports only */
+void      k_switch(void);
+void      k_task_exit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
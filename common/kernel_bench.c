@@ -0,0 +1,183 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - kernel
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel_bench.c
+ * @author   insert authors names here
+ * @brief    Context-switch latency benchmark (see kernel_bench.h). \n
+ *           Phase 1: "low" gives a semaphore "high" waits on, so every give
+ *           preempts. Phase 2, once both have ended: two tasks of equal
+ *           priority hand the CPU to each other with k_yield().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+
+#include "common/kernel_bench.h"
+#include "common/kernel.h"
+#include "common/cycles.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define BENCH_STACK_WORDS   256u
+
+#define PRIO_HIGH           1u
+#define PRIO_LOW            2u
+#define PRIO_YIELD          3u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+kernel_bench_t g_kernel_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static k_task_t s_high;
+static k_task_t s_low;
+static k_task_t s_yieldA;
+static k_task_t s_yieldB;
+K_STACK(s_highStack, BENCH_STACK_WORDS);
+K_STACK(s_lowStack, BENCH_STACK_WORDS);
+K_STACK(s_yieldAStack, BENCH_STACK_WORDS);
+K_STACK(s_yieldBStack, BENCH_STACK_WORDS);
+
+static const k_task_t *const s_tasks[] =
+{
+    &s_high, &s_low, &s_yieldA, &s_yieldB
+};
+
+static k_sem_t s_wake;
+static volatile uint32_t s_t0;
+static uint32_t s_yieldRunning;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void stat_init(kernel_bench_stat_t *stat)
+{
+    stat->min = UINT32_MAX;
+    stat->max = 0;
+    stat->total = 0;
+    stat->count = 0;
+}
+
+static void stat_add(kernel_bench_stat_t *stat, uint32_t cycles)
+{
+    if (cycles < stat->min)
+    {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max)
+    {
+        stat->max = cycles;
+    }
+    stat->total += cycles;
+    stat->count++;
+}
+
+static void high_entry(void *arg)
+{
+    uint32_t i;
+
+    (void)arg;
+    for (i = 0; i < KERNEL_BENCH_ITERATIONS; i++)
+    {
+        k_sem_take(&s_wake);
+        stat_add(&g_kernel_bench.sem_wake, cycles_now() - s_t0);
+    }
+}
+
+static void low_entry(void *arg)
+{
+    uint32_t i;
+
+    (void)arg;
+    for (i = 0; i < KERNEL_BENCH_ITERATIONS; i++)
+    {
+        s_t0 = cycles_now();
+        k_sem_give(&s_wake);
+    }
+}
+
+static void yield_entry(void *arg)
+{
+    uint32_t i;
+
+    (void)arg;
+    for (i = 0; i < KERNEL_BENCH_ITERATIONS; i++)
+    {
+        s_t0 = cycles_now();
+        k_yield();
+        /* the other task's first run and its exit are not a yield */
+        if (s_yieldRunning == 2u)
+        {
+            stat_add(&g_kernel_bench.yield, cycles_now() - s_t0);
+        }
+        else
+        {
+            s_yieldRunning++;
+        }
+    }
+    s_yieldRunning = 0;
+    if (s_yieldA.state == K_DONE || s_yieldB.state == K_DONE)
+    {
+        g_kernel_bench.done = true;
+    }
+}
+
+/**
+ * Creates the benchmark tasks and starts the kernel; does not return.
+ */
+void kernel_bench_start(void)
+{
+    stat_init(&g_kernel_bench.sem_wake);
+    stat_init(&g_kernel_bench.yield);
+    g_kernel_bench.done = false;
+    s_yieldRunning = 0;
+    cycles_init();
+
+    k_init();
+    k_sem_init(&s_wake, 0);
+    k_task_create(&s_high, "high", high_entry, NULL, PRIO_HIGH,
+                  s_highStack, K_STACK_WORDS(s_highStack));
+    k_task_create(&s_low, "low", low_entry, NULL, PRIO_LOW,
+                  s_lowStack, K_STACK_WORDS(s_lowStack));
+    k_task_create(&s_yieldA, "yieldA", yield_entry, NULL, PRIO_YIELD,
+                  s_yieldAStack, K_STACK_WORDS(s_yieldAStack));
+    k_task_create(&s_yieldB, "yieldB", yield_entry, NULL, PRIO_YIELD,
+                  s_yieldBStack, K_STACK_WORDS(s_yieldBStack));
+    k_start();
+}
+
+/**
+ * Writes the stack high-water marks of the benchmark tasks (and of CSTACK
+ * on the target) after a run, see common/stack_watch.h.
+ *
+ * @param[in] sink - receives the report text
+ */
+void kernel_bench_stack_report(stack_sink_t sink)
+{
+    stack_report(sink, s_tasks, sizeof(s_tasks) / sizeof(s_tasks[0]));
+}
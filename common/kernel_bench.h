@@ -0,0 +1,82 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - kernel
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel_bench.h
+ * @author   insert authors names here
+ * @brief    Context-switch latency benchmark of the kernel. \n
+ *           Measured with the DWT cycle counter on the board (call
+ *           kernel_bench_start() from main() and read g_kernel_bench in the
+ *           debugger once done is set); the host benchmark runs the same code
+ *           on the simulated HAL (host/bench/bench_kernel.c).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _KERNEL_BENCH_H_
+#define _KERNEL_BENCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/stack_watch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define KERNEL_BENCH_ITERATIONS 1000u
+
+/** Latency statistics, in core cycles. */
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t count;
+} kernel_bench_stat_t;
+
+typedef struct
+{
+    /** k_sem_give() in a task to the return of k_sem_take() in a higher one */
+    kernel_bench_stat_t sem_wake;
+    /** k_yield() in a task to the return of k_yield() in an equal one */
+    kernel_bench_stat_t yield;
+    volatile bool       done;
+} kernel_bench_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern kernel_bench_t g_kernel_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void kernel_bench_start(void);
+void kernel_bench_stack_report(stack_sink_t sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - kernel
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel_port.h
+ * @author   insert authors names here
+ * @brief    Interface between the portable kernel (kernel.c) and its ports. \n
+ *           Cortex-M4 (IAR): kernel_port_cm4.c/.s, context switch in
+ *           PendSV_Handler. Host: host/sim/kernel_port_host.c, context switch
+ *           with ucontext inside the simulated PendSV.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _KERNEL_PORT_H_
+#define _KERNEL_PORT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#else
+#include <ucontext.h>
+#include "driverlib/interrupt.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+
+/** Saved context: the process stack pointer; must be the TCB's first field. */
+typedef struct
+{
+    uint32_t *sp;
+} port_context_t;
+
+/** Smallest usable task stack: exception frame with FPU state + margin. */
+#define PORT_STACK_MIN_WORDS    64u
+
+/** Stacks are statically allocated in the .task_stacks section (Tiva.icf). */
+#define PORT_STACK_ATTR         _Pragma("location=\".task_stacks\"") __no_init
+
+#else
+
+typedef struct
+{
+    ucontext_t uc;
+    bool       fpu;         /**< switched out with FPU state */
+} port_context_t;
+
+/** Host threads run C library code; give them room. */
+#define PORT_STACK_MIN_WORDS    8192u
+
+#define PORT_STACK_ATTR
+
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+struct k_task;
+
+void port_stack_init(struct k_task *task);
+void port_start(void);
+void port_request_switch(void);
+bool port_fpu_saved(struct k_task *task);
+void port_fpu_access(bool enable);
+
+/** Masks interrupts; returns the previous mask for port_irq_restore(). */
+static inline uint32_t port_irq_save(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_interrupt();
+    return primask;
+#else
+    return IntMasterDisable() ? 1u : 0u;
+#endif
+}
+
+/** Restores the interrupt mask returned by port_irq_save(). */
+static inline void port_irq_restore(uint32_t primask)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __set_PRIMASK(primask);
+#else
+    if (primask == 0u)
+    {
+        IntMasterEnable();
+    }
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
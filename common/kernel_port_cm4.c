@@ -0,0 +1,231 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - kernel
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel_port_cm4.c
+ * @author   insert authors names here
+ * @brief    Cortex-M4F port of the kernel (IAR EWARM). \n
+ *           Tasks run in thread mode on the process stack (PSP); handlers and
+ *           main() use the main stack (CSTACK). The context switch itself is
+ *           PendSV_Handler in kernel_port_cm4.s.\n
+ *           DLIB thread support (project option "Enable thread support in
+ *           library"): each task gets its own copy of the library's
+ *           thread-local data (errno, strtok state, ...) from a static pool in
+ *           section .task_tls, and the library's locks are mapped onto
+ *           k_sched_lock().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <intrinsics.h>
+#include <DLib_Threads.h>
+
+#include "common/kernel.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define NVIC_INT_CTRL           (*(volatile uint32_t *)0xE000ED04u)
+#define NVIC_INT_CTRL_PEND_SV   0x10000000u
+#define NVIC_SYS_PRI3           (*(volatile uint32_t *)0xE000ED20u)
+#define NVIC_SYS_PRI3_PENDSV_M  0x00FF0000u
+#define NVIC_SYS_PRI3_PENDSV_LOWEST 0x00E00000u
+
+#define NVIC_CPACR              (*(volatile uint32_t *)0xE000ED88u)
+#define NVIC_CPACR_CP10_CP11    0x00F00000u
+
+#define XPSR_THUMB              0x01000000u
+#define EXC_RETURN_THREAD_PSP   0xFFFFFFFDu
+/** EXC_RETURN bit 4 clear: the frame holds S0-S15/FPSCR. */
+#define EXC_RETURN_BASIC_FRAME  0x00000010u
+/** Word of the saved context holding EXC_RETURN: after r4-r11. */
+#define CTX_EXC_RETURN          8u
+
+/** Tasks with their own DLIB thread-local data (others share main()'s). */
+#ifndef K_TLS_TASKS
+#define K_TLS_TASKS             8u
+#endif
+
+/** Bytes reserved per task; checked against __iar_tls_size() at run time. */
+#ifndef K_TLS_SIZE
+#define K_TLS_SIZE              64u
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+#pragma location=".task_tls"
+static __no_init uint64_t s_tls[K_TLS_TASKS][K_TLS_SIZE / 8u];
+static uint32_t s_tlsUsed;
+
+#pragma section="__iar_tls$$DATA"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Builds the frame PendSV_Handler restores the first time the task runs:
+ * r4-r11 and EXC_RETURN below a hardware exception frame whose PC is the
+ * task entry and whose LR is k_task_exit().
+ */
+void port_stack_init(k_task_t *task)
+{
+    uint32_t *sp = task->stack + task->stack_words;
+    uint32_t reg;
+
+    *--sp = XPSR_THUMB;                         /* xPSR */
+    *--sp = (uint32_t)task->entry;              /* PC   */
+    *--sp = (uint32_t)k_task_exit;              /* LR   */
+    for (reg = 0; reg < 4u; reg++)
+    {
+        *--sp = 0u;                             /* r12, r3, r2, r1 */
+    }
+    *--sp = (uint32_t)task->arg;                /* r0   */
+    *--sp = EXC_RETURN_THREAD_PSP;              /* lr in the handler */
+    for (reg = 0; reg < 8u; reg++)
+    {
+        *--sp = 0u;                             /* r11 .. r4 */
+    }
+    task->ctx.sp = sp;
+
+    if (s_tlsUsed < K_TLS_TASKS && __iar_tls_size() <= sizeof(s_tls[0]))
+    {
+        task->tls = s_tls[s_tlsUsed++];
+        __iar_tls_init(task->tls);
+    }
+}
+
+/**
+ * Starts the first task: PendSV gets the lowest priority and is pended;
+ * enabling interrupts then takes it. With k_current_task still NULL the
+ * handler saves nothing and lets k_switch() pick the first task.
+ */
+void port_start(void)
+{
+    NVIC_SYS_PRI3 = (NVIC_SYS_PRI3 & ~NVIC_SYS_PRI3_PENDSV_M) |
+                    NVIC_SYS_PRI3_PENDSV_LOWEST;
+    NVIC_INT_CTRL = NVIC_INT_CTRL_PEND_SV;
+    __enable_interrupt();
+    for (;;)
+    {
+    }
+}
+
+void port_request_switch(void)
+{
+    NVIC_INT_CTRL = NVIC_INT_CTRL_PEND_SV;
+}
+
+/**
+ * @returns bool - true if PendSV_Handler saved FPU state for @p task, the
+ *                 one it just switched out
+ */
+bool port_fpu_saved(k_task_t *task)
+{
+    return (task->ctx.sp[CTX_EXC_RETURN] & EXC_RETURN_BASIC_FRAME) == 0u;
+}
+
+/**
+ * Grants or removes access to the FPU (CP10/CP11) for the task switched
+ * in; takes effect before PendSV returns to it.
+ */
+void port_fpu_access(bool enable)
+{
+    if (enable)
+    {
+        NVIC_CPACR |= NVIC_CPACR_CP10_CP11;
+    }
+    else
+    {
+        NVIC_CPACR &= ~NVIC_CPACR_CP10_CP11;
+    }
+    __DSB();
+    __ISB();
+}
+
+/**
+ * DLIB hook: thread pointer of the running task.
+ */
+void *__aeabi_read_tp(void)
+{
+    k_task_t *task = k_current_task;
+
+    if (task == NULL || task->tls == NULL)
+    {
+        return __section_begin("__iar_tls$$DATA");
+    }
+    return task->tls;
+}
+
+/*------------------------------------------------------------------------------
+ *
+ *      DLIB locks: tasks never block inside the library, so preventing
+ *      preemption is enough.
+ *
+ *------------------------------------------------------------------------------*/
+void __iar_system_Mtxinit(__iar_Rmtx *m)
+{
+    (void)m;
+}
+
+void __iar_system_Mtxdst(__iar_Rmtx *m)
+{
+    (void)m;
+}
+
+void __iar_system_Mtxlock(__iar_Rmtx *m)
+{
+    (void)m;
+    k_sched_lock();
+}
+
+void __iar_system_Mtxunlock(__iar_Rmtx *m)
+{
+    (void)m;
+    k_sched_unlock();
+}
+
+void __iar_file_Mtxinit(__iar_Rmtx *m)
+{
+    (void)m;
+}
+
+void __iar_file_Mtxdst(__iar_Rmtx *m)
+{
+    (void)m;
+}
+
+void __iar_file_Mtxlock(__iar_Rmtx *m)
+{
+    (void)m;
+    k_sched_lock();
+}
+
+void __iar_file_Mtxunlock(__iar_Rmtx *m)
+{
+    (void)m;
+    k_sched_unlock();
+}
+
+#endif
@@ -0,0 +1,58 @@
+;__________________________________________________________________________________
+;       Disciplina de Sistemas Embarcados - 2023-1
+;       Prof. Douglas Renaux
+; __________________________________________________________________________________
+;
+;		Common - kernel
+; __________________________________________________________________________________
+;
+; @file     kernel_port_cm4.s
+; @author   insert authors names here
+; @brief    PendSV_Handler: context switch of the Cortex-M4F port (IAR EWARM).
+;           The hardware has already pushed r0-r3, r12, lr, pc, xPSR (and
+;           s0-s15 if the task used the FPU) on the task's PSP. This handler
+;           pushes r4-r11, EXC_RETURN and, for FPU tasks, s16-s31, stores the
+;           PSP in k_current_task->ctx.sp (offset 0), lets k_switch() pick the
+;           next task and unwinds that task's stack the same way.
+;           Runs at the lowest priority, so it never preempts another handler.
+; @version  V1
+; @date     Oct, 2026
+;******************************************************************************
+
+        MODULE  kernel_port_cm4
+
+        EXTERN  k_current_task
+        EXTERN  k_switch
+        PUBLIC  PendSV_Handler
+
+        SECTION .text:CODE:NOROOT(2)
+        THUMB
+
+PendSV_Handler:
+        LDR     R2, =k_current_task
+        LDR     R1, [R2]
+        CBZ     R1, pendsv_restore      ; first switch (k_start): nothing to save
+
+        MRS     R0, PSP
+        TST     LR, #0x10               ; EXC_RETURN bit 4 clear: FPU frame
+        IT      EQ
+        VSTMDBEQ R0!, {S16-S31}
+        STMDB   R0!, {R4-R11, LR}
+        STR     R0, [R1]
+
+pendsv_restore:
+        CPSID   I
+        BL      k_switch
+        CPSIE   I
+
+        LDR     R2, =k_current_task
+        LDR     R1, [R2]
+        LDR     R0, [R1]
+        LDMIA   R0!, {R4-R11, LR}
+        TST     LR, #0x10
+        IT      EQ
+        VLDMIAEQ R0!, {S16-S31}
+        MSR     PSP, R0
+        BX      LR
+
+        END
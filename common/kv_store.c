@@ -0,0 +1,962 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - key-value store in flash
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kv_store.c
+ * @author   insert authors names here
+ * @brief    Log-structured key-value store, see kv_store.h. \n
+ *           Sector: a 16-byte header - magic and erase count, programmed
+ *           right after the erase, then the sequence number and its
+ *           complement, programmed when the sector becomes active - and
+ *           records up to the end. A free sector has the first half of the
+ *           header only; any other header is bad and the sector is erased.
+ *           Record: key length, type and value length (one word), CRC-32 of
+ *           that word, the key and the value; key and value padded to a
+ *           word. The last 8 bytes of a sector are kept for the marker a
+ *           compaction appends after its copies: kv_init() finishes a
+ *           compaction whose marker is there (erases the old sector) and
+ *           undoes one without it (erases the copies).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "driverlib/flash.h"
+
+#include "common/kv_store.h"
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+#include "host/sim/sim.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Flash is read in place; the host reads the array of host/sim/flash.c. */
+#if defined(__IAR_SYSTEMS_ICC__)
+#define FLASH_PTR(addr)         ((const uint8_t *)(addr))
+#else
+#define FLASH_PTR(addr)         sim_flash_ptr(addr)
+#endif
+
+#define SECTOR_MAGIC            0x4B565331u     /**< "KVS1" */
+#define ERASED_WORD             0xFFFFFFFFu
+#define SECTOR_HDR_SIZE         16u
+#define REC_HDR_SIZE            8u
+
+/** Record types; never 0xFF, so an erased word is not a record. */
+#define REC_VALUE               0x56u
+#define REC_DELETE              0x44u
+#define REC_MOVED               0x4Du   /**< end of the copies of a compaction */
+
+/** RAM buffer records are programmed from (FlashProgram() needs words). */
+#define WRITE_WORDS             32u
+
+#define INDEX_MASK              (KV_INDEX_SLOTS - 1u)
+#define NO_SECTOR               0xFFFFFFFFu
+
+#define FNV_OFFSET              2166136261u
+#define FNV_PRIME               16777619u
+
+#if (KV_INDEX_SLOTS & (KV_INDEX_SLOTS - 1u)) != 0u
+#error "KV_INDEX_SLOTS must be a power of two"
+#endif
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t erase_count;
+    uint32_t seq;
+    uint32_t seq_check;         /**< ~seq */
+} sector_hdr_t;
+
+typedef struct
+{
+    uint8_t  key_len;
+    uint8_t  type;
+    uint16_t value_len;
+    uint32_t crc;
+} rec_hdr_t;
+
+typedef enum
+{
+    SECTOR_FREE,
+    SECTOR_USED,
+    SECTOR_BAD
+} sector_state_t;
+
+typedef enum
+{
+    READ_OK,
+    READ_BLANK,
+    READ_BAD
+} read_result_t;
+
+typedef struct
+{
+    uint32_t hash;
+    uint32_t addr;              /**< flash address of the record, 0: empty */
+} slot_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+kv_stats_t g_kv;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static slot_t         s_index[KV_INDEX_SLOTS];
+static sector_state_t s_state[KV_SECTORS];
+static uint32_t       s_seqOf[KV_SECTORS];
+static uint32_t       s_active;
+static uint32_t       s_writeOff;       /**< in the active sector */
+static uint32_t       s_seq;            /**< of the next sector activated */
+static uint32_t       s_buf[WRITE_WORDS];
+static bool           s_ready;
+
+/** CRC-32 (reflected 0xEDB88320), four bits at a time. */
+static const uint32_t s_crcTable[16] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t crc32(uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    while (length-- != 0u)
+    {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ s_crcTable[crc & 0x0Fu];
+        crc = (crc >> 4) ^ s_crcTable[crc & 0x0Fu];
+    }
+    return crc;
+}
+
+static uint32_t hash_key(const char *key, uint32_t length)
+{
+    uint32_t hash = FNV_OFFSET;
+
+    while (length-- != 0u)
+    {
+        hash = (hash ^ (uint8_t)*key++) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t align4(uint32_t n)
+{
+    return (n + 3u) & ~3u;
+}
+
+static uint32_t sector_base(uint32_t sector)
+{
+    return KV_FLASH_BASE + sector * KV_SECTOR_SIZE;
+}
+
+static uint32_t rec_size(uint32_t key_len, uint32_t value_len)
+{
+    return REC_HDR_SIZE + align4(key_len) + align4(value_len);
+}
+
+static void read_hdr(uint32_t addr, rec_hdr_t *hdr)
+{
+    memcpy(hdr, FLASH_PTR(addr), sizeof(*hdr));
+}
+
+static uint32_t record_crc(const rec_hdr_t *hdr, const uint8_t *key,
+                           const uint8_t *value)
+{
+    uint32_t crc = crc32(ERASED_WORD, (const uint8_t *)hdr, 4u);
+
+    crc = crc32(crc, key, hdr->key_len);
+    return ~crc32(crc, value, hdr->value_len);
+}
+
+/**
+ * Reads the record at @p addr, @p room bytes before the end of its sector.
+ *
+ * @returns read_result_t - READ_BLANK on erased flash, READ_BAD for
+ *          anything that is not a whole record with a good CRC
+ */
+static read_result_t read_record(uint32_t addr, uint32_t room, rec_hdr_t *hdr)
+{
+    const uint8_t *key;
+
+    read_hdr(addr, hdr);
+    if (hdr->key_len == 0xFFu && hdr->type == 0xFFu &&
+        hdr->value_len == 0xFFFFu)
+    {
+        return READ_BLANK;
+    }
+    if ((hdr->type != REC_VALUE && hdr->type != REC_DELETE &&
+         hdr->type != REC_MOVED) ||
+        hdr->key_len > KV_KEY_MAX || hdr->value_len > KV_VALUE_MAX ||
+        (hdr->key_len == 0u) != (hdr->type == REC_MOVED) ||
+        rec_size(hdr->key_len, hdr->value_len) > room)
+    {
+        return READ_BAD;
+    }
+    key = FLASH_PTR(addr + REC_HDR_SIZE);
+    if (record_crc(hdr, key, key + align4(hdr->key_len)) != hdr->crc)
+    {
+        return READ_BAD;
+    }
+    return READ_OK;
+}
+
+/*------------------------------------------------------------------------------
+ *      Index
+ *------------------------------------------------------------------------------*/
+/**
+ * Linear probing from the home slot of @p hash.
+ *
+ * @returns uint32_t - the slot of the key, or the empty slot ending the
+ *          search (*found false)
+ */
+static uint32_t find_slot(const char *key, uint32_t key_len, uint32_t hash,
+                          bool *found)
+{
+    uint32_t slot = hash & INDEX_MASK;
+    uint32_t probes = 1u;
+
+    *found = false;
+    while (s_index[slot].addr != 0u)
+    {
+        if (s_index[slot].hash == hash)
+        {
+            rec_hdr_t hdr;
+
+            read_hdr(s_index[slot].addr, &hdr);
+            if (hdr.key_len == key_len &&
+                memcmp(FLASH_PTR(s_index[slot].addr + REC_HDR_SIZE), key,
+                       key_len) == 0)
+            {
+                *found = true;
+                break;
+            }
+        }
+        slot = (slot + 1u) & INDEX_MASK;
+        probes++;
+    }
+    if (probes > g_kv.max_probes)
+    {
+        g_kv.max_probes = probes;
+    }
+    return slot;
+}
+
+/**
+ * Empties @p slot, moving back the entries after it that would no longer
+ * be found (no tombstones, so searches stay short).
+ */
+static void index_remove(uint32_t slot)
+{
+    uint32_t next = slot;
+
+    while (1)
+    {
+        uint32_t home;
+
+        next = (next + 1u) & INDEX_MASK;
+        if (s_index[next].addr == 0u)
+        {
+            break;
+        }
+        home = s_index[next].hash & INDEX_MASK;
+        /* the entry stays if its home is cyclically in (slot, next] */
+        if ((next > slot) ? (home <= slot || home > next)
+                          : (home <= slot && home > next))
+        {
+            s_index[slot] = s_index[next];
+            slot = next;
+        }
+    }
+    s_index[slot].addr = 0u;
+}
+
+/**
+ * Applies the record at @p addr to the index, as kv_init() reads the log.
+ */
+static void index_apply(uint32_t addr, const rec_hdr_t *hdr)
+{
+    const char *key = (const char *)FLASH_PTR(addr + REC_HDR_SIZE);
+    uint32_t hash = hash_key(key, hdr->key_len);
+    uint32_t slot;
+    bool found;
+    rec_hdr_t old;
+
+    if (hdr->type == REC_MOVED)
+    {
+        return;
+    }
+    slot = find_slot(key, hdr->key_len, hash, &found);
+    if (found)
+    {
+        read_hdr(s_index[slot].addr, &old);
+        g_kv.live_bytes -= rec_size(old.key_len, old.value_len);
+        if (hdr->type == REC_DELETE)
+        {
+            index_remove(slot);
+            g_kv.keys--;
+            return;
+        }
+    }
+    else if (hdr->type == REC_DELETE || g_kv.keys >= KV_MAX_KEYS)
+    {
+        return;
+    }
+    else
+    {
+        s_index[slot].hash = hash;
+        g_kv.keys++;
+    }
+    s_index[slot].addr = addr;
+    g_kv.live_bytes += rec_size(hdr->key_len, hdr->value_len);
+}
+
+/*------------------------------------------------------------------------------
+ *      Sectors
+ *------------------------------------------------------------------------------*/
+static int program(uint32_t addr, uint32_t length)
+{
+    if (FlashProgram(s_buf, addr, length) != 0)
+    {
+        /* a word may be half programmed: nothing more goes there */
+        s_writeOff = KV_SECTOR_SIZE;
+        return KV_FLASH_ERROR;
+    }
+    return KV_OK;
+}
+
+/**
+ * Erases @p sector and programs the first half of its header: it is free.
+ */
+static int erase_sector(uint32_t sector)
+{
+    if (FlashErase(sector_base(sector)) != 0)
+    {
+        return KV_FLASH_ERROR;
+    }
+    g_kv.erases++;
+    g_kv.erase_count[sector]++;
+    s_state[sector] = SECTOR_FREE;
+    s_buf[0] = SECTOR_MAGIC;
+    s_buf[1] = g_kv.erase_count[sector];
+    return FlashProgram(s_buf, sector_base(sector), 8u) == 0 ? KV_OK
+                                                            : KV_FLASH_ERROR;
+}
+
+/**
+ * Makes the free @p sector the active one, with the next sequence number.
+ */
+static int activate(uint32_t sector)
+{
+    s_buf[0] = s_seq;
+    s_buf[1] = ~s_seq;
+    s_state[sector] = SECTOR_USED;
+    s_seqOf[sector] = s_seq++;
+    s_active = sector;
+    s_writeOff = SECTOR_HDR_SIZE;
+    return program(sector_base(sector) + 8u, 8u);
+}
+
+/** @returns uint32_t - the free sector erased the fewest times, or NO_SECTOR */
+static uint32_t least_worn_free(uint32_t *free_count)
+{
+    uint32_t best = NO_SECTOR;
+    uint32_t i;
+
+    *free_count = 0u;
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        if (s_state[i] == SECTOR_FREE)
+        {
+            (*free_count)++;
+            if (best == NO_SECTOR ||
+                g_kv.erase_count[i] < g_kv.erase_count[best])
+            {
+                best = i;
+            }
+        }
+    }
+    return best;
+}
+
+/** @returns uint32_t - the used sector with the lowest sequence number */
+static uint32_t oldest_used(void)
+{
+    uint32_t best = NO_SECTOR;
+    uint32_t i;
+
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        if (s_state[i] == SECTOR_USED &&
+            (best == NO_SECTOR || s_seqOf[i] < s_seqOf[best]))
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * Appends a record to the active sector; @p key and @p value may be in
+ * flash too, as they are staged through s_buf.
+ */
+static int write_record(uint8_t type, const char *key, uint32_t key_len,
+                        const uint8_t *value, uint32_t len, uint32_t *addr)
+{
+    uint32_t at = sector_base(s_active) + s_writeOff;
+    uint32_t head = REC_HDR_SIZE + align4(key_len);
+    uint32_t done;
+    rec_hdr_t hdr;
+    int rc;
+
+    hdr.key_len = (uint8_t)key_len;
+    hdr.type = type;
+    hdr.value_len = (uint16_t)len;
+    hdr.crc = record_crc(&hdr, (const uint8_t *)key, value);
+
+    memset(s_buf, 0xFF, head);
+    memcpy(s_buf, &hdr, sizeof(hdr));
+    if (key_len != 0u)
+    {
+        memcpy((uint8_t *)s_buf + REC_HDR_SIZE, key, key_len);
+    }
+    rc = program(at, head);
+    for (done = 0u; rc == KV_OK && done < len; done += sizeof(s_buf))
+    {
+        uint32_t chunk = len - done;
+
+        if (chunk > sizeof(s_buf))
+        {
+            chunk = sizeof(s_buf);
+        }
+        memset(s_buf, 0xFF, align4(chunk));
+        memcpy(s_buf, value + done, chunk);
+        rc = program(at + head + done, align4(chunk));
+    }
+    if (rc != KV_OK)
+    {
+        return rc;
+    }
+    s_writeOff += rec_size(key_len, len);
+    *addr = at;
+    return KV_OK;
+}
+
+/**
+ * Compacts @p sector: copies its live records to the active sector,
+ * appends the marker and erases it.
+ */
+static int compact(uint32_t sector)
+{
+    uint32_t base = sector_base(sector);
+    uint32_t off = SECTOR_HDR_SIZE;
+    rec_hdr_t hdr;
+    uint32_t addr;
+    int rc;
+
+    while (off + REC_HDR_SIZE <= KV_SECTOR_SIZE &&
+           read_record(base + off, KV_SECTOR_SIZE - off, &hdr) == READ_OK)
+    {
+        if (hdr.type == REC_VALUE)
+        {
+            const char *key = (const char *)FLASH_PTR(base + off + REC_HDR_SIZE);
+            bool found;
+            uint32_t slot = find_slot(key, hdr.key_len,
+                                      hash_key(key, hdr.key_len), &found);
+
+            if (found && s_index[slot].addr == base + off)
+            {
+                rc = write_record(REC_VALUE, key, hdr.key_len,
+                                  (const uint8_t *)key + align4(hdr.key_len),
+                                  hdr.value_len, &addr);
+                if (rc != KV_OK)
+                {
+                    return rc;
+                }
+                s_index[slot].addr = addr;
+                g_kv.moved_bytes += rec_size(hdr.key_len, hdr.value_len);
+            }
+        }
+        off += rec_size(hdr.key_len, hdr.value_len);
+    }
+    rc = write_record(REC_MOVED, NULL, 0u, NULL, 0u, &addr);
+    if (rc != KV_OK)
+    {
+        return rc;
+    }
+    g_kv.compactions++;
+    return erase_sector(sector);
+}
+
+/**
+ * Moves on to a new active sector; taking the last free one compacts the
+ * oldest sector.
+ */
+static int next_sector(void)
+{
+    uint32_t free_count;
+    uint32_t sector = least_worn_free(&free_count);
+    int rc;
+
+    if (sector == NO_SECTOR)
+    {
+        return KV_FULL;
+    }
+    rc = activate(sector);
+    if (rc == KV_OK && free_count == 1u)
+    {
+        rc = compact(oldest_used());
+    }
+    return rc;
+}
+
+/**
+ * Makes room for a record of @p size bytes in the active sector.
+ */
+static int make_room(uint32_t size)
+{
+    uint32_t round;
+    int rc;
+
+    for (round = 0u; round <= KV_SECTORS; round++)
+    {
+        if (s_writeOff + size <= KV_SECTOR_SIZE - REC_HDR_SIZE)
+        {
+            return KV_OK;
+        }
+        rc = next_sector();
+        if (rc != KV_OK)
+        {
+            return rc;
+        }
+    }
+    return KV_FULL;
+}
+
+/**
+ * Reads the sector headers: states, sequence numbers and erase counts.
+ * Bad sectors get the highest erase count seen.
+ */
+static void read_sectors(void)
+{
+    uint32_t most = 0u;
+    uint32_t i;
+
+    s_seq = 0u;
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        sector_hdr_t hdr;
+
+        memcpy(&hdr, FLASH_PTR(sector_base(i)), sizeof(hdr));
+        s_state[i] = SECTOR_BAD;
+        if (hdr.magic == SECTOR_MAGIC && hdr.erase_count != ERASED_WORD)
+        {
+            if (hdr.seq == ERASED_WORD && hdr.seq_check == ERASED_WORD)
+            {
+                s_state[i] = SECTOR_FREE;
+            }
+            else if (hdr.seq_check == ~hdr.seq && hdr.seq != ERASED_WORD)
+            {
+                s_state[i] = SECTOR_USED;
+                s_seqOf[i] = hdr.seq;
+                if (hdr.seq >= s_seq)
+                {
+                    s_seq = hdr.seq + 1u;
+                }
+            }
+        }
+        if (s_state[i] != SECTOR_BAD)
+        {
+            g_kv.erase_count[i] = hdr.erase_count;
+            if (hdr.erase_count > most)
+            {
+                most = hdr.erase_count;
+            }
+        }
+    }
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        if (s_state[i] == SECTOR_BAD)
+        {
+            g_kv.erase_count[i] = most;
+        }
+    }
+}
+
+/**
+ * Rebuilds the index from @p sector; leaves in s_writeOff where appending
+ * could go on (the end of the sector past a bad record).
+ *
+ * @returns bool - true if the sector holds a compaction marker
+ */
+static bool scan_sector(uint32_t sector)
+{
+    uint32_t base = sector_base(sector);
+    uint32_t off = SECTOR_HDR_SIZE;
+    bool moved = false;
+    rec_hdr_t hdr;
+
+    while (off + REC_HDR_SIZE <= KV_SECTOR_SIZE)
+    {
+        read_result_t result = read_record(base + off, KV_SECTOR_SIZE - off,
+                                           &hdr);
+
+        if (result == READ_BLANK)
+        {
+            break;
+        }
+        if (result == READ_BAD)
+        {
+            g_kv.torn++;
+            off = KV_SECTOR_SIZE;
+            break;
+        }
+        g_kv.boot_records++;
+        index_apply(base + off, &hdr);
+        moved = moved || hdr.type == REC_MOVED;
+        off += rec_size(hdr.key_len, hdr.value_len);
+    }
+    s_writeOff = off;
+    return moved;
+}
+
+/** @returns bool - true if the active sector is erased from s_writeOff on */
+static bool tail_blank(void)
+{
+    uint32_t off;
+    uint32_t word;
+
+    for (off = s_writeOff; off < KV_SECTOR_SIZE; off += 4u)
+    {
+        memcpy(&word, FLASH_PTR(sector_base(s_active) + off), 4u);
+        if (word != ERASED_WORD)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * One pass of kv_init().
+ *
+ * @returns int - KV_OK, an error, or 1 to start again after undoing an
+ *          interrupted compaction
+ */
+static int mount(void)
+{
+    uint32_t order[KV_SECTORS];
+    uint32_t used = 0u;
+    uint32_t free_count;
+    bool moved = false;
+    uint32_t i;
+    uint32_t j;
+    int rc;
+
+    memset(s_index, 0, sizeof(s_index));
+    g_kv.keys = 0u;
+    g_kv.live_bytes = 0u;
+    g_kv.boot_records = 0u;
+    read_sectors();
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        if (s_state[i] == SECTOR_BAD)
+        {
+            rc = erase_sector(i);
+            if (rc != KV_OK)
+            {
+                return rc;
+            }
+        }
+        else if (s_state[i] == SECTOR_USED)
+        {
+            /* insertion sort by sequence number */
+            for (j = used; j > 0u && s_seqOf[order[j - 1u]] > s_seqOf[i]; j--)
+            {
+                order[j] = order[j - 1u];
+            }
+            order[j] = i;
+            used++;
+        }
+    }
+    if (used == 0u)
+    {
+        return activate(least_worn_free(&free_count));
+    }
+    for (i = 0u; i < used; i++)
+    {
+        s_active = order[i];
+        moved = scan_sector(order[i]);
+    }
+    if (!tail_blank())
+    {
+        s_writeOff = KV_SECTOR_SIZE;
+    }
+    (void)least_worn_free(&free_count);
+    if (free_count == 0u)
+    {
+        /* the reset came in a compaction: the active sector has the copies */
+        g_kv.recoveries++;
+        if (moved)
+        {
+            return erase_sector(order[0]);
+        }
+        rc = erase_sector(s_active);
+        return rc == KV_OK ? 1 : rc;
+    }
+    return KV_OK;
+}
+
+/**
+ * Mounts the store: reads the sector headers, erases bad sectors and
+ * rebuilds the index from the log. Formats blank flash. Call once at boot,
+ * before any other kv_ function.
+ *
+ * @returns int - KV_OK or KV_FLASH_ERROR
+ */
+int kv_init(void)
+{
+    int rc;
+
+    s_ready = false;
+    memset(&g_kv, 0, sizeof(g_kv));
+    do
+    {
+        rc = mount();
+    } while (rc == 1);
+    s_ready = (rc == KV_OK);
+    return rc;
+}
+
+/**
+ * Erases every key. Erase counts are kept.
+ *
+ * @returns int - KV_OK or KV_FLASH_ERROR
+ */
+int kv_format(void)
+{
+    uint32_t free_count;
+    uint32_t i;
+    int rc;
+
+    s_ready = false;
+    memset(s_index, 0, sizeof(s_index));
+    memset(&g_kv, 0, sizeof(g_kv));
+    read_sectors();
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        rc = erase_sector(i);
+        if (rc != KV_OK)
+        {
+            return rc;
+        }
+    }
+    rc = activate(least_worn_free(&free_count));
+    s_ready = (rc == KV_OK);
+    return rc;
+}
+
+static bool key_ok(const char *key, uint32_t *key_len)
+{
+    if (!s_ready || key == NULL)
+    {
+        return false;
+    }
+    *key_len = (uint32_t)strlen(key);
+    return *key_len != 0u && *key_len <= KV_KEY_MAX;
+}
+
+/**
+ * Sets @p key to @p len bytes at @p value. When it returns KV_OK the value
+ * is in flash; if a reset comes first the key keeps its old value.
+ *
+ * @param[in] key   - NUL-terminated, 1 to KV_KEY_MAX characters
+ * @param[in] value - not in the store itself (e.g. from kv_get_ptr())
+ * @param[in] len   - 0 to KV_VALUE_MAX
+ * @returns int - KV_OK, KV_FULL, KV_BAD_ARG or KV_FLASH_ERROR
+ */
+int kv_put(const char *key, const void *value, uint32_t len)
+{
+    uint32_t key_len;
+    uint32_t hash;
+    uint32_t slot;
+    uint32_t size;
+    uint32_t old = 0u;
+    uint32_t addr;
+    bool found;
+    rec_hdr_t hdr;
+    int rc;
+
+    if (!key_ok(key, &key_len) || len > KV_VALUE_MAX ||
+        (value == NULL && len != 0u))
+    {
+        return KV_BAD_ARG;
+    }
+    hash = hash_key(key, key_len);
+    size = rec_size(key_len, len);
+    slot = find_slot(key, key_len, hash, &found);
+    if (found)
+    {
+        read_hdr(s_index[slot].addr, &hdr);
+        old = rec_size(hdr.key_len, hdr.value_len);
+    }
+    else if (g_kv.keys >= KV_MAX_KEYS)
+    {
+        return KV_FULL;
+    }
+    if (g_kv.live_bytes - old + size > KV_CAPACITY)
+    {
+        return KV_FULL;
+    }
+    /* compactions move records but leave the index slots where they are */
+    rc = make_room(size);
+    if (rc == KV_OK)
+    {
+        rc = write_record(REC_VALUE, key, key_len, (const uint8_t *)value,
+                          len, &addr);
+    }
+    if (rc != KV_OK)
+    {
+        return rc;
+    }
+    if (!found)
+    {
+        s_index[slot].hash = hash;
+        g_kv.keys++;
+    }
+    s_index[slot].addr = addr;
+    g_kv.live_bytes += size - old;
+    return KV_OK;
+}
+
+/**
+ * Removes @p key, with the same atomicity as kv_put().
+ *
+ * @returns int - KV_OK, KV_NOT_FOUND, KV_FULL, KV_BAD_ARG or KV_FLASH_ERROR
+ */
+int kv_delete(const char *key)
+{
+    uint32_t key_len;
+    uint32_t slot;
+    uint32_t addr;
+    bool found;
+    rec_hdr_t hdr;
+    int rc;
+
+    if (!key_ok(key, &key_len))
+    {
+        return KV_BAD_ARG;
+    }
+    slot = find_slot(key, key_len, hash_key(key, key_len), &found);
+    if (!found)
+    {
+        return KV_NOT_FOUND;
+    }
+    rc = make_room(rec_size(key_len, 0u));
+    if (rc == KV_OK)
+    {
+        rc = write_record(REC_DELETE, key, key_len, NULL, 0u, &addr);
+    }
+    if (rc != KV_OK)
+    {
+        return rc;
+    }
+    read_hdr(s_index[slot].addr, &hdr);
+    g_kv.live_bytes -= rec_size(hdr.key_len, hdr.value_len);
+    g_kv.keys--;
+    index_remove(slot);
+    return KV_OK;
+}
+
+/**
+ * Finds @p key without copying its value.
+ *
+ * @param[out] len - length of the value
+ * @returns const void* - the value in flash, 4-byte aligned; NULL if the
+ *          key is not there
+ */
+const void *kv_get_ptr(const char *key, uint32_t *len)
+{
+    uint32_t key_len;
+    uint32_t slot;
+    bool found;
+    rec_hdr_t hdr;
+
+    if (!key_ok(key, &key_len))
+    {
+        return NULL;
+    }
+    slot = find_slot(key, key_len, hash_key(key, key_len), &found);
+    if (!found)
+    {
+        return NULL;
+    }
+    read_hdr(s_index[slot].addr, &hdr);
+    *len = hdr.value_len;
+    return FLASH_PTR(s_index[slot].addr + REC_HDR_SIZE + align4(key_len));
+}
+
+/**
+ * Copies the value of @p key to @p buf.
+ *
+ * @returns int32_t - length of the value; KV_NOT_FOUND, or KV_FULL if it
+ *          is longer than @p max (nothing copied)
+ */
+int32_t kv_get(const char *key, void *buf, uint32_t max)
+{
+    uint32_t len;
+    const void *value = kv_get_ptr(key, &len);
+
+    if (value == NULL)
+    {
+        return KV_NOT_FOUND;
+    }
+    if (len > max)
+    {
+        return KV_FULL;
+    }
+    memcpy(buf, value, len);
+    return (int32_t)len;
+}
+
+/**
+ * @returns bool - true if @p key has a value
+ */
+bool kv_exists(const char *key)
+{
+    uint32_t len;
+
+    return kv_get_ptr(key, &len) != NULL;
+}
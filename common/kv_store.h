@@ -0,0 +1,128 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - key-value store in flash
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kv_store.h
+ * @author   insert authors names here
+ * @brief    Persistent key-value store (configuration, calibration tables)
+ *           in the KV_FLASH region of Tiva.icf: the last 64 KB of flash,
+ *           four 16 KB erase sectors. \n
+ *           Log: every kv_put() or kv_delete() appends a record (header,
+ *           key, value, CRC-32) to the active sector; the newest record of
+ *           a key is its value. A RAM hash index (key hash -> record) is
+ *           rebuilt by kv_init() from the log, so lookups read one record
+ *           of flash. Values are 4-byte aligned in flash and kv_get_ptr()
+ *           returns them in place, without a copy.\n
+ *           Atomic: a record only counts once its CRC checks, so after a
+ *           reset in the middle of a kv_put() the key has its old value or
+ *           its new one. kv_init() also finishes or undoes an interrupted
+ *           compaction.\n
+ *           Wear leveling and compaction: a full sector is followed by the
+ *           free sector erased the fewest times. One sector is always kept
+ *           free: taking the last one compacts the oldest sector - its live
+ *           records are copied to the new active sector and it is erased -
+ *           so sectors are erased in turn and static data moves with them.
+ *           Each word is programmed once between erases.\n
+ *           Erasing or programming stalls the core (about 10 ms per erase,
+ *           one per sector filled): call kv_put() and kv_delete() where that
+ *           is acceptable, not from handlers. Pointers of kv_get_ptr() are
+ *           valid up to the next kv_put() or kv_delete(). Not thread-safe.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _KV_STORE_H_
+#define _KV_STORE_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** The KV_FLASH region of Tiva.icf: keep both in step. */
+#define KV_FLASH_BASE           0x000F0000u
+#define KV_FLASH_SIZE           0x00010000u
+#define KV_SECTOR_SIZE          0x00004000u     /**< flash erase sector */
+#define KV_SECTORS              (KV_FLASH_SIZE / KV_SECTOR_SIZE)
+
+/** Longest key, in characters. */
+#define KV_KEY_MAX              31u
+
+/** Longest value, in bytes. */
+#ifndef KV_VALUE_MAX
+#define KV_VALUE_MAX            4096u
+#endif
+
+/** Slots of the RAM index, a power of two; 8 bytes each. */
+#ifndef KV_INDEX_SLOTS
+#define KV_INDEX_SLOTS          128u
+#endif
+/** Keys the store holds: the index stays at most 3/4 full. */
+#define KV_MAX_KEYS             (KV_INDEX_SLOTS * 3u / 4u)
+
+/** Room for live records: two sectors are needed to move them around. */
+#define KV_CAPACITY             ((KV_SECTORS - 2u) * (KV_SECTOR_SIZE - 24u))
+
+/** Return values. */
+#define KV_OK                   0
+#define KV_NOT_FOUND            (-1)
+#define KV_FULL                 (-2)    /**< no room or no index slot     */
+#define KV_BAD_ARG              (-3)
+#define KV_FLASH_ERROR          (-4)    /**< FlashErase/FlashProgram failed */
+
+typedef struct
+{
+    uint32_t keys;
+    uint32_t live_bytes;        /**< records of the current values          */
+    uint32_t boot_records;      /**< records read by the last kv_init()     */
+    uint32_t torn;              /**< bad records found by kv_init()         */
+    uint32_t recoveries;        /**< compactions kv_init() finished/undid   */
+    uint32_t compactions;
+    uint32_t moved_bytes;       /**< copied by compactions                  */
+    uint32_t erases;
+    uint32_t max_probes;        /**< longest index search                   */
+    uint32_t erase_count[KV_SECTORS];
+} kv_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern kv_stats_t g_kv;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+int  kv_init(void);
+int  kv_format(void);
+int  kv_put(const char *key, const void *value, uint32_t len);
+int  kv_delete(const char *key);
+const void *kv_get_ptr(const char *key, uint32_t *len);
+int32_t kv_get(const char *key, void *buf, uint32_t max);
+bool kv_exists(const char *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - memory pools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     mem_new.cpp
+ * @author   insert authors names here
+ * @brief    Global operator new/delete on the pools of mem_pool.h, target
+ *           side. \n
+ *           A failed allocation throws std::bad_alloc when exceptions are
+ *           enabled (IccExceptions2) and calls abort() otherwise; the
+ *           nothrow forms return nullptr. Objects above MEM_MAX_BLOCK get
+ *           a large block; g_mem tells which class or heap ran out.
+ *           The host build keeps the C++ library's operators: host threads
+ *           (e.g. bench_ring.cpp) allocate concurrently, which the
+ *           simulated interrupt mask does not serialise.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "common/mem_pool.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void *alloc_or_fail(std::size_t size)
+{
+    void *block = mem_alloc(size);
+
+    if (block == nullptr)
+    {
+#if defined(__cpp_exceptions)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+    return block;
+}
+
+void *operator new(std::size_t size)
+{
+    return alloc_or_fail(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return alloc_or_fail(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return mem_alloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return mem_alloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    mem_free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    mem_free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    mem_free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    mem_free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    mem_free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    mem_free(ptr);
+}
+
+#endif
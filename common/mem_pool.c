@@ -0,0 +1,579 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - memory pools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     mem_pool.c
+ * @author   insert authors names here
+ * @brief    Size-class pools and arena (see mem_pool.h). \n
+ *           HEAP is split at mem_init() into one region per class, in class
+ *           order, followed by the space of the arena (from its bottom) and
+ *           the large blocks (from its top). A class hands out never-used
+ *           blocks with a bump index and reuses freed ones through an
+ *           intrusive free list, so mem_init() does not have to walk the
+ *           blocks. Free large blocks are kept in an address-ordered list
+ *           so that neighbours merge; the lowest one gives its memory back
+ *           to the shared space. Allocation and release mask interrupts -
+ *           for a few instructions with the pools, for a walk of the free
+ *           list with large blocks; they are safe from tasks and handlers.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#include "common/bitops.h"
+#include "common/mem_pool.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Also route malloc()/free()/calloc()/realloc() to the pools (IAR only). */
+#ifndef MEM_REPLACE_MALLOC
+#define MEM_REPLACE_MALLOC  1
+#endif
+
+typedef struct mem_block
+{
+    struct mem_block *next;
+} mem_block_t;
+
+/** Header in front of every large block; free ones also link the list. */
+typedef struct large_block
+{
+    uint32_t            size;   /**< bytes, header included            */
+    uint32_t            tag;
+    struct large_block *next;   /**< free list, in the free ones only  */
+} large_block_t;
+
+#define LARGE_HEADER        MEM_ALIGN
+#define LARGE_TAG_USED      0x4C524755u
+#define LARGE_TAG_FREE      0x4C524746u
+/** Smallest remainder worth splitting off a free large block. */
+#define LARGE_MIN_SPLIT     64u
+
+typedef struct
+{
+    uint8_t     *base;
+    uint8_t     *end;
+    uint32_t     fresh;     /**< blocks never handed out start here */
+    mem_block_t *free;
+} mem_class_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+mem_stats_t g_mem;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+#pragma section="HEAP"
+#else
+/** Stand-in for the HEAP block of Tiva.icf. */
+static uint64_t s_heap[MEM_HEAP_SIZE / sizeof(uint64_t)];
+#endif
+
+static const uint32_t s_counts[MEM_CLASSES] = MEM_POOL_COUNTS;
+
+static mem_class_t    s_classes[MEM_CLASSES];
+static uint8_t       *s_arena;
+static uint8_t       *s_largeLow;   /**< lowest large block, free or used */
+static uint8_t       *s_heapEnd;
+static large_block_t *s_largeFree;  /**< address order                    */
+static bool           s_ready;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Masks interrupts around a free-list update. The simulator only takes
+ * exceptions at HAL calls, and there are none in between, so the host build
+ * needs no mask.
+ */
+static inline uint32_t lock(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_interrupt();
+    return primask;
+#else
+    return 0u;
+#endif
+}
+
+static inline void unlock(uint32_t primask)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __set_PRIMASK(primask);
+#else
+    (void)primask;
+#endif
+}
+
+/** @returns uint32_t - smallest class for @p size, MEM_CLASSES if none */
+static inline uint32_t class_of(size_t size)
+{
+    if (size <= MEM_MIN_BLOCK)
+    {
+        return 0u;
+    }
+    if (size > MEM_MAX_BLOCK)
+    {
+        return MEM_CLASSES;
+    }
+    /* 17..32 -> 1, 33..64 -> 2, ... */
+    return 32u - clz32((uint32_t)size - 1u) - 4u;
+}
+
+/** mem_init() with interrupts already masked. */
+static void split_heap(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint8_t *heap = (uint8_t *)__section_begin("HEAP");
+    uint32_t heap_size = __section_size("HEAP");
+#else
+    uint8_t *heap = (uint8_t *)s_heap;
+    uint32_t heap_size = sizeof(s_heap);
+#endif
+    uint8_t *next = heap;
+    uint32_t i;
+
+    memset(&g_mem, 0, sizeof(g_mem));
+    for (i = 0; i < MEM_CLASSES; i++)
+    {
+        uint32_t size = MEM_MIN_BLOCK << i;
+
+        s_classes[i].base = next;
+        s_classes[i].end = next + size * s_counts[i];
+        s_classes[i].fresh = 0u;
+        s_classes[i].free = NULL;
+        g_mem.cls[i].size = size;
+        g_mem.cls[i].count = s_counts[i];
+        next = s_classes[i].end;
+    }
+    s_arena = next;
+    s_heapEnd = heap + heap_size;
+    s_largeLow = s_heapEnd;
+    s_largeFree = NULL;
+    g_mem.arena_size = (uint32_t)(s_heapEnd - next);
+    s_ready = true;
+}
+
+/**
+ * Splits HEAP into the class regions and the shared space of arena and
+ * large blocks, and clears the statistics. Called by the first allocation;
+ * call it earlier to reset all allocators (every block handed out before
+ * becomes invalid).
+ */
+void mem_init(void)
+{
+    uint32_t primask = lock();
+
+    split_heap();
+    unlock(primask);
+}
+
+/** @returns uint32_t - bytes between the arena top and the large blocks */
+static inline uint32_t shared_room(void)
+{
+    return (uint32_t)(s_largeLow - s_arena) - g_mem.arena_used;
+}
+
+/**
+ * First-fit large block of at least @p size bytes, interrupts masked. A
+ * block is cut from the top of the first free one that fits, else from the
+ * shared space below the lowest block.
+ */
+static void *large_alloc(size_t size)
+{
+    large_block_t **link = &s_largeFree;
+    large_block_t *b = NULL;
+    uint32_t total;
+
+    if (size > g_mem.arena_size)
+    {
+        g_mem.large_failures++;
+        return NULL;
+    }
+    total = (((uint32_t)size + MEM_ALIGN - 1u) & ~(MEM_ALIGN - 1u)) + LARGE_HEADER;
+    if (total < sizeof(large_block_t))
+    {
+        total = sizeof(large_block_t);
+    }
+
+    while (*link != NULL && (*link)->size < total)
+    {
+        link = &(*link)->next;
+    }
+    if (*link != NULL)
+    {
+        large_block_t *f = *link;
+
+        if (f->size - total >= LARGE_MIN_SPLIT)
+        {
+            f->size -= total;
+            b = (large_block_t *)((uint8_t *)f + f->size);
+        }
+        else
+        {
+            total = f->size;
+            *link = f->next;
+            b = f;
+        }
+    }
+    else if (total <= shared_room())
+    {
+        s_largeLow -= total;
+        b = (large_block_t *)s_largeLow;
+    }
+    else
+    {
+        g_mem.large_failures++;
+        return NULL;
+    }
+
+    b->size = total;
+    b->tag = LARGE_TAG_USED;
+    g_mem.large_allocs++;
+    g_mem.large_used += total;
+    if (g_mem.large_used > g_mem.large_peak)
+    {
+        g_mem.large_peak = g_mem.large_used;
+    }
+    return (uint8_t *)b + LARGE_HEADER;
+}
+
+/** @returns large_block_t* - header of the large block @p ptr, NULL if none */
+static large_block_t *large_of(const void *ptr)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    large_block_t *b;
+
+    if (p < s_largeLow + LARGE_HEADER || p >= s_heapEnd ||
+        ((uintptr_t)p & (MEM_ALIGN - 1u)) != 0u)
+    {
+        return NULL;
+    }
+    b = (large_block_t *)(p - LARGE_HEADER);
+    return (b->tag == LARGE_TAG_USED) ? b : NULL;
+}
+
+/**
+ * Puts a large block back in the free list, interrupts masked, merging it
+ * with free neighbours; a free block at the bottom goes back to the shared
+ * space.
+ */
+static void large_free(large_block_t *b)
+{
+    large_block_t **link = &s_largeFree;
+    large_block_t *prev = NULL;
+
+    g_mem.large_used -= b->size;
+    b->tag = LARGE_TAG_FREE;
+    while (*link != NULL && *link < b)
+    {
+        prev = *link;
+        link = &(*link)->next;
+    }
+    b->next = *link;
+    *link = b;
+    if (b->next != NULL && (uint8_t *)b + b->size == (uint8_t *)b->next)
+    {
+        b->size += b->next->size;
+        b->next = b->next->next;
+    }
+    if (prev != NULL && (uint8_t *)prev + prev->size == (uint8_t *)b)
+    {
+        prev->size += b->size;
+        prev->next = b->next;
+    }
+    if (s_largeFree != NULL && (uint8_t *)s_largeFree == s_largeLow)
+    {
+        s_largeLow += s_largeFree->size;
+        s_largeFree = s_largeFree->next;
+    }
+}
+
+/**
+ * Allocates a block of at least @p size bytes, aligned to MEM_ALIGN: from
+ * the pools up to MEM_MAX_BLOCK, else (or when every class that fits is
+ * empty) a large block.
+ *
+ * @param[in] size - bytes
+ * @returns void*  - the block, NULL if neither can serve it
+ */
+void *mem_alloc(size_t size)
+{
+    uint32_t wanted;
+    uint32_t i;
+    uint32_t primask;
+    void *block = NULL;
+
+    primask = lock();
+    if (!s_ready)
+    {
+        split_heap();
+    }
+    wanted = class_of(size);
+    if (wanted == MEM_CLASSES)
+    {
+        g_mem.oversize++;
+        block = large_alloc(size);
+        unlock(primask);
+        return block;
+    }
+
+    for (i = wanted; i < MEM_CLASSES && block == NULL; i++)
+    {
+        mem_class_t *c = &s_classes[i];
+        mem_class_stats_t *st = &g_mem.cls[i];
+
+        if (c->free != NULL)
+        {
+            block = c->free;
+            c->free = c->free->next;
+        }
+        else if (c->fresh < st->count)
+        {
+            block = c->base + c->fresh * st->size;
+            c->fresh++;
+        }
+        else
+        {
+            continue;
+        }
+        st->allocs++;
+        if (++st->used > st->peak)
+        {
+            st->peak = st->used;
+        }
+        if (i != wanted)
+        {
+            g_mem.cls[wanted].spills++;
+        }
+    }
+    if (block == NULL)
+    {
+        block = large_alloc(size);
+        if (block != NULL)
+        {
+            g_mem.cls[wanted].spills++;
+        }
+        else
+        {
+            g_mem.cls[wanted].failures++;
+        }
+    }
+    unlock(primask);
+    return block;
+}
+
+/** @returns uint32_t - class owning @p ptr, MEM_CLASSES if none */
+static uint32_t owner_of(const void *ptr)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    uint32_t i;
+
+    for (i = 0; i < MEM_CLASSES; i++)
+    {
+        if (p >= s_classes[i].base && p < s_classes[i].end)
+        {
+            return i;
+        }
+    }
+    return MEM_CLASSES;
+}
+
+/**
+ * Returns a block to its class or to the large-block heap. NULL is ignored;
+ * other pointers (arena, stack, a large block already freed, ...) are
+ * counted in g_mem.bad_frees.
+ */
+void mem_free(void *ptr)
+{
+    large_block_t *large;
+    uint32_t i;
+    uint32_t primask;
+
+    if (ptr == NULL)
+    {
+        return;
+    }
+    primask = lock();
+    i = owner_of(ptr);
+    if (i == MEM_CLASSES)
+    {
+        large = large_of(ptr);
+        if (large != NULL)
+        {
+            large_free(large);
+        }
+        else
+        {
+            g_mem.bad_frees++;
+        }
+        unlock(primask);
+        return;
+    }
+    ((mem_block_t *)ptr)->next = s_classes[i].free;
+    s_classes[i].free = (mem_block_t *)ptr;
+    g_mem.cls[i].used--;
+    unlock(primask);
+}
+
+/** @returns size_t - usable size of a pool or large block, 0 for others */
+size_t mem_block_size(const void *ptr)
+{
+    uint32_t i = owner_of(ptr);
+    const large_block_t *large;
+
+    if (i != MEM_CLASSES)
+    {
+        return g_mem.cls[i].size;
+    }
+    large = large_of(ptr);
+    return (large == NULL) ? 0u : large->size - LARGE_HEADER;
+}
+
+/**
+ * Allocates from the arena. Arena memory is only given back in bulk, by
+ * mem_arena_release().
+ *
+ * @param[in] size - bytes
+ * @returns void*  - aligned to MEM_ALIGN, NULL if it would reach the large
+ *                   blocks
+ */
+void *mem_arena_alloc(size_t size)
+{
+    uint32_t rounded;
+    uint32_t primask;
+    void *block = NULL;
+
+    primask = lock();
+    if (!s_ready)
+    {
+        split_heap();
+    }
+    rounded = ((uint32_t)size + MEM_ALIGN - 1u) & ~(MEM_ALIGN - 1u);
+    if (size <= g_mem.arena_size && rounded <= shared_room())
+    {
+        block = s_arena + g_mem.arena_used;
+        g_mem.arena_used += rounded;
+        if (g_mem.arena_used > g_mem.arena_peak)
+        {
+            g_mem.arena_peak = g_mem.arena_used;
+        }
+    }
+    else
+    {
+        g_mem.arena_failures++;
+    }
+    unlock(primask);
+    return block;
+}
+
+/** @returns uint32_t - current arena position, for mem_arena_release() */
+uint32_t mem_arena_mark(void)
+{
+    return g_mem.arena_used;
+}
+
+/**
+ * Frees every arena allocation made after mem_arena_mark() returned
+ * @p mark; 0 frees the whole arena.
+ */
+void mem_arena_release(uint32_t mark)
+{
+    if (mark <= g_mem.arena_used)
+    {
+        g_mem.arena_used = mark;
+    }
+}
+
+#if defined(__IAR_SYSTEMS_ICC__) && MEM_REPLACE_MALLOC
+/*------------------------------------------------------------------------------
+ *      DLIB heap replacement: the library and the application share the
+ *      pools, and the DLIB heap is not linked in.
+ *------------------------------------------------------------------------------*/
+void *malloc(size_t size)
+{
+    return mem_alloc(size);
+}
+
+void free(void *ptr)
+{
+    mem_free(ptr);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    void *block;
+
+    if (size != 0u && count > SIZE_MAX / size)
+    {
+        return NULL;
+    }
+    block = mem_alloc(count * size);
+    if (block != NULL)
+    {
+        memset(block, 0, count * size);
+    }
+    return block;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    size_t old;
+    void *block;
+
+    if (ptr == NULL)
+    {
+        return mem_alloc(size);
+    }
+    if (size == 0u)
+    {
+        mem_free(ptr);
+        return NULL;
+    }
+    old = mem_block_size(ptr);
+    if (size <= old)
+    {
+        return ptr;
+    }
+    block = mem_alloc(size);
+    if (block != NULL)
+    {
+        memcpy(block, ptr, old);
+        mem_free(ptr);
+    }
+    return block;
+}
+#endif
@@ -0,0 +1,126 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - memory pools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     mem_pool.h
+ * @author   insert authors names here
+ * @brief    Deterministic allocators carved from the HEAP block of Tiva.icf:
+ *           size-class pools, a large-block heap and a monotonic arena. \n
+ *           - pools: MEM_CLASSES classes of power-of-two blocks from 16 bytes
+ *             up, each a fixed number of blocks with its own free list.
+ *             mem_alloc() takes the smallest class that fits and, when that
+ *             one is empty, the next larger ones; mem_free() finds the class
+ *             from the address. Both are O(1) (at most MEM_CLASSES steps)
+ *             and never fragment the memory of another class.
+ *           - large blocks: requests above MEM_MAX_BLOCK, and requests no
+ *             class can serve, are taken first-fit from the top of the rest
+ *             of HEAP, with an 8-byte header. mem_free() and
+ *             mem_block_size() recognise them; freed neighbours are merged.
+ *             Cost grows with the number of free large blocks: keep them
+ *             for buffers set up once or rarely.
+ *           - arena: the bottom of the same space, handed out by a bump
+ *             pointer for objects that live until a matching
+ *             mem_arena_release() (e.g. everything set up at start-up).
+ *             Arena and large blocks grow towards each other.
+ *           On IAR builds these also serve malloc()/free() and global
+ *           operator new/delete (mem_new.cpp), replacing the DLIB heap.
+ *           Per-class use, peak and failures are kept in g_mem.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _MEM_POOL_H_
+#define _MEM_POOL_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Size of the HEAP block (__ICFEDIT_size_heap__ in Tiva.icf). */
+#ifndef MEM_HEAP_SIZE
+#define MEM_HEAP_SIZE       0x10000u
+#endif
+
+/** Blocks per class, smallest class (16 bytes) first; the rest is arena. */
+#ifndef MEM_POOL_COUNTS
+#define MEM_POOL_COUNTS     { 256u, 256u, 128u, 64u, 32u, 16u }
+#endif
+
+#define MEM_CLASSES         6u
+#define MEM_MIN_BLOCK       16u
+#define MEM_MAX_BLOCK       (MEM_MIN_BLOCK << (MEM_CLASSES - 1u))
+
+/** Allocation alignment of pools, large blocks and arena. */
+#define MEM_ALIGN           8u
+
+typedef struct
+{
+    uint32_t size;          /**< block size                                */
+    uint32_t count;         /**< blocks in the class                       */
+    uint32_t used;          /**< blocks allocated now                      */
+    uint32_t peak;          /**< most blocks allocated at once             */
+    uint32_t allocs;        /**< blocks handed out                         */
+    uint32_t spills;        /**< requests served by a larger class/block   */
+    uint32_t failures;      /**< requests of this class nothing could serve */
+} mem_class_stats_t;
+
+typedef struct
+{
+    mem_class_stats_t cls[MEM_CLASSES];
+    uint32_t          oversize;       /**< pool requests above MEM_MAX_BLOCK */
+    uint32_t          bad_frees;      /**< mem_free() of a foreign pointer   */
+    uint32_t          large_used;     /**< large-block bytes, headers included */
+    uint32_t          large_peak;
+    uint32_t          large_allocs;
+    uint32_t          large_failures;
+    uint32_t          arena_size;     /**< shared with the large blocks      */
+    uint32_t          arena_used;
+    uint32_t          arena_peak;
+    uint32_t          arena_failures;
+} mem_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern mem_stats_t g_mem;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     mem_init(void);
+void    *mem_alloc(size_t size);
+void     mem_free(void *ptr);
+size_t   mem_block_size(const void *ptr);
+
+void    *mem_arena_alloc(size_t size);
+uint32_t mem_arena_mark(void);
+void     mem_arena_release(uint32_t mark);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
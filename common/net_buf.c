@@ -0,0 +1,142 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_buf.c
+ * @author   insert authors names here
+ * @brief    Frame buffer pool (see net_buf.h): a static array and a free
+ *           list. Allocation and release mask interrupts for a few
+ *           instructions; they are safe from tasks and handlers.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#include "common/boot.h"
+#include "common/net_buf.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+net_buf_stats_t g_net_buf;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static BOOT_NOINIT net_buf_t s_bufs[NET_BUF_COUNT];
+static net_buf_t            *s_free;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Masks interrupts around a free-list update. The simulator only takes
+ * exceptions at HAL calls, so the host build needs no mask.
+ */
+static inline uint32_t lock(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_interrupt();
+    return primask;
+#else
+    return 0u;
+#endif
+}
+
+static inline void unlock(uint32_t primask)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __set_PRIMASK(primask);
+#else
+    (void)primask;
+#endif
+}
+
+/**
+ * Puts every buffer back in the pool. Call before the drivers start; any
+ * buffer still held is forgotten.
+ */
+void net_buf_init(void)
+{
+    uint32_t i;
+
+    s_free = NULL;
+    for (i = NET_BUF_COUNT; i > 0u; i--)
+    {
+        s_bufs[i - 1u].next = s_free;
+        s_free = &s_bufs[i - 1u];
+    }
+    g_net_buf.free = NET_BUF_COUNT;
+    g_net_buf.min_free = NET_BUF_COUNT;
+    g_net_buf.failures = 0u;
+}
+
+/** @returns net_buf_t* - an empty buffer (len 0), NULL if none is left */
+net_buf_t *net_buf_alloc(void)
+{
+    uint32_t primask = lock();
+    net_buf_t *buf = s_free;
+
+    if (buf != NULL)
+    {
+        s_free = buf->next;
+        if (--g_net_buf.free < g_net_buf.min_free)
+        {
+            g_net_buf.min_free = g_net_buf.free;
+        }
+    }
+    else
+    {
+        g_net_buf.failures++;
+    }
+    unlock(primask);
+
+    if (buf != NULL)
+    {
+        buf->next = NULL;
+        buf->len = 0u;
+    }
+    return buf;
+}
+
+/** Returns a buffer to the pool; NULL is ignored. */
+void net_buf_free(net_buf_t *buf)
+{
+    uint32_t primask;
+
+    if (buf == NULL)
+    {
+        return;
+    }
+    primask = lock();
+    buf->next = s_free;
+    s_free = buf;
+    g_net_buf.free++;
+    unlock(primask);
+}
@@ -0,0 +1,90 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_buf.h
+ * @author   insert authors names here
+ * @brief    Pool of frame buffers shared by the network drivers and the
+ *           protocol code. \n
+ *           Every buffer holds one whole Ethernet frame, so the MAC's DMA
+ *           descriptors point straight into them and a received frame goes
+ *           up the stack, and a frame built by the stack goes down to the
+ *           DMA, without being copied. Whoever holds a buffer frees it:
+ *           the consumer of a received frame, the driver once a frame has
+ *           been sent. net_buf_alloc() and net_buf_free() are O(1) and may
+ *           be called from interrupts.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _NET_BUF_H_
+#define _NET_BUF_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Bytes per buffer: a 1518-byte frame, rounded up to a multiple of 32. */
+#ifndef NET_BUF_SIZE
+#define NET_BUF_SIZE        1536u
+#endif
+
+/** Buffers in the pool; enough for both descriptor rings and the stack. */
+#ifndef NET_BUF_COUNT
+#define NET_BUF_COUNT       24u
+#endif
+
+/** Frame buffer; data comes first so that it is word aligned for the DMA. */
+typedef struct net_buf
+{
+    uint8_t         data[NET_BUF_SIZE];
+    struct net_buf *next;       /**< free list, or a queue of the holder */
+    uint16_t        len;        /**< bytes of the frame in data[]        */
+} net_buf_t;
+
+typedef struct
+{
+    uint32_t free;          /**< buffers in the pool now                  */
+    uint32_t min_free;      /**< fewest buffers left in the pool at once   */
+    uint32_t failures;      /**< net_buf_alloc() calls that found none     */
+} net_buf_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern net_buf_stats_t g_net_buf;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void       net_buf_init(void);
+net_buf_t *net_buf_alloc(void);
+void       net_buf_free(net_buf_t *buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,122 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_if.h
+ * @author   insert authors names here
+ * @brief    Frame transport interface between the protocol code and a
+ *           link. \n
+ *           A transport fills in the ops and calls rx() with every frame it
+ *           receives; the protocol code sends through net_if_send(). On the
+ *           board the transport is the Ethernet MAC (eth_mac.h); on the host
+ *           it can also be a software loopback that writes a pcap capture
+ *           (host/net/net_loop.h), so the same protocol code runs on both.
+ *           Frames travel in net_buf_t buffers and change hands, never
+ *           bytes: send() takes the buffer, rx() gives it away.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _NET_IF_H_
+#define _NET_IF_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/net_buf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define NET_MAC_LEN         6u
+
+/** Shortest frame without FCS; shorter ones are padded by the transport. */
+#define NET_FRAME_MIN       60u
+
+/** The transport fills in the IPv4/UDP checksums of frames it sends. */
+#define NET_IF_TX_CSUM      0x01u
+/** The transport drops received frames with a bad IPv4/UDP checksum. */
+#define NET_IF_RX_CSUM      0x02u
+
+typedef struct net_if net_if_t;
+
+/**
+ * A received frame. Runs in the transport's context (the MAC interrupt on
+ * the board); the callee owns @p buf and frees it, now or later.
+ */
+typedef void (*net_rx_fn_t)(net_if_t *netif, net_buf_t *buf);
+
+typedef struct
+{
+    /**
+     * Queues a frame of buf->len bytes.
+     * @returns bool - true if the transport took @p buf; false if it is
+     *                 full, and the caller still owns @p buf
+     */
+    bool (*send)(net_if_t *netif, net_buf_t *buf);
+    /** Does the work otherwise done in interrupts; may be NULL. */
+    void (*poll)(net_if_t *netif);
+} net_if_ops_t;
+
+/** Counters, for the debugger and the benchmarks. */
+typedef struct
+{
+    uint32_t tx_frames;     /**< frames taken by send()                   */
+    uint32_t tx_bytes;
+    uint32_t tx_full;       /**< send() refused: queue full                */
+    uint32_t rx_frames;     /**< frames passed to rx()                     */
+    uint32_t rx_bytes;
+    uint32_t rx_dropped;    /**< frames lost: no buffer, error, no room    */
+    uint32_t irqs;          /**< transport interrupts                     */
+} net_if_stats_t;
+
+struct net_if
+{
+    const net_if_ops_t *ops;
+    void               *priv;       /**< transport state                  */
+    net_rx_fn_t         rx;         /**< set by the protocol code          */
+    void               *rx_ctx;     /**< for rx()                          */
+    uint8_t             mac[NET_MAC_LEN];
+    uint8_t             flags;      /**< NET_IF_x                          */
+    net_if_stats_t      stats;
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+static inline bool net_if_send(net_if_t *netif, net_buf_t *buf)
+{
+    return netif->ops->send(netif, buf);
+}
+
+static inline void net_if_poll(net_if_t *netif)
+{
+    if (netif->ops->poll != NULL)
+    {
+        netif->ops->poll(netif);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,350 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - power governor
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     power.c
+ * @author   insert authors names here
+ * @brief    Power governor (see power.h). \n
+ *           power_idle() sleeps with PRIMASK set: the core wakes up on the
+ *           pending interrupt without taking it, so the timer service is
+ *           back on the run clock, and the idle time accounted, before any
+ *           handler runs. SysTick counts the deep-sleep clock while in
+ *           deep-sleep (its source is the system clock), hence the rescaling
+ *           around SysCtlDeepSleep().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+#include "common/timer_service.h"
+#include "common/power.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define POWER_CLOCK_CONFIG  (SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN | \
+                             SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240)
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+power_stats_t g_power;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const uint32_t s_profileHz[POWER_PROFILES] =
+{
+    120000000u, 60000000u, 30000000u
+};
+
+static const power_config_t s_defaultConfig =
+{
+    100u,   /* window_ms   */
+    80u,    /* up_pct      */
+    30u,    /* down_pct    */
+    10u     /* deep_min_ms */
+};
+
+static power_config_t  s_config;
+static power_client_t *s_clients;
+static uint64_t        s_windowStart;   /**< us, timer_time_us() */
+static uint64_t        s_idleUs;        /**< idle in this window */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Tightest constraints of the registered clients.
+ */
+static void constraints(uint32_t *latency_us, uint32_t *min_hz)
+{
+    const power_client_t *client;
+
+    *latency_us = POWER_LATENCY_ANY;
+    *min_hz = 0u;
+    for (client = s_clients; client != NULL; client = client->next)
+    {
+        if (client->max_latency_us < *latency_us)
+        {
+            *latency_us = client->max_latency_us;
+        }
+        if (client->min_hz > *min_hz)
+        {
+            *min_hz = client->min_hz;
+        }
+    }
+}
+
+/**
+ * Switches to a clock profile, rescales the timer service and tells the
+ * clients. Interrupts masked.
+ */
+static void set_profile(uint32_t profile)
+{
+    const power_client_t *client;
+    uint32_t hz = SysCtlClockFreqSet(POWER_CLOCK_CONFIG, s_profileHz[profile]);
+
+    timer_service_set_clock(hz);
+    g_power.profile = profile;
+    g_power.hz = hz;
+    g_power.switches++;
+    for (client = s_clients; client != NULL; client = client->next)
+    {
+        if (client->on_clock != NULL)
+        {
+            client->on_clock(hz);
+        }
+    }
+}
+
+/**
+ * @returns uint32_t - the profile the load of the window that just ended
+ *                     asks for
+ */
+static uint32_t governed_profile(uint32_t util, uint32_t min_hz)
+{
+    uint32_t profile = g_power.profile;
+
+    if (util >= s_config.up_pct)
+    {
+        profile = 0u;
+    }
+    else if (util < s_config.down_pct && profile + 1u < POWER_PROFILES)
+    {
+        uint32_t lower = s_profileHz[profile + 1u];
+
+        /* the same work at the lower clock must not trigger a step up */
+        if ((uint64_t)util * g_power.hz / lower < s_config.up_pct &&
+            lower >= min_hz)
+        {
+            profile++;
+        }
+    }
+    return profile;
+}
+
+/**
+ * Ends the utilization window once it is complete and applies the profile
+ * it selects; a client's min_hz is applied at once. Interrupts masked.
+ */
+static void govern(uint32_t latency_us, uint32_t min_hz)
+{
+    uint64_t now = timer_time_us();
+    uint64_t span = now - s_windowStart;
+    uint32_t profile = g_power.profile;
+
+    if (span >= (uint64_t)s_config.window_ms * 1000u)
+    {
+        uint64_t idle = (s_idleUs < span) ? s_idleUs : span;
+
+        g_power.util_pct = (uint32_t)((100u * (span - idle)) / span);
+        s_windowStart = now;
+        s_idleUs = 0u;
+        profile = governed_profile(g_power.util_pct, min_hz);
+    }
+    while (profile > 0u && s_profileHz[profile] < min_hz)
+    {
+        profile--;
+    }
+
+    if (profile == g_power.profile)
+    {
+        return;
+    }
+    /* a client's latency may delay a switch, not keep a clock it can't use */
+    if (latency_us >= POWER_SWITCH_US || g_power.hz < min_hz)
+    {
+        set_profile(profile);
+    }
+    else
+    {
+        g_power.vetoes++;
+    }
+}
+
+/**
+ * Starts the governor. Call after timer_service_init(), with the clock
+ * set up by SysCtlClockFreqSet() from the 25 MHz crystal and the PLL.
+ *
+ * @param[in] sysclk_hz - current core clock
+ * @param[in] config    - NULL for the defaults (100 ms window, up at 80%,
+ *                        down below 30%, deep-sleep from 10 ms idle)
+ */
+void power_init(uint32_t sysclk_hz, const power_config_t *config)
+{
+    uint32_t profile = POWER_PROFILES - 1u;
+    uint32_t i;
+
+    s_config = (config != NULL) ? *config : s_defaultConfig;
+    s_clients = NULL;
+    memset(&g_power, 0, sizeof(g_power));
+    for (i = 0; i < POWER_PROFILES; i++)
+    {
+        if (sysclk_hz >= s_profileHz[i])
+        {
+            profile = i;
+            break;
+        }
+    }
+    g_power.profile = profile;
+    g_power.hz = sysclk_hz;
+
+    SysCtlPeripheralClockGating(true);
+    SysCtlDeepSleepClockConfigSet(1, SYSCTL_DSLP_OSC_INT | SYSCTL_DSLP_MOSC_PD);
+
+    s_windowStart = timer_time_us();
+    s_idleUs = 0u;
+}
+
+/**
+ * Registers a client. Safe to call from any context.
+ *
+ * @param[in,out] client - constraints filled in; must stay valid until
+ *                         power_client_remove()
+ */
+void power_client_add(power_client_t *client)
+{
+    bool masked = IntMasterDisable();
+
+    client->next = s_clients;
+    s_clients = client;
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/**
+ * Unregisters a client. Safe to call from any context.
+ *
+ * @param[in] client - registered with power_client_add()
+ */
+void power_client_remove(power_client_t *client)
+{
+    bool masked = IntMasterDisable();
+    power_client_t **link = &s_clients;
+
+    while (*link != NULL && *link != client)
+    {
+        link = &(*link)->next;
+    }
+    if (*link != NULL)
+    {
+        *link = client->next;
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/**
+ * Changes a client's latency constraint, e.g. around a transfer. Takes
+ * effect at the next power_idle().
+ *
+ * @param[in,out] client         - registered with power_client_add()
+ * @param[in]     max_latency_us - POWER_LATENCY_ANY: no constraint
+ */
+void power_set_latency(power_client_t *client, uint32_t max_latency_us)
+{
+    client->max_latency_us = max_latency_us;
+}
+
+/**
+ * Keeps a peripheral clocked in sleep and/or deep-sleep. By default, with
+ * clock gating on, none is.
+ *
+ * @param[in] periph     - SYSCTL_PERIPH_x
+ * @param[in] sleep      - clocked in sleep
+ * @param[in] deep_sleep - clocked in deep-sleep (from the deep-sleep clock)
+ */
+void power_periph(uint32_t periph, bool sleep, bool deep_sleep)
+{
+    if (sleep)
+    {
+        SysCtlPeripheralSleepEnable(periph);
+    }
+    else
+    {
+        SysCtlPeripheralSleepDisable(periph);
+    }
+    if (deep_sleep)
+    {
+        SysCtlPeripheralDeepSleepEnable(periph);
+    }
+    else
+    {
+        SysCtlPeripheralDeepSleepDisable(periph);
+    }
+}
+
+/**
+ * Sleeps until the next interrupt, in deep-sleep when the next timer is
+ * far enough and no client objects, then lets the handler run. Call from
+ * the background loop. It may be called with interrupts masked, after
+ * checking that no work is pending, so that an interrupt posting work
+ * cannot slip in before the WFI; they are enabled on return.
+ */
+void power_idle(void)
+{
+    uint32_t latency;
+    uint32_t min_hz;
+    uint64_t start;
+    bool deep;
+
+    (void)IntMasterDisable();
+    constraints(&latency, &min_hz);
+    deep = timer_ticks_to_next() >= TIMER_MS(s_config.deep_min_ms);
+    if (deep && latency < POWER_DEEP_WAKE_US)
+    {
+        g_power.vetoes++;
+        deep = false;
+    }
+
+    start = timer_time_us();
+    if (deep)
+    {
+        g_power.deep_sleeps++;
+        timer_service_set_clock(POWER_DSLP_HZ);
+        SysCtlDeepSleep();
+        timer_service_set_clock(g_power.hz);
+    }
+    else
+    {
+        g_power.sleeps++;
+        SysCtlSleep();
+    }
+    s_idleUs += timer_time_us() - start;
+
+    govern(latency, min_hz);
+    IntMasterEnable();
+}
@@ -0,0 +1,135 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - power governor
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     power.h
+ * @author   insert authors names here
+ * @brief    Dynamic power/performance governor. \n
+ *           power_idle() replaces timer_idle() in the background loop
+ *           (Lab2 blinky: build with POWER_GOVERNOR=1). It
+ *           measures the time spent idle and, every window, the utilization
+ *           of the core:
+ *           - at or above up_pct the clock goes straight to the top profile;
+ *           - below down_pct it steps down one profile, if the load would
+ *             still stay under up_pct there.
+ *           Profiles are PLL settings (120, 60 and 30 MHz from the 240 MHz
+ *           VCO). When the next timer deadline is at least deep_min_ms away
+ *           it enters deep-sleep on PIOSC, otherwise sleep (WFI).
+ *
+ *           Clock gating: power_init() turns on SCGC/DCGC gating, so in
+ *           sleep and deep-sleep only the peripherals enabled with
+ *           power_periph() keep their clock.
+ *
+ *           Latency constraints: a driver registers a power_client_t and
+ *           states the longest time it can wait for the core (interrupt to
+ *           handler). Deep-sleep is entered only if every client allows
+ *           POWER_DEEP_WAKE_US, and a clock switch only if every client
+ *           allows POWER_SWITCH_US; min_hz keeps the clock from going below
+ *           what a client needs. on_clock() runs after each switch, with
+ *           interrupts masked, to re-derive baud rates, timer loads, etc.
+ *           The timer service is rescaled by the governor itself.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _POWER_H_
+#define _POWER_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#ifndef POWER_GOVERNOR
+#define POWER_GOVERNOR          0
+#endif
+
+/** Clock profiles, fastest first. */
+#define POWER_PROFILES          3u
+
+/** Deep-sleep clock: PIOSC, undivided. */
+#define POWER_DSLP_HZ           16000000u
+
+/**
+ * Wake-up from deep-sleep to the first handler instruction: MOSC start and
+ * PLL lock. Conservative; see the power.wake bench.
+ */
+#define POWER_DEEP_WAKE_US      200u
+
+/** SysCtlClockFreqSet(): PLL lock polled at PIOSC rate. Conservative. */
+#define POWER_SWITCH_US         2000u
+
+/** Client latency: no constraint. */
+#define POWER_LATENCY_ANY       UINT32_MAX
+
+typedef struct power_client power_client_t;
+
+struct power_client
+{
+    uint32_t        max_latency_us;         /**< POWER_LATENCY_ANY: none   */
+    uint32_t        min_hz;                 /**< 0: any profile            */
+    void          (*on_clock)(uint32_t sysclk_hz); /**< NULL: not needed   */
+    power_client_t *next;
+};
+
+typedef struct
+{
+    uint32_t window_ms;     /**< utilization measured over this period    */
+    uint32_t up_pct;        /**< utilization that selects the top profile */
+    uint32_t down_pct;      /**< utilization that allows a step down      */
+    uint32_t deep_min_ms;   /**< idle time worth a deep-sleep             */
+} power_config_t;
+
+typedef struct
+{
+    uint32_t profile;       /**< 0: fastest                               */
+    uint32_t hz;            /**< current core clock                       */
+    uint32_t util_pct;      /**< utilization over the last window         */
+    uint32_t switches;      /**< clock changes                            */
+    uint32_t sleeps;        /**< WFI                                      */
+    uint32_t deep_sleeps;   /**< WFI with SLEEPDEEP                       */
+    uint32_t vetoes;        /**< deep-sleeps or switches refused by a
+                                 client's latency                         */
+} power_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern power_stats_t g_power;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void power_init(uint32_t sysclk_hz, const power_config_t *config);
+void power_client_add(power_client_t *client);
+void power_client_remove(power_client_t *client);
+void power_set_latency(power_client_t *client, uint32_t max_latency_us);
+void power_periph(uint32_t periph, bool sleep, bool deep_sleep);
+void power_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
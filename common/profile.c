@@ -0,0 +1,206 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - profiling
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     profile.c
+ * @author   insert authors names here
+ * @brief    Trace ring, handler trampoline and drain (see profile.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+
+#include "common/profile.h"
+#include "common/vtable.h"
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+#include "host/sim/sim.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define ITM_STIM0           (*(volatile uint32_t *)0xE0000000u)
+#define ITM_TER             (*(volatile uint32_t *)0xE0000E00u)
+#define ITM_TCR             (*(volatile uint32_t *)0xE0000E80u)
+#define ITM_TCR_ITMENA      0x00000001u
+
+/** Zone id used by the calibration, never left in the ring. */
+#define CALIBRATION_ID      PROF_ID_MAX
+#define CALIBRATION_RUNS    8u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+#pragma location=".noinit"
+__no_init prof_trace_t g_prof_trace;
+#else
+prof_trace_t g_prof_trace;
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t         s_clockHz;
+static uint32_t         s_overhead;
+static vtable_handler_t s_wrapped[VTABLE_ENTRIES];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Starts the cycle counter and measures the probe overhead. The ring is
+ * kept if it survived a reset (to drain it after a crash); prof_reset()
+ * clears it.
+ *
+ * @param[in] clock_hz - core clock, recorded in the drained header
+ */
+void prof_init(uint32_t clock_hz)
+{
+    uint32_t run;
+    uint32_t head;
+
+    cycles_init();
+    s_clockHz = clock_hz;
+    if (g_prof_trace.magic != PROF_MAGIC)
+    {
+        prof_reset();
+    }
+
+    /* the cost of an empty zone, in the conditions of a real one */
+    s_overhead = UINT32_MAX;
+    for (run = 0; run < CALIBRATION_RUNS; run++)
+    {
+        uint32_t begin;
+        uint32_t cost;
+
+        head = g_prof_trace.head;
+        prof_record(PROF_TAG(PROF_KIND_BEGIN, CALIBRATION_ID));
+        prof_record(PROF_TAG(PROF_KIND_END, CALIBRATION_ID));
+        begin = g_prof_trace.records[head & (PROF_TRACE_ENTRIES - 1u)].cycles;
+        cost = g_prof_trace.records[(head + 1u) & (PROF_TRACE_ENTRIES - 1u)].cycles -
+               begin;
+        if (cost < s_overhead)
+        {
+            s_overhead = cost;
+        }
+        g_prof_trace.head = head;
+    }
+}
+
+/**
+ * Empties the ring. Not safe against concurrent probes.
+ */
+void prof_reset(void)
+{
+    g_prof_trace.head = 0;
+    g_prof_trace.magic = PROF_MAGIC;
+}
+
+/**
+ * Handler trampoline: the exception number tells which handler to call.
+ */
+static void isr_trampoline(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t irq = __get_IPSR();
+#else
+    uint32_t irq = sim_active_exception();
+#endif
+
+    prof_record(PROF_TAG(PROF_KIND_ISR_ENTER, irq));
+    s_wrapped[irq]();
+    prof_record(PROF_TAG(PROF_KIND_ISR_EXIT, irq));
+}
+
+/**
+ * Records entry and exit of a handler from now on. Do not wrap PendSV when
+ * the kernel runs: its context switch depends on the exception frame.
+ *
+ * @param[in] irq - vector number (INT_x, FAULT_SYSTICK, ...)
+ */
+void prof_wrap_isr(uint32_t irq)
+{
+    vtable_handler_t previous;
+
+    if (irq >= VTABLE_ENTRIES || s_wrapped[irq] != NULL)
+    {
+        return;
+    }
+    previous = register_isr(irq, isr_trampoline);
+    s_wrapped[irq] = previous;
+}
+
+/**
+ * Writes the header and the records in the ring, oldest first. Records
+ * written meanwhile may be torn; stop probing first for a clean capture.
+ *
+ * @param[in] sink   - byte output
+ * @returns uint32_t - records written
+ */
+uint32_t prof_drain(prof_sink_t sink)
+{
+    prof_header_t header;
+    uint32_t head = g_prof_trace.head;
+    uint32_t first = (head > PROF_TRACE_ENTRIES) ? head - PROF_TRACE_ENTRIES : 0u;
+    uint32_t i;
+
+    header.magic = PROF_MAGIC;
+    header.clock_hz = s_clockHz;
+    header.overhead = s_overhead;
+    header.count = head - first;
+    sink(&header, sizeof(header));
+    for (i = first; i != head; i++)
+    {
+        sink(&g_prof_trace.records[i & (PROF_TRACE_ENTRIES - 1u)],
+             sizeof(prof_record_t));
+    }
+    return header.count;
+}
+
+/**
+ * Sink for prof_drain(): ITM stimulus port 0, read over SWO by the
+ * debugger. Drops the data if the debugger has not enabled the port.
+ */
+void prof_itm_sink(const void *data, uint32_t length)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    if ((ITM_TCR & ITM_TCR_ITMENA) == 0u || (ITM_TER & 1u) == 0u)
+    {
+        return;
+    }
+    while (length-- != 0u)
+    {
+        while ((ITM_STIM0 & 1u) == 0u)
+        {
+        }
+        *(volatile uint8_t *)&ITM_STIM0 = *bytes++;
+    }
+#else
+    (void)data;
+    (void)length;
+#endif
+}
@@ -0,0 +1,168 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - profiling
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     profile.h
+ * @author   insert authors names here
+ * @brief    Cycle-accurate instrumentation on the DWT cycle counter. \n
+ *           Probes append {CYCCNT, tag} records to a trace ring in .noinit
+ *           (not cleared by reset, Tiva.icf), claiming slots with LDREX/STREX
+ *           so tasks and handlers can record without masking interrupts. The
+ *           ring keeps the newest PROF_TRACE_ENTRIES records.\n
+ *           - zones: PROF_BEGIN(id) / PROF_END(id) in C, PROF_ZONE(id) (scope)
+ *             in C++; id is any value below PROF_ID_MAX;
+ *           - handlers: prof_wrap_isr(irq) routes a vector through a
+ *             trampoline (vtable.h) that records entry and exit;
+ *           - prof_drain() writes a header and the records oldest first to a
+ *             byte sink: prof_itm_sink (ITM port 0, SWO) or e.g. a UART.
+ *           host/tools/prof_hist turns the captured file into min/avg/max
+ *           tables and histograms.\n
+ *           Cost: a probe is about 12 cycles (claim 5, CYCCNT read 2, two
+ *           stores); prof_init() measures the cost a zone adds to what it
+ *           wraps and the tool subtracts it. Probes compile to nothing unless
+ *           PROF_ENABLE is 1 (project define); prof_wrap_isr() works either way.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "common/cycles.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#ifndef PROF_ENABLE
+#define PROF_ENABLE             0
+#endif
+
+/** Ring size in records, a power of two (8 bytes each). */
+#ifndef PROF_TRACE_ENTRIES
+#define PROF_TRACE_ENTRIES      1024u
+#endif
+
+#define PROF_MAGIC              0x31465250u     /* "PRF1" */
+#define PROF_ID_MAX             0xFFFFu
+
+/** Record kinds, upper half of the tag; the lower half is the id. */
+#define PROF_KIND_BEGIN         1u
+#define PROF_KIND_END           2u
+#define PROF_KIND_ISR_ENTER     3u
+#define PROF_KIND_ISR_EXIT      4u
+
+#define PROF_TAG(kind, id)      (((uint32_t)(kind) << 16) | (uint16_t)(id))
+
+typedef struct
+{
+    uint32_t cycles;
+    uint32_t tag;
+} prof_record_t;
+
+/** The trace ring; head counts every record ever written. */
+typedef struct
+{
+    uint32_t          magic;
+    volatile uint32_t head;
+    prof_record_t     records[PROF_TRACE_ENTRIES];
+} prof_trace_t;
+
+/** Header written by prof_drain(), followed by count records. */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t clock_hz;
+    uint32_t overhead;          /**< cycles a zone adds to what it wraps */
+    uint32_t count;
+} prof_header_t;
+
+typedef void (*prof_sink_t)(const void *data, uint32_t length);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern prof_trace_t g_prof_trace;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     prof_init(uint32_t clock_hz);
+void     prof_reset(void);
+void     prof_wrap_isr(uint32_t irq);
+uint32_t prof_drain(prof_sink_t sink);
+void     prof_itm_sink(const void *data, uint32_t length);
+
+/** Appends one record; safe from any context. */
+static inline void prof_record(uint32_t tag)
+{
+    uint32_t slot;
+    prof_record_t *record;
+
+#if defined(__IAR_SYSTEMS_ICC__)
+    /* exception entry clears the exclusive monitor: a preempted claim retries */
+    do
+    {
+        slot = __LDREX((unsigned long *)&g_prof_trace.head);
+    } while (__STREX(slot + 1u, (unsigned long *)&g_prof_trace.head) != 0u);
+#else
+    slot = __atomic_fetch_add(&g_prof_trace.head, 1u, __ATOMIC_RELAXED);
+#endif
+    record = &g_prof_trace.records[slot & (PROF_TRACE_ENTRIES - 1u)];
+    record->cycles = cycles_now();
+    record->tag = tag;
+}
+
+#if PROF_ENABLE
+#define PROF_BEGIN(id)  prof_record(PROF_TAG(PROF_KIND_BEGIN, (id)))
+#define PROF_END(id)    prof_record(PROF_TAG(PROF_KIND_END, (id)))
+#else
+#define PROF_BEGIN(id)  ((void)0)
+#define PROF_END(id)    ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+
+/** Zone covering the enclosing scope. */
+class ProfZone
+{
+public:
+    explicit ProfZone(uint16_t id) : m_id(id) { PROF_BEGIN(id); }
+    ~ProfZone() { PROF_END(m_id); }
+
+private:
+    uint16_t m_id;
+};
+
+#define PROF_ZONE_NAME2(line)   prof_zone_##line
+#define PROF_ZONE_NAME(line)    PROF_ZONE_NAME2(line)
+#define PROF_ZONE(id)           ProfZone PROF_ZONE_NAME(__LINE__)(id)
+#endif
+
+#endif
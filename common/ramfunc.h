@@ -0,0 +1,41 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - SRAM code
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     ramfunc.h
+ * @author   insert authors names here
+ * @brief    Opt-in SRAM execution for hot code. \n
+ *           A function declared RAMFUNC is linked into section .ramfunc,
+ *           which Tiva.icf places in SRAM and the startup code copies from
+ *           flash together with the initialized data. It then runs without
+ *           flash wait states (5 at 120 MHz; the prefetch buffer hides them
+ *           for straight-line code, not for taken branches). Keep such
+ *           functions small and make them call only other RAMFUNCs or
+ *           inlined code. Ordinary functions on the host.
+ *
+ *              RAMFUNC void ADC0SS0_Handler(void) { ... }
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _RAMFUNC_H_
+#define _RAMFUNC_H_
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+#define RAMFUNC     _Pragma("location=\".ramfunc\"") __ramfunc
+#else
+#define RAMFUNC
+#endif
+
+#endif
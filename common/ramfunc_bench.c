@@ -0,0 +1,132 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - SRAM code
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     ramfunc_bench.c
+ * @author   insert authors names here
+ * @brief    Flash vs SRAM execution micro-benchmark (see ramfunc_bench.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include "common/ramfunc_bench.h"
+#include "common/ramfunc.h"
+#include "common/cycles.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CRC32_POLY          0xEDB88320u     /* reflected IEEE 802.3 */
+
+typedef uint32_t (*crc_fn_t)(const uint8_t *data, uint32_t length);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+ramfunc_bench_t g_ramfunc_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t s_data[RAMFUNC_BENCH_BYTES];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** Shared body, inlined into both copies so they are the same code. */
+#if defined(__IAR_SYSTEMS_ICC__)
+#pragma inline=forced
+#endif
+static inline uint32_t crc32_body(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    uint32_t bit;
+
+    while (length-- != 0u)
+    {
+        crc ^= *data++;
+        for (bit = 0; bit < 8u; bit++)
+        {
+            if ((crc & 1u) != 0u)
+            {
+                crc = (crc >> 1) ^ CRC32_POLY;
+            }
+            else
+            {
+                crc >>= 1;
+            }
+        }
+    }
+    return ~crc;
+}
+
+uint32_t ramfunc_crc32_flash(const uint8_t *data, uint32_t length)
+{
+    return crc32_body(data, length);
+}
+
+RAMFUNC uint32_t ramfunc_crc32_sram(const uint8_t *data, uint32_t length)
+{
+    return crc32_body(data, length);
+}
+
+/**
+ * Best-of-runs cycles of one copy; the first run also warms the caches
+ * (flash prefetch buffer) the way a hot loop would.
+ */
+static uint32_t best_cycles(crc_fn_t fn, uint32_t *crc)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t run;
+
+    for (run = 0; run < RAMFUNC_BENCH_RUNS; run++)
+    {
+        uint32_t start = cycles_now();
+        uint32_t elapsed;
+
+        *crc = fn(s_data, RAMFUNC_BENCH_BYTES);
+        elapsed = cycles_now() - start;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+/**
+ * Runs both copies over the same buffer; results in g_ramfunc_bench.
+ */
+void ramfunc_bench_run(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < RAMFUNC_BENCH_BYTES; i++)
+    {
+        s_data[i] = (uint8_t)(i * 7u + (i >> 3));
+    }
+    cycles_init();
+    g_ramfunc_bench.flash_cycles = best_cycles(ramfunc_crc32_flash,
+                                               &g_ramfunc_bench.flash_crc);
+    g_ramfunc_bench.sram_cycles = best_cycles(ramfunc_crc32_sram,
+                                              &g_ramfunc_bench.sram_crc);
+}
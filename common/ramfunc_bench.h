@@ -0,0 +1,72 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - SRAM code
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     ramfunc_bench.h
+ * @author   insert authors names here
+ * @brief    Flash vs SRAM execution micro-benchmark. \n
+ *           The same bitwise CRC-32 (a branch per bit, the worst case for the
+ *           flash prefetch buffer) is compiled once as an ordinary function
+ *           and once as RAMFUNC, and timed with the DWT cycle counter. On the
+ *           board, call ramfunc_bench_run() and read g_ramfunc_bench. The
+ *           host build has no flash: it only checks that both copies agree.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _RAMFUNC_BENCH_H_
+#define _RAMFUNC_BENCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define RAMFUNC_BENCH_BYTES     1024u
+#define RAMFUNC_BENCH_RUNS      8u
+
+typedef struct
+{
+    uint32_t flash_cycles;      /**< best of RAMFUNC_BENCH_RUNS */
+    uint32_t sram_cycles;
+    uint32_t flash_crc;
+    uint32_t sram_crc;
+} ramfunc_bench_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern ramfunc_bench_t g_ramfunc_bench;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+uint32_t ramfunc_crc32_flash(const uint8_t *data, uint32_t length);
+uint32_t ramfunc_crc32_sram(const uint8_t *data, uint32_t length);
+void     ramfunc_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
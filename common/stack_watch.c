@@ -0,0 +1,162 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - stack watch
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     stack_watch.c
+ * @author   insert authors names here
+ * @brief    Stack painting and high-water marks (see stack_watch.h). \n
+ *           Stacks grow down, so the scan goes up from the lowest address
+ *           and stops at the first word that was overwritten. A stack that
+ *           was never painted reads as fully used. On the host CSTACK is the
+ *           one of the host process and is not measured.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "stack_watch.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#pragma section = "CSTACK"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define LINE_SIZE       64u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Fills a stack with STACK_PAINT.
+ *
+ * @param[in] base  - lowest address of the stack
+ * @param[in] words - words to fill
+ */
+void stack_paint(uint32_t *base, uint32_t words)
+{
+    while (words-- != 0u)
+    {
+        *base++ = STACK_PAINT;
+    }
+}
+
+/**
+ * High-water mark of a painted stack.
+ *
+ * @param[in] base     - lowest address of the stack
+ * @param[in] words    - size of the stack
+ * @returns uint32_t   - bytes used at the deepest point so far
+ */
+uint32_t stack_used(const uint32_t *base, uint32_t words)
+{
+    uint32_t untouched = 0;
+
+    while (untouched < words && base[untouched] == STACK_PAINT)
+    {
+        untouched++;
+    }
+    return (words - untouched) * (uint32_t)sizeof(uint32_t);
+}
+
+/**
+ * Paints the free part of CSTACK, below the current SP. Runs before the C
+ * run-time is initialised (from __low_level_init()), so it must not use
+ * static data. No effect on the host.
+ */
+void stack_paint_main(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t *base = (uint32_t *)__section_begin("CSTACK");
+    uint32_t *sp = (uint32_t *)__get_SP();
+
+    if (sp - base > (int32_t)STACK_PAINT_GUARD_WORDS)
+    {
+        stack_paint(base, (uint32_t)(sp - base) - STACK_PAINT_GUARD_WORDS);
+    }
+#endif
+}
+
+/** @returns uint32_t - size of CSTACK in bytes, 0 on the host */
+uint32_t stack_main_size(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return (uint32_t)__section_size("CSTACK");
+#else
+    return 0u;
+#endif
+}
+
+/** @returns uint32_t - peak use of CSTACK in bytes, 0 on the host */
+uint32_t stack_main_used(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    return stack_used((const uint32_t *)__section_begin("CSTACK"),
+                      stack_main_size() / sizeof(uint32_t));
+#else
+    return 0u;
+#endif
+}
+
+/** @returns uint32_t - peak use of the stack of @p task in bytes */
+uint32_t stack_task_used(const k_task_t *task)
+{
+    return stack_used(task->stack, task->stack_words);
+}
+
+/**
+ * Writes the high-water marks of CSTACK (target only) and of the given
+ * tasks, in the format of stack_watch.h.
+ *
+ * @param[in] sink  - receives the report text
+ * @param[in] tasks - tasks to report, may be NULL if count is 0
+ * @param[in] count - entries in tasks
+ */
+void stack_report(stack_sink_t sink, const k_task_t *const *tasks,
+                  uint32_t count)
+{
+    char line[LINE_SIZE];
+    uint32_t stacks = 0;
+    uint32_t i;
+
+    snprintf(line, sizeof(line), "stack,%u,%s\n", STACK_WATCH_FORMAT,
+             STACK_WATCH_CONFIG);
+    sink(line, (uint32_t)strlen(line));
+    if (stack_main_size() != 0u)
+    {
+        snprintf(line, sizeof(line), "CSTACK,%u,%u\n",
+                 (unsigned)stack_main_size(), (unsigned)stack_main_used());
+        sink(line, (uint32_t)strlen(line));
+        stacks++;
+    }
+    for (i = 0; i < count; i++)
+    {
+        snprintf(line, sizeof(line), "%s,%u,%u\n",
+                 (tasks[i]->name != NULL) ? tasks[i]->name : "?",
+                 (unsigned)(tasks[i]->stack_words * sizeof(uint32_t)),
+                 (unsigned)stack_task_used(tasks[i]));
+        sink(line, (uint32_t)strlen(line));
+        stacks++;
+    }
+    snprintf(line, sizeof(line), "end,%u\n", (unsigned)stacks);
+    sink(line, (uint32_t)strlen(line));
+}
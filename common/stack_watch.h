@@ -0,0 +1,95 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - stack watch
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     stack_watch.h
+ * @author   insert authors names here
+ * @brief    Stack high-water marks of the main stack (CSTACK) and of the
+ *           kernel task stacks. \n
+ *           Stacks are filled with STACK_PAINT before use: CSTACK by
+ *           __low_level_init() in startup_ewarm.c, task stacks by
+ *           k_task_create(). The deepest word no longer holding the pattern
+ *           gives the peak use. stack_report() writes the figures of one
+ *           build configuration as CSV to a byte sink; host tool stack_map
+ *           puts captures of several configurations next to the worst case
+ *           computed by the linker (map file, "STACK USAGE") and suggests
+ *           sizes for Tiva.icf and K_STACK().
+ *
+ *           Capture format, one record per line:
+ *               stack,<format>,<configuration>
+ *               <stack name>,<size bytes>,<peak bytes>     (one per stack)
+ *               end,<number of stacks>
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _STACK_WATCH_H_
+#define _STACK_WATCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "common/kernel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define STACK_WATCH_FORMAT      1u
+
+/** Fill pattern of unused stack. */
+#define STACK_PAINT             0xDEADBEEFu
+
+/**
+ * Words just below the SP left unpainted by stack_paint_main(), room for the
+ * frame of the painting code itself.
+ */
+#define STACK_PAINT_GUARD_WORDS 16u
+
+/** Name of the build configuration in reports (Release builds define NDEBUG). */
+#ifndef STACK_WATCH_CONFIG
+#ifdef NDEBUG
+#define STACK_WATCH_CONFIG      "Release"
+#else
+#define STACK_WATCH_CONFIG      "Debug"
+#endif
+#endif
+
+/** Receives report text; e.g. prof_itm_sink, or a UART writer. */
+typedef void (*stack_sink_t)(const void *data, uint32_t length);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     stack_paint(uint32_t *base, uint32_t words);
+uint32_t stack_used(const uint32_t *base, uint32_t words);
+
+void     stack_paint_main(void);
+uint32_t stack_main_size(void);
+uint32_t stack_main_used(void);
+uint32_t stack_task_used(const k_task_t *task);
+
+void     stack_report(stack_sink_t sink, const k_task_t *const *tasks,
+                      uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,354 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - timer service
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     timer_service.c
+ * @author   insert authors names here
+ * @brief    SysTick port of the timing wheel (see timer_service.h). \n
+ *           Tickless bookkeeping: the SysTick period currently running spans
+ *           s_programmed ticks and was started s_offset cycles after the
+ *           tick boundary it is counted from. Restarting the counter loses
+ *           the cycles between reading SysTick and re-enabling it; that is
+ *           compensated with TIMER_RESTART_CYCLES. A rescale between a
+ *           wrap and its handler restarts the counter too; the cycles
+ *           counted since the wrap are carried over in s_carry.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+
+#include "common/timer_service.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** SysTick is a 24-bit down counter. */
+#define SYSTICK_MAX_PERIOD      0x01000000u
+
+/** Cycles from SysTickValueGet() to the counter restarting in program(). */
+#ifndef TIMER_RESTART_CYCLES
+#define TIMER_RESTART_CYCLES    24u
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static tw_wheel_t s_wheel;
+static uint32_t   s_cyclesPerTick;
+static uint32_t   s_maxTicks;
+static bool       s_tickless;
+static uint32_t   s_programmed;
+static uint32_t   s_offset;
+static uint32_t   s_carry;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Cycles elapsed since the tick boundary the running period counts from.
+ */
+static uint32_t elapsed_cycles(void)
+{
+    return s_offset + (SysTickPeriodGet() - 1u) - SysTickValueGet();
+}
+
+/**
+ * Restarts SysTick so that it expires @p ticks tick boundaries after the one
+ * that was @p elapsed cycles ago.
+ */
+static void program(uint32_t ticks, uint32_t elapsed)
+{
+    elapsed += TIMER_RESTART_CYCLES;
+    if (elapsed >= ticks * s_cyclesPerTick)
+    {
+        /* already late: expire as soon as possible */
+        elapsed = ticks * s_cyclesPerTick - 1u;
+    }
+    SysTickDisable();
+    SysTickPeriodSet(ticks * s_cyclesPerTick - elapsed);
+    SysTickEnable();
+    s_programmed = ticks;
+    s_offset = elapsed;
+}
+
+/**
+ * Starts the timer service on SysTick.
+ *
+ * @param[in] sysclk_hz - core clock, as returned by SysCtlClockFreqSet()
+ * @param[in] tickless  - false: interrupt every tick;
+ *                        true: interrupt only on timer deadlines
+ */
+void timer_service_init(uint32_t sysclk_hz, bool tickless)
+{
+    tw_init(&s_wheel, 0);
+    s_cyclesPerTick = sysclk_hz / TIMER_TICK_HZ;
+    s_maxTicks = (SYSTICK_MAX_PERIOD / s_cyclesPerTick) - 1u;
+    s_tickless = tickless;
+    s_programmed = tickless ? s_maxTicks : 1u;
+    s_offset = 0;
+    s_carry = 0;
+
+    SysTickPeriodSet(s_programmed * s_cyclesPerTick);
+    SysTickIntEnable();
+    SysTickEnable();
+}
+
+/**
+ * Moves the service to a new SysTick clock without losing time: the part
+ * of the tick in progress is carried over at the new scale. Call with
+ * interrupts masked, right after the clock changed (or right before
+ * SysTick starts counting a deep-sleep clock); the cycles in between are
+ * counted at the wrong scale.
+ *
+ * @param[in] sysclk_hz - the clock SysTick now counts
+ */
+void timer_service_set_clock(uint32_t sysclk_hz)
+{
+    uint32_t perTick = sysclk_hz / TIMER_TICK_HZ;
+    uint32_t oldPerTick = s_cyclesPerTick;
+    uint32_t elapsed;
+    uint32_t lag;
+    uint32_t part;
+
+    if (perTick == s_cyclesPerTick)
+    {
+        return;
+    }
+    if (!s_tickless)
+    {
+        s_cyclesPerTick = perTick;
+        s_maxTicks = (SYSTICK_MAX_PERIOD / s_cyclesPerTick) - 1u;
+        SysTickDisable();
+        SysTickPeriodSet(s_cyclesPerTick);
+        SysTickEnable();
+        return;
+    }
+    s_cyclesPerTick = perTick;
+    s_maxTicks = (SYSTICK_MAX_PERIOD / s_cyclesPerTick) - 1u;
+
+    if ((HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PEND_SYST) != 0u)
+    {
+        /*
+         * The pending handler starts the next period; until then the
+         * counter runs at the new scale, the count so far is carried.
+         */
+        elapsed = s_carry + (SysTickPeriodGet() - 1u) - SysTickValueGet();
+        s_carry = (uint32_t)(((uint64_t)elapsed * perTick) / oldPerTick) +
+                  TIMER_RESTART_CYCLES;
+        SysTickDisable();
+        SysTickPeriodSet(s_maxTicks * s_cyclesPerTick);
+        SysTickEnable();
+        return;
+    }
+
+    elapsed = elapsed_cycles();
+    lag = elapsed / oldPerTick;
+    part = (uint32_t)(((uint64_t)(elapsed - lag * oldPerTick) * perTick) /
+                      oldPerTick);
+
+    tw_advance(&s_wheel, lag);
+    program(tw_ticks_to_next(&s_wheel, s_maxTicks), part);
+    HWREG(NVIC_INT_CTRL) = NVIC_INT_CTRL_UNPEND_SYST;
+}
+
+/**
+ * Arms a timer. Safe to call from any context, including callbacks.
+ *
+ * @param[in,out] timer  - the timer, initialized with tw_timer_init()
+ * @param[in]     delay  - ticks to the first expiry (see TIMER_MS())
+ * @param[in]     period - ticks between further expiries, 0 for one-shot
+ */
+void timer_start(tw_timer_t *timer, uint32_t delay, uint32_t period)
+{
+    bool masked = IntMasterDisable();
+
+    if (delay == 0u)
+    {
+        delay = 1u;
+    }
+
+    if (!s_tickless)
+    {
+        tw_arm(&s_wheel, timer, delay, period);
+    }
+    else if ((HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PEND_SYST) != 0u)
+    {
+        /* the pending handler advances the wheel and reprograms SysTick */
+        tw_arm(&s_wheel, timer, delay + s_programmed, period);
+    }
+    else
+    {
+        /* the wheel lags behind by the whole ticks of the running period */
+        uint32_t elapsed = elapsed_cycles();
+        uint32_t lag = elapsed / s_cyclesPerTick;
+
+        tw_arm(&s_wheel, timer, delay + lag, period);
+        if (tw_ticks_to_next(&s_wheel, s_maxTicks) < s_programmed)
+        {
+            tw_advance(&s_wheel, lag);
+            program(tw_ticks_to_next(&s_wheel, s_maxTicks),
+                    elapsed - lag * s_cyclesPerTick);
+
+            /* a wrap of the old period is superseded by the new one */
+            HWREG(NVIC_INT_CTRL) = NVIC_INT_CTRL_UNPEND_SYST;
+        }
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/**
+ * Disarms a timer. Safe to call from any context, including callbacks.
+ * In tickless mode SysTick is not reprogrammed; it just wakes up for
+ * nothing at the cancelled deadline.
+ *
+ * @param[in,out] timer - the timer
+ */
+void timer_stop(tw_timer_t *timer)
+{
+    bool masked = IntMasterDisable();
+
+    tw_cancel(&s_wheel, timer);
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/**
+ * @returns uint32_t - ticks since timer_service_init()
+ */
+uint32_t timer_now(void)
+{
+    bool masked = IntMasterDisable();
+    uint32_t now = s_wheel.now;
+
+    if (s_tickless)
+    {
+        now += elapsed_cycles() / s_cyclesPerTick;
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+    return now;
+}
+
+/**
+ * @returns uint64_t - microseconds since timer_service_init(), to the cycle
+ *                     in tickless mode and to the tick in periodic mode
+ */
+uint64_t timer_time_us(void)
+{
+    bool masked = IntMasterDisable();
+    uint64_t cycles = (uint64_t)s_wheel.now * s_cyclesPerTick;
+    uint32_t perTick = s_cyclesPerTick;
+
+    if (s_tickless)
+    {
+        if ((HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PEND_SYST) != 0u)
+        {
+            /* wrapped, handler not run yet: the counter restarted */
+            cycles += (uint64_t)s_programmed * s_cyclesPerTick + s_carry;
+            cycles += (SysTickPeriodGet() - 1u) - SysTickValueGet();
+        }
+        else
+        {
+            cycles += elapsed_cycles();
+        }
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+    return cycles * (1000000u / TIMER_TICK_HZ) / perTick;
+}
+
+/**
+ * @returns uint32_t - ticks until the next timer expires, counted from now;
+ *                     0 when one is due
+ */
+uint32_t timer_ticks_to_next(void)
+{
+    bool masked = IntMasterDisable();
+    uint32_t ticks;
+
+    if (!s_tickless)
+    {
+        ticks = tw_ticks_to_next(&s_wheel, s_maxTicks);
+    }
+    else if ((HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PEND_SYST) != 0u)
+    {
+        ticks = 0u;
+    }
+    else
+    {
+        uint32_t lag = elapsed_cycles() / s_cyclesPerTick;
+
+        ticks = (lag < s_programmed) ? s_programmed - lag : 0u;
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+    return ticks;
+}
+
+/**
+ * Sleeps (WFI) until the next interrupt. Call from the background loop.
+ */
+void timer_idle(void)
+{
+    SysCtlSleep();
+}
+
+/**
+ * SysTick exception: processes the ticks of the period that just ended and,
+ * in tickless mode, programs the next one.
+ */
+void SysTick_Handler(void)
+{
+    if (!s_tickless)
+    {
+        tw_advance(&s_wheel, 1);
+        return;
+    }
+
+    /* counter reloaded at the wrap; its count is this handler's latency */
+    s_offset = s_carry;
+    s_carry = 0;
+    tw_advance(&s_wheel, s_programmed);
+    program(tw_ticks_to_next(&s_wheel, s_maxTicks), elapsed_cycles());
+}
@@ -0,0 +1,74 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - timer service
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     timer_service.h
+ * @author   insert authors names here
+ * @brief    SysTick-driven software timers on top of timer_wheel.h. \n
+ *           Periodic mode interrupts every tick. Tickless mode programs
+ *           SysTick to the next timer deadline (at most ~139 ms at 120 MHz,
+ *           the 24-bit SysTick range), so an idle core only wakes up when
+ *           there is work. Callbacks run in the SysTick handler. \n
+ *           SysTick counts the system clock: whoever changes the clock, or
+ *           enters deep-sleep on a different one, rescales the service with
+ *           timer_service_set_clock() (see common/power.c).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _TIMER_SERVICE_H_
+#define _TIMER_SERVICE_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/timer_wheel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Timer resolution; delays and periods are given in ticks. */
+#ifndef TIMER_TICK_HZ
+#define TIMER_TICK_HZ       1000u
+#endif
+
+/** Converts milliseconds into ticks. */
+#define TIMER_MS(ms)        ((uint32_t)(((uint64_t)(ms) * TIMER_TICK_HZ) / 1000u))
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     timer_service_init(uint32_t sysclk_hz, bool tickless);
+void     timer_service_set_clock(uint32_t sysclk_hz);
+void     timer_start(tw_timer_t *timer, uint32_t delay, uint32_t period);
+void     timer_stop(tw_timer_t *timer);
+uint32_t timer_now(void);
+uint64_t timer_time_us(void);
+uint32_t timer_ticks_to_next(void);
+void     timer_idle(void);
+
+void     SysTick_Handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
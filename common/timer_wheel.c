@@ -0,0 +1,297 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - timer service
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     timer_wheel.c
+ * @author   insert authors names here
+ * @brief    Hierarchical timing wheel (see timer_wheel.h). \n
+ *           A timer armed with delay D expires when the D-th following tick
+ *           is processed; D = 0 is treated as 1.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+
+#include "timer_wheel.h"
+#include "bitops.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define SLOT_MASK           (TW_SLOTS - 1u)
+
+/** level value of a timer sitting in the expired list */
+#define LEVEL_EXPIRED       TW_LEVELS
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static tw_timer_t **list_of(tw_wheel_t *wheel, const tw_timer_t *timer)
+{
+    if (timer->level == LEVEL_EXPIRED)
+    {
+        return &wheel->expired;
+    }
+    return &wheel->slots[timer->level][timer->slot];
+}
+
+static void unlink(tw_wheel_t *wheel, tw_timer_t *timer)
+{
+    tw_timer_t **head = list_of(wheel, timer);
+
+    if (timer->prev != NULL)
+    {
+        timer->prev->next = timer->next;
+    }
+    else
+    {
+        *head = timer->next;
+    }
+    if (timer->next != NULL)
+    {
+        timer->next->prev = timer->prev;
+    }
+    if (*head == NULL && timer->level != LEVEL_EXPIRED)
+    {
+        wheel->occupied[timer->level] &= ~(1ull << timer->slot);
+    }
+}
+
+static void push(tw_timer_t **head, tw_timer_t *timer)
+{
+    timer->prev = NULL;
+    timer->next = *head;
+    if (*head != NULL)
+    {
+        (*head)->prev = timer;
+    }
+    *head = timer;
+}
+
+/**
+ * Places an armed timer in the slot matching its distance from now.
+ */
+static void insert(tw_wheel_t *wheel, tw_timer_t *timer)
+{
+    uint32_t delta = timer->expires - wheel->now;
+    uint32_t due = timer->expires;
+    uint32_t level = 0;
+
+    if (delta > TW_MAX_DELAY)
+    {
+        /* parked at the far end of the top level and re-cascaded from there */
+        due = wheel->now + TW_MAX_DELAY;
+        delta = TW_MAX_DELAY;
+    }
+    while (delta >= (1ul << (TW_SLOT_BITS * (level + 1u))))
+    {
+        level++;
+    }
+    timer->level = (uint8_t)level;
+    timer->slot = (uint8_t)((due >> (TW_SLOT_BITS * level)) & SLOT_MASK);
+    push(&wheel->slots[level][timer->slot], timer);
+    wheel->occupied[level] |= 1ull << timer->slot;
+}
+
+/**
+ * Moves every timer of slots[level][slot] down to the levels below.
+ */
+static void cascade(tw_wheel_t *wheel, uint32_t level, uint32_t slot)
+{
+    tw_timer_t *timer = wheel->slots[level][slot];
+
+    wheel->slots[level][slot] = NULL;
+    wheel->occupied[level] &= ~(1ull << slot);
+    while (timer != NULL)
+    {
+        tw_timer_t *next = timer->next;
+
+        insert(wheel, timer);
+        timer = next;
+    }
+}
+
+/**
+ * Initializes an empty wheel.
+ *
+ * @param[out] wheel - the wheel
+ * @param[in]  now   - initial tick count
+ */
+void tw_init(tw_wheel_t *wheel, uint32_t now)
+{
+    uint32_t level;
+    uint32_t slot;
+
+    for (level = 0; level < TW_LEVELS; level++)
+    {
+        for (slot = 0; slot < TW_SLOTS; slot++)
+        {
+            wheel->slots[level][slot] = NULL;
+        }
+        wheel->occupied[level] = 0;
+    }
+    wheel->expired = NULL;
+    wheel->now = now;
+}
+
+/**
+ * Initializes a timer; it starts disarmed.
+ *
+ * @param[out] timer    - the timer
+ * @param[in]  callback - called on every expiry, from the tick context
+ * @param[in]  arg      - passed to the callback
+ */
+void tw_timer_init(tw_timer_t *timer, tw_callback_t callback, void *arg)
+{
+    timer->next = NULL;
+    timer->prev = NULL;
+    timer->expires = 0;
+    timer->period = 0;
+    timer->callback = callback;
+    timer->arg = arg;
+    timer->level = 0;
+    timer->slot = 0;
+    timer->armed = false;
+}
+
+/**
+ * Arms (or re-arms) a timer. O(1).
+ *
+ * @param[in,out] wheel  - the wheel
+ * @param[in,out] timer  - the timer
+ * @param[in]     delay  - ticks to the first expiry
+ * @param[in]     period - ticks between further expiries, 0 for one-shot
+ */
+void tw_arm(tw_wheel_t *wheel, tw_timer_t *timer, uint32_t delay,
+            uint32_t period)
+{
+    tw_cancel(wheel, timer);
+    timer->expires = wheel->now + ((delay != 0u) ? delay : 1u);
+    timer->period = period;
+    timer->armed = true;
+    insert(wheel, timer);
+}
+
+/**
+ * Disarms a timer. O(1). No effect if it is not armed.
+ *
+ * @param[in,out] wheel - the wheel
+ * @param[in,out] timer - the timer
+ */
+void tw_cancel(tw_wheel_t *wheel, tw_timer_t *timer)
+{
+    if (timer->armed)
+    {
+        unlink(wheel, timer);
+        timer->armed = false;
+    }
+}
+
+/**
+ * Processes @p ticks ticks, calling back every timer that expires.
+ *
+ * @param[in,out] wheel - the wheel
+ * @param[in]     ticks - number of ticks elapsed
+ */
+void tw_advance(tw_wheel_t *wheel, uint32_t ticks)
+{
+    while (ticks-- != 0u)
+    {
+        uint32_t now = ++wheel->now;
+        uint32_t slot = now & SLOT_MASK;
+        uint32_t level;
+        tw_timer_t *timer;
+
+        /* each level is cascaded when all the levels below it wrap */
+        for (level = 1; level < TW_LEVELS; level++)
+        {
+            uint32_t shift = TW_SLOT_BITS * level;
+
+            if ((now & ((1ul << shift) - 1u)) != 0u)
+            {
+                break;
+            }
+            cascade(wheel, level, (now >> shift) & SLOT_MASK);
+        }
+
+        if ((wheel->occupied[0] & (1ull << slot)) == 0u)
+        {
+            continue;
+        }
+        wheel->expired = wheel->slots[0][slot];
+        wheel->slots[0][slot] = NULL;
+        wheel->occupied[0] &= ~(1ull << slot);
+        for (timer = wheel->expired; timer != NULL; timer = timer->next)
+        {
+            timer->level = LEVEL_EXPIRED;
+        }
+
+        /* callbacks may arm or cancel any timer, including queued ones */
+        while (wheel->expired != NULL)
+        {
+            timer = wheel->expired;
+            unlink(wheel, timer);
+            timer->armed = false;
+            if (timer->period != 0u)
+            {
+                timer->expires += timer->period;
+                timer->armed = true;
+                insert(wheel, timer);
+            }
+            timer->callback(timer->arg);
+        }
+    }
+}
+
+/**
+ * Number of ticks until the wheel next has work to do: a timer expiry or a
+ * cascade. Tickless tick sources sleep that long and then call
+ * tw_advance() with the ticks actually elapsed.
+ *
+ * @param[in] wheel    - the wheel
+ * @param[in] limit    - upper bound on the result (tick source range)
+ * @returns uint32_t   - ticks, 1..limit
+ */
+uint32_t tw_ticks_to_next(const tw_wheel_t *wheel, uint32_t limit)
+{
+    uint32_t best = limit;
+    uint32_t level;
+
+    for (level = 0; level < TW_LEVELS; level++)
+    {
+        uint32_t shift = TW_SLOT_BITS * level;
+        uint32_t block = wheel->now >> shift;
+        uint64_t pending = wheel->occupied[level];
+        uint32_t steps;
+        uint32_t ticks;
+
+        if (pending == 0u)
+        {
+            continue;
+        }
+        /* first occupied slot strictly after the current one, 1..TW_SLOTS */
+        steps = ctz64(ror64(pending, (block + 1u) & SLOT_MASK)) + 1u;
+        ticks = ((block + steps) << shift) - wheel->now;
+        if (ticks < best)
+        {
+            best = ticks;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,102 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - timer service
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     timer_wheel.h
+ * @author   insert authors names here
+ * @brief    Hierarchical timing wheel. \n
+ *           TW_LEVELS levels of TW_SLOTS slots each; level L holds the timers
+ *           due between TW_SLOTS^L and TW_SLOTS^(L+1) ticks from now and is
+ *           cascaded into the level below whenever that one wraps. Arm and
+ *           cancel are O(1) (intrusive doubly-linked slot lists); each tick
+ *           costs O(1) plus the timers that expire or cascade on it.\n
+ *           The wheel keeps no clock of its own: the owner calls
+ *           tw_advance() from its tick source and is responsible for mutual
+ *           exclusion with arm/cancel (see timer_service.c).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define TW_SLOT_BITS    6u
+#define TW_SLOTS        (1u << TW_SLOT_BITS)
+#define TW_LEVELS       4u
+
+/** Longest delay that does not need re-cascading: 2^24 ticks (4.6 h @ 1 ms). */
+#define TW_MAX_DELAY    ((1ul << (TW_SLOT_BITS * TW_LEVELS)) - 1u)
+
+typedef void (*tw_callback_t)(void *arg);
+
+/** A timer. Owned by the caller; must stay valid while armed. */
+typedef struct tw_timer
+{
+    struct tw_timer *next;
+    struct tw_timer *prev;
+    uint32_t         expires;   /**< absolute tick of the next expiry      */
+    uint32_t         period;    /**< reload in ticks, 0 for one-shot       */
+    tw_callback_t    callback;
+    void            *arg;
+    uint8_t          level;
+    uint8_t          slot;
+    bool             armed;
+} tw_timer_t;
+
+/** The wheel. */
+typedef struct
+{
+    tw_timer_t *slots[TW_LEVELS][TW_SLOTS];
+    uint64_t    occupied[TW_LEVELS];    /**< bit n set: slots[L][n] non-empty */
+    tw_timer_t *expired;                /**< timers being called back         */
+    uint32_t    now;                    /**< ticks processed so far           */
+} tw_wheel_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     tw_init(tw_wheel_t *wheel, uint32_t now);
+void     tw_timer_init(tw_timer_t *timer, tw_callback_t callback, void *arg);
+void     tw_arm(tw_wheel_t *wheel, tw_timer_t *timer, uint32_t delay,
+                uint32_t period);
+void     tw_cancel(tw_wheel_t *wheel, tw_timer_t *timer);
+void     tw_advance(tw_wheel_t *wheel, uint32_t ticks);
+uint32_t tw_ticks_to_next(const tw_wheel_t *wheel, uint32_t limit);
+
+/**
+ * @returns bool - true while the timer is armed
+ */
+static inline bool tw_is_armed(const tw_timer_t *timer)
+{
+    return timer->armed;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,248 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - tokenized log
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     tlog.c
+ * @author   insert authors names here
+ * @brief    Ring, drain and sinks of the tokenized log (tlog.h). \n
+ *           The ring is ordinary zeroed RAM: a zero word is a free slot.
+ *           tlog_drain() is the only consumer; it copies a record out,
+ *           zeroes its words and only then moves the tail, so a producer
+ *           never reuses a slot that still holds an old header.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/tlog.h"
+#include "common/cycles.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define ITM_STIM(port)      (*(volatile uint32_t *)(0xE0000000u + 4u * (port)))
+#define ITM_TER             (*(volatile uint32_t *)0xE0000E00u)
+#define ITM_TCR             (*(volatile uint32_t *)0xE0000E80u)
+#define ITM_TCR_ITMENA      0x00000001u
+
+#define CALIBRATION_RUNS    8u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+tlog_ring_t g_tlog;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t s_droppedSent;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Empties the ring. Not safe against concurrent logging.
+ */
+void tlog_reset(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < TLOG_RING_WORDS; i++)
+    {
+        g_tlog.words[i] = 0u;
+    }
+    g_tlog.head = 0u;
+    g_tlog.tail = 0u;
+    g_tlog.dropped = 0u;
+    s_droppedSent = 0u;
+}
+
+/**
+ * Counts a record that did not fit. Safe from any context.
+ */
+void tlog_drop(void)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t dropped;
+
+    do
+    {
+        dropped = __LDREX((unsigned long *)&g_tlog.dropped);
+    } while (__STREX(dropped + 1u, (unsigned long *)&g_tlog.dropped) != 0u);
+#else
+    (void)__atomic_fetch_add(&g_tlog.dropped, 1u, __ATOMIC_RELAXED);
+#endif
+}
+
+static uint32_t load_header(uint32_t at)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    uint32_t header = g_tlog.words[at & (TLOG_RING_WORDS - 1u)];
+
+    __DMB();
+    return header;
+#else
+    return __atomic_load_n(&g_tlog.words[at & (TLOG_RING_WORDS - 1u)],
+                           __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void store_tail(uint32_t tail)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    __DMB();
+    g_tlog.tail = tail;
+#else
+    __atomic_store_n(&g_tlog.tail, tail, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * Sends the records completed so far, oldest first, each batch preceded
+ * by TLOG_MAGIC so the decoder can join the stream anywhere. A record
+ * still being written stops the drain until the next call, as do records
+ * logged while draining, so the call is bounded. Single consumer: call
+ * from one task or the background loop, never from a handler.
+ *
+ * @param[in] sink   - byte output
+ * @returns uint32_t - records sent, the dropped notice included
+ */
+uint32_t tlog_drain(tlog_sink_t sink)
+{
+    uint32_t head = g_tlog.head;
+    uint32_t tail = g_tlog.tail;
+    uint32_t dropped = g_tlog.dropped;
+    uint32_t record[1u + TLOG_MAX_ARGS];
+    uint32_t count = 0u;
+    uint32_t magic = TLOG_MAGIC;
+
+    if (dropped != s_droppedSent)
+    {
+        record[0] = TLOG_DROPPED;
+        record[1] = dropped - s_droppedSent;
+        s_droppedSent = dropped;
+        sink(&magic, sizeof(magic));
+        sink(record, 2u * sizeof(uint32_t));
+        count++;
+    }
+
+    while (tail != head)
+    {
+        uint32_t header = load_header(tail);
+        uint32_t words;
+        uint32_t i;
+
+        if ((header & TLOG_VALID) == 0u)
+        {
+            break;
+        }
+        words = 1u + (header & TLOG_NARGS_MASK);
+        record[0] = header;
+        for (i = 1u; i < words; i++)
+        {
+            record[i] = g_tlog.words[(tail + i) & (TLOG_RING_WORDS - 1u)];
+        }
+        for (i = 0u; i < words; i++)
+        {
+            g_tlog.words[(tail + i) & (TLOG_RING_WORDS - 1u)] = 0u;
+        }
+        tail += words;
+        store_tail(tail);
+
+        if (count == 0u)
+        {
+            sink(&magic, sizeof(magic));
+        }
+        sink(record, words * sizeof(uint32_t));
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Sink for tlog_drain(): ITM stimulus port TLOG_ITM_PORT, one word per
+ * write, read over SWO by the debugger. Drops the data if the debugger
+ * has not enabled the port.
+ */
+void tlog_itm_sink(const void *data, uint32_t length)
+{
+#if defined(__IAR_SYSTEMS_ICC__)
+    const uint32_t *words = (const uint32_t *)data;
+
+    if ((ITM_TCR & ITM_TCR_ITMENA) == 0u ||
+        (ITM_TER & (1u << TLOG_ITM_PORT)) == 0u)
+    {
+        return;
+    }
+    for (; length >= sizeof(uint32_t); length -= sizeof(uint32_t))
+    {
+        while ((ITM_STIM(TLOG_ITM_PORT) & 1u) == 0u)
+        {
+        }
+        ITM_STIM(TLOG_ITM_PORT) = *words++;
+    }
+#else
+    (void)data;
+    (void)length;
+#endif
+}
+
+/**
+ * Measures a TLOG2() call with the DWT cycle counter, the cost of reading
+ * the counter taken out; the best of a few runs. The records stay in the
+ * ring. On the host build C code costs no simulated cycles: returns 0.
+ *
+ * @returns uint32_t - cycles per call
+ */
+uint32_t tlog_cycles(void)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t empty = UINT32_MAX;
+    uint32_t run;
+
+    cycles_init();
+    for (run = 0; run < CALIBRATION_RUNS; run++)
+    {
+        uint32_t start = cycles_now();
+        uint32_t cost = cycles_now() - start;
+
+        if (cost < empty)
+        {
+            empty = cost;
+        }
+    }
+    for (run = 0; run < CALIBRATION_RUNS; run++)
+    {
+        uint32_t start = cycles_now();
+        uint32_t cost;
+
+        TLOG2("tlog_cycles run %u of %u", run, CALIBRATION_RUNS);
+        cost = cycles_now() - start;
+        if (cost < best)
+        {
+            best = cost;
+        }
+    }
+    return best - empty;
+}
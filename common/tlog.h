@@ -0,0 +1,263 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - tokenized log
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     tlog.h
+ * @author   insert authors names here
+ * @brief    Deferred binary log for handlers and control loops. \n
+ *           TLOG0(fmt) .. TLOG4(fmt, a, b, c, d) never format anything: the
+ *           printf-style fmt string is placed in section .tlog_str, which
+ *           Tiva.icf puts outside the memory map (not in flash), and the
+ *           call appends a 32-bit header (string offset, argument count)
+ *           and the raw 32-bit arguments to a RAM ring. Slots are claimed
+ *           with LDREX/STREX, so tasks and handlers log without masking
+ *           interrupts; a record that does not fit is counted as dropped.\n
+ *           tlog_drain() runs in idle time (a task or the background loop)
+ *           and sends the complete records to a byte sink: tlog_itm_sink
+ *           (ITM port TLOG_ITM_PORT, SWO) or tlog_uart_sink. The capture is
+ *           turned back into text on Linux by host/tools/tlog_decode, which
+ *           reads the strings from the ELF of the same build (Lab2.out).\n
+ *           Arguments: integers and characters as they are, pointers
+ *           through (uintptr_t), printed with %x or %p; floats through
+ *           TLOG_FLOAT(x), printed with %f/%e/%g. %s is not
+ *           supported (the string would be gone by the time it is drained).
+ *           Cost: about 20 cycles plus 3 per argument, counted from the
+ *           instructions; tlog_cycles() measures it on the board. Nothing is
+ *           compiled, and the arguments are not evaluated, when TLOG_ENABLE
+ *           is 0 (project define).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _TLOG_H_
+#define _TLOG_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common/uart_stdio.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <intrinsics.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#ifndef TLOG_ENABLE
+#define TLOG_ENABLE             1
+#endif
+
+/** Ring size in 32-bit words, a power of two. */
+#ifndef TLOG_RING_WORDS
+#define TLOG_RING_WORDS         256u
+#endif
+
+/** ITM stimulus port used by tlog_itm_sink (0 is profile.h's). */
+#ifndef TLOG_ITM_PORT
+#define TLOG_ITM_PORT           1u
+#endif
+
+/** Start of the TLOG region in Tiva.icf: offset 0 of .tlog_str. */
+#define TLOG_STR_BASE           0xF0000000u
+
+#define TLOG_MAGIC              0x31474C54u     /* "TLG1" */
+#define TLOG_MAX_ARGS           4u
+
+/**
+ * Record header: bit 31 set (a header is never 0, the value of a free
+ * slot, nor TLOG_MAGIC), the offset of the string in .tlog_str (strings
+ * are 8-byte aligned) and the argument count in the low 3 bits.
+ */
+#define TLOG_VALID              0x80000000u
+#define TLOG_OFFSET_MASK        0x7FFFFFF8u
+#define TLOG_NARGS_MASK         0x00000007u
+#define TLOG_HEADER(offset, n)  (TLOG_VALID | (uint32_t)(offset) | (uint32_t)(n))
+
+/** Sent by tlog_drain() before the next record when records were dropped;
+    its argument is how many. */
+#define TLOG_DROPPED            TLOG_HEADER(TLOG_OFFSET_MASK, 1u)
+
+typedef struct
+{
+    volatile uint32_t head;     /**< words claimed, ever */
+    volatile uint32_t tail;     /**< words drained, ever */
+    volatile uint32_t dropped;  /**< records that did not fit, ever */
+    volatile uint32_t words[TLOG_RING_WORDS];
+} tlog_ring_t;
+
+typedef void (*tlog_sink_t)(const void *data, uint32_t length);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern tlog_ring_t g_tlog;
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+/* start of section tlog_str, provided by the GNU linker */
+extern const char __start_tlog_str[];
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     tlog_reset(void);
+void     tlog_drop(void);
+uint32_t tlog_drain(tlog_sink_t sink);
+void     tlog_itm_sink(const void *data, uint32_t length);
+uint32_t tlog_cycles(void);
+
+/** Sends to the console; set crlf to false, the stream is binary. */
+static inline void tlog_uart_sink(const void *data, uint32_t length)
+{
+    (void)uart_stdio_write(data, length);
+}
+
+/** Bits of a float argument, for %f, %e and %g. */
+static inline uint32_t tlog_float(float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/**
+ * Claims @p count words at *at. Safe from any context.
+ *
+ * @returns bool - false if the ring is full
+ */
+static inline bool tlog_claim(uint32_t count, uint32_t *at)
+{
+    uint32_t head;
+
+#if defined(__IAR_SYSTEMS_ICC__)
+    /* exception entry clears the exclusive monitor: a preempted claim retries */
+    do
+    {
+        head = __LDREX((unsigned long *)&g_tlog.head);
+        if (head - g_tlog.tail > TLOG_RING_WORDS - count)
+        {
+            __CLREX();
+            return false;
+        }
+    } while (__STREX(head + count, (unsigned long *)&g_tlog.head) != 0u);
+#else
+    head = __atomic_load_n(&g_tlog.head, __ATOMIC_RELAXED);
+    do
+    {
+        if (head - __atomic_load_n(&g_tlog.tail, __ATOMIC_ACQUIRE) >
+            TLOG_RING_WORDS - count)
+        {
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&g_tlog.head, &head, head + count,
+                                          true, __ATOMIC_RELAXED,
+                                          __ATOMIC_RELAXED));
+#endif
+    *at = head;
+    return true;
+}
+
+/** Appends one record; the header goes last, it makes the record visible. */
+static inline void tlog_put(uint32_t header, uint32_t n, uint32_t a0,
+                            uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    volatile uint32_t *words = g_tlog.words;
+    uint32_t at;
+
+    if (!tlog_claim(n + 1u, &at))
+    {
+        tlog_drop();
+        return;
+    }
+    if (n > 0u)
+    {
+        words[(at + 1u) & (TLOG_RING_WORDS - 1u)] = a0;
+    }
+    if (n > 1u)
+    {
+        words[(at + 2u) & (TLOG_RING_WORDS - 1u)] = a1;
+    }
+    if (n > 2u)
+    {
+        words[(at + 3u) & (TLOG_RING_WORDS - 1u)] = a2;
+    }
+    if (n > 3u)
+    {
+        words[(at + 4u) & (TLOG_RING_WORDS - 1u)] = a3;
+    }
+#if defined(__IAR_SYSTEMS_ICC__)
+    __DMB();
+    words[at & (TLOG_RING_WORDS - 1u)] = header;
+#else
+    __atomic_store_n(&words[at & (TLOG_RING_WORDS - 1u)], header,
+                     __ATOMIC_RELEASE);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Macros
+ *
+ *------------------------------------------------------------------------------*/
+/* The string of one call site, in .tlog_str, and its offset there. */
+#if defined(__IAR_SYSTEMS_ICC__)
+#define TLOG_STRING(name, fmt)                                              \
+    _Pragma("location=\".tlog_str\"") _Pragma("data_alignment=8")           \
+    static const char name[] = fmt
+#define TLOG_OFFSET(name)       ((uint32_t)(name) - TLOG_STR_BASE)
+#else
+#define TLOG_STRING(name, fmt)                                              \
+    static const char name[]                                                \
+        __attribute__((section("tlog_str"), aligned(8), used)) = fmt
+#define TLOG_OFFSET(name)       ((uint32_t)((name) - __start_tlog_str))
+#endif
+
+#define TLOG_FLOAT(x)           tlog_float(x)
+
+#if TLOG_ENABLE
+#define TLOG_RECORD(fmt, n, a0, a1, a2, a3)                                 \
+    do                                                                      \
+    {                                                                       \
+        TLOG_STRING(s_tlogFmt, fmt);                                        \
+        tlog_put(TLOG_HEADER(TLOG_OFFSET(s_tlogFmt), (n)), (n),             \
+                 (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2),            \
+                 (uint32_t)(a3));                                           \
+    } while (0)
+#else
+#define TLOG_RECORD(fmt, n, a0, a1, a2, a3)     ((void)0)
+#endif
+
+#define TLOG0(fmt)                  TLOG_RECORD(fmt, 0u, 0u, 0u, 0u, 0u)
+#define TLOG1(fmt, a)               TLOG_RECORD(fmt, 1u, (a), 0u, 0u, 0u)
+#define TLOG2(fmt, a, b)            TLOG_RECORD(fmt, 2u, (a), (b), 0u, 0u)
+#define TLOG3(fmt, a, b, c)         TLOG_RECORD(fmt, 3u, (a), (b), (c), 0u)
+#define TLOG4(fmt, a, b, c, d)      TLOG_RECORD(fmt, 4u, (a), (b), (c), (d))
+
+#endif
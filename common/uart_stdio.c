@@ -0,0 +1,445 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - UART console
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     uart_stdio.c
+ * @author   insert authors names here
+ * @brief    UART0 console with uDMA output and interrupt-fed input (see
+ *           uart_stdio.h). \n
+ *           TX: writers append to s_buf[s_fill]; a buffer marked ready is
+ *           started on the uDMA by whoever sees the channel idle, the writer
+ *           (kick(), interrupts masked) or the DMATX interrupt. The interrupt
+ *           leaves the buffers alone while a write is copying (s_writing);
+ *           the writer kicks when it is done.\n
+ *           RX: the handler is the only producer and uart_stdio_read() the
+ *           only consumer of the ring, so the free-running indices need no
+ *           lock.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+
+#include "common/boot.h"
+#include "common/dma.h"
+#include "common/uart_stdio.h"
+#include "common/vtable.h"
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#include <LowLevelIOInterface.h>
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define TX_CHANNEL          UDMA_CH9_UART0TX
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+uart_stdio_stats_t g_uart_stdio;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uart_stdio_config_t s_config;
+
+static BOOT_NOINIT uint8_t s_buf[2][UART_STDIO_TX_SIZE];
+static uint32_t          s_len[2];
+static volatile uint32_t s_fill;        /**< buffer being written        */
+static volatile bool     s_ready;       /**< s_buf[s_fill] may be sent   */
+static volatile bool     s_dmaActive;   /**< the other buffer is on DMA  */
+static volatile bool     s_writing;     /**< a write is copying          */
+
+static BOOT_NOINIT uint8_t s_rx[UART_STDIO_RX_SIZE];
+static volatile uint32_t s_rxHead;      /**< written by the handler      */
+static volatile uint32_t s_rxTail;      /**< written by the reader       */
+static bool              s_lastCr;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Hands the fill buffer to the uDMA if it is ready and the channel is idle.
+ * Runs with interrupts masked or in the handler.
+ */
+static void start_pending(void)
+{
+    uint32_t b = s_fill;
+
+    if (s_dmaActive || !s_ready || s_len[b] == 0u)
+    {
+        return;
+    }
+    s_dmaActive = true;
+    uDMAChannelTransferSet(TX_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           s_buf[b], (void *)(uintptr_t)(UART0_BASE + UART_O_DR),
+                           s_len[b]);
+    uDMAChannelEnable(TX_CHANNEL);
+    g_uart_stdio.tx_bytes += s_len[b];
+    g_uart_stdio.dma_starts++;
+    s_len[b ^ 1u] = 0u;
+    s_fill = b ^ 1u;
+    s_ready = false;
+}
+
+static void kick(void)
+{
+    bool masked = IntMasterDisable();
+
+    start_pending();
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/** Moves the RX FIFO into the ring. */
+static void rx_drain(void)
+{
+    int32_t c;
+
+    while ((c = UARTCharGetNonBlocking(UART0_BASE)) >= 0)
+    {
+        g_uart_stdio.rx_bytes++;
+        if (s_rxHead - s_rxTail == UART_STDIO_RX_SIZE)
+        {
+            g_uart_stdio.rx_dropped++;
+            continue;
+        }
+        s_rx[s_rxHead & (UART_STDIO_RX_SIZE - 1u)] = (uint8_t)c;
+        s_rxHead++;
+    }
+}
+
+/**
+ * Waits until the uDMA channel is idle. Sleeps when interrupts are
+ * enabled; with interrupts masked (a write from a critical section) it polls
+ * the channel instead.
+ */
+static void wait_tx(void)
+{
+    bool masked = IntMasterDisable();
+
+    g_uart_stdio.tx_waits++;
+    while (s_dmaActive)
+    {
+        if (masked)
+        {
+            s_dmaActive = uDMAChannelIsEnabled(TX_CHANNEL);
+            continue;
+        }
+        /* WFI wakes up on the pending interrupt even with PRIMASK set */
+        SysCtlSleep();
+        IntMasterEnable();
+        IntMasterDisable();
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/** Waits until the ring holds at least one byte; see wait_tx(). */
+static void wait_rx(void)
+{
+    bool masked = IntMasterDisable();
+
+    while (s_rxHead == s_rxTail)
+    {
+        if (masked)
+        {
+            rx_drain();
+            continue;
+        }
+        SysCtlSleep();
+        IntMasterEnable();
+        IntMasterDisable();
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+/** Appends one byte to the fill buffer, waiting for the other one if full. */
+static void put(uint8_t c)
+{
+    while (s_len[s_fill] == UART_STDIO_TX_SIZE)
+    {
+        s_ready = true;
+        kick();
+        if (s_len[s_fill] == UART_STDIO_TX_SIZE)
+        {
+            wait_tx();
+        }
+    }
+    s_buf[s_fill][s_len[s_fill]++] = c;
+}
+
+/**
+ * Sets up UART0 at @p clock_hz (PA0/PA1), the uDMA TX channel and the
+ * interrupt handler, and enables the UART0 interrupt.
+ *
+ * @param[in] clock_hz - system clock, e.g. from SysCtlClockFreqSet()
+ * @param[in] config   - NULL for UART_STDIO_CONFIG_DEFAULT
+ */
+void uart_stdio_init(uint32_t clock_hz, const uart_stdio_config_t *config)
+{
+    static const uart_stdio_config_t defaults = UART_STDIO_CONFIG_DEFAULT;
+
+    s_config = (config != NULL) ? *config : defaults;
+    memset(&g_uart_stdio, 0, sizeof(g_uart_stdio));
+    s_fill = 0u;
+    s_len[0] = 0u;
+    s_len[1] = 0u;
+    s_ready = false;
+    s_dmaActive = false;
+    s_writing = false;
+    s_rxHead = 0u;
+    s_rxTail = 0u;
+    s_lastCr = false;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UART0) ||
+           !SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOA))
+    {
+    }
+    GPIOPinConfigure(GPIO_PA0_U0RX);
+    GPIOPinConfigure(GPIO_PA1_U0TX);
+    GPIOPinTypeUART(GPIO_PORTA_AHB_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+
+    UARTConfigSetExpClk(UART0_BASE, clock_hz, s_config.baud,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
+                        UART_CONFIG_PAR_NONE);
+    UARTFIFOLevelSet(UART0_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+    UARTEnable(UART0_BASE);
+    UARTDMAEnable(UART0_BASE, UART_DMA_TX);
+
+    dma_init();
+    uDMAChannelAssign(UDMA_CH9_UART0TX);
+    uDMAChannelAttributeDisable(TX_CHANNEL, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(TX_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE |
+                          UDMA_ARB_4);
+
+    (void)register_isr(INT_UART0, uart_stdio_isr);
+    UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT | UART_INT_DMATX);
+    IntEnable(INT_UART0);
+}
+
+/**
+ * Queues bytes for transmission. Returns once they are copied, which only
+ * waits when both buffers are full.
+ *
+ * @param[in] data   - bytes to send
+ * @param[in] size   - number of bytes
+ * @returns size_t   - @p size
+ */
+size_t uart_stdio_write(const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t i;
+
+    s_writing = true;
+    for (i = 0; i < size; i++)
+    {
+        if (bytes[i] == '\n')
+        {
+            if (s_config.crlf)
+            {
+                put('\r');
+            }
+            put('\n');
+            if (s_config.policy == UART_STDIO_LINE)
+            {
+                s_ready = true;
+                kick();
+            }
+            continue;
+        }
+        put(bytes[i]);
+    }
+    s_writing = false;
+
+    if (s_config.policy == UART_STDIO_UNBUFFERED)
+    {
+        s_ready = true;
+    }
+    /* a DMATX interrupt during the copy did not start the next buffer */
+    kick();
+    return size;
+}
+
+/**
+ * Reads input up to and including a newline. Waits (asleep) for the first
+ * byte only.
+ *
+ * @param[out] data - receives the bytes
+ * @param[in]  size - room in @p data
+ * @returns size_t  - bytes read, at least 1 when @p size is not 0
+ */
+size_t uart_stdio_read(void *data, size_t size)
+{
+    uint8_t *bytes = (uint8_t *)data;
+    size_t n = 0u;
+
+    while (n < size)
+    {
+        uint8_t c;
+
+        if (s_rxHead == s_rxTail)
+        {
+            if (n != 0u)
+            {
+                break;
+            }
+            wait_rx();
+        }
+        c = s_rx[s_rxTail & (UART_STDIO_RX_SIZE - 1u)];
+        s_rxTail++;
+
+        if (s_config.crlf)
+        {
+            bool skip = (c == '\n' && s_lastCr);
+
+            s_lastCr = (c == '\r');
+            if (skip)
+            {
+                continue;
+            }
+            if (c == '\r')
+            {
+                c = '\n';
+            }
+        }
+        bytes[n++] = c;
+        if (s_config.echo)
+        {
+            (void)uart_stdio_write(&c, 1u);
+            s_ready = true;
+            kick();
+        }
+        if (c == '\n')
+        {
+            break;
+        }
+    }
+    return n;
+}
+
+/**
+ * Sends everything written so far and waits until the last byte has left
+ * the UART.
+ */
+void uart_stdio_flush(void)
+{
+    s_ready = true;
+    kick();
+    while (s_dmaActive)
+    {
+        wait_tx();
+        kick();
+    }
+    while (UARTBusy(UART0_BASE))
+    {
+    }
+}
+
+/**
+ * UART0 interrupt: uDMA transfer done, RX FIFO at its level or timed out.
+ */
+void uart_stdio_isr(void)
+{
+    uint32_t status = UARTIntStatus(UART0_BASE, true);
+
+    UARTIntClear(UART0_BASE, status);
+    /* a stale DMATX (the writer polled the channel) finds it busy again */
+    if ((status & UART_INT_DMATX) != 0u && !uDMAChannelIsEnabled(TX_CHANNEL))
+    {
+        s_dmaActive = false;
+        if (!s_writing)
+        {
+            start_pending();
+        }
+    }
+    if ((status & (UART_INT_RX | UART_INT_RT)) != 0u)
+    {
+        rx_drain();
+    }
+}
+
+#if defined(__IAR_SYSTEMS_ICC__)
+/**
+ * DLIB low-level output. stdout follows the configured policy, stderr is
+ * sent at once; a NULL buffer asks for buffered output to be sent.
+ */
+size_t __write(int handle, const unsigned char *buffer, size_t size)
+{
+    if (buffer == NULL)
+    {
+        s_ready = true;
+        kick();
+        return 0u;
+    }
+    if (handle != _LLIO_STDOUT && handle != _LLIO_STDERR)
+    {
+        return _LLIO_ERROR;
+    }
+    (void)uart_stdio_write(buffer, size);
+    if (handle == _LLIO_STDERR)
+    {
+        s_ready = true;
+        kick();
+    }
+    return size;
+}
+
+/**
+ * DLIB low-level input: stdin only, one line at a time.
+ */
+size_t __read(int handle, unsigned char *buffer, size_t size)
+{
+    if (handle != _LLIO_STDIN)
+    {
+        return _LLIO_ERROR;
+    }
+    return uart_stdio_read(buffer, size);
+}
+#endif
@@ -0,0 +1,112 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - UART console
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     uart_stdio.h
+ * @author   insert authors names here
+ * @brief    Interrupt and uDMA driven console on UART0 (PA0/PA1, the ICDI
+ *           virtual COM port), the back end of std::cout/std::cin. \n
+ *           Output is collected in one of two buffers while the uDMA sends
+ *           the other one, so a write only copies bytes and returns; the
+ *           core waits (asleep) only when both buffers are full. When a
+ *           buffer is handed to the uDMA depends on the policy: every write
+ *           (UNBUFFERED), every newline (LINE) or only when it is full or
+ *           flushed (FULL). Input is drained by the RX/RX-timeout interrupt
+ *           into a ring, from which reads return whole lines.\n
+ *           On IAR builds this module defines __write() and __read(), so
+ *           the library's stdout, stderr and stdin go through it; select
+ *           "Library low-level interface implementation: None" in the
+ *           project options.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _UART_STDIO_H_
+#define _UART_STDIO_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Size of each of the two TX buffers, at most 1024 (one uDMA transfer). */
+#ifndef UART_STDIO_TX_SIZE
+#define UART_STDIO_TX_SIZE      256u
+#endif
+
+/** Size of the RX ring, a power of two. */
+#ifndef UART_STDIO_RX_SIZE
+#define UART_STDIO_RX_SIZE      128u
+#endif
+
+/** When buffered output is handed to the uDMA. */
+typedef enum
+{
+    UART_STDIO_UNBUFFERED,  /**< at the end of every write              */
+    UART_STDIO_LINE,        /**< at every newline                       */
+    UART_STDIO_FULL         /**< when a buffer is full, or on flush     */
+} uart_stdio_policy_t;
+
+typedef struct
+{
+    uint32_t            baud;
+    uart_stdio_policy_t policy;
+    bool                crlf;   /**< send "\n" as "\r\n", read "\r" as "\n" */
+    bool                echo;   /**< echo input as it is read               */
+} uart_stdio_config_t;
+
+/** Default configuration: 115200 8N1, line buffered, CRLF, echo. */
+#define UART_STDIO_CONFIG_DEFAULT   { 115200u, UART_STDIO_LINE, true, true }
+
+/** Counters, for the debugger and the benchmarks. */
+typedef struct
+{
+    uint32_t tx_bytes;      /**< bytes handed to the uDMA               */
+    uint32_t dma_starts;    /**< uDMA transfers started                 */
+    uint32_t tx_waits;      /**< times a writer had to wait for a buffer */
+    uint32_t rx_bytes;      /**< bytes received                         */
+    uint32_t rx_dropped;    /**< bytes lost because the ring was full   */
+} uart_stdio_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern uart_stdio_stats_t g_uart_stdio;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void   uart_stdio_init(uint32_t clock_hz, const uart_stdio_config_t *config);
+size_t uart_stdio_write(const void *data, size_t size);
+size_t uart_stdio_read(void *data, size_t size);
+void   uart_stdio_flush(void);
+
+void   uart_stdio_isr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,257 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     udp_fast.c
+ * @author   insert authors names here
+ * @brief    Fixed-flow UDP send and receive (see udp_fast.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common/udp_fast.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/* offsets in the frame */
+#define OFF_TYPE            12u
+#define OFF_IP              14u
+#define OFF_IP_LEN          (OFF_IP + 2u)
+#define OFF_IP_ID           (OFF_IP + 4u)
+#define OFF_IP_FRAG         (OFF_IP + 6u)
+#define OFF_IP_PROTO        (OFF_IP + 9u)
+#define OFF_IP_SUM          (OFF_IP + 10u)
+#define OFF_IP_SRC          (OFF_IP + 12u)
+#define OFF_IP_DST          (OFF_IP + 16u)
+#define OFF_UDP             34u
+#define OFF_UDP_DST         (OFF_UDP + 2u)
+#define OFF_UDP_LEN         (OFF_UDP + 4u)
+#define OFF_UDP_SUM         (OFF_UDP + 6u)
+
+#define IP_HEADER           20u
+#define UDP_HEADER          8u
+#define IP_VER_IHL          0x45u
+#define IP_FLAG_DF          0x40u
+#define IP_TTL              64u
+#define IP_PROTO_UDP        17u
+#define ETHERTYPE_IPV4      0x0800u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static inline void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static inline void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v >> 16);
+    put16(&p[2], v);
+}
+
+static inline uint32_t get16(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 8) | p[1];
+}
+
+static inline uint32_t get32(const uint8_t *p)
+{
+    return (get16(p) << 16) | get16(&p[2]);
+}
+
+/** Adds big-endian 16-bit words to a one's complement sum. */
+static uint32_t csum_add(uint32_t sum, const uint8_t *p, uint32_t n)
+{
+    while (n > 1u)
+    {
+        sum += get16(p);
+        p += 2;
+        n -= 2u;
+    }
+    if (n != 0u)
+    {
+        sum += (uint32_t)p[0] << 8;
+    }
+    return sum;
+}
+
+static uint32_t csum_fold(uint32_t sum)
+{
+    while ((sum >> 16) != 0u)
+    {
+        sum = (sum & 0xFFFFu) + (sum >> 16);
+    }
+    return sum;
+}
+
+/**
+ * Builds the header template of a flow.
+ *
+ * @param[out] tx    - sender state
+ * @param[in]  netif - transport; its MAC address is the source
+ * @param[in]  flow  - addresses and ports
+ */
+void udp_fast_tx_init(udp_fast_tx_t *tx, net_if_t *netif,
+                      const udp_fast_flow_t *flow)
+{
+    uint8_t *h = tx->header;
+
+    memset(tx, 0, sizeof(*tx));
+    tx->netif = netif;
+
+    memcpy(h, flow->dst_mac, NET_MAC_LEN);
+    memcpy(&h[NET_MAC_LEN], netif->mac, NET_MAC_LEN);
+    put16(&h[OFF_TYPE], ETHERTYPE_IPV4);
+    h[OFF_IP] = IP_VER_IHL;
+    h[OFF_IP_FRAG] = IP_FLAG_DF;
+    h[OFF_IP_PROTO - 1u] = IP_TTL;
+    h[OFF_IP_PROTO] = IP_PROTO_UDP;
+    put32(&h[OFF_IP_SRC], flow->src_ip);
+    put32(&h[OFF_IP_DST], flow->dst_ip);
+    put16(&h[OFF_UDP], flow->src_port);
+    put16(&h[OFF_UDP_DST], flow->dst_port);
+
+    /* length, id and checksum are still 0 */
+    tx->sum = csum_add(0u, &h[OFF_IP], IP_HEADER);
+}
+
+/**
+ * Sends a datagram whose payload is already at udp_fast_payload(buf).
+ *
+ * @param[in] tx  - sender
+ * @param[in] buf - frame buffer; taken on success
+ * @param[in] len - payload bytes, at most UDP_FAST_PAYLOAD_MAX
+ * @returns bool  - false if @p len is too long or the transport is full;
+ *                  the caller still owns @p buf then
+ */
+bool udp_fast_send(udp_fast_tx_t *tx, net_buf_t *buf, uint32_t len)
+{
+    uint8_t *h = buf->data;
+    uint32_t total = IP_HEADER + UDP_HEADER + len;
+    uint32_t id = tx->id;
+
+    if (len > UDP_FAST_PAYLOAD_MAX)
+    {
+        return false;
+    }
+    memcpy(h, tx->header, UDP_FAST_HEADER);
+    put16(&h[OFF_IP_LEN], total);
+    put16(&h[OFF_IP_ID], id);
+    put16(&h[OFF_IP_SUM], ~csum_fold(tx->sum + total + id) & 0xFFFFu);
+    put16(&h[OFF_UDP_LEN], UDP_HEADER + len);
+    buf->len = (uint16_t)(UDP_FAST_HEADER + len);
+
+    if (!net_if_send(tx->netif, buf))
+    {
+        return false;
+    }
+    tx->id = (uint16_t)(id + 1u);
+    tx->sent++;
+    return true;
+}
+
+/**
+ * @returns uint32_t - UDP length of a datagram for @p rx with valid
+ *                     headers and checksums, 0 for anything else
+ */
+static uint32_t udp_fast_check(const net_if_t *netif, const udp_fast_rx_t *rx,
+                               const net_buf_t *buf)
+{
+    const uint8_t *f = buf->data;
+    uint32_t total;
+    uint32_t udp_len;
+    uint32_t sum;
+
+    if (buf->len < UDP_FAST_HEADER || get16(&f[OFF_TYPE]) != ETHERTYPE_IPV4 ||
+        f[OFF_IP] != IP_VER_IHL || f[OFF_IP_PROTO] != IP_PROTO_UDP ||
+        (get16(&f[OFF_IP_FRAG]) & 0x3FFFu) != 0u ||
+        get32(&f[OFF_IP_DST]) != rx->ip || get16(&f[OFF_UDP_DST]) != rx->port)
+    {
+        return 0u;
+    }
+    total = get16(&f[OFF_IP_LEN]);
+    udp_len = get16(&f[OFF_UDP_LEN]);
+    if (total < IP_HEADER + UDP_HEADER || OFF_IP + total > buf->len ||
+        udp_len != total - IP_HEADER)
+    {
+        return 0u;
+    }
+    if ((netif->flags & NET_IF_RX_CSUM) != 0u)
+    {
+        return udp_len;
+    }
+    if (csum_fold(csum_add(0u, &f[OFF_IP], IP_HEADER)) != 0xFFFFu)
+    {
+        return 0u;
+    }
+    if (get16(&f[OFF_UDP_SUM]) != 0u)
+    {
+        sum = csum_add(0u, &f[OFF_IP_SRC], 8u) + IP_PROTO_UDP + udp_len;
+        if (csum_fold(csum_add(sum, &f[OFF_UDP], udp_len)) != 0xFFFFu)
+        {
+            return 0u;
+        }
+    }
+    return udp_len;
+}
+
+/** net_if_t.rx of a bound receiver. */
+static void udp_fast_input(net_if_t *netif, net_buf_t *buf)
+{
+    udp_fast_rx_t *rx = (udp_fast_rx_t *)netif->rx_ctx;
+    uint32_t udp_len = udp_fast_check(netif, rx, buf);
+
+    if (udp_len == 0u)
+    {
+        rx->dropped++;
+        net_buf_free(buf);
+        return;
+    }
+    rx->received++;
+    rx->fn(rx->ctx, buf, &buf->data[UDP_FAST_HEADER], udp_len - UDP_HEADER);
+}
+
+/**
+ * Binds a receiver to a transport, replacing its rx callback.
+ *
+ * @param[out] rx    - receiver state
+ * @param[in]  netif - transport
+ * @param[in]  ip    - own address, host order
+ * @param[in]  port  - own port, host order
+ * @param[in]  fn    - called for every datagram to @p ip : @p port
+ * @param[in]  ctx   - for @p fn
+ */
+void udp_fast_rx_init(udp_fast_rx_t *rx, net_if_t *netif, uint32_t ip,
+                      uint16_t port, udp_fast_rx_fn_t fn, void *ctx)
+{
+    memset(rx, 0, sizeof(*rx));
+    rx->ip = ip;
+    rx->port = port;
+    rx->fn = fn;
+    rx->ctx = ctx;
+    netif->rx_ctx = rx;
+    netif->rx = udp_fast_input;
+}
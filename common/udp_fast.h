@@ -0,0 +1,125 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - networking
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     udp_fast.h
+ * @author   insert authors names here
+ * @brief    UDP over IPv4 over Ethernet for one fixed flow, for telemetry.\n
+ *           No ARP, no fragments, no IP options: the peer's MAC address is
+ *           configured with the flow. Sending copies a 42-byte header built
+ *           once by udp_fast_tx_init() in front of the payload and patches
+ *           the lengths, the IP id and the IP checksum, which is derived
+ *           from a sum kept with the template. The UDP checksum is left to
+ *           the transport when it has NET_IF_TX_CSUM, and is 0 ("none",
+ *           valid for IPv4) otherwise.\n
+ *           Receiving: udp_fast_rx_init() takes over net_if_t.rx and passes
+ *           datagrams for one address and port to a callback; everything
+ *           else is dropped. Checksums are checked in software unless the
+ *           transport has NET_IF_RX_CSUM.\n
+ *           Typical use, payload written in place:
+ *           @code
+ *           net_buf_t *buf = net_buf_alloc();
+ *           memcpy(udp_fast_payload(buf), sample, n);
+ *           if (!udp_fast_send(&tx, buf, n)) net_buf_free(buf);
+ *           @endcode
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _UDP_FAST_H_
+#define _UDP_FAST_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/net_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Ethernet (14) + IPv4 (20) + UDP (8) headers. */
+#define UDP_FAST_HEADER         42u
+/** Largest payload in a 1500-byte MTU. */
+#define UDP_FAST_PAYLOAD_MAX    1472u
+
+/** IPv4 address a.b.c.d in host order. */
+#define UDP_FAST_IP(a, b, c, d) (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | \
+                                 ((uint32_t)(c) << 8) | (uint32_t)(d))
+
+/** Both ends of a flow; addresses and ports in host order. */
+typedef struct
+{
+    uint8_t  dst_mac[NET_MAC_LEN];
+    uint32_t src_ip;
+    uint32_t dst_ip;
+    uint16_t src_port;
+    uint16_t dst_port;
+} udp_fast_flow_t;
+
+typedef struct
+{
+    net_if_t *netif;
+    uint8_t   header[UDP_FAST_HEADER];
+    uint32_t  sum;          /**< IP header sum, total length and id excluded */
+    uint16_t  id;
+    uint32_t  sent;
+} udp_fast_tx_t;
+
+/**
+ * A datagram for the bound address and port, @p len payload bytes at
+ * @p payload inside @p buf. Runs in the transport's context; the callee
+ * owns @p buf.
+ */
+typedef void (*udp_fast_rx_fn_t)(void *ctx, net_buf_t *buf,
+                                 const uint8_t *payload, uint32_t len);
+
+typedef struct
+{
+    uint32_t         ip;
+    uint16_t         port;
+    udp_fast_rx_fn_t fn;
+    void            *ctx;
+    uint32_t         received;
+    uint32_t         dropped;   /**< not IPv4/UDP, not ours, bad checksum */
+} udp_fast_rx_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void udp_fast_tx_init(udp_fast_tx_t *tx, net_if_t *netif,
+                      const udp_fast_flow_t *flow);
+
+/** @returns uint8_t* - where the payload of a frame built in @p buf goes */
+static inline uint8_t *udp_fast_payload(net_buf_t *buf)
+{
+    return &buf->data[UDP_FAST_HEADER];
+}
+
+bool udp_fast_send(udp_fast_tx_t *tx, net_buf_t *buf, uint32_t len);
+
+void udp_fast_rx_init(udp_fast_rx_t *rx, net_if_t *netif, uint32_t ip,
+                      uint16_t port, udp_fast_rx_fn_t fn, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,419 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - vector table
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     vector_table.h
+ * @author   insert authors names here
+ * @brief    Vector table built at compile time (C++). \n
+ *           The application lists its handlers once:
+ *               constexpr Binding kBindings[] =
+ *               {
+ *                   bind<Irq::SysTick, 6>(SysTick_Handler),
+ *                   bind<Irq::UART0, 2>(uart_isr),
+ *                   bind<Irq::EMAC0>(eth_isr),         // reset priority
+ *                   bind<Irq::ADC0SS0, 3, Fpu::Uses>(adc_isr),
+ *               };
+ *           vector_handlers() turns the list into the 127 entries that
+ *           follow the stack pointer in .intvec (see Lab2/src/vectors.cpp);
+ *           vectors not bound go to vector_trap(), the reserved exception
+ *           vectors stay 0. vector_priorities() turns it into the NVIC
+ *           priority registers to write (NVIC_PRIn, and SYS_PRIn for the
+ *           system handlers), whole words, so that start-up applies all of
+ *           them in one loop with vector_priorities_apply(); lanes of those
+ *           words that are not bound get priority 0, the reset value, so
+ *           apply before any IntPrioritySet().
+ *
+ *           Checked by the compiler: only vectors of the TM4C1294NCPDT can be
+ *           named (Irq), priorities are 0..7 (3 bits implemented) and only
+ *           for exceptions whose priority is configurable, and a vector
+ *           bound twice stops the build (the call to an undefined, non
+ *           constexpr function is reached during constant evaluation).
+ *
+ *           Handlers are integer-only (Fpu::Free) unless bound with
+ *           Fpu::Uses. With lazy stacking (common/fpu_ctx.h) only Fpu::Uses
+ *           handlers that interrupt floating-point code pay for saving
+ *           S0-S15/FPSCR; vector_fpu_users() == 0 is what allows
+ *           FPU_CTX_OFF. The marks are not enforced on the target.
+ *
+ *           Irq values are vector numbers, as the INT_x constants of
+ *           inc/hw_ints.h and register_isr() (common/vtable.h) use them.
+ *           On the host the table is loaded into the simulator's exception
+ *           dispatch with vector_table_install(), and the Fpu marks into
+ *           its stacking cost with vector_fpu_install().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _VECTOR_TABLE_H_
+#define _VECTOR_TABLE_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "inc/hw_ints.h"
+#include "common/vtable.h"
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+#include "host/sim/sim.h"
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Priority levels implemented (NVIC_PRIn bits 7:5). */
+constexpr uint8_t  IRQ_PRIO_LEVELS = 8u;
+constexpr uint8_t  IRQ_PRIO_SHIFT  = 5u;
+/** Binding that leaves the priority at its reset value. */
+constexpr uint8_t  IRQ_PRIO_NONE   = 0xFFu;
+
+/** NVIC_PRI0 (IRQ 0..3) and SYS_PRI1 (MemManage .. vector 7). */
+constexpr uint32_t NVIC_PRI_BASE   = 0xE000E400u;
+constexpr uint32_t NVIC_SYS_PRI_BASE = 0xE000ED18u;
+
+/** Priority words: NVIC_PRI0..27 and SYS_PRI1..3. */
+constexpr uint32_t VECTOR_PRIO_WORDS = (VTABLE_ENTRIES - 16u) / 4u + 3u;
+
+/**
+ * Vectors of the TM4C1294NCPDT. Vectors reserved on this part (for
+ * peripherals of other TM4C129 devices) have no name.
+ */
+enum class Irq : uint32_t
+{
+    NMI        = FAULT_NMI,
+    HardFault  = FAULT_HARD,
+    MemManage  = FAULT_MPU,
+    BusFault   = FAULT_BUS,
+    UsageFault = FAULT_USAGE,
+    SVCall     = FAULT_SVCALL,
+    DebugMon   = FAULT_DEBUG,
+    PendSV     = FAULT_PENDSV,
+    SysTick    = FAULT_SYSTICK,
+
+    GPIOA      = INT_GPIOA,
+    GPIOB      = INT_GPIOB,
+    GPIOC      = INT_GPIOC,
+    GPIOD      = INT_GPIOD,
+    GPIOE      = INT_GPIOE,
+    UART0      = INT_UART0,
+    UART1      = INT_UART1,
+    SSI0       = INT_SSI0,
+    I2C0       = INT_I2C0,
+    PWM0_FAULT = INT_PWM0_FAULT,
+    PWM0_0     = INT_PWM0_0,
+    PWM0_1     = INT_PWM0_1,
+    PWM0_2     = INT_PWM0_2,
+    QEI0       = INT_QEI0,
+    ADC0SS0    = INT_ADC0SS0,
+    ADC0SS1    = INT_ADC0SS1,
+    ADC0SS2    = INT_ADC0SS2,
+    ADC0SS3    = INT_ADC0SS3,
+    WATCHDOG   = INT_WATCHDOG,
+    TIMER0A    = INT_TIMER0A,
+    TIMER0B    = INT_TIMER0B,
+    TIMER1A    = INT_TIMER1A,
+    TIMER1B    = INT_TIMER1B,
+    TIMER2A    = INT_TIMER2A,
+    TIMER2B    = INT_TIMER2B,
+    COMP0      = INT_COMP0,
+    COMP1      = INT_COMP1,
+    COMP2      = INT_COMP2,
+    SYSCTL     = INT_SYSCTL,
+    FLASH      = INT_FLASH,
+    GPIOF      = INT_GPIOF,
+    GPIOG      = INT_GPIOG,
+    GPIOH      = INT_GPIOH,
+    UART2      = INT_UART2,
+    SSI1       = INT_SSI1,
+    TIMER3A    = INT_TIMER3A,
+    TIMER3B    = INT_TIMER3B,
+    I2C1       = INT_I2C1,
+    CAN0       = INT_CAN0,
+    CAN1       = INT_CAN1,
+    EMAC0      = INT_EMAC0,
+    HIBERNATE  = INT_HIBERNATE,
+    USB0       = INT_USB0,
+    PWM0_3     = INT_PWM0_3,
+    UDMA       = INT_UDMA,
+    UDMAERR    = INT_UDMAERR,
+    ADC1SS0    = INT_ADC1SS0,
+    ADC1SS1    = INT_ADC1SS1,
+    ADC1SS2    = INT_ADC1SS2,
+    ADC1SS3    = INT_ADC1SS3,
+    EPI0       = INT_EPI0,
+    GPIOJ      = INT_GPIOJ,
+    GPIOK      = INT_GPIOK,
+    GPIOL      = INT_GPIOL,
+    SSI2       = INT_SSI2,
+    SSI3       = INT_SSI3,
+    UART3      = INT_UART3,
+    UART4      = INT_UART4,
+    UART5      = INT_UART5,
+    UART6      = INT_UART6,
+    UART7      = INT_UART7,
+    I2C2       = INT_I2C2,
+    I2C3       = INT_I2C3,
+    TIMER4A    = INT_TIMER4A,
+    TIMER4B    = INT_TIMER4B,
+    TIMER5A    = INT_TIMER5A,
+    TIMER5B    = INT_TIMER5B,
+    SYSEXC     = INT_SYSEXC,
+    I2C4       = INT_I2C4,
+    I2C5       = INT_I2C5,
+    GPIOM      = INT_GPIOM,
+    GPION      = INT_GPION,
+    TAMPER0    = INT_TAMPER0,
+    GPIOP0     = INT_GPIOP0,
+    GPIOP1     = INT_GPIOP1,
+    GPIOP2     = INT_GPIOP2,
+    GPIOP3     = INT_GPIOP3,
+    GPIOP4     = INT_GPIOP4,
+    GPIOP5     = INT_GPIOP5,
+    GPIOP6     = INT_GPIOP6,
+    GPIOP7     = INT_GPIOP7,
+    GPIOQ0     = INT_GPIOQ0,
+    GPIOQ1     = INT_GPIOQ1,
+    GPIOQ2     = INT_GPIOQ2,
+    GPIOQ3     = INT_GPIOQ3,
+    GPIOQ4     = INT_GPIOQ4,
+    GPIOQ5     = INT_GPIOQ5,
+    GPIOQ6     = INT_GPIOQ6,
+    GPIOQ7     = INT_GPIOQ7,
+    TIMER6A    = INT_TIMER6A,
+    TIMER6B    = INT_TIMER6B,
+    TIMER7A    = INT_TIMER7A,
+    TIMER7B    = INT_TIMER7B,
+    I2C6       = INT_I2C6,
+    I2C7       = INT_I2C7,
+    I2C8       = INT_I2C8,
+    I2C9       = INT_I2C9
+};
+
+/** Whether a handler executes floating-point instructions. */
+enum class Fpu : uint8_t
+{
+    Free,
+    Uses
+};
+
+/** A handler for a vector and the priority to give it. */
+struct Binding
+{
+    uint32_t         vector;
+    vtable_handler_t fn;
+    uint8_t          priority;      /**< 0..7, or IRQ_PRIO_NONE */
+    Fpu              fpu;
+};
+
+/** Vectors 1..127 (reset onwards), the part of .intvec after the SP. */
+struct VectorHandlers
+{
+    vtable_handler_t fn[VTABLE_ENTRIES - 1u];
+};
+
+/** What .intvec holds. */
+struct VectorImage
+{
+    void          *sp;
+    VectorHandlers handlers;
+};
+
+struct PriorityWrite
+{
+    uint32_t addr;
+    uint32_t value;
+};
+
+/** Priority registers to write: system handlers first, then by vector. */
+struct VectorPriorities
+{
+    PriorityWrite write[VECTOR_PRIO_WORDS];
+    uint32_t      count;
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern "C" volatile uint32_t g_vector_trap;     /**< vector last trapped */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+/** Shared handler of the vectors not bound: records IPSR, then stops. */
+extern "C" void vector_trap(void);
+
+/** Not defined: reached at compile time only when a vector is bound twice. */
+void vector_table_error_vector_bound_twice(void);
+
+/**
+ * Binds a handler to a vector.
+ *
+ * @tparam  I        - the vector
+ * @tparam  Priority - 0 (highest) .. 7, IRQ_PRIO_NONE to keep the reset value
+ * @tparam  F        - Fpu::Uses if the handler uses floating point
+ * @param[in] fn     - the handler
+ */
+template <Irq I, uint8_t Priority = IRQ_PRIO_NONE, Fpu F = Fpu::Free>
+constexpr Binding bind(vtable_handler_t fn)
+{
+    static_assert(Priority == IRQ_PRIO_NONE || Priority < IRQ_PRIO_LEVELS,
+                  "priorities are 0 to 7");
+    static_assert(Priority == IRQ_PRIO_NONE ||
+                  static_cast<uint32_t>(I) >= FAULT_MPU,
+                  "NMI and HardFault have fixed priorities");
+    return Binding{ static_cast<uint32_t>(I), fn, Priority, F };
+}
+
+/** Exception vectors 7..10 and 13 are reserved by the architecture. */
+constexpr bool vector_reserved(uint32_t vector)
+{
+    return (vector >= 7u && vector <= 10u) || vector == 13u;
+}
+
+/**
+ * @param[in] reset    - vector 1, the program entry
+ * @param[in] bindings - the application's handlers
+ * @returns VectorHandlers - vectors 1..127
+ */
+template <size_t N>
+constexpr VectorHandlers vector_handlers(vtable_handler_t reset,
+                                         const Binding (&bindings)[N])
+{
+    VectorHandlers table{};
+    bool bound[VTABLE_ENTRIES] = {};
+
+    for (uint32_t v = 2u; v < VTABLE_ENTRIES; v++)
+    {
+        table.fn[v - 1u] = vector_reserved(v) ? nullptr : vector_trap;
+    }
+    table.fn[0] = reset;
+    for (size_t i = 0; i < N; i++)
+    {
+        if (bound[bindings[i].vector])
+        {
+            vector_table_error_vector_bound_twice();
+        }
+        bound[bindings[i].vector] = true;
+        table.fn[bindings[i].vector - 1u] = bindings[i].fn;
+    }
+    return table;
+}
+
+/** @returns uint32_t - handlers bound with Fpu::Uses */
+template <size_t N>
+constexpr uint32_t vector_fpu_users(const Binding (&bindings)[N])
+{
+    uint32_t users = 0u;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if (bindings[i].fpu == Fpu::Uses)
+        {
+            users++;
+        }
+    }
+    return users;
+}
+
+/** Address of the priority byte of @p vector (4..15, 16..127). */
+constexpr uint32_t vector_priority_addr(uint32_t vector)
+{
+    return (vector >= 16u) ? NVIC_PRI_BASE + (vector - 16u)
+                           : NVIC_SYS_PRI_BASE + (vector - 4u);
+}
+
+/**
+ * @param[in] bindings - the application's handlers
+ * @returns VectorPriorities - the words to write
+ */
+template <size_t N>
+constexpr VectorPriorities vector_priorities(const Binding (&bindings)[N])
+{
+    VectorPriorities prio{};
+    uint32_t values[VECTOR_PRIO_WORDS] = {};
+    bool touched[VECTOR_PRIO_WORDS] = {};
+    uint32_t addrs[VECTOR_PRIO_WORDS] = {};
+
+    /* SYS_PRI1..3, then NVIC_PRI0..27: word vector / 4 - 1 */
+    for (size_t i = 0; i < N; i++)
+    {
+        uint32_t v = bindings[i].vector;
+
+        if (bindings[i].priority != IRQ_PRIO_NONE)
+        {
+            uint32_t word = v / 4u - 1u;
+            uint32_t addr = vector_priority_addr(v);
+
+            addrs[word] = addr & ~3u;
+            values[word] |= static_cast<uint32_t>(bindings[i].priority
+                                                  << IRQ_PRIO_SHIFT)
+                            << ((addr & 3u) * 8u);
+            touched[word] = true;
+        }
+    }
+    for (uint32_t w = 0; w < VECTOR_PRIO_WORDS; w++)
+    {
+        if (touched[w])
+        {
+            prio.write[prio.count].addr = addrs[w];
+            prio.write[prio.count].value = values[w];
+            prio.count++;
+        }
+    }
+    return prio;
+}
+
+/**
+ * Writes the priority registers: one store per word. Call at start-up,
+ * before any IntPrioritySet() and before interrupts are enabled.
+ */
+inline void vector_priorities_apply(const VectorPriorities &prio)
+{
+    for (uint32_t i = 0; i < prio.count; i++)
+    {
+#if defined(__IAR_SYSTEMS_ICC__)
+        *reinterpret_cast<volatile uint32_t *>(prio.write[i].addr) =
+            prio.write[i].value;
+#else
+        sim_nvic_store_priorities(prio.write[i].addr, prio.write[i].value);
+#endif
+    }
+}
+
+#if !defined(__IAR_SYSTEMS_ICC__)
+/** Host: the table takes over the simulator's exception dispatch. */
+inline void vector_table_install(const VectorHandlers &handlers)
+{
+    for (uint32_t v = 2u; v < VTABLE_ENTRIES; v++)
+    {
+        (void)sim_set_vector(v, handlers.fn[v - 1u]);
+    }
+}
+
+/** Host: the Fpu marks, for the simulator's lazy stacking cost. */
+template <size_t N>
+inline void vector_fpu_install(const Binding (&bindings)[N])
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        sim_set_vector_fpu(bindings[i].vector, bindings[i].fpu == Fpu::Uses);
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,129 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - RAM vector table
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     vtable.c
+ * @author   insert authors names here
+ * @brief    RAM vector table, target side (see vtable.h).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#if defined(__IAR_SYSTEMS_ICC__)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <intrinsics.h>
+
+#include "common/vtable.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define NVIC_VTABLE         (*(volatile uint32_t *)0xE000ED08u)
+
+/** Layout of __vector_table in startup_ewarm.c and in IAR's cstartup_M.c. */
+typedef union
+{
+    vtable_handler_t __fun;
+    void            *__ptr;
+} intvec_elem;
+
+extern const intvec_elem __vector_table[];
+
+/* section of __vector_table: the full table of startup_ewarm.c (Lab2), only
+   the 16 core ones from the IAR default (Lab1) */
+#pragma section=".intvec"
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+/** VTOR needs the table aligned to its size rounded up to a power of two. */
+#pragma data_alignment=512
+#pragma location="VTABLE"
+static __no_init vtable_handler_t s_vtable[VTABLE_ENTRIES];
+
+static bool s_relocated;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Handler of the vectors the flash table does not have: stops where the
+ * debugger shows which one fired (IPSR).
+ */
+static void unhandled_isr(void)
+{
+    for (;;)
+    {
+    }
+}
+
+/**
+ * Copies the flash vector table into SRAM and switches VTOR to it; entries
+ * past the end of the linked table get unhandled_isr(). Called by the
+ * first register_isr(); call it earlier to pay the copy at start-up
+ * instead.
+ */
+void vtable_init(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t linked = __section_size(".intvec") / sizeof(intvec_elem);
+    uint32_t i;
+
+    __disable_interrupt();
+    if (!s_relocated)
+    {
+        for (i = 0; i < VTABLE_ENTRIES; i++)
+        {
+            s_vtable[i] = (i < linked) ? __vector_table[i].__fun
+                                       : unhandled_isr;
+        }
+        NVIC_VTABLE = (uint32_t)s_vtable;
+        __DSB();
+        s_relocated = true;
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * Installs the handler of an exception or interrupt.
+ *
+ * @param[in] irq  - vector number, as the INT_x constants of inc/hw_ints.h
+ *                   (FAULT_SYSTICK = 15, INT_GPIOA = 16, ...)
+ * @param[in] fn   - new handler
+ * @returns vtable_handler_t - the previous handler, NULL if irq is invalid
+ */
+vtable_handler_t register_isr(uint32_t irq, vtable_handler_t fn)
+{
+    vtable_handler_t previous;
+
+    if (irq >= VTABLE_ENTRIES || irq == 0u)
+    {
+        return 0;
+    }
+    vtable_init();
+    previous = s_vtable[irq];
+    s_vtable[irq] = fn;
+    __DSB();
+    return previous;
+}
+
+#endif
@@ -0,0 +1,62 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - RAM vector table
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     vtable.h
+ * @author   insert authors names here
+ * @brief    Vector table in SRAM, with handlers installed at run time. \n
+ *           The first register_isr() copies the flash table of
+ *           startup_ewarm.c into section VTABLE (start of SRAM, Tiva.icf) and
+ *           points VTOR at it; vectors not registered keep their weak
+ *           handlers, and those past the end of a shorter flash table (the
+ *           16 of IAR's default cstartup_M.c in Lab1) a trap. Handlers
+ *           that should also run from SRAM are declared RAMFUNC
+ *           (ramfunc.h).\n
+ *           On the host (host/sim/vtable_host.c) the handlers are installed
+ *           into the simulator's exception dispatch.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _VTABLE_H_
+#define _VTABLE_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Entries of the table in startup_ewarm.c: 16 exceptions + IRQ 0..111. */
+#define VTABLE_ENTRIES      128u
+
+typedef void (*vtable_handler_t)(void);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void             vtable_init(void);
+vtable_handler_t register_isr(uint32_t irq, vtable_handler_t fn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,362 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - waveform output
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     wave.c
+ * @author   insert authors names here
+ * @brief    Timer PWM and uDMA-fed GPIO patterns (see wave.h). \n
+ *           Pattern table: with n ticks per loop, the uDMA writes n - 1
+ *           table entries, one per timeout, then spends the n-th timeout on
+ *           the reload task while the pins hold the last entry. The loop is
+ *           phased so that this held tick falls inside a step: at r = 0 when
+ *           the last step has the value of the first one, else at r = 1
+ *           inside the first step (two ticks long, after halving if need
+ *           be). Entry i holds the value of tick i + 1 + r; the CPU writes
+ *           the value of tick 0 and the first timeout comes after r + 1
+ *           ticks, so the output follows the steps from the call on.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/udma.h"
+
+#include "common/wave.h"
+#include "common/dma.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define TIMERS              8u
+
+/** Alternate clock of the timers (TIMER_CLOCK_PIOSC). */
+#define PIOSC_HZ            16000000u
+
+/** Longest PWM period: 16-bit count and 8-bit prescaler, one count kept
+    free so that a match above the load gives a 100 % duty cycle. */
+#define PWM_MAX_COUNT       0xFFFFFFu
+
+/** What a timer is used for. */
+#define USE_NONE            0u
+#define USE_PWM             1u
+#define USE_PATTERN         2u
+
+typedef struct
+{
+    uint8_t          table[WAVE_PATTERN_TICKS];
+    tDMAControlTable tasks[2];      /**< GPIO writes, then the reload */
+    uint32_t         reload;        /**< primary control word of the list */
+} wave_pattern_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t  s_use[TIMERS];
+static bool     s_piosc[TIMERS];
+/** Timer clocks per PWM period of each half, 0 when stopped. */
+static uint32_t s_period[TIMERS][2];
+
+static wave_pattern_t s_patterns[WAVE_PATTERN_TIMERS];
+
+/** Timer A channels of the pattern timers, uDMA encoding 0. */
+static const uint32_t s_patternMap[WAVE_PATTERN_TIMERS] =
+{
+    UDMA_CH18_TIMER0A, UDMA_CH20_TIMER1A
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t timer_index(uint32_t base)
+{
+    return (base >= TIMER6_BASE) ? 6u + ((base - TIMER6_BASE) >> 12) % 2u
+                                 : ((base - TIMER0_BASE) >> 12) % 6u;
+}
+
+static uint32_t timer_periph(uint32_t base)
+{
+    if (base >= TIMER6_BASE)
+    {
+        return SYSCTL_PERIPH_TIMER6 + ((base - TIMER6_BASE) >> 12);
+    }
+    return SYSCTL_PERIPH_TIMER0 + ((base - TIMER0_BASE) >> 12);
+}
+
+static void periph_enable(uint32_t periph)
+{
+    SysCtlPeripheralEnable(periph);
+    while (!SysCtlPeripheralReady(periph))
+    {
+    }
+}
+
+static uint32_t half_index(uint32_t half)
+{
+    return (half == TIMER_B) ? 1u : 0u;
+}
+
+/** Writes the match of @p duty; it takes effect at the next timeout. */
+static void pwm_match(const wave_pin_t *pin, uint32_t period, uint32_t duty)
+{
+    uint32_t load = period - 1u;
+    uint32_t high = (uint32_t)((uint64_t)period * duty / WAVE_DUTY_FULL);
+    /* asserted at the load value, deasserted when the count equals match */
+    uint32_t match = (high >= period) ? load + 1u : load - high;
+
+    TimerPrescaleMatchSet(pin->timer, pin->half, match >> 16);
+    TimerMatchSet(pin->timer, pin->half, match & 0xFFFFu);
+}
+
+/**
+ * Starts a PWM output on a CCP pin.
+ *
+ * @param[in] pin      - the pin and its timer half
+ * @param[in] clock_hz - system clock
+ * @param[in] freq_hz  - output frequency
+ * @param[in] duty     - high time, in 1/WAVE_DUTY_FULL of the period
+ * @returns bool       - false if the frequency is out of range, or the
+ *                       timer plays a pattern or counts another clock
+ */
+bool wave_pwm_start(const wave_pin_t *pin, uint32_t clock_hz,
+                    uint32_t freq_hz, uint32_t duty)
+{
+    uint32_t t = timer_index(pin->timer);
+    uint32_t h = half_index(pin->half);
+    uint32_t period;
+    bool piosc = false;
+
+    if (freq_hz == 0u || duty > WAVE_DUTY_FULL || s_use[t] == USE_PATTERN)
+    {
+        return false;
+    }
+    period = clock_hz / freq_hz;
+    if (period > PWM_MAX_COUNT)
+    {
+        piosc = true;
+        period = PIOSC_HZ / freq_hz;
+    }
+    if (period < 2u || period > PWM_MAX_COUNT ||
+        (s_period[t][h ^ 1u] != 0u && s_piosc[t] != piosc))
+    {
+        return false;
+    }
+
+    if (s_use[t] == USE_NONE)
+    {
+        periph_enable(timer_periph(pin->timer));
+        TimerConfigure(pin->timer, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PWM |
+                                   TIMER_CFG_B_PWM);
+        s_use[t] = USE_PWM;
+    }
+    else
+    {
+        TimerDisable(pin->timer, pin->half);
+    }
+    if (s_period[t][h ^ 1u] == 0u)
+    {
+        TimerClockSourceSet(pin->timer, piosc ? TIMER_CLOCK_PIOSC
+                                              : TIMER_CLOCK_SYSTEM);
+        s_piosc[t] = piosc;
+    }
+    TimerUpdateMode(pin->timer, pin->half,
+                    TIMER_UP_LOAD_TIMEOUT | TIMER_UP_MATCH_TIMEOUT);
+    TimerPrescaleSet(pin->timer, pin->half, (period - 1u) >> 16);
+    TimerLoadSet(pin->timer, pin->half, (period - 1u) & 0xFFFFu);
+    pwm_match(pin, period, duty);
+    s_period[t][h] = period;
+
+    GPIOPinConfigure(pin->pin_config);
+    GPIOPinTypeTimer(pin->port, pin->pin);
+    TimerEnable(pin->timer, pin->half);
+    return true;
+}
+
+/**
+ * Changes the duty cycle of a running PWM output from its next period on.
+ *
+ * @param[in] pin  - as given to wave_pwm_start()
+ * @param[in] duty - high time, in 1/WAVE_DUTY_FULL of the period
+ */
+void wave_pwm_duty(const wave_pin_t *pin, uint32_t duty)
+{
+    uint32_t period = s_period[timer_index(pin->timer)][half_index(pin->half)];
+
+    if (period == 0u)
+    {
+        return;
+    }
+    pwm_match(pin, period, (duty > WAVE_DUTY_FULL) ? WAVE_DUTY_FULL : duty);
+}
+
+/**
+ * Stops a PWM output; the pin stays in its timer function, at its level.
+ */
+void wave_pwm_stop(const wave_pin_t *pin)
+{
+    uint32_t t = timer_index(pin->timer);
+    uint32_t h = half_index(pin->half);
+
+    if (s_period[t][h] == 0u)
+    {
+        return;
+    }
+    TimerDisable(pin->timer, pin->half);
+    s_period[t][h] = 0u;
+    if (s_period[t][h ^ 1u] == 0u)
+    {
+        s_use[t] = USE_NONE;
+    }
+}
+
+/** @returns uint8_t - pin levels at tick @p tick of a loop of the steps */
+static uint8_t step_value(const wave_step_t *steps, uint32_t count,
+                          uint32_t scale, uint32_t tick)
+{
+    uint32_t i;
+
+    for (i = 0; i < count - 1u; i++)
+    {
+        uint32_t ticks = (uint32_t)steps[i].ticks * scale;
+
+        if (tick < ticks)
+        {
+            break;
+        }
+        tick -= ticks;
+    }
+    return steps[i].value;
+}
+
+/**
+ * Plays a pattern on pins of one port, forever, from timer 0 or 1 and its
+ * uDMA channel. Steps start at the call: the first one is written at once.
+ *
+ * @param[in] timer    - TIMER0_BASE or TIMER1_BASE
+ * @param[in] clock_hz - system clock
+ * @param[in] port     - GPIO port base
+ * @param[in] pins     - pins driven; the others keep their level
+ * @param[in] steps    - pin levels and their lengths; copied
+ * @param[in] count    - number of steps, at least 1
+ * @param[in] tick_us  - length of a tick
+ * @returns bool       - false if the timer has no channel or is in use,
+ *                       or the loop is too long or the tick too short
+ */
+bool wave_pattern_start(uint32_t timer, uint32_t clock_hz, uint32_t port,
+                        uint8_t pins, const wave_step_t *steps,
+                        uint32_t count, uint32_t tick_us)
+{
+    uint32_t t = timer_index(timer);
+    uint32_t channel;
+    wave_pattern_t *p;
+    uint64_t tick;
+    uint32_t total = 0u;
+    uint32_t scale = 1u;
+    uint32_t phase = 0u;
+    uint32_t n;
+    uint32_t i;
+
+    if (t >= WAVE_PATTERN_TIMERS || s_use[t] != USE_NONE || count == 0u)
+    {
+        return false;
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (steps[i].ticks == 0u)
+        {
+            return false;
+        }
+        total += steps[i].ticks;
+    }
+
+    /* the held tick: on the loop boundary, or one tick into step 0 */
+    if (steps[count - 1u].value != steps[0].value || total == 1u)
+    {
+        phase = 1u;
+        if (steps[0].ticks == 1u)
+        {
+            scale = 2u;
+        }
+    }
+    n = total * scale;
+    tick = (uint64_t)clock_hz * tick_us / (1000000u * (uint64_t)scale);
+    if (n - 1u > WAVE_PATTERN_TICKS || tick < WAVE_PATTERN_MIN_TICK ||
+        (phase + 1u) * tick > 0x100000000ull)
+    {
+        return false;
+    }
+
+    p = &s_patterns[t];
+    channel = s_patternMap[t] & 0xFFu;
+    for (i = 0; i < n - 1u; i++)
+    {
+        p->table[i] = step_value(steps, count, scale, (i + 1u + phase) % n);
+    }
+    s_use[t] = USE_PATTERN;
+
+    /* list: n - 1 GPIO writes, then the primary control word restored */
+    dma_init();
+    uDMAChannelAssign(s_patternMap[t]);
+    uDMAChannelAttributeDisable(channel, UDMA_ATTR_ALL);
+    p->tasks[0] = (tDMAControlTable)uDMATaskStructEntry(
+        n - 1u, UDMA_SIZE_8, UDMA_SRC_INC_8, p->table, UDMA_DST_INC_NONE,
+        (void *)(uintptr_t)(port + ((uint32_t)pins << 2)), UDMA_ARB_1,
+        UDMA_MODE_PER_SCATTER_GATHER);
+    p->tasks[1] = (tDMAControlTable)uDMATaskStructEntry(
+        1u, UDMA_SIZE_32, UDMA_SRC_INC_NONE, &p->reload, UDMA_DST_INC_NONE,
+        (void *)&g_dma_table[channel].ui32Control, UDMA_ARB_1,
+        UDMA_MODE_PER_SCATTER_GATHER);
+    uDMAChannelScatterGatherSet(channel, 2u, p->tasks, 1u);
+    p->reload = g_dma_table[channel].ui32Control;
+    uDMAChannelEnable(channel);
+
+    /* first timeout after phase + 1 ticks, then one per tick */
+    periph_enable(timer_periph(timer));
+    TimerConfigure(timer, TIMER_CFG_PERIODIC);
+    TimerUpdateMode(timer, TIMER_A, TIMER_UP_LOAD_TIMEOUT);
+    TimerLoadSet(timer, TIMER_A, (uint32_t)((phase + 1u) * tick - 1u));
+    TimerDMAEventSet(timer, TIMER_DMA_TIMEOUT_A);
+    GPIOPinWrite(port, pins, steps[0].value);
+    TimerEnable(timer, TIMER_A);
+    TimerLoadSet(timer, TIMER_A, (uint32_t)(tick - 1u));
+    return true;
+}
+
+/**
+ * Stops a pattern; the pins keep their levels.
+ */
+void wave_pattern_stop(uint32_t timer)
+{
+    uint32_t t = timer_index(timer);
+
+    if (t >= WAVE_PATTERN_TIMERS || s_use[t] != USE_PATTERN)
+    {
+        return;
+    }
+    TimerDisable(timer, TIMER_A);
+    TimerDMAEventSet(timer, 0u);
+    uDMAChannelDisable(s_patternMap[t] & 0xFFu);
+    s_use[t] = USE_NONE;
+}
@@ -0,0 +1,117 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Common - waveform output
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     wave.h
+ * @author   insert authors names here
+ * @brief    Periodic outputs generated by the timers and the uDMA: once
+ *           started, no instruction runs and no interrupt is taken to keep
+ *           them going. \n
+ *           PWM: wave_pwm_start() puts a half of a general-purpose timer in
+ *           PWM mode on one of its CCP pins (GPIO_PxN_TnCCPm of
+ *           driverlib/pin_map.h). The period is 24 bits of the system
+ *           clock, with the prescaler as the top 8 bits; frequencies below
+ *           clock / 2^24 count PIOSC instead, down to about 1 Hz. Both
+ *           halves of a timer share the clock. wave_pwm_duty() changes the
+ *           duty cycle at the end of the running period, so no period is cut
+ *           short.\n
+ *           Pattern: wave_pattern_start() plays a sequence of steps on any
+ *           pins of one port, for pins with no timer function (e.g. the
+ *           LEDs on PN0/PN1). Timer 0 or 1 times out every tick and requests
+ *           its uDMA channel, which writes the next value of a table to the
+ *           masked GPIODATA address of the pins. The channel runs in
+ *           peripheral scatter-gather mode and its last task writes the
+ *           saved primary control word back into g_dma_table, so the list
+ *           restarts by itself. That reload takes one request, during which
+ *           the pins hold their value: the table is built around it, and
+ *           when the first step is one tick long and differs from the last
+ *           one the tick is halved to make room (the table then holds two
+ *           entries per step).\n
+ *           The ports must be clocked, and the pattern pins configured as
+ *           outputs, before the calls. The outputs stop in deep-sleep unless
+ *           the timers (and the uDMA) are enabled there.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _WAVE_H_
+#define _WAVE_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Lab2 blinks its LEDs with a pattern instead of the timer service. */
+#ifndef WAVE_OUTPUT
+#define WAVE_OUTPUT             1
+#endif
+
+/** Duty cycle of wave_pwm_start() / wave_pwm_duty(), in 1/1000. */
+#define WAVE_DUTY_FULL          1000u
+
+/** Ticks of one pattern loop, after halving; at most 1024 (a uDMA task). */
+#ifndef WAVE_PATTERN_TICKS
+#define WAVE_PATTERN_TICKS      256u
+#endif
+
+/** Timers that can play a pattern: their timer A has a uDMA channel. */
+#define WAVE_PATTERN_TIMERS     2u      /**< TIMER0_BASE, TIMER1_BASE */
+
+/** Shortest tick of a pattern, in system clock cycles. */
+#define WAVE_PATTERN_MIN_TICK   120u
+
+/** A CCP pin and the timer half behind it. */
+typedef struct
+{
+    uint32_t timer;             /**< TIMERn_BASE                            */
+    uint32_t half;              /**< TIMER_A (CCP0) or TIMER_B (CCP1)       */
+    uint32_t port;              /**< GPIO port base of the pin              */
+    uint8_t  pin;               /**< GPIO_PIN_n                             */
+    uint32_t pin_config;        /**< GPIO_PxN_TnCCPm                        */
+} wave_pin_t;
+
+/** One step of a pattern: the pin levels, held for a number of ticks. */
+typedef struct
+{
+    uint8_t  value;             /**< masked by the pins of the pattern      */
+    uint16_t ticks;             /**< at least 1                             */
+} wave_step_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool wave_pwm_start(const wave_pin_t *pin, uint32_t clock_hz,
+                    uint32_t freq_hz, uint32_t duty);
+void wave_pwm_duty(const wave_pin_t *pin, uint32_t duty);
+void wave_pwm_stop(const wave_pin_t *pin);
+
+bool wave_pattern_start(uint32_t timer, uint32_t clock_hz, uint32_t port,
+                        uint8_t pins, const wave_step_t *steps,
+                        uint32_t count, uint32_t tick_us);
+void wave_pattern_stop(uint32_t timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench.h
+ * @author   insert authors names here
+ * @brief    Interface between the benchmark runner and the benchmarks. \n
+ *           A benchmark reports one line per metric. Metrics reported with a
+ *           budget make the runner fail when the value exceeds the budget;
+ *           metrics with budget 0 are informational.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Budget value of metrics that are reported but not checked. */
+#define BENCH_NO_BUDGET     0.0
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void bench_report(const char *bench, const char *metric, double value,
+                  double budget);
+void bench_fail(const char *bench, const char *reason);
+uint64_t bench_now_ns(void);
+
+/* Benchmarks, one per module; listed in bench_main.c */
+void bench_blinky(void);
+void bench_timer_wheel(void);
+void bench_kernel(void);
+void bench_sram(void);
+void bench_profile(void);
+void bench_irq(void);
+void bench_ring(void);
+void bench_uart(void);
+void bench_mem(void);
+void bench_stack(void);
+void bench_gpio(void);
+void bench_boot(void);
+void bench_dsp(void);
+void bench_adc(void);
+void bench_eth(void);
+void bench_power(void);
+void bench_vectors(void);
+void bench_fmt(void);
+void bench_tlog(void);
+void bench_dma(void);
+void bench_fpu(void);
+void bench_crypto(void);
+void bench_can(void);
+void bench_wave(void);
+void bench_kv(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,352 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_adc.c
+ * @author   insert authors names here
+ * @brief    Timer-triggered ADC streaming through common/adc_stream.c. \n
+ *           The simulated ADCs convert a 12-bit ramp, one value per result
+ *           and ADC, so every block can be checked for a gap. Cases, at
+ *           120 MHz with 4 channels on sequencer 0 and blocks of 512:
+ *           "adc.stream" ADC0 at 1 Msps; "adc.dual" ADC0 and ADC1 both at
+ *           2 Msps, the hardware maximum, after checking that a faster rate
+ *           is refused; "adc.slow" a consumer that keeps every block for
+ *           1.5 block times, which must be reported as overruns; "adc.stall"
+ *           interrupts masked for 3 block times, which must be reported as a
+ *           stall and FIFO overflows, after which the stream goes on.\n
+ *           The CPU figure is the share of cycles not spent asleep while the
+ *           main loop waits for blocks; the consumers' C code costs nothing
+ *           here, so it covers the driver only.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/adc.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "common/adc_stream.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+#define VCO_HZ              480000000u
+#define CHANNELS            4u
+#define BLOCK               512u
+#define BLOCKS              256u
+#define RAMP_MASK           0x0FFFu
+/** Safety stop: 1 s of simulated time. */
+#define RUN_CYCLES          120000000ull
+
+/** Budgets, slightly above the current figures. */
+#define BUDGET_STREAM_CPU_PCT   0.25
+#define BUDGET_DUAL_CPU_PCT     0.90
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const uint32_t s_channels[CHANNELS] =
+{
+    ADC_CTL_CH0, ADC_CTL_CH1, ADC_CTL_CH2, ADC_CTL_CH3
+};
+
+static uint16_t     s_buffer[2][2 * BLOCK];
+static adc_stream_t s_stream[2];
+
+static uint32_t s_expect[2];
+static bool     s_started[2];
+static uint32_t s_gaps;
+
+static const uint16_t *volatile s_kept;
+
+static uint64_t s_startCycles;
+static uint64_t s_startSleep;
+static uint64_t s_endCycles;
+static uint64_t s_endSleep;
+static bool     s_refused;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** Counts the places where the ramp of the block's ADC skips. */
+static void check_block(const adc_stream_t *stream, const uint16_t *block,
+                        uint32_t count)
+{
+    uint32_t adc = (stream->config.adc_base == ADC1_BASE) ? 1u : 0u;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (s_started[adc] && block[i] != s_expect[adc])
+        {
+            s_gaps++;
+        }
+        s_started[adc] = true;
+        s_expect[adc] = (block[i] + 1u) & RAMP_MASK;
+    }
+}
+
+static bool on_block(adc_stream_t *stream, const uint16_t *block,
+                     uint32_t count)
+{
+    check_block(stream, block, count);
+    return true;
+}
+
+/** Keeps the block for the main loop. */
+static bool on_block_keep(adc_stream_t *stream, const uint16_t *block,
+                          uint32_t count)
+{
+    check_block(stream, block, count);
+    s_kept = block;
+    return false;
+}
+
+static void open_stream(uint32_t index, uint32_t adc_base, adc_stream_fn_t fn)
+{
+    adc_stream_config_t c;
+
+    c.adc_base = adc_base;
+    c.sequencer = 0u;
+    c.channels = s_channels;
+    c.channel_count = CHANNELS;
+    c.vco_hz = VCO_HZ;
+    c.buffer = s_buffer[index];
+    c.block = BLOCK;
+    c.on_block = fn;
+    c.ctx = NULL;
+    (void)adc_stream_open(&s_stream[index], &c);
+}
+
+static uint32_t clock_init(void)
+{
+    return SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                              SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240, CLOCK_HZ);
+}
+
+static void mark_start(void)
+{
+    s_startCycles = g_sim.cycles;
+    s_startSleep = g_sim.sleep_cycles;
+}
+
+static void mark_end(void)
+{
+    s_endCycles = g_sim.cycles;
+    s_endSleep = g_sim.sleep_cycles;
+}
+
+static void wait_blocks(const adc_stream_t *stream, uint32_t blocks)
+{
+    while (stream->stats.blocks < blocks)
+    {
+        SysCtlSleep();
+    }
+}
+
+static void run_stream(void)
+{
+    uint32_t clock = clock_init();
+
+    open_stream(0u, ADC0_BASE, on_block);
+    mark_start();
+    (void)adc_stream_trigger_start(TIMER0_BASE, clock, 1000000u / CHANNELS);
+    wait_blocks(&s_stream[0], BLOCKS);
+    mark_end();
+    adc_stream_trigger_stop(TIMER0_BASE);
+    adc_stream_close(&s_stream[0]);
+}
+
+static void run_dual(void)
+{
+    uint32_t clock = clock_init();
+
+    open_stream(0u, ADC0_BASE, on_block);
+    open_stream(1u, ADC1_BASE, on_block);
+    s_refused = !adc_stream_trigger_start(TIMER0_BASE, clock,
+                                          2500000u / CHANNELS);
+    mark_start();
+    (void)adc_stream_trigger_start(TIMER0_BASE, clock,
+                                   ADC_STREAM_MAX_SPS / CHANNELS);
+    wait_blocks(&s_stream[0], BLOCKS);
+    wait_blocks(&s_stream[1], BLOCKS);
+    mark_end();
+    adc_stream_trigger_stop(TIMER0_BASE);
+    adc_stream_close(&s_stream[0]);
+    adc_stream_close(&s_stream[1]);
+}
+
+/** Works on each kept block for 1.5 block times before releasing it. */
+static void run_slow(void)
+{
+    uint32_t clock = clock_init();
+    uint32_t rate = 1000000u / CHANNELS;
+    uint32_t block_cycles = BLOCK * (clock / rate) / CHANNELS;
+
+    open_stream(0u, ADC0_BASE, on_block_keep);
+    (void)adc_stream_trigger_start(TIMER0_BASE, clock, rate);
+    while (s_stream[0].stats.blocks < BLOCKS / 4u)
+    {
+        const uint16_t *block;
+
+        SysCtlSleep();
+        block = s_kept;
+        if (block != NULL)
+        {
+            s_kept = NULL;
+            /* 3 cycles per iteration */
+            SysCtlDelay(block_cycles / 2u);
+            adc_stream_release(&s_stream[0], block);
+        }
+    }
+    adc_stream_trigger_stop(TIMER0_BASE);
+    adc_stream_close(&s_stream[0]);
+    mark_end();
+}
+
+/** Masks interrupts for 3 block times, then lets the stream go on. */
+static void run_stall(void)
+{
+    uint32_t clock = clock_init();
+    uint32_t rate = 1000000u / CHANNELS;
+    uint32_t block_cycles = BLOCK * (clock / rate) / CHANNELS;
+
+    open_stream(0u, ADC0_BASE, on_block);
+    (void)adc_stream_trigger_start(TIMER0_BASE, clock, rate);
+    wait_blocks(&s_stream[0], 4u);
+    (void)IntMasterDisable();
+    /* 3 cycles per iteration */
+    SysCtlDelay(block_cycles);
+    IntMasterEnable();
+    wait_blocks(&s_stream[0], 16u);
+    adc_stream_trigger_stop(TIMER0_BASE);
+    adc_stream_close(&s_stream[0]);
+    mark_end();
+}
+
+static bool run_case(const char *name, void (*entry)(void))
+{
+    sim_reset();
+    memset(s_started, 0, sizeof(s_started));
+    s_gaps = 0u;
+    s_kept = NULL;
+    s_endCycles = 0;
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(entry) || s_endCycles == 0)
+    {
+        bench_fail(name, "did_not_finish");
+        return false;
+    }
+    return true;
+}
+
+static double cpu_busy(void)
+{
+    double cycles = (double)(s_endCycles - s_startCycles);
+
+    return 100.0 * (cycles - (double)(s_endSleep - s_startSleep)) / cycles;
+}
+
+static double msps(const adc_stream_t *stream)
+{
+    return stream->stats.samples * (double)CLOCK_HZ /
+           (double)(s_endCycles - s_startCycles) / 1e6;
+}
+
+void bench_adc(void)
+{
+    if (run_case("adc.stream", run_stream))
+    {
+        if (s_gaps != 0u || s_stream[0].stats.overruns != 0u ||
+            s_stream[0].stats.stalls != 0u ||
+            s_stream[0].stats.fifo_overflows != 0u)
+        {
+            bench_fail("adc.stream", "samples_lost");
+        }
+        else
+        {
+            bench_report("adc.stream", "msps", msps(&s_stream[0]),
+                         BENCH_NO_BUDGET);
+            bench_report("adc.stream", "cpu_busy_%", cpu_busy(),
+                         BUDGET_STREAM_CPU_PCT);
+        }
+    }
+
+    if (run_case("adc.dual", run_dual))
+    {
+        if (!s_refused)
+        {
+            bench_fail("adc.dual", "rate_above_max_accepted");
+        }
+        else if (s_gaps != 0u || s_stream[0].stats.overruns != 0u ||
+                 s_stream[1].stats.overruns != 0u ||
+                 s_stream[0].stats.stalls != 0u ||
+                 s_stream[1].stats.stalls != 0u ||
+                 sim_adc_lost(ADC0_BASE) != 0u || sim_adc_lost(ADC1_BASE) != 0u)
+        {
+            bench_fail("adc.dual", "samples_lost");
+        }
+        else
+        {
+            bench_report("adc.dual", "msps",
+                         msps(&s_stream[0]) + msps(&s_stream[1]),
+                         BENCH_NO_BUDGET);
+            bench_report("adc.dual", "cpu_busy_%", cpu_busy(),
+                         BUDGET_DUAL_CPU_PCT);
+        }
+    }
+
+    if (run_case("adc.slow", run_slow))
+    {
+        if (s_stream[0].stats.overruns == 0u)
+        {
+            bench_fail("adc.slow", "overrun_not_counted");
+        }
+        else
+        {
+            bench_report("adc.slow", "overruns/block",
+                         (double)s_stream[0].stats.overruns /
+                             s_stream[0].stats.blocks,
+                         BENCH_NO_BUDGET);
+        }
+    }
+
+    if (run_case("adc.stall", run_stall))
+    {
+        if (s_stream[0].stats.stalls == 0u ||
+            s_stream[0].stats.fifo_overflows == 0u)
+        {
+            bench_fail("adc.stall", "stall_not_counted");
+        }
+        else
+        {
+            bench_report("adc.stall", "stalls", s_stream[0].stats.stalls,
+                         BENCH_NO_BUDGET);
+            bench_report("adc.stall", "lost_results",
+                         sim_adc_lost(ADC0_BASE), BENCH_NO_BUDGET);
+        }
+    }
+}
@@ -0,0 +1,229 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_blinky.c
+ * @author   insert authors names here
+ * @brief    Runs Lab2/src/blinky.c on the simulated HAL. \n
+ *           Reports the set-up cost (reset to first LED write) and, for the
+ *           steady-state loop, the work cycles and register writes spent per
+ *           LED toggle, the CPU occupancy (cycles not spent asleep in WFI)
+ *           and the toggle jitter. Busy-wait cycles are excluded from the
+ *           work cycles but count as CPU occupancy.\n
+ *           Also the modelled energy per toggle (host/sim/power.c).\n
+ *           "blinky.busy_wait" runs the original SysCtlDelay() loop as the
+ *           baseline; "blinky.governor" the program built with the power
+ *           governor (POWER_GOVERNOR=1); its jitter is the deep-sleep
+ *           wake-up (PLL relock), which delays the toggles from the first
+ *           deep-sleep on. "blinky.wave" the default build (WAVE_OUTPUT=1),
+ *           where timer 0 and the uDMA write the LEDs: only writes that
+ *           change the LEDs count as toggles, and the uDMA's own are not
+ *           register writes of the core.
+ * @version  V2
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "bench.h"
+#include "common/wave.h"
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Simulated run length: 10 s at 120 MHz. */
+#define RUN_CYCLES          1200000000ull
+
+/** Nominal time between toggles. */
+#define HALF_PERIOD_PS      500000000000ull
+
+typedef struct
+{
+    const char *name;
+    void      (*entry)(void);
+    double      setup_cycles;       /**< budgets, slightly above current */
+    double      setup_writes;
+    double      toggle_cycles;
+    double      toggle_writes;
+    double      jitter_us;
+} blinky_case_t;
+
+/** main() of Lab2/src/blinky.c, renamed by the build. */
+int blinky_main(void);
+int blinky_power_main(void);
+int blinky_wave_main(void);
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t s_toggles;
+static uint8_t  s_lastValue;
+static uint64_t s_setupCycles;
+static uint64_t s_setupWrites;
+static uint64_t s_firstWork;
+static uint64_t s_firstSleep;
+static uint64_t s_firstCycles;
+static double   s_firstUj;
+static uint64_t s_lastPs;
+static uint64_t s_maxDeviationPs;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_gpio(uint32_t port, uint8_t pins, uint8_t value)
+{
+    (void)port;
+    (void)pins;
+
+    if (s_toggles != 0 && value == s_lastValue)
+    {
+        return;
+    }
+    s_lastValue = value;
+
+    /* counters are sampled before the write itself is charged */
+    if (s_toggles == 0)
+    {
+        s_setupCycles = g_sim.cycles;
+        s_setupWrites = g_sim.reg_writes;
+        s_firstWork = g_sim.cycles - g_sim.delay_cycles - g_sim.sleep_cycles;
+        s_firstSleep = g_sim.sleep_cycles;
+        s_firstCycles = g_sim.cycles;
+        s_firstUj = g_sim.energy_uj;
+    }
+    else
+    {
+        uint64_t interval = g_sim.time_ps - s_lastPs;
+        uint64_t deviation = (interval > HALF_PERIOD_PS)
+                                 ? interval - HALF_PERIOD_PS
+                                 : HALF_PERIOD_PS - interval;
+
+        if (deviation > s_maxDeviationPs)
+        {
+            s_maxDeviationPs = deviation;
+        }
+    }
+    s_lastPs = g_sim.time_ps;
+    s_toggles++;
+}
+
+static void run_blinky(void)
+{
+    (void)blinky_main();
+}
+
+static void run_blinky_power(void)
+{
+    (void)blinky_power_main();
+}
+
+static void run_blinky_wave(void)
+{
+    (void)blinky_wave_main();
+}
+
+/**
+ * The original Lab2 loop: SysCtlDelay() busy-waits between toggles.
+ */
+static void run_busy_wait(void)
+{
+    uint32_t ui32SysClock;
+
+    ui32SysClock = SysCtlClockFreqSet((SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                                       SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240),
+                                      120000000);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPION);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_GPION))
+    {
+    }
+    GPIOPinTypeGPIOOutput(GPIO_PORTN_BASE, (GPIO_PIN_0 | GPIO_PIN_1));
+    while (1)
+    {
+        GPIOPinWrite(GPIO_PORTN_BASE, (GPIO_PIN_0 | GPIO_PIN_1), GPIO_PIN_0);
+        SysCtlDelay(ui32SysClock / 6);
+        GPIOPinWrite(GPIO_PORTN_BASE, (GPIO_PIN_0 | GPIO_PIN_1), GPIO_PIN_1);
+        SysCtlDelay(ui32SysClock / 6);
+    }
+}
+
+static void run_case(const blinky_case_t *c)
+{
+    uint64_t work;
+    uint64_t writes;
+    uint64_t cycles;
+    uint64_t sleep;
+    double energy;
+
+    sim_reset();
+    s_toggles = 0;
+    s_maxDeviationPs = 0;
+    sim_set_gpio_hook(on_gpio);
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (!sim_run(c->entry) || s_toggles < 2)
+    {
+        bench_fail(c->name, "no_steady_state");
+        return;
+    }
+
+    /* steady state: from the first toggle up to the end of the run */
+    work = (g_sim.cycles - g_sim.delay_cycles - g_sim.sleep_cycles) - s_firstWork;
+    writes = g_sim.reg_writes - s_setupWrites;
+    cycles = g_sim.cycles - s_firstCycles;
+    sleep = g_sim.sleep_cycles - s_firstSleep;
+    energy = g_sim.energy_uj - s_firstUj;
+
+    bench_report(c->name, "setup_cycles", (double)s_setupCycles,
+                 c->setup_cycles);
+    bench_report(c->name, "setup_reg_writes", (double)s_setupWrites,
+                 c->setup_writes);
+    bench_report(c->name, "work_cycles/toggle", (double)work / s_toggles,
+                 c->toggle_cycles);
+    bench_report(c->name, "reg_writes/toggle", (double)writes / s_toggles,
+                 c->toggle_writes);
+    bench_report(c->name, "jitter_max_us", (double)s_maxDeviationPs / 1e6,
+                 c->jitter_us);
+    bench_report(c->name, "cpu_busy_%",
+                 100.0 * (double)(cycles - sleep) / (double)cycles,
+                 BENCH_NO_BUDGET);
+    bench_report(c->name, "uJ/toggle", energy / s_toggles, BENCH_NO_BUDGET);
+}
+
+void bench_blinky(void)
+{
+    static const blinky_case_t cases[] =
+    {
+        { "blinky.busy_wait", run_busy_wait, 34000, 24, 10, 1, 1 },
+        { "blinky",           run_blinky,    34400, 32, 280, 17, 1 },
+        { "blinky.governor",  run_blinky_power, 34400, 32, 850, 23, 110 },
+        { "blinky.wave",      run_blinky_wave, 34400, 48, 5, 1, 1 },
+    };
+    unsigned i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        run_case(&cases[i]);
+    }
+    /* blinky.wave leaves its pattern on timer 0 in common/wave.c's state */
+    wave_pattern_stop(TIMER0_BASE);
+}
@@ -0,0 +1,145 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_boot.c
+ * @author   insert authors names here
+ * @brief    Reset-to-first-useful-work time of Lab2/src/blinky.c, built
+ *           normally and with BOOT_FAST=1 (common/boot.h). \n
+ *           The timeline starts at main() on the host: the C start-up
+ *           (data copy, .bss zeroing, constructors) and the stack painting
+ *           are not modelled, so "main" is 0 here and only a board capture
+ *           (boot_report()) shows them. Times are those of the simulated
+ *           clock: PIOSC until the PLL is locked, then 120 MHz.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "common/boot.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Long enough to reach the first LED toggle and the first sleep. */
+#define RUN_CYCLES          2000000ull
+
+#define REPORT_SIZE         256u
+
+typedef struct
+{
+    const char *name;
+    const char *config;
+    void      (*entry)(void);
+    double      ready_us;       /**< budget */
+} boot_case_t;
+
+/** main() of Lab2/src/blinky.c, renamed by the build, normal and fast. */
+int blinky_main(void);
+int blinky_fast_main(void);
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static char     s_report[REPORT_SIZE];
+static uint32_t s_length;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void run_standard(void)
+{
+    (void)blinky_main();
+}
+
+static void run_fast(void)
+{
+    (void)blinky_fast_main();
+}
+
+static void report_sink(const void *data, uint32_t length)
+{
+    if (length > sizeof(s_report) - 1u - s_length)
+    {
+        length = sizeof(s_report) - 1u - s_length;
+    }
+    memcpy(&s_report[s_length], data, length);
+    s_length += length;
+    s_report[s_length] = '\0';
+}
+
+static void run_case(const boot_case_t *c)
+{
+    uint32_t i;
+
+    sim_reset();
+    boot_start();
+    sim_stop_at_cycle(RUN_CYCLES);
+    (void)sim_run(c->entry);
+
+    if (g_boot.marked != (1u << BOOT_PHASES) - 1u)
+    {
+        bench_fail(c->name, "phase_not_reached");
+        return;
+    }
+    for (i = 1; i < BOOT_PHASES; i++)
+    {
+        if (g_boot.ns[i] < g_boot.ns[i - 1u])
+        {
+            bench_fail(c->name, "timeline_not_monotonic");
+            return;
+        }
+    }
+    s_length = 0;
+    boot_report(report_sink, c->config);
+    if (strncmp(s_report, "boot,", 5) != 0 || strstr(s_report, "end,5\n") == NULL)
+    {
+        bench_fail(c->name, "bad_report");
+        return;
+    }
+
+    bench_report(c->name, "clock_us", g_boot.ns[BOOT_CLOCK] / 1e3,
+                 BENCH_NO_BUDGET);
+    bench_report(c->name, "periph_us", g_boot.ns[BOOT_PERIPH] / 1e3,
+                 BENCH_NO_BUDGET);
+    bench_report(c->name, "ready_us", g_boot.ns[BOOT_READY] / 1e3,
+                 c->ready_us);
+    bench_report(c->name, "ready_cycles", g_boot.cycles[BOOT_READY],
+                 BENCH_NO_BUDGET);
+}
+
+void bench_boot(void)
+{
+    static const boot_case_t cases[] =
+    {
+        { "boot.standard", "standard", run_standard, 2100.0 },
+        { "boot.fast",     "fast",     run_fast,     2020.0 },
+    };
+    unsigned i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        run_case(&cases[i]);
+    }
+}
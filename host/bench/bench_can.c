@@ -0,0 +1,743 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_can.c
+ * @author   insert authors names here
+ * @brief    common/can_bus.c on the virtual CAN bus of host/sim/can.c. \n
+ *           All cases run the bus at 1 Mbit/s with frames back to back.\n
+ *           "can.filter" opens CAN0 with 40 filters - more than there are
+ *           receive objects, so groups are merged - and puts every standard
+ *           identifier and a range of extended ones on the bus: the frames
+ *           received must be exactly those a filter takes, each with the
+ *           index of that filter.\n
+ *           "can.rx.naive" and "can.rx.hw" receive the same saturated
+ *           traffic, half of it for us, while the application masks
+ *           interrupts for 250 us every 2 ms. naive is the usual first
+ *           driver: one object takes every frame, one frame per interrupt,
+ *           filters in software. hw is can_bus.c. Reported: frames
+ *           delivered per second, interrupts per delivered frame, frames
+ *           lost (overwritten in the controller or the ring; must be 0 for
+ *           hw), worst latency from the end of the frame on the bus to
+ *           can_recv(), and the core time the driver takes (sleep and the
+ *           masked sections excluded).\n
+ *           "can.tx" sends a burst from CAN0 to CAN1 with interrupts
+ *           masked: frames with one identifier must arrive in send order,
+ *           and no frame may follow more than CAN_BUS_TX_OBJECTS of lower
+ *           priority. Then CAN0 keeps its queue full of low-priority frames
+ *           and sends a high-priority one every millisecond; its worst
+ *           latency from can_send() to the end of the frame must stay
+ *           within CAN_BUS_TX_OBJECTS + 2 frame times.\n
+ *           Cycles are the simulator's model of the driverlib calls and
+ *           exceptions; the driver's own C code is not charged.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "inc/hw_can.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/can.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "common/can_bus.h"
+#include "common/vtable.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+#define BITRATE             1000000u
+/** Safety stop: 2 s of simulated time. */
+#define RUN_CYCLES          240000000ull
+
+#define FILTERS             40u
+#define EXACT_FILTERS       32u
+#define EXT_FILTERS         4u
+#define RANGE_FILTERS       4u
+#define NO_FILTER           0xFFFFFFFFu
+
+/** Frames of the filter case: every standard identifier, then extended. */
+#define STD_IDS             2048u
+#define EXT_IDS             48u
+#define FILTER_FRAMES       (STD_IDS + EXT_IDS)
+
+#define RX_FRAMES           4000u
+/** Frames the consumer takes per call. */
+#define RX_BATCH            16u
+/** Interrupts masked by the application, and how often. */
+#define BLOCK_US            250u
+#define BLOCK_PERIOD_US     2000u
+#define NAIVE_RING          64u
+
+#define ORDER_FRAMES        24u
+#define HIGH_FRAMES         64u
+#define HIGH_ID             0x010u
+#define HIGH_PERIOD_US      1000u
+#define LOW_ID              0x700u
+/** Low-priority frames kept queued during the latency case. */
+#define LOW_BACKLOG         12u
+
+/** Budgets, slightly above the current figures. */
+#define BUDGET_RX_LATENCY_US    300.0
+#define BUDGET_IRQS_PER_FRAME   1.35
+
+typedef uint32_t (*recv_fn_t)(can_frame_t *frames, uint32_t max);
+
+typedef enum
+{
+    TRAFFIC_FILTER,
+    TRAFFIC_RX,
+} traffic_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static can_filter_t s_filters[FILTERS];
+
+/* traffic put on the bus by the other nodes */
+static traffic_t s_traffic;
+static uint32_t  s_trafficCount;
+static uint32_t  s_nextFrame;
+static uint64_t  s_firstStart;
+static uint64_t  s_lastEnd;
+static uint64_t  s_end[FILTER_FRAMES > RX_FRAMES ? FILTER_FRAMES : RX_FRAMES];
+
+/* consumer */
+static recv_fn_t s_recv;
+static bool      s_blocking;
+static uint64_t  s_nextBlock;
+static uint32_t  s_received;
+static uint32_t  s_wrongFilter;
+static uint64_t  s_worstLatency;
+static uint32_t  s_perFilter[FILTERS];
+
+/* naive driver */
+static can_frame_t s_naiveRing[NAIVE_RING];
+static uint32_t    s_naiveHead;
+static uint32_t    s_naiveTail;
+static uint32_t    s_naiveIrqs;
+static uint32_t    s_naiveFull;
+
+/* TX case */
+static can_frame_t s_order[ORDER_FRAMES];
+static uint32_t    s_orderCount;
+static uint64_t    s_highAt[HIGH_FRAMES];
+static uint32_t    s_highSeen;
+static uint64_t    s_highWorst;
+
+static const char *s_failure;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void filters_init(void)
+{
+    uint32_t i;
+    uint32_t n = 0u;
+
+    for (i = 0; i < EXACT_FILTERS; i++, n++)
+    {
+        s_filters[n].id = 0x100u + 3u * i;
+        s_filters[n].mask = 0x7FFu;
+        s_filters[n].flags = 0u;
+    }
+    for (i = 0; i < EXT_FILTERS; i++, n++)
+    {
+        s_filters[n].id = 0x18FF0000u | (i << 8);
+        s_filters[n].mask = 0x1FFFFF00u;
+        s_filters[n].flags = CAN_FRAME_EXT;
+    }
+    for (i = 0; i < RANGE_FILTERS; i++, n++)
+    {
+        s_filters[n].id = 0x600u + 0x20u * i;
+        s_filters[n].mask = 0x7F8u;
+        s_filters[n].flags = 0u;
+    }
+}
+
+/** @returns uint32_t - the filter that takes the frame, NO_FILTER if none */
+static uint32_t reference_filter(uint32_t id, bool ext)
+{
+    uint32_t i;
+
+    for (i = 0; i < FILTERS; i++)
+    {
+        const can_filter_t *f = &s_filters[i];
+
+        if (((f->flags & CAN_FRAME_EXT) != 0u) == ext &&
+            ((id ^ f->id) & f->mask) == 0u)
+        {
+            return i;
+        }
+    }
+    return NO_FILTER;
+}
+
+/** Frame @p k of the current traffic; its number is in data[0..3]. */
+static void traffic_frame(uint32_t k, sim_can_frame_t *f)
+{
+    uint32_t j = k / 4u;
+
+    if (s_traffic == TRAFFIC_FILTER)
+    {
+        f->ext = (k >= STD_IDS);
+        f->id = f->ext ? 0x18FF0000u + (k - STD_IDS) * 0x40u : k;
+    }
+    else
+    {
+        switch (k % 4u)
+        {
+        case 0u:        /* exact filters, walked with a stride of 7 */
+            f->ext = false;
+            f->id = 0x100u + 3u * ((j * 7u) % EXACT_FILTERS);
+            break;
+        case 1u:        /* next to them: merged groups let some in */
+            f->ext = false;
+            f->id = 0x101u + 3u * (j % EXACT_FILTERS);
+            break;
+        case 2u:        /* half of the extended frames match */
+            f->ext = true;
+            f->id = 0x18FF0000u | ((j % 8u) << 8) | (j & 0xFFu);
+            break;
+        default:        /* standard ranges and the gaps between them */
+            f->ext = false;
+            f->id = 0x600u + 0x10u * (j % 8u) + (j & 7u);
+            break;
+        }
+    }
+    f->len = 8u;
+    memset(f->data, 0xA5, sizeof(f->data));
+    f->data[0] = (uint8_t)k;
+    f->data[1] = (uint8_t)(k >> 8);
+    f->data[2] = (uint8_t)(k >> 16);
+    f->data[3] = (uint8_t)(k >> 24);
+}
+
+static uint32_t frame_number(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+           ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void inject_next(void)
+{
+    sim_can_frame_t f;
+
+    if (s_nextFrame < s_trafficCount)
+    {
+        traffic_frame(s_nextFrame++, &f);
+        (void)sim_can_inject(&f, 0u);
+    }
+}
+
+static void on_bus(uint32_t node, const sim_can_frame_t *frame, uint64_t start,
+                   uint64_t end)
+{
+    if (node == SIM_CAN_EXTERNAL)
+    {
+        uint32_t k = frame_number(frame->data);
+
+        if (k == 0u)
+        {
+            s_firstStart = start;
+        }
+        s_end[k] = end;
+        s_lastEnd = end;
+        inject_next();
+    }
+    else if (node == 0u && frame->id == HIGH_ID)
+    {
+        uint64_t latency = end - s_highAt[frame->data[0]];
+
+        s_highWorst = (latency > s_highWorst) ? latency : s_highWorst;
+        s_highSeen++;
+    }
+}
+
+/** Starts the traffic: two frames waiting keep the bus busy. */
+static void traffic_start(traffic_t traffic, uint32_t count)
+{
+    s_traffic = traffic;
+    s_trafficCount = count;
+    s_nextFrame = 0u;
+    sim_can_set_tx_hook(on_bus);
+    inject_next();
+    inject_next();
+}
+
+static uint32_t start_clock(void)
+{
+    return SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                              SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240, CLOCK_HZ);
+}
+
+static uint32_t recv_hw(can_frame_t *frames, uint32_t max)
+{
+    return can_recv_n(0u, frames, max);
+}
+
+/** Application work with interrupts masked, BLOCK_US every BLOCK_PERIOD_US. */
+static void app_block(void)
+{
+    if (s_blocking && g_sim.cycles >= s_nextBlock)
+    {
+        bool masked = IntMasterDisable();
+
+        SysCtlDelay(BLOCK_US * (CLOCK_HZ / 1000000u) / 3u);
+        if (!masked)
+        {
+            IntMasterEnable();
+        }
+        s_nextBlock += (uint64_t)BLOCK_PERIOD_US * (CLOCK_HZ / 1000000u);
+    }
+}
+
+/** Takes frames until the bus falls silent (the idle core stops the run). */
+static void consume(void)
+{
+    for (;;)
+    {
+        can_frame_t frames[RX_BATCH];
+        uint32_t n;
+        uint32_t i;
+
+        IntMasterDisable();
+        n = s_recv(frames, RX_BATCH);
+        if (n == 0u)
+        {
+            SysCtlSleep();
+        }
+        IntMasterEnable();
+
+        for (i = 0; i < n; i++)
+        {
+            const can_frame_t *f = &frames[i];
+            uint32_t k = frame_number(f->data);
+            uint32_t expect = reference_filter(f->id,
+                                               (f->flags & CAN_FRAME_EXT) != 0u);
+            uint64_t latency = g_sim.cycles - s_end[k];
+
+            if (expect == NO_FILTER || f->filter != expect)
+            {
+                s_wrongFilter++;
+            }
+            else
+            {
+                s_perFilter[expect]++;
+            }
+            s_worstLatency = (latency > s_worstLatency) ? latency : s_worstLatency;
+            s_received++;
+        }
+        app_block();
+    }
+}
+
+static void consumer_reset(recv_fn_t recv, bool blocking)
+{
+    s_recv = recv;
+    s_blocking = blocking;
+    s_nextBlock = g_sim.cycles + (uint64_t)BLOCK_PERIOD_US * (CLOCK_HZ / 1000000u);
+    s_received = 0u;
+    s_wrongFilter = 0u;
+    s_worstLatency = 0u;
+    memset(s_perFilter, 0, sizeof(s_perFilter));
+}
+
+/* -- naive driver: one object for everything, filters in software -------- */
+static void naive_isr(void)
+{
+    tCANMsgObject msg;
+    can_frame_t *slot = &s_naiveRing[s_naiveHead % NAIVE_RING];
+    uint32_t obj;
+    uint32_t i;
+
+    s_naiveIrqs++;
+    obj = CANIntStatus(CAN0_BASE, CAN_INT_STS_CAUSE);
+    if (obj == 0u || obj == CAN_INT_INTID_STATUS)
+    {
+        (void)CANStatusGet(CAN0_BASE, CAN_STS_CONTROL);
+        return;
+    }
+    msg.pui8MsgData = slot->data;
+    CANMessageGet(CAN0_BASE, obj, &msg, true);
+    slot->flags = ((msg.ui32Flags & MSG_OBJ_EXTENDED_ID) != 0u) ?
+                  CAN_FRAME_EXT : 0u;
+    for (i = 0; i < FILTERS; i++)
+    {
+        const can_filter_t *f = &s_filters[i];
+
+        if (f->flags == slot->flags && ((msg.ui32MsgID ^ f->id) & f->mask) == 0u)
+        {
+            break;
+        }
+    }
+    if (i == FILTERS)
+    {
+        return;
+    }
+    if (s_naiveHead - s_naiveTail == NAIVE_RING)
+    {
+        s_naiveFull++;
+        return;
+    }
+    slot->id = msg.ui32MsgID;
+    slot->len = (uint8_t)msg.ui32MsgLen;
+    slot->filter = (uint8_t)i;
+    s_naiveHead++;
+}
+
+static uint32_t recv_naive(can_frame_t *frames, uint32_t max)
+{
+    uint32_t n = 0u;
+
+    while (s_naiveTail != s_naiveHead && n < max)
+    {
+        frames[n++] = s_naiveRing[s_naiveTail++ % NAIVE_RING];
+    }
+    return n;
+}
+
+static void naive_open(uint32_t clock)
+{
+    tCANMsgObject msg;
+
+    s_naiveHead = 0u;
+    s_naiveTail = 0u;
+    s_naiveIrqs = 0u;
+    s_naiveFull = 0u;
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_CAN0);
+    CANInit(CAN0_BASE);
+    CANBitRateSet(CAN0_BASE, clock, BITRATE);
+    msg.ui32MsgID = 0u;
+    msg.ui32MsgIDMask = 0u;
+    msg.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER;
+    msg.ui32MsgLen = 0u;
+    msg.pui8MsgData = NULL;
+    CANMessageSet(CAN0_BASE, 1u, &msg, MSG_OBJ_TYPE_RX);
+    (void)register_isr(INT_CAN0, naive_isr);
+    CANIntEnable(CAN0_BASE, CAN_INT_MASTER | CAN_INT_ERROR);
+    IntEnable(INT_CAN0);
+    CANEnable(CAN0_BASE);
+}
+
+/* -- cases ---------------------------------------------------------------- */
+static void run_filter(void)
+{
+    uint32_t clock = start_clock();
+
+    if (!can_open(0u, clock, BITRATE, s_filters, FILTERS))
+    {
+        s_failure = "open";
+        return;
+    }
+    consumer_reset(recv_hw, false);
+    traffic_start(TRAFFIC_FILTER, FILTER_FRAMES);
+    consume();
+}
+
+static void run_rx_hw(void)
+{
+    uint32_t clock = start_clock();
+
+    if (!can_open(0u, clock, BITRATE, s_filters, FILTERS))
+    {
+        s_failure = "open";
+        return;
+    }
+    consumer_reset(recv_hw, true);
+    traffic_start(TRAFFIC_RX, RX_FRAMES);
+    consume();
+}
+
+static void run_rx_naive(void)
+{
+    naive_open(start_clock());
+    consumer_reset(recv_naive, true);
+    traffic_start(TRAFFIC_RX, RX_FRAMES);
+    consume();
+}
+
+/** Takes what CAN1 received; the first ORDER_FRAMES are kept. */
+static void drain_can1(void)
+{
+    can_frame_t frames[RX_BATCH];
+    uint32_t n;
+    uint32_t i;
+
+    while ((n = can_recv_n(1u, frames, RX_BATCH)) != 0u)
+    {
+        for (i = 0; i < n && s_orderCount < ORDER_FRAMES; i++)
+        {
+            s_order[s_orderCount++] = frames[i];
+        }
+    }
+}
+
+static void sleep_once(void)
+{
+    IntMasterDisable();
+    SysCtlSleep();
+    IntMasterEnable();
+}
+
+static void run_tx(void)
+{
+    static const uint16_t ids[ORDER_FRAMES] =
+    {
+        0x520, 0x300, 0x7F0, 0x120, 0x300, 0x050, 0x6A0, 0x300,
+        0x400, 0x0F0, 0x210, 0x700, 0x011, 0x388, 0x300, 0x5C0,
+        0x150, 0x6FF, 0x022, 0x430, 0x300, 0x0A0, 0x7A0, 0x260,
+    };
+    uint32_t clock = start_clock();
+    uint64_t us = clock / 1000000u;
+    uint64_t nextHigh;
+    uint32_t highSent = 0u;
+    uint32_t low = 0u;
+    can_frame_t f;
+    uint32_t i;
+
+    if (!can_open(0u, clock, BITRATE, NULL, 0u) ||
+        !can_open(1u, clock, BITRATE, NULL, 0u))
+    {
+        s_failure = "open";
+        return;
+    }
+    sim_can_set_tx_hook(on_bus);
+
+    /* a burst queued at once, sent by priority */
+    memset(&f, 0, sizeof(f));
+    f.len = 8u;
+    IntMasterDisable();
+    for (i = 0; i < ORDER_FRAMES; i++)
+    {
+        f.id = ids[i];
+        f.data[0] = (uint8_t)i;
+        (void)can_send(0u, &f);
+    }
+    IntMasterEnable();
+    while (s_orderCount < ORDER_FRAMES)
+    {
+        sleep_once();
+        drain_can1();
+    }
+
+    /* a high-priority frame every millisecond behind a full queue */
+    nextHigh = g_sim.cycles;
+    while (s_highSeen < HIGH_FRAMES)
+    {
+        while (can_tx_pending(0u) < LOW_BACKLOG)
+        {
+            f.id = LOW_ID + (low++ & 7u);
+            (void)can_send(0u, &f);
+        }
+        if (highSent < HIGH_FRAMES && g_sim.cycles >= nextHigh)
+        {
+            f.id = HIGH_ID;
+            f.data[0] = (uint8_t)highSent;
+            s_highAt[highSent++] = g_sim.cycles;
+            (void)can_send(0u, &f);
+            nextHigh += HIGH_PERIOD_US * us;
+        }
+        sleep_once();
+        drain_can1();
+    }
+    sim_stop();
+}
+
+static bool run_case(const char *name, void (*entry)(void))
+{
+    sim_reset();
+    s_failure = NULL;
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (!sim_run(entry) || s_failure != NULL || g_sim.cycles >= RUN_CYCLES)
+    {
+        bench_fail(name, (s_failure != NULL) ? s_failure : "did_not_finish");
+        return false;
+    }
+    return true;
+}
+
+static double to_us(uint64_t cycles)
+{
+    return (double)cycles * 1e6 / CLOCK_HZ;
+}
+
+static void bench_filter(void)
+{
+    uint32_t expected = 0u;
+    uint32_t covered = 0u;
+    sim_can_frame_t f;
+    uint32_t k;
+    uint32_t i;
+
+    s_traffic = TRAFFIC_FILTER;
+    for (k = 0; k < FILTER_FRAMES; k++)
+    {
+        traffic_frame(k, &f);
+        expected += (reference_filter(f.id, f.ext) != NO_FILTER) ? 1u : 0u;
+    }
+    if (!run_case("can.filter", run_filter))
+    {
+        return;
+    }
+    for (i = 0; i < FILTERS; i++)
+    {
+        covered += (s_perFilter[i] != 0u) ? 1u : 0u;
+    }
+    if (s_received != expected || s_wrongFilter != 0u || covered != FILTERS ||
+        g_can[0].rx_lost != 0u || g_can[0].rx_ring_full != 0u)
+    {
+        bench_fail("can.filter", "wrong_frames");
+        return;
+    }
+    bench_report("can.filter", "filters", FILTERS, BENCH_NO_BUDGET);
+    bench_report("can.filter", "groups", g_can[0].rx_groups, BENCH_NO_BUDGET);
+    bench_report("can.filter", "accepted", s_received, BENCH_NO_BUDGET);
+    bench_report("can.filter", "rejected_sw", g_can[0].rx_rejected,
+                 BENCH_NO_BUDGET);
+    bench_report("can.filter", "rejected_hw",
+                 FILTER_FRAMES - s_received - g_can[0].rx_rejected,
+                 BENCH_NO_BUDGET);
+}
+
+static void report_rx(const char *name, uint32_t expected, uint32_t irqs,
+                      uint32_t lost, bool budgets)
+{
+    double seconds = (double)(s_lastEnd - s_firstStart) / CLOCK_HZ;
+    double busy = (double)(g_sim.cycles - g_sim.sleep_cycles -
+                           g_sim.delay_cycles);
+
+    bench_report(name, "bus_frames_per_s", RX_FRAMES / seconds, BENCH_NO_BUDGET);
+    bench_report(name, "frames_per_s", s_received / seconds, BENCH_NO_BUDGET);
+    bench_report(name, "lost", lost, BENCH_NO_BUDGET);
+    bench_report(name, "irqs_per_frame",
+                 (s_received != 0u) ? (double)irqs / s_received : 0.0,
+                 budgets ? BUDGET_IRQS_PER_FRAME : BENCH_NO_BUDGET);
+    bench_report(name, "worst_latency_us", to_us(s_worstLatency),
+                 budgets ? BUDGET_RX_LATENCY_US : BENCH_NO_BUDGET);
+    bench_report(name, "cpu_pct", 100.0 * busy / (double)g_sim.cycles,
+                 BENCH_NO_BUDGET);
+    if (budgets && (s_received != expected || lost != 0u))
+    {
+        bench_fail(name, "frames_lost");
+    }
+    if (s_wrongFilter != 0u)
+    {
+        bench_fail(name, "wrong_filter");
+    }
+}
+
+static void bench_rx(void)
+{
+    uint32_t expected = 0u;
+    sim_can_frame_t f;
+    uint32_t k;
+
+    s_traffic = TRAFFIC_RX;
+    for (k = 0; k < RX_FRAMES; k++)
+    {
+        traffic_frame(k, &f);
+        expected += (reference_filter(f.id, f.ext) != NO_FILTER) ? 1u : 0u;
+    }
+
+    if (run_case("can.rx.naive", run_rx_naive))
+    {
+        report_rx("can.rx.naive", expected, s_naiveIrqs,
+                  sim_can_lost(CAN0_BASE) + s_naiveFull, false);
+    }
+    if (run_case("can.rx.hw", run_rx_hw))
+    {
+        report_rx("can.rx.hw", expected, g_can[0].irqs,
+                  sim_can_lost(CAN0_BASE) + g_can[0].rx_ring_full, true);
+        bench_report("can.rx.hw", "max_batch", g_can[0].rx_batch_max,
+                     BENCH_NO_BUDGET);
+        bench_report("can.rx.hw", "rejected_sw", g_can[0].rx_rejected,
+                     BENCH_NO_BUDGET);
+    }
+}
+
+static void bench_tx(void)
+{
+    sim_can_frame_t longest;
+    uint64_t frameCycles;
+    uint32_t worstInversion = 0u;
+    uint32_t lastSame = 0u;
+    bool ordered = true;
+    double bound;
+    uint32_t p;
+    uint32_t q;
+
+    s_orderCount = 0u;
+    s_highSeen = 0u;
+    s_highWorst = 0u;
+    if (!run_case("can.tx", run_tx))
+    {
+        return;
+    }
+    for (p = 0; p < ORDER_FRAMES; p++)
+    {
+        uint32_t inversions = 0u;
+
+        for (q = 0; q < p; q++)
+        {
+            inversions += (s_order[q].id > s_order[p].id) ? 1u : 0u;
+        }
+        worstInversion = (inversions > worstInversion) ? inversions
+                                                       : worstInversion;
+        if (s_order[p].id == 0x300u)
+        {
+            ordered = ordered && (s_order[p].data[0] >= lastSame);
+            lastSame = s_order[p].data[0];
+        }
+    }
+
+    /* the longest frame of 8 bytes: stuff bits all the way */
+    memset(&longest, 0, sizeof(longest));
+    longest.len = 8u;
+    frameCycles = (uint64_t)sim_can_frame_bits(&longest) * CLOCK_HZ / BITRATE;
+    bound = to_us((CAN_BUS_TX_OBJECTS + 2u) * frameCycles);
+
+    bench_report("can.tx", "max_inversions", worstInversion, BENCH_NO_BUDGET);
+    bench_report("can.tx", "high_worst_latency_us", to_us(s_highWorst), bound);
+    bench_report("can.tx", "frames_sent", g_can[0].tx_frames, BENCH_NO_BUDGET);
+    if (!ordered)
+    {
+        bench_fail("can.tx", "same_id_reordered");
+    }
+    if (worstInversion > CAN_BUS_TX_OBJECTS)
+    {
+        bench_fail("can.tx", "priority_inversion");
+    }
+}
+
+void bench_can(void)
+{
+    filters_init();
+    bench_filter();
+    bench_rx();
+    bench_tx();
+}
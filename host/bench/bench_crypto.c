@@ -0,0 +1,513 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_crypto.c
+ * @author   insert authors names here
+ * @brief    common/crypto.c requests and the crypto_sw.c reference. \n
+ *           "crypto.vectors" submits the published test vectors as one
+ *           batch: SHA-256 (FIPS 180-4 examples), MD5 (RFC 1321 suite),
+ *           AES-128/192/256 (FIPS 197 appendix C, both directions) and the
+ *           ECB, CBC and CTR examples of SP 800-38A; every output and the
+ *           order of the done() calls must match. It also checks a CBC
+ *           message cut into two requests that chain through iv, a CTR
+ *           round trip with a partial block, SHA-256 of a million 'a'
+ *           streamed in odd pieces, and that a batch with one bad request
+ *           is refused whole.\n
+ *           "crypto.<op>" reports the software reference's throughput on
+ *           the host (MB/s and ns/byte); the board figures, and the engines
+ *           against the CPU, come from common/crypto_bench.c.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "common/crypto.h"
+#include "common/crypto_bench.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Safety stop: 1 s of simulated time. */
+#define RUN_CYCLES          120000000ull
+
+#define MAX_BYTES           80u
+#define HASH_VECTORS        (sizeof(s_hashVectors) / sizeof(s_hashVectors[0]))
+#define AES_VECTORS         (sizeof(s_aesVectors) / sizeof(s_aesVectors[0]))
+#define REQUESTS            (HASH_VECTORS + 2u * AES_VECTORS)
+
+#define MILLION             1000000u
+#define CTR_BYTES           37u
+
+#define SPEED_BYTES         (16u * 1024u)
+#define SPEED_REPEAT        64u
+
+typedef struct
+{
+    crypto_op_t op;
+    const char *text;
+    const char *digest;         /**< hex */
+} hash_vector_t;
+
+/** Hex strings; in and out swap for the decrypt direction. */
+typedef struct
+{
+    crypto_op_t op;
+    const char *key;
+    const char *iv;             /**< NULL for ECB */
+    const char *plain;
+    const char *cipher;
+} aes_vector_t;
+
+typedef struct
+{
+    crypto_req_t req;
+    uint8_t      key[32];
+    uint8_t      iv[CRYPTO_AES_BLOCK];
+    uint8_t      in[MAX_BYTES];
+    uint8_t      out[MAX_BYTES];
+    uint8_t      expect[MAX_BYTES];
+    uint32_t     expectLen;
+} slot_t;
+
+typedef struct
+{
+    const char  *name;
+    crypto_op_t  op;
+    uint32_t     keyBytes;
+    bool         decrypt;
+} speed_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const hash_vector_t s_hashVectors[] =
+{
+    { CRYPTO_SHA256, "abc",
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+    { CRYPTO_SHA256, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+    { CRYPTO_SHA256, "",
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { CRYPTO_MD5, "",                "d41d8cd98f00b204e9800998ecf8427e" },
+    { CRYPTO_MD5, "a",               "0cc175b9c0f1b6a831c399e269772661" },
+    { CRYPTO_MD5, "abc",             "900150983cd24fb0d6963f7d28e17f72" },
+    { CRYPTO_MD5, "message digest",  "f96b697d7cb7938d525a2f31aaf161d0" },
+    { CRYPTO_MD5, "abcdefghijklmnopqrstuvwxyz",
+      "c3fcd3d76192e4007dfb496cca67e13b" },
+    { CRYPTO_MD5, "12345678901234567890123456789012345678901234567890"
+                  "123456789012345678901234567890",
+      "57edf4a22be3c955ac49da2e2107b67a" },
+};
+
+#define SP800_KEY   "2b7e151628aed2a6abf7158809cf4f3c"
+#define SP800_PLAIN "6bc1bee22e409f96e93d7e117393172a" \
+                    "ae2d8a571e03ac9c9eb76fac45af8e51" \
+                    "30c81c46a35ce411e5fbc1191a0a52ef" \
+                    "f69f2445df4f9b17ad2b417be66c3710"
+#define SP800_CBC   "7649abac8119b246cee98e9b12e9197d" \
+                    "5086cb9b507219ee95db113a917678b2" \
+                    "73bed6b8e3c1743b7116e69e22229516" \
+                    "3ff1caa1681fac09120eca307586e1a7"
+
+static const aes_vector_t s_aesVectors[] =
+{
+    { CRYPTO_AES_ECB, "000102030405060708090a0b0c0d0e0f", NULL,
+      "00112233445566778899aabbccddeeff", "69c4e0d86a7b0430d8cdb78070b4c55a" },
+    { CRYPTO_AES_ECB, "000102030405060708090a0b0c0d0e0f1011121314151617", NULL,
+      "00112233445566778899aabbccddeeff", "dda97ca4864cdfe06eaf70a0ec0d7191" },
+    { CRYPTO_AES_ECB, "000102030405060708090a0b0c0d0e0f"
+                      "101112131415161718191a1b1c1d1e1f", NULL,
+      "00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089" },
+    { CRYPTO_AES_ECB, SP800_KEY, NULL, SP800_PLAIN,
+      "3ad77bb40d7a3660a89ecaf32466ef97" "f5d3d58503b9699de785895a96fdbaaf"
+      "43b1cd7f598ece23881b00e3ed030688" "7b0c785e27e8ad3f8223207104725dd4" },
+    { CRYPTO_AES_CBC, SP800_KEY, "000102030405060708090a0b0c0d0e0f",
+      SP800_PLAIN, SP800_CBC },
+    { CRYPTO_AES_CTR, SP800_KEY, "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff", SP800_PLAIN,
+      "874d6191b620e3261bef6864990db6ce" "9806f66b7970fdff8617187bb9fffdff"
+      "5ae4df3edbd5d35e5b4f09020db03eab" "1e031dda2fbe03d1792170a0f3009cee" },
+};
+
+static const speed_t s_speeds[] =
+{
+    { "crypto.sha256",         CRYPTO_SHA256,  0u,  false },
+    { "crypto.md5",            CRYPTO_MD5,     0u,  false },
+    { "crypto.aes128_cbc_enc", CRYPTO_AES_CBC, 16u, false },
+    { "crypto.aes128_cbc_dec", CRYPTO_AES_CBC, 16u, true  },
+    { "crypto.aes128_ctr",     CRYPTO_AES_CTR, 16u, false },
+    { "crypto.aes256_ctr",     CRYPTO_AES_CTR, 32u, false },
+};
+
+static slot_t      s_slots[REQUESTS];
+static uint32_t    s_order[REQUESTS];
+static uint32_t    s_done;
+static const char *s_failure;
+static uint8_t     s_speedIn[SPEED_BYTES];
+static uint8_t     s_speedOut[SPEED_BYTES];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** @returns uint32_t - bytes written */
+static uint32_t unhex(const char *hex, uint8_t *out)
+{
+    uint32_t n = 0u;
+
+    while (hex[0] != '\0' && hex[1] != '\0')
+    {
+        uint32_t hi = (hex[0] <= '9') ? (uint32_t)(hex[0] - '0')
+                                      : (uint32_t)(hex[0] - 'a' + 10);
+        uint32_t lo = (hex[1] <= '9') ? (uint32_t)(hex[1] - '0')
+                                      : (uint32_t)(hex[1] - 'a' + 10);
+
+        out[n++] = (uint8_t)((hi << 4) | lo);
+        hex += 2;
+    }
+    return n;
+}
+
+static void on_done(void *arg)
+{
+    s_order[s_done++] = (uint32_t)(uintptr_t)arg;
+}
+
+static void add_hash(uint32_t i, const hash_vector_t *v)
+{
+    slot_t *slot = &s_slots[i];
+
+    memset(slot, 0, sizeof(*slot));
+    slot->req.op = v->op;
+    slot->req.len = (uint32_t)strlen(v->text);
+    memcpy(slot->in, v->text, slot->req.len);
+    slot->expectLen = unhex(v->digest, slot->expect);
+}
+
+static void add_aes(uint32_t i, const aes_vector_t *v, bool decrypt)
+{
+    slot_t *slot = &s_slots[i];
+
+    memset(slot, 0, sizeof(*slot));
+    slot->req.op = v->op;
+    slot->req.decrypt = decrypt;
+    slot->req.key_bytes = unhex(v->key, slot->key);
+    if (v->iv != NULL)
+    {
+        (void)unhex(v->iv, slot->iv);
+    }
+    slot->req.len = unhex(decrypt ? v->cipher : v->plain, slot->in);
+    slot->expectLen = unhex(decrypt ? v->plain : v->cipher, slot->expect);
+}
+
+/** Links the slots into one batch and submits it. */
+static bool vectors_case(void)
+{
+    uint32_t i;
+    uint32_t n = 0u;
+
+    for (i = 0; i < HASH_VECTORS; i++)
+    {
+        add_hash(n++, &s_hashVectors[i]);
+    }
+    for (i = 0; i < AES_VECTORS; i++)
+    {
+        add_aes(n++, &s_aesVectors[i], false);
+        add_aes(n++, &s_aesVectors[i], true);
+    }
+    for (i = 0; i < n; i++)
+    {
+        crypto_req_t *req = &s_slots[i].req;
+
+        req->key = s_slots[i].key;
+        req->iv = s_slots[i].iv;
+        req->in = s_slots[i].in;
+        req->out = s_slots[i].out;
+        req->done = on_done;
+        req->arg = (void *)(uintptr_t)i;
+        req->next = (i + 1u < n) ? &s_slots[i + 1u].req : NULL;
+    }
+    s_done = 0u;
+    if (!crypto_run(&s_slots[0].req) || s_done != n)
+    {
+        return false;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if (s_order[i] != i || s_slots[i].req.pending ||
+            memcmp(s_slots[i].out, s_slots[i].expect, s_slots[i].expectLen) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** SP 800-38A F.2.1 again, as two requests that chain through iv. */
+static bool chain_case(void)
+{
+    crypto_req_t first;
+    crypto_req_t second;
+    uint8_t key[16];
+    uint8_t iv[CRYPTO_AES_BLOCK];
+    uint8_t plain[64];
+    uint8_t cipher[64];
+    uint8_t out[64];
+
+    (void)unhex(SP800_KEY, key);
+    (void)unhex("000102030405060708090a0b0c0d0e0f", iv);
+    (void)unhex(SP800_PLAIN, plain);
+    (void)unhex(SP800_CBC, cipher);
+
+    memset(&first, 0, sizeof(first));
+    first.op = CRYPTO_AES_CBC;
+    first.key = key;
+    first.key_bytes = sizeof(key);
+    first.iv = iv;
+    first.in = plain;
+    first.out = out;
+    first.len = 32u;
+    first.next = &second;
+    second = first;
+    second.next = NULL;
+    second.in = &plain[32];
+    second.out = &out[32];
+
+    return crypto_submit(&first) == CRYPTO_CPU &&
+           memcmp(out, cipher, sizeof(cipher)) == 0;
+}
+
+/** CTR encrypts and decrypts alike; a partial last block included. */
+static bool ctr_case(void)
+{
+    crypto_req_t req;
+    uint8_t key[32];
+    uint8_t counter[CRYPTO_AES_BLOCK];
+    uint8_t plain[CTR_BYTES];
+    uint8_t cipher[CTR_BYTES];
+    uint8_t back[CTR_BYTES];
+    uint32_t i;
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)(3u * i + 1u);
+    }
+    for (i = 0; i < CTR_BYTES; i++)
+    {
+        plain[i] = (uint8_t)(7u * i);
+    }
+    memset(counter, 0xFF, sizeof(counter));     /* wraps after one block */
+
+    memset(&req, 0, sizeof(req));
+    req.op = CRYPTO_AES_CTR;
+    req.key = key;
+    req.key_bytes = sizeof(key);
+    req.iv = counter;
+    req.in = plain;
+    req.out = cipher;
+    req.len = CTR_BYTES;
+    if (!crypto_run(&req) || counter[15] != 2u || memcmp(cipher, plain, 16u) == 0)
+    {
+        return false;
+    }
+    memset(counter, 0xFF, sizeof(counter));
+    req.in = cipher;
+    req.out = back;
+    return crypto_run(&req) && memcmp(back, plain, CTR_BYTES) == 0;
+}
+
+/** A bad request refuses its batch: nothing runs, no done(). */
+static bool invalid_case(void)
+{
+    crypto_req_t hash;
+    crypto_req_t bad;
+    uint8_t key[16] = { 0 };
+    uint8_t iv[CRYPTO_AES_BLOCK] = { 0 };
+    uint8_t data[17] = { 0 };
+    uint8_t digest[CRYPTO_SHA256_BYTES];
+
+    memset(&hash, 0, sizeof(hash));
+    hash.op = CRYPTO_SHA256;
+    hash.in = data;
+    hash.out = digest;
+    hash.len = sizeof(data);
+    hash.done = on_done;
+    hash.next = &bad;
+    memset(&bad, 0, sizeof(bad));
+    bad.op = CRYPTO_AES_CBC;
+    bad.key = key;
+    bad.key_bytes = sizeof(key);
+    bad.iv = iv;
+    bad.in = data;
+    bad.out = data;
+    bad.len = sizeof(data);             /* not whole blocks */
+
+    s_done = 0u;
+    return crypto_submit(&hash) == CRYPTO_INVALID && s_done == 0u &&
+           !hash.pending;
+}
+
+/** One million 'a' in pieces of 1 to 97 bytes (FIPS 180-4 example). */
+static bool stream_case(void)
+{
+    crypto_hash_sw_t ctx;
+    uint8_t digest[CRYPTO_SHA256_BYTES];
+    uint8_t expect[CRYPTO_SHA256_BYTES];
+    uint8_t piece[97];
+    uint32_t left = MILLION;
+    uint32_t size = 1u;
+
+    memset(piece, 'a', sizeof(piece));
+    (void)unhex("cdc76e5c9914fb9281a1c7e284d73e67"
+                "f1809a48a497200e046d39ccc7112cd0", expect);
+    crypto_sha256_init(&ctx);
+    while (left > 0u)
+    {
+        uint32_t n = (size < left) ? size : left;
+
+        crypto_sha256_update(&ctx, piece, n);
+        left -= n;
+        size = size % sizeof(piece) + 1u;
+    }
+    crypto_sha256_final(&ctx, digest);
+    return memcmp(digest, expect, sizeof(expect)) == 0;
+}
+
+static void run_vectors(void)
+{
+    crypto_init();
+    memset(&g_crypto, 0, sizeof(g_crypto));
+
+    if (!vectors_case())
+    {
+        s_failure = "test_vector";
+    }
+    else if (!chain_case())
+    {
+        s_failure = "cbc_chain";
+    }
+    else if (!ctr_case())
+    {
+        s_failure = "ctr_round_trip";
+    }
+    else if (!invalid_case())
+    {
+        s_failure = "invalid_batch";
+    }
+    else if (!stream_case())
+    {
+        s_failure = "sha256_stream";
+    }
+}
+
+static void run_board_bench(void)
+{
+    uint32_t op;
+
+    crypto_bench_run();
+    for (op = 0; op < CRYPTO_BENCH_OPS; op++)
+    {
+        if (g_crypto_bench.name[op] == NULL || g_crypto_bench.hw[op] != 0u)
+        {
+            s_failure = "op_not_run";
+        }
+    }
+}
+
+static bool run_case(const char *name, void (*entry)(void))
+{
+    sim_reset();
+    s_failure = NULL;
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(entry))
+    {
+        bench_fail(name, "did_not_finish");
+        return false;
+    }
+    if (s_failure != NULL)
+    {
+        bench_fail(name, s_failure);
+        return false;
+    }
+    return true;
+}
+
+/** Host throughput of the software reference, outside the simulator. */
+static void bench_speed(const speed_t *s)
+{
+    static const uint8_t key[32] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    uint8_t iv[CRYPTO_AES_BLOCK] = { 0 };
+    uint8_t digest[CRYPTO_SHA256_BYTES];
+    crypto_req_t req;
+    uint64_t start;
+    uint64_t elapsed;
+    double bytes = (double)SPEED_BYTES * SPEED_REPEAT;
+    uint32_t i;
+
+    memset(&req, 0, sizeof(req));
+    req.op = s->op;
+    req.decrypt = s->decrypt;
+    req.key = key;
+    req.key_bytes = s->keyBytes;
+    req.iv = iv;
+    req.in = s_speedIn;
+    req.out = (s->keyBytes == 0u) ? digest : s_speedOut;
+    req.len = SPEED_BYTES;
+
+    start = bench_now_ns();
+    for (i = 0; i < SPEED_REPEAT; i++)
+    {
+        (void)crypto_submit(&req);
+    }
+    elapsed = bench_now_ns() - start;
+    if (elapsed == 0u)
+    {
+        elapsed = 1u;
+    }
+    bench_report(s->name, "host_MB/s", bytes * 1000.0 / (double)elapsed,
+                 BENCH_NO_BUDGET);
+    bench_report(s->name, "host_ns/byte", (double)elapsed / bytes,
+                 BENCH_NO_BUDGET);
+}
+
+void bench_crypto(void)
+{
+    uint32_t i;
+
+    if (run_case("crypto.vectors", run_vectors))
+    {
+        bench_report("crypto.vectors", "requests", g_crypto.cpu_reqs,
+                     BENCH_NO_BUDGET);
+    }
+    (void)run_case("crypto.bench", run_board_bench);
+
+    for (i = 0; i < SPEED_BYTES; i++)
+    {
+        s_speedIn[i] = (uint8_t)(i * 31u);
+    }
+    for (i = 0; i < sizeof(s_speeds) / sizeof(s_speeds[0]); i++)
+    {
+        bench_speed(&s_speeds[i]);
+    }
+}
@@ -0,0 +1,416 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_dma.c
+ * @author   insert authors names here
+ * @brief    common/dma_copy.c on the uDMA model of host/sim/udma.c. \n
+ *           "dma.copy" checks every byte of copies and fills between
+ *           guarded buffers: aligned, each mutual misalignment, a
+ *           scatter-gather rectangle, a job longer than one round, a burst
+ *           that fills pool and queue (the next call must be refused) and a
+ *           bus error that must fail its job only.\n
+ *           "dma.crossover" sends copies of growing size to the uDMA
+ *           (dma_copy_wait(), the core asleep meanwhile) and to the CPU, and
+ *           compares the core cycles each takes: set-up, interrupt and
+ *           wake-up against the modelled memcpy(). The first size where the
+ *           uDMA costs the core less is the crossover; DMA_COPY_MIN_BYTES
+ *           must sit near it. The cycle figures come from the simulator's
+ *           cost model, not from the board.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "common/dma_copy.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+/** Safety stop: 1 s of simulated time. */
+#define RUN_CYCLES          120000000ull
+
+#define BUFFER_SIZE         (64u * 1024u)
+#define GUARD               16u
+#define GUARD_BYTE          0xEEu
+/** Frame buffer of the rectangle copy, bytes per line and lines. */
+#define FRAME_STRIDE        320u
+#define RECT_WIDTH          100u
+#define RECT_LINES          3u
+#define BURST_BYTES         8192u
+/** Jobs accepted at once: one per channel plus the queue. */
+#define BURST_JOBS          (DMA_COPY_CHANNELS + DMA_COPY_QUEUE)
+
+#define SWEEP_SIZES         10u
+#define SWEEP_REPEAT        4u
+/** DMA_COPY_MIN_BYTES may be off the measured crossover by this factor. */
+#define CROSSOVER_SLACK     2u
+
+/** Budgets, slightly above the current figures. */
+#define BUDGET_DMA_BUSY_4K  190.0
+#define BUDGET_DMA_TIME_4K  2800.0
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t  s_src[BUFFER_SIZE];
+static uint8_t  s_dst[GUARD + BUFFER_SIZE + GUARD];
+static uint8_t  s_burst[BURST_JOBS + 1u][BURST_BYTES];
+
+static const uint32_t s_sizes[SWEEP_SIZES] =
+    { 16u, 32u, 64u, 128u, 192u, 256u, 384u, 512u, 1024u, 4096u };
+static uint64_t s_dmaBusy[SWEEP_SIZES];
+static uint64_t s_dmaTime[SWEEP_SIZES];
+static uint64_t s_cpuBusy[SWEEP_SIZES];
+
+static volatile uint32_t s_doneOk;
+static volatile uint32_t s_doneFailed;
+static const char *s_failure;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_done(void *arg, bool ok)
+{
+    (void)arg;
+
+    if (ok)
+    {
+        s_doneOk++;
+    }
+    else
+    {
+        s_doneFailed++;
+    }
+}
+
+static uint32_t start_clock(void)
+{
+    return SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                              SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240, CLOCK_HZ);
+}
+
+/** Sleeps until the pool is idle. */
+static void wait_idle(void)
+{
+    bool masked = IntMasterDisable();
+
+    while (dma_copy_busy())
+    {
+        SysCtlSleep();
+        IntMasterEnable();
+        IntMasterDisable();
+    }
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+static void reset_buffers(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BUFFER_SIZE; i++)
+    {
+        s_src[i] = (uint8_t)(i * 7u + (i >> 8));
+    }
+    memset(s_dst, GUARD_BYTE, sizeof(s_dst));
+    s_doneOk = 0u;
+    s_doneFailed = 0u;
+}
+
+/** @returns bool - true if only dst[at, at + len) changed, to @p expected */
+static bool check(uint32_t at, const uint8_t *expected, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_dst); i++)
+    {
+        bool inside = (i >= GUARD + at && i < GUARD + at + len);
+
+        if (!inside && s_dst[i] != GUARD_BYTE)
+        {
+            return false;
+        }
+    }
+    return memcmp(&s_dst[GUARD + at], expected, len) == 0;
+}
+
+/** One asynchronous copy: @p len bytes from s_src + @p from to s_dst + @p to. */
+static bool copy_case(uint32_t from, uint32_t to, uint32_t len)
+{
+    reset_buffers();
+    if (dma_copy(&s_dst[GUARD + to], &s_src[from], len, on_done, NULL) !=
+        DMA_COPY_STARTED)
+    {
+        return false;
+    }
+    wait_idle();
+    return s_doneOk == 1u && s_doneFailed == 0u &&
+           check(to, &s_src[from], len);
+}
+
+static bool fill_case(void)
+{
+    static uint8_t expected[5003];
+
+    reset_buffers();
+    memset(expected, 0xA5, sizeof(expected));
+    if (dma_fill(&s_dst[GUARD + 1u], 0xA5u, sizeof(expected), on_done, NULL) !=
+        DMA_COPY_STARTED)
+    {
+        return false;
+    }
+    wait_idle();
+    return s_doneOk == 1u && check(1u, expected, sizeof(expected));
+}
+
+/** Three lines of a rectangle into a frame buffer, as one job. */
+static bool rect_case(void)
+{
+    static uint8_t expected[RECT_LINES * FRAME_STRIDE];
+    dma_seg_t segs[RECT_LINES];
+    uint32_t y;
+
+    reset_buffers();
+    memset(expected, GUARD_BYTE, sizeof(expected));
+    for (y = 0; y < RECT_LINES; y++)
+    {
+        segs[y].dst = &s_dst[GUARD + y * FRAME_STRIDE + 13u];
+        segs[y].src = &s_src[y * RECT_WIDTH];
+        segs[y].len = RECT_WIDTH;
+        memcpy(&expected[y * FRAME_STRIDE + 13u], &s_src[y * RECT_WIDTH],
+               RECT_WIDTH);
+    }
+    if (dma_copy_sg(segs, RECT_LINES, on_done, NULL) != DMA_COPY_STARTED)
+    {
+        return false;
+    }
+    wait_idle();
+    return s_doneOk == 1u && check(0u, expected, sizeof(expected));
+}
+
+/** Pool and queue full: the next job is refused, the others complete. */
+static bool burst_case(void)
+{
+    uint32_t i;
+
+    reset_buffers();
+    memset(s_burst, 0, sizeof(s_burst));
+    for (i = 0; i < BURST_JOBS; i++)
+    {
+        if (dma_copy(s_burst[i], &s_src[i], BURST_BYTES, on_done, NULL) !=
+            DMA_COPY_STARTED)
+        {
+            return false;
+        }
+    }
+    if (dma_copy(s_burst[BURST_JOBS], s_src, BURST_BYTES, on_done, NULL) !=
+        DMA_COPY_FULL)
+    {
+        return false;
+    }
+    wait_idle();
+    for (i = 0; i < BURST_JOBS; i++)
+    {
+        if (memcmp(s_burst[i], &s_src[i], BURST_BYTES) != 0)
+        {
+            return false;
+        }
+    }
+    return s_doneOk == BURST_JOBS && s_burst[BURST_JOBS][0] == 0u;
+}
+
+/** A faulting job next to a good one: only the first fails. */
+static bool error_case(void)
+{
+    reset_buffers();
+    if (dma_copy(NULL, s_src, 512u, on_done, NULL) != DMA_COPY_STARTED ||
+        dma_copy(&s_dst[GUARD], s_src, 512u, on_done, NULL) != DMA_COPY_STARTED)
+    {
+        return false;
+    }
+    wait_idle();
+    return s_doneOk == 1u && s_doneFailed == 1u && g_dma_copy.errors == 1u &&
+           check(0u, s_src, 512u);
+}
+
+static void run_copy(void)
+{
+    (void)start_clock();
+    dma_copy_init();
+    memset(&g_dma_copy, 0, sizeof(g_dma_copy));
+
+    if (!copy_case(0u, 0u, 4096u))
+    {
+        s_failure = "aligned";
+    }
+    else if (!copy_case(1u, 0u, 3001u) || !copy_case(3u, 1u, 3001u) ||
+             !copy_case(2u, 0u, 3002u) || !copy_case(0u, 3u, 301u))
+    {
+        s_failure = "misaligned";
+    }
+    else if (!copy_case(5u, 6u, BUFFER_SIZE - 16u))
+    {
+        s_failure = "multi_round";
+    }
+    else if (!fill_case())
+    {
+        s_failure = "fill";
+    }
+    else if (!rect_case())
+    {
+        s_failure = "scatter_gather";
+    }
+    else if (!burst_case())
+    {
+        s_failure = "queue_full";
+    }
+    else if (!error_case())
+    {
+        s_failure = "bus_error";
+    }
+}
+
+static void run_crossover(void)
+{
+    uint32_t i;
+    uint32_t k;
+
+    (void)start_clock();
+    dma_copy_init();
+
+    for (i = 0; i < SWEEP_SIZES; i++)
+    {
+        s_dmaBusy[i] = 0u;
+        s_dmaTime[i] = 0u;
+        s_cpuBusy[i] = 0u;
+        for (k = 0; k < SWEEP_REPEAT; k++)
+        {
+            uint64_t cycles;
+            uint64_t sleep;
+
+            (void)dma_copy_set_min(0u);
+            cycles = g_sim.cycles;
+            sleep = g_sim.sleep_cycles;
+            if (!dma_copy_wait(&s_dst[GUARD], s_src, s_sizes[i]))
+            {
+                s_failure = "wait_failed";
+            }
+            s_dmaTime[i] += g_sim.cycles - cycles;
+            s_dmaBusy[i] += (g_sim.cycles - cycles) -
+                            (g_sim.sleep_cycles - sleep);
+
+            (void)dma_copy_set_min(UINT32_MAX);
+            cycles = g_sim.cycles;
+            (void)dma_copy(&s_dst[GUARD], s_src, s_sizes[i], NULL, NULL);
+            s_cpuBusy[i] += g_sim.cycles - cycles;
+        }
+    }
+    (void)dma_copy_set_min(DMA_COPY_MIN_BYTES);
+}
+
+static bool run_case(const char *name, void (*entry)(void))
+{
+    sim_reset();
+    s_failure = NULL;
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(entry))
+    {
+        bench_fail(name, "did_not_finish");
+        return false;
+    }
+    if (s_failure != NULL)
+    {
+        bench_fail(name, s_failure);
+        return false;
+    }
+    return true;
+}
+
+static void bench_crossover(void)
+{
+    uint32_t crossover = 0u;
+    uint32_t i;
+
+    if (!run_case("dma.crossover", run_crossover))
+    {
+        return;
+    }
+    for (i = 0; i < SWEEP_SIZES && crossover == 0u; i++)
+    {
+        if (s_dmaBusy[i] < s_cpuBusy[i])
+        {
+            crossover = s_sizes[i];
+        }
+    }
+    for (i = 0; i < SWEEP_SIZES; i++)
+    {
+        if (s_sizes[i] == 64u || s_sizes[i] == 256u || s_sizes[i] == 1024u)
+        {
+            char metric[32];
+
+            (void)snprintf(metric, sizeof(metric), "cpu_cycles@%u",
+                           (unsigned int)s_sizes[i]);
+            bench_report("dma.crossover", metric,
+                         (double)s_cpuBusy[i] / SWEEP_REPEAT, BENCH_NO_BUDGET);
+            (void)snprintf(metric, sizeof(metric), "dma_busy_cycles@%u",
+                           (unsigned int)s_sizes[i]);
+            bench_report("dma.crossover", metric,
+                         (double)s_dmaBusy[i] / SWEEP_REPEAT, BENCH_NO_BUDGET);
+        }
+    }
+    bench_report("dma.crossover", "cpu_cycles@4096",
+                 (double)s_cpuBusy[SWEEP_SIZES - 1u] / SWEEP_REPEAT,
+                 BENCH_NO_BUDGET);
+    bench_report("dma.crossover", "dma_busy_cycles@4096",
+                 (double)s_dmaBusy[SWEEP_SIZES - 1u] / SWEEP_REPEAT,
+                 BUDGET_DMA_BUSY_4K);
+    bench_report("dma.crossover", "dma_done_cycles@4096",
+                 (double)s_dmaTime[SWEEP_SIZES - 1u] / SWEEP_REPEAT,
+                 BUDGET_DMA_TIME_4K);
+    bench_report("dma.crossover", "crossover_bytes", crossover,
+                 BENCH_NO_BUDGET);
+    if (crossover == 0u || DMA_COPY_MIN_BYTES > crossover * CROSSOVER_SLACK ||
+        DMA_COPY_MIN_BYTES * CROSSOVER_SLACK < crossover)
+    {
+        bench_fail("dma.crossover", "DMA_COPY_MIN_BYTES_off_crossover");
+    }
+}
+
+void bench_dma(void)
+{
+    if (run_case("dma.copy", run_copy))
+    {
+        bench_report("dma.copy", "rounds", g_dma_copy.rounds, BENCH_NO_BUDGET);
+        bench_report("dma.copy", "queued", g_dma_copy.queued, BENCH_NO_BUDGET);
+    }
+    bench_crossover();
+}
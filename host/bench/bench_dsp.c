@@ -0,0 +1,517 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_dsp.c
+ * @author   insert authors names here
+ * @brief    common/dsp.c kernels against a portable scalar reference. \n
+ *           The reference computes each output directly from its definition
+ *           (natural-order taps, whole signal, no packing, no running sums),
+ *           while the kernels run block by block with sizes that change from
+ *           call to call, so the state carried between blocks is exercised
+ *           too. The input is a full-scale square wave plus noise, which
+ *           drives the Q15/Q31 kernels into saturation. Fixed-point results
+ *           must match bit for bit ("dsp.<kernel>" fails otherwise); the
+ *           float kernels are compared against a double reference with the
+ *           largest error as a budgeted metric. The cycles per sample are
+ *           only meaningful on the board (common/dsp_bench.c).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+
+#include "bench.h"
+#include "common/dsp.h"
+#include "common/dsp_bench.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define SAMPLES             1024u
+#define BLOCK_MAX           64u
+#define TAPS                31u     /* odd: covers the single-tap tail */
+#define STAGES              2u
+#define MAVG                16u
+#define FACTOR              4u
+
+/** Q31 FIR input headroom, log2(TAPS) rounded up (see dsp.h). */
+#define Q31_FIR_SHIFT       5
+
+/** Largest float error against the double reference. */
+#define BUDGET_F32_ERROR    1e-5
+#define BUDGET_F32_BIQUAD   1e-4
+
+/** Low-pass at fs/8, then a gain stage that makes the output saturate. */
+#define BIQUAD_COEFFS                                       \
+    0.0976310729, 0.1952621459, 0.0976310729, 0.9428090416, -0.3333333333, \
+    1.9, -0.5, 0.1, 0.5, -0.25
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const double s_biquad[STAGES * DSP_BIQUAD_COEFFS] = { BIQUAD_COEFFS };
+
+/** Block sizes cycled through; multiples of FACTOR for the decimators. */
+static const uint32_t s_blocks[] = { 1, 7, 64, 2, 33, 16, 5 };
+static const uint32_t s_decimBlocks[] = { 4, 64, 12, 32, 8 };
+
+#define BLOCK_SIZES         (sizeof(s_blocks) / sizeof(s_blocks[0]))
+#define DECIM_SIZES         (sizeof(s_decimBlocks) / sizeof(s_decimBlocks[0]))
+
+static double  s_firReal[TAPS];     /**< reverse time order, as in dsp.h */
+static int16_t s_firQ15[TAPS];
+static int32_t s_firQ31[TAPS];
+static float   s_firF32[TAPS];
+
+static int16_t s_inQ15[SAMPLES];
+static int32_t s_inQ31[SAMPLES];
+static float   s_inF32[SAMPLES];
+
+static int16_t s_outQ15[SAMPLES];
+static int32_t s_outQ31[SAMPLES];
+static float   s_outF32[SAMPLES];
+static int16_t s_refQ15[SAMPLES];
+static int32_t s_refQ31[SAMPLES];
+static double  s_refF64[SAMPLES];
+
+static int16_t s_stateQ15[DSP_FIR_STATE(TAPS, BLOCK_MAX)];
+static int32_t s_stateQ31[DSP_FIR_STATE(TAPS, BLOCK_MAX)];
+static float   s_stateF32[DSP_FIR_STATE(TAPS, BLOCK_MAX)];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static int64_t sat(int64_t v, int64_t min, int64_t max)
+{
+    return (v < min) ? min : (v > max) ? max : v;
+}
+
+/**
+ * Asymmetric taps (so that a reversed order would show) with a sum of
+ * magnitudes around 1.5, and a square wave at full scale plus noise.
+ */
+static void fill_data(void)
+{
+    uint32_t seed = 1u;
+    uint32_t i;
+
+    for (i = 0; i < TAPS; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        s_firReal[i] = ((double)(int32_t)seed / 2147483648.0) * 3.0 / TAPS;
+        s_firQ15[i] = DSP_Q15(s_firReal[i]);
+        s_firQ31[i] = DSP_Q31(s_firReal[i]);
+        s_firF32[i] = (float)s_firReal[i];
+    }
+    for (i = 0; i < SAMPLES; i++)
+    {
+        int32_t square = ((i / 50u) & 1u) ? -30000 : 30000;
+
+        seed = seed * 1664525u + 1013904223u;
+        s_inQ15[i] = (int16_t)sat(square + ((int32_t)seed >> 20), INT16_MIN,
+                                  INT16_MAX);
+        s_inQ31[i] = (int32_t)((uint32_t)s_inQ15[i] << 16) | (seed & 0xFFFFu);
+        s_inF32[i] = (float)s_inQ15[i] / 32768.0f;
+    }
+}
+
+/** FIR output at input @p n, from the definition. */
+static int64_t ref_fir_int(const int32_t *h, const void *x, int bits,
+                           uint32_t n)
+{
+    int64_t acc = 0;
+    uint32_t j;
+
+    /* h is in reverse time order: h[TAPS-1-j] multiplies x[n-j] */
+    for (j = 0; j < TAPS && j <= n; j++)
+    {
+        int64_t v = (bits == 16) ? ((const int16_t *)x)[n - j]
+                                 : ((const int32_t *)x)[n - j];
+
+        acc += h[TAPS - 1u - j] * v;
+    }
+    return acc;
+}
+
+static double ref_fir_real(const float *x, uint32_t n)
+{
+    double acc = 0.0;
+    uint32_t j;
+
+    for (j = 0; j < TAPS && j <= n; j++)
+    {
+        acc += (double)s_firF32[TAPS - 1u - j] * x[n - j];
+    }
+    return acc;
+}
+
+static void ref_biquad_int(const int64_t *c, int shift, int64_t min,
+                           int64_t max, const int64_t *in, int64_t *out)
+{
+    uint32_t s;
+    uint32_t n;
+
+    memcpy(out, in, SAMPLES * sizeof(*out));
+    for (s = 0; s < STAGES; s++)
+    {
+        const int64_t *k = &c[s * DSP_BIQUAD_COEFFS];
+        int64_t x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+        for (n = 0; n < SAMPLES; n++)
+        {
+            int64_t x = out[n];
+            int64_t y = sat((k[0] * x + k[1] * x1 + k[2] * x2 + k[3] * y1 +
+                             k[4] * y2) >> shift, min, max);
+
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            out[n] = y;
+        }
+    }
+}
+
+static uint32_t count_q15(const int16_t *a, const int16_t *b, uint32_t n)
+{
+    uint32_t bad = 0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        bad += (a[i] != b[i]);
+    }
+    return bad;
+}
+
+static uint32_t count_q31(const int32_t *a, const int32_t *b, uint32_t n)
+{
+    uint32_t bad = 0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        bad += (a[i] != b[i]);
+    }
+    return bad;
+}
+
+static double max_error(const float *a, const double *b, uint32_t n)
+{
+    double worst = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        double e = (a[i] > b[i]) ? a[i] - b[i] : b[i] - a[i];
+
+        worst = (e > worst) ? e : worst;
+    }
+    return worst;
+}
+
+static void report_exact(const char *bench, uint32_t bad, uint32_t n)
+{
+    if (bad != 0u)
+    {
+        bench_fail(bench, "not_bit_exact");
+        return;
+    }
+    bench_report(bench, "bit_exact_samples", n, BENCH_NO_BUDGET);
+}
+
+static void check_fir(void)
+{
+    int32_t h15[TAPS];
+    int32_t h31[TAPS];
+    int32_t in31[SAMPLES];
+    dsp_fir_q15_t q15;
+    dsp_fir_q31_t q31;
+    dsp_fir_f32_t f32;
+    uint32_t n;
+    uint32_t b;
+
+    for (n = 0; n < TAPS; n++)
+    {
+        h15[n] = s_firQ15[n];
+        h31[n] = s_firQ31[n];
+    }
+    for (n = 0; n < SAMPLES; n++)
+    {
+        in31[n] = s_inQ31[n] >> Q31_FIR_SHIFT;
+        s_refQ15[n] = (int16_t)sat(ref_fir_int(h15, s_inQ15, 16, n) >> 15,
+                                   INT16_MIN, INT16_MAX);
+        s_refQ31[n] = (int32_t)sat(ref_fir_int(h31, in31, 32, n) >> 31,
+                                   INT32_MIN, INT32_MAX);
+        s_refF64[n] = ref_fir_real(s_inF32, n);
+    }
+
+    dsp_fir_q15_init(&q15, s_firQ15, TAPS, s_stateQ15);
+    dsp_fir_q31_init(&q31, s_firQ31, TAPS, s_stateQ31);
+    dsp_fir_f32_init(&f32, s_firF32, TAPS, s_stateF32);
+    for (n = 0, b = 0; n < SAMPLES; n += s_blocks[b], b = (b + 1u) % BLOCK_SIZES)
+    {
+        uint32_t count = (SAMPLES - n < s_blocks[b]) ? SAMPLES - n : s_blocks[b];
+
+        dsp_fir_q15(&q15, &s_inQ15[n], &s_outQ15[n], count);
+        dsp_fir_q31(&q31, &in31[n], &s_outQ31[n], count);
+        dsp_fir_f32(&f32, &s_inF32[n], &s_outF32[n], count);
+    }
+    report_exact("dsp.fir_q15", count_q15(s_outQ15, s_refQ15, SAMPLES), SAMPLES);
+    report_exact("dsp.fir_q31", count_q31(s_outQ31, s_refQ31, SAMPLES), SAMPLES);
+    bench_report("dsp.fir_f32", "max_abs_error",
+                 max_error(s_outF32, s_refF64, SAMPLES), BUDGET_F32_ERROR);
+}
+
+static void check_decim(void)
+{
+    int32_t h15[TAPS];
+    int32_t h31[TAPS];
+    int32_t in31[SAMPLES];
+    dsp_decim_q15_t q15;
+    dsp_decim_q31_t q31;
+    dsp_decim_f32_t f32;
+    const uint32_t outputs = SAMPLES / FACTOR;
+    uint32_t n;
+    uint32_t b;
+
+    for (n = 0; n < TAPS; n++)
+    {
+        h15[n] = s_firQ15[n];
+        h31[n] = s_firQ31[n];
+    }
+    for (n = 0; n < SAMPLES; n++)
+    {
+        in31[n] = s_inQ31[n] >> Q31_FIR_SHIFT;
+    }
+    /* output o is the filter output at the last input of its group */
+    for (n = 0; n < outputs; n++)
+    {
+        uint32_t at = n * FACTOR + FACTOR - 1u;
+
+        s_refQ15[n] = (int16_t)sat(ref_fir_int(h15, s_inQ15, 16, at) >> 15,
+                                   INT16_MIN, INT16_MAX);
+        s_refQ31[n] = (int32_t)sat(ref_fir_int(h31, in31, 32, at) >> 31,
+                                   INT32_MIN, INT32_MAX);
+        s_refF64[n] = ref_fir_real(s_inF32, at);
+    }
+
+    dsp_decim_q15_init(&q15, FACTOR, s_firQ15, TAPS, s_stateQ15);
+    dsp_decim_q31_init(&q31, FACTOR, s_firQ31, TAPS, s_stateQ31);
+    dsp_decim_f32_init(&f32, FACTOR, s_firF32, TAPS, s_stateF32);
+    for (n = 0, b = 0; n < SAMPLES; n += s_decimBlocks[b], b = (b + 1u) % DECIM_SIZES)
+    {
+        uint32_t count = (SAMPLES - n < s_decimBlocks[b]) ? SAMPLES - n
+                                                          : s_decimBlocks[b];
+
+        dsp_decim_q15(&q15, &s_inQ15[n], &s_outQ15[n / FACTOR], count);
+        dsp_decim_q31(&q31, &in31[n], &s_outQ31[n / FACTOR], count);
+        dsp_decim_f32(&f32, &s_inF32[n], &s_outF32[n / FACTOR], count);
+    }
+    report_exact("dsp.decim_q15", count_q15(s_outQ15, s_refQ15, outputs), outputs);
+    report_exact("dsp.decim_q31", count_q31(s_outQ31, s_refQ31, outputs), outputs);
+    bench_report("dsp.decim_f32", "max_abs_error",
+                 max_error(s_outF32, s_refF64, outputs), BUDGET_F32_ERROR);
+}
+
+static void check_biquad(void)
+{
+    static int64_t in[SAMPLES];
+    static int64_t ref[SAMPLES];
+    int16_t c15[STAGES * DSP_BIQUAD_COEFFS];
+    int32_t c31[STAGES * DSP_BIQUAD_COEFFS];
+    float   cf[STAGES * DSP_BIQUAD_COEFFS];
+    int64_t k15[STAGES * DSP_BIQUAD_COEFFS];
+    int64_t k31[STAGES * DSP_BIQUAD_COEFFS];
+    int16_t st15[STAGES * DSP_BIQUAD_STATE];
+    int32_t st31[STAGES * DSP_BIQUAD_STATE];
+    float   stf[STAGES * DSP_BIQUAD_STATE_F32];
+    dsp_biquad_q15_t q15;
+    dsp_biquad_q31_t q31;
+    dsp_biquad_f32_t f32;
+    uint32_t n;
+    uint32_t b;
+
+    for (n = 0; n < STAGES * DSP_BIQUAD_COEFFS; n++)
+    {
+        c15[n] = DSP_Q14(s_biquad[n]);
+        c31[n] = DSP_Q30(s_biquad[n]);
+        cf[n] = (float)s_biquad[n];
+        k15[n] = c15[n];
+        k31[n] = c31[n];
+    }
+
+    for (n = 0; n < SAMPLES; n++)
+    {
+        in[n] = s_inQ15[n];
+    }
+    ref_biquad_int(k15, 14, INT16_MIN, INT16_MAX, in, ref);
+    for (n = 0; n < SAMPLES; n++)
+    {
+        s_refQ15[n] = (int16_t)ref[n];
+        in[n] = s_inQ31[n];
+    }
+    ref_biquad_int(k31, 30, INT32_MIN, INT32_MAX, in, ref);
+    for (n = 0; n < SAMPLES; n++)
+    {
+        s_refQ31[n] = (int32_t)ref[n];
+    }
+
+    dsp_biquad_q15_init(&q15, c15, STAGES, st15);
+    dsp_biquad_q31_init(&q31, c31, STAGES, st31);
+    dsp_biquad_f32_init(&f32, cf, STAGES, stf);
+    for (n = 0, b = 0; n < SAMPLES; n += s_blocks[b], b = (b + 1u) % BLOCK_SIZES)
+    {
+        uint32_t count = (SAMPLES - n < s_blocks[b]) ? SAMPLES - n : s_blocks[b];
+
+        dsp_biquad_q15(&q15, &s_inQ15[n], &s_outQ15[n], count);
+        dsp_biquad_q31(&q31, &s_inQ31[n], &s_outQ31[n], count);
+        dsp_biquad_f32(&f32, &s_inF32[n], &s_outF32[n], count);
+    }
+    report_exact("dsp.biquad_q15", count_q15(s_outQ15, s_refQ15, SAMPLES), SAMPLES);
+    report_exact("dsp.biquad_q31", count_q31(s_outQ31, s_refQ31, SAMPLES), SAMPLES);
+
+    /* float: unsaturated direct form I in double, same coefficients */
+    for (n = 0; n < SAMPLES; n++)
+    {
+        s_refF64[n] = s_inF32[n];
+    }
+    for (b = 0; b < STAGES; b++)
+    {
+        const float *k = &cf[b * DSP_BIQUAD_COEFFS];
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+        for (n = 0; n < SAMPLES; n++)
+        {
+            double x = s_refF64[n];
+            double y = k[0] * x + k[1] * x1 + k[2] * x2 + k[3] * y1 + k[4] * y2;
+
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            s_refF64[n] = y;
+        }
+    }
+    bench_report("dsp.biquad_f32", "max_abs_error",
+                 max_error(s_outF32, s_refF64, SAMPLES), BUDGET_F32_BIQUAD);
+}
+
+static void check_mavg(void)
+{
+    int16_t w15[MAVG];
+    int32_t w31[MAVG];
+    float   wf[MAVG];
+    dsp_mavg_q15_t q15;
+    dsp_mavg_q31_t q31;
+    dsp_mavg_f32_t f32;
+    uint32_t n;
+    uint32_t b;
+
+    for (n = 0; n < SAMPLES; n++)
+    {
+        int64_t sum15 = 0;
+        int64_t sum31 = 0;
+        double sumf = 0.0;
+        uint32_t j;
+
+        for (j = 0; j < MAVG && j <= n; j++)
+        {
+            sum15 += s_inQ15[n - j];
+            sum31 += s_inQ31[n - j];
+            sumf += s_inF32[n - j];
+        }
+        /* floor division; MAVG is a power of two */
+        s_refQ15[n] = (int16_t)((sum15 - ((sum15 < 0) ? MAVG - 1 : 0)) / (int64_t)MAVG);
+        s_refQ31[n] = (int32_t)((sum31 - ((sum31 < 0) ? MAVG - 1 : 0)) / (int64_t)MAVG);
+        s_refF64[n] = sumf / MAVG;
+    }
+
+    if (!dsp_mavg_q15_init(&q15, w15, MAVG) ||
+        !dsp_mavg_q31_init(&q31, w31, MAVG) ||
+        !dsp_mavg_f32_init(&f32, wf, MAVG) ||
+        dsp_mavg_q15_init(&q15, w15, MAVG - 1u))
+    {
+        bench_fail("dsp.mavg", "init");
+        return;
+    }
+    for (n = 0, b = 0; n < SAMPLES; n += s_blocks[b], b = (b + 1u) % BLOCK_SIZES)
+    {
+        uint32_t count = (SAMPLES - n < s_blocks[b]) ? SAMPLES - n : s_blocks[b];
+
+        dsp_mavg_q15(&q15, &s_inQ15[n], &s_outQ15[n], count);
+        dsp_mavg_q31(&q31, &s_inQ31[n], &s_outQ31[n], count);
+        dsp_mavg_f32(&f32, &s_inF32[n], &s_outF32[n], count);
+    }
+    report_exact("dsp.mavg_q15", count_q15(s_outQ15, s_refQ15, SAMPLES), SAMPLES);
+    report_exact("dsp.mavg_q31", count_q31(s_outQ31, s_refQ31, SAMPLES), SAMPLES);
+    bench_report("dsp.mavg_f32", "max_abs_error",
+                 max_error(s_outF32, s_refF64, SAMPLES), BUDGET_F32_ERROR);
+}
+
+static void check_add(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < SAMPLES; n++)
+    {
+        s_refQ15[n] = (int16_t)sat((int32_t)s_inQ15[n] + s_inQ15[SAMPLES - 1u - n],
+                                   INT16_MIN, INT16_MAX);
+        s_outQ15[n] = s_inQ15[SAMPLES - 1u - n];
+    }
+    /* odd count and odd offset: unaligned pairs and the single tail */
+    dsp_add_q15(s_inQ15, s_outQ15, s_outQ15, 1u);
+    dsp_add_q15(&s_inQ15[1], &s_outQ15[1], &s_outQ15[1], SAMPLES - 1u);
+    report_exact("dsp.add_q15", count_q15(s_outQ15, s_refQ15, SAMPLES), SAMPLES);
+}
+
+/** Runs the board benchmark once, for the wall-clock cost on the host. */
+static void run_bench(void)
+{
+    uint64_t start = bench_now_ns();
+    uint32_t k;
+
+    dsp_bench_run();
+    for (k = 0; k < DSP_BENCH_KERNELS; k++)
+    {
+        if (g_dsp_bench.name[k] == NULL)
+        {
+            bench_fail("dsp.bench", "kernel_not_run");
+            return;
+        }
+    }
+    bench_report("dsp.bench", "host_ns/sample",
+                 (double)(bench_now_ns() - start) /
+                 (DSP_BENCH_KERNELS * DSP_BENCH_RUNS * DSP_BENCH_BLOCK),
+                 BENCH_NO_BUDGET);
+}
+
+void bench_dsp(void)
+{
+    fill_data();
+    check_fir();
+    check_decim();
+    check_biquad();
+    check_mavg();
+    check_add();
+    run_bench();
+}
@@ -0,0 +1,333 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_eth.c
+ * @author   insert authors names here
+ * @brief    Ethernet: common/eth_mac.c and common/udp_fast.c. \n
+ *           Simulated cases, at 120 MHz with the MAC in loopback: the main
+ *           loop sends numbered UDP datagrams as fast as the TX ring takes
+ *           them and sleeps when it is full; the receiver checks the
+ *           numbers. "eth.small" 60-byte frames with one interrupt per
+ *           frame each way (in loopback a frame comes back as it leaves, so
+ *           both land in one interrupt); "eth.small_coal" the same with
+ *           coalescing (receive interrupt every 4 frames or 50 us, transmit
+ *           interrupt every 4 frames); "eth.large_coal" 1514-byte frames,
+ *           coalesced likewise but with a 500 us watchdog, as a 50 us one
+ *           would fire on every 123 us frame.\n
+ *           Reported: frames/s, Mbit/s of frame bytes, interrupts per frame
+ *           and the share of cycles not spent asleep. The wire limits the
+ *           rates (148.8 kfps at 60 bytes); C code costs nothing in the
+ *           simulator, so the CPU figure covers the HAL calls and exception
+ *           entries only.\n
+ *           "eth.host": the same UDP code on the software loopback
+ *           (host/net/net_loop.c), capturing to a pcap file that is then
+ *           replayed through a second receiver; wall-clock cost per frame on
+ *           this machine.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "driverlib/sysctl.h"
+#include "common/eth_mac.h"
+#include "common/udp_fast.h"
+#include "host/net/net_loop.h"
+#include "host/net/net_pcap.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+/** Safety stop: 1 s of simulated time. */
+#define RUN_CYCLES          120000000ull
+
+#define SMALL_PAYLOAD       (NET_FRAME_MIN - UDP_FAST_HEADER)
+#define LARGE_PAYLOAD       UDP_FAST_PAYLOAD_MAX
+#define SMALL_FRAMES        2000u
+#define LARGE_FRAMES        500u
+#define HOST_FRAMES         20000u
+#define HOST_QUEUE          16u
+
+#define LOCAL_IP            UDP_FAST_IP(192, 168, 0, 10)
+#define LOCAL_PORT          5000u
+
+/** Budgets, slightly above the current figures. */
+#define BUDGET_SMALL_IRQS   1.05
+#define BUDGET_SMALL_CPU    7.0
+#define BUDGET_COAL_IRQS    0.30
+#define BUDGET_COAL_CPU     2.6
+#define BUDGET_LARGE_IRQS   0.30
+#define BUDGET_LARGE_CPU    0.20
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const uint8_t s_mac[NET_MAC_LEN] = { 0x00, 0x1A, 0xB6, 0x03, 0x00, 0x01 };
+
+static net_if_t      s_netif;
+static udp_fast_tx_t s_tx;
+static udp_fast_rx_t s_rx;
+
+/* case parameters */
+static eth_mac_config_t s_config;
+static uint32_t         s_payload;
+static uint32_t         s_frames;
+
+/* receiver */
+static uint32_t s_next;
+static uint32_t s_errors;
+
+static uint64_t s_startCycles;
+static uint64_t s_startSleep;
+static uint64_t s_endCycles;
+static uint64_t s_endSleep;
+static uint32_t s_startIrqs;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void put_seq(uint8_t *p, uint32_t seq)
+{
+    p[0] = (uint8_t)(seq >> 24);
+    p[1] = (uint8_t)(seq >> 16);
+    p[2] = (uint8_t)(seq >> 8);
+    p[3] = (uint8_t)seq;
+}
+
+static uint32_t get_seq(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | p[3];
+}
+
+/** Checks the numbering of the datagrams, and their length. */
+static void on_datagram(void *ctx, net_buf_t *buf, const uint8_t *payload,
+                        uint32_t len)
+{
+    (void)ctx;
+
+    if (len != s_payload || get_seq(payload) != s_next)
+    {
+        s_errors++;
+    }
+    s_next = get_seq(payload) + 1u;
+    net_buf_free(buf);
+}
+
+static void bind_flow(net_if_t *netif)
+{
+    udp_fast_flow_t flow;
+
+    memcpy(flow.dst_mac, netif->mac, NET_MAC_LEN);
+    flow.src_ip = LOCAL_IP;
+    flow.dst_ip = LOCAL_IP;
+    flow.src_port = LOCAL_PORT;
+    flow.dst_port = LOCAL_PORT;
+    udp_fast_tx_init(&s_tx, netif, &flow);
+    udp_fast_rx_init(&s_rx, netif, LOCAL_IP, LOCAL_PORT, on_datagram, NULL);
+}
+
+/** @returns net_buf_t* - a datagram numbered @p seq, NULL if the pool is dry */
+static net_buf_t *make_datagram(uint32_t seq)
+{
+    net_buf_t *buf = net_buf_alloc();
+
+    if (buf != NULL)
+    {
+        memset(udp_fast_payload(buf), 0x5A, s_payload);
+        put_seq(udp_fast_payload(buf), seq);
+    }
+    return buf;
+}
+
+/** Simulated case: sends s_frames datagrams, waits until all came back. */
+static void run_sim(void)
+{
+    uint32_t clock = SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                                        SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240,
+                                        CLOCK_HZ);
+    net_buf_t *buf = NULL;
+    uint32_t seq = 0u;
+
+    net_buf_init();
+    if (!eth_mac_init(&s_netif, clock, s_mac, &s_config))
+    {
+        return;
+    }
+    bind_flow(&s_netif);
+
+    s_startCycles = g_sim.cycles;
+    s_startSleep = g_sim.sleep_cycles;
+    s_startIrqs = s_netif.stats.irqs;
+    while (seq < s_frames)
+    {
+        if (buf == NULL)
+        {
+            buf = make_datagram(seq);
+        }
+        if (buf != NULL && udp_fast_send(&s_tx, buf, s_payload))
+        {
+            buf = NULL;
+            seq++;
+        }
+        else
+        {
+            /* TX ring or pool full: a transmit interrupt frees room */
+            SysCtlSleep();
+        }
+    }
+    while (s_rx.received + s_rx.dropped + s_netif.stats.rx_dropped < s_frames)
+    {
+        SysCtlSleep();
+    }
+    s_endCycles = g_sim.cycles;
+    s_endSleep = g_sim.sleep_cycles;
+}
+
+static void sim_case(const char *name, uint32_t payload, uint32_t frames,
+                     uint32_t rx_frames, uint32_t rx_timeout_us,
+                     uint32_t tx_frames, double budget_irqs, double budget_cpu)
+{
+    double cycles;
+    double seconds;
+    uint32_t frame_len = UDP_FAST_HEADER + payload;
+
+    s_config.loopback = true;
+    s_config.rx_frames = rx_frames;
+    s_config.rx_timeout_us = rx_timeout_us;
+    s_config.tx_frames = tx_frames;
+    s_payload = payload;
+    s_frames = frames;
+    s_next = 0u;
+    s_errors = 0u;
+    s_endCycles = 0u;
+
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(run_sim) || s_endCycles == 0u)
+    {
+        bench_fail(name, "did_not_finish");
+        return;
+    }
+    if (s_rx.received != frames || s_errors != 0u)
+    {
+        bench_fail(name, "frames_lost");
+        return;
+    }
+
+    cycles = (double)(s_endCycles - s_startCycles);
+    seconds = cycles / CLOCK_HZ;
+    bench_report(name, "kfps", frames / seconds / 1e3, BENCH_NO_BUDGET);
+    bench_report(name, "mbit/s", (double)frames * frame_len * 8.0 / seconds / 1e6,
+                 BENCH_NO_BUDGET);
+    bench_report(name, "irqs/frame",
+                 (double)(s_netif.stats.irqs - s_startIrqs) / frames,
+                 budget_irqs);
+    bench_report(name, "cpu_busy_%",
+                 100.0 * (cycles - (double)(s_endSleep - s_startSleep)) / cycles,
+                 budget_cpu);
+}
+
+/** The UDP code on the software loopback, capture and replay. */
+static void host_case(void)
+{
+    static const char name[] = "eth.host";
+    net_loop_t loop;
+    net_pcap_t pcap;
+    FILE *file = tmpfile();
+    uint64_t start;
+    uint64_t ns;
+    uint32_t seq = 0u;
+    int32_t replayed;
+
+    if (file == NULL || !net_pcap_open(&pcap, file))
+    {
+        bench_fail(name, "no_capture_file");
+        if (file != NULL)
+        {
+            fclose(file);
+        }
+        return;
+    }
+    s_payload = SMALL_PAYLOAD;
+    s_next = 0u;
+    s_errors = 0u;
+    net_buf_init();
+    net_loop_init(&loop, &s_netif, s_mac, HOST_QUEUE, &pcap);
+    bind_flow(&s_netif);
+
+    start = bench_now_ns();
+    while (seq < HOST_FRAMES)
+    {
+        net_buf_t *buf = make_datagram(seq);
+
+        if (buf != NULL && udp_fast_send(&s_tx, buf, s_payload))
+        {
+            seq++;
+        }
+        else
+        {
+            net_buf_free(buf);
+            net_if_poll(&s_netif);
+        }
+    }
+    net_if_poll(&s_netif);
+    ns = bench_now_ns() - start;
+
+    if (s_rx.received != HOST_FRAMES || s_errors != 0u)
+    {
+        bench_fail(name, "frames_lost");
+        fclose(file);
+        return;
+    }
+    bench_report(name, "ns/frame", (double)ns / HOST_FRAMES, BENCH_NO_BUDGET);
+
+    /* the capture, through a receiver on a transport that never sends */
+    rewind(file);
+    s_next = 0u;
+    net_loop_init(&loop, &s_netif, s_mac, HOST_QUEUE, NULL);
+    bind_flow(&s_netif);
+    replayed = net_pcap_replay(file, &s_netif);
+    fclose(file);
+    if (replayed != (int32_t)pcap.frames || s_rx.received != HOST_FRAMES ||
+        s_errors != 0u)
+    {
+        bench_fail(name, "replay_mismatch");
+        return;
+    }
+    bench_report(name, "replayed", replayed, BENCH_NO_BUDGET);
+}
+
+void bench_eth(void)
+{
+    sim_case("eth.small", SMALL_PAYLOAD, SMALL_FRAMES, 1u, 0u, 1u,
+             BUDGET_SMALL_IRQS, BUDGET_SMALL_CPU);
+    sim_case("eth.small_coal", SMALL_PAYLOAD, SMALL_FRAMES, 4u, 50u, 4u,
+             BUDGET_COAL_IRQS, BUDGET_COAL_CPU);
+    sim_case("eth.large_coal", LARGE_PAYLOAD, LARGE_FRAMES, 4u, 500u, 4u,
+             BUDGET_LARGE_IRQS, BUDGET_LARGE_CPU);
+    host_case();
+}
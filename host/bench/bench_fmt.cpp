@@ -0,0 +1,341 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_fmt.cpp
+ * @author   insert authors names here
+ * @brief    common/fmt.h against snprintf()/strtof() and iostream. \n
+ *           Correctness: integers and fixed point must print as snprintf()
+ *           does; shortest floats must read back (strtof()) as the same
+ *           float, with no more digits than the shortest %.*e that does;
+ *           fmt_scan() must read %.9g output back exactly. Inputs are
+ *           pseudo-random bit patterns, over the whole finite range
+ *           (subnormals included).
+ *           Speed: host ns per call, formatting into a buffer with
+ *           fmt_format(), snprintf() and a std::ostringstream (a new one per
+ *           call, as a buffer is filled with iostream), and scanning with
+ *           fmt_scan(), strtof() and std::istringstream. Heap: allocations
+ *           per call, counted by the operator new below (the whole runner
+ *           uses it; it only counts). Host figures: they rank the
+ *           implementations, they do not predict the target's.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <new>
+#include <iomanip>
+#include <sstream>
+
+#include "bench.h"
+#include "common/fmt.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CHECK_VALUES    200000u
+#define TIMED_CALLS     20000u
+#define TEXT_SIZE       64u
+/** Scan inputs, made beforehand. */
+#define SCAN_INPUTS     1024u
+
+/** Fixed point checked against snprintf() below this magnitude. */
+#define FIXED_LIMIT     1e30f
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static size_t            s_allocs;
+static volatile size_t   s_sink;
+static char              s_inputs[SCAN_INPUTS][16];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void *operator new(std::size_t size)
+{
+    void *p = malloc((size != 0u) ? size : 1u);
+
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    s_allocs++;
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    free(p);
+}
+
+static uint32_t next_random(uint32_t *state)
+{
+    /* xorshift32 */
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/** @returns float - a finite float from random bits */
+static float random_float(uint32_t *state)
+{
+    float v;
+
+    do
+    {
+        uint32_t bits = next_random(state);
+
+        memcpy(&v, &bits, sizeof(v));
+    } while (!isfinite(v));
+    return v;
+}
+
+static bool same_float(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+/**
+ * Runs @p call TIMED_CALLS times.
+ *
+ * @returns double - ns per call; *allocs: heap allocations per call
+ */
+template <typename F>
+static double time_calls(F call, double *allocs)
+{
+    uint32_t state = 0x2545F491u;
+    size_t before = s_allocs;
+    uint64_t start = bench_now_ns();
+
+    for (uint32_t i = 0u; i < TIMED_CALLS; i++)
+    {
+        s_sink = s_sink + call(next_random(&state));
+    }
+    *allocs = static_cast<double>(s_allocs - before) / TIMED_CALLS;
+    return static_cast<double>(bench_now_ns() - start) / TIMED_CALLS;
+}
+
+/** Reports the three implementations; fails if fmt allocated. */
+static void report(const char *bench, double fmt_ns, double fmt_allocs,
+                   double libc_ns, double ios_ns, double ios_allocs)
+{
+    if (fmt_allocs != 0.0)
+    {
+        bench_fail(bench, "fmt_allocated");
+        return;
+    }
+    bench_report(bench, "host_ns/call", fmt_ns, BENCH_NO_BUDGET);
+    bench_report(bench, "libc_host_ns/call", libc_ns, BENCH_NO_BUDGET);
+    bench_report(bench, "iostream_host_ns/call", ios_ns, BENCH_NO_BUDGET);
+    bench_report(bench, "iostream_allocs/call", ios_allocs, BENCH_NO_BUDGET);
+}
+
+static void bench_int(void)
+{
+    uint32_t state = 1u;
+    char text[TEXT_SIZE];
+    char ref[TEXT_SIZE];
+    double fmt_ns;
+    double fmt_allocs;
+    double libc_ns;
+    double ios_ns;
+    double ios_allocs;
+    double unused;
+
+    for (uint32_t i = 0u; i < CHECK_VALUES; i++)
+    {
+        int32_t a = static_cast<int32_t>(next_random(&state)) >> (i % 32u);
+        uint32_t b = next_random(&state) >> (i % 32u);
+
+        (void)fmt_format(text, sizeof(text), FMT("{} {:08x} {:>12} {:b}"),
+                         a, b, a, b);
+        (void)snprintf(ref, sizeof(ref), "%d %08x %12d ", a, b, a);
+        if (strncmp(text, ref, strlen(ref)) != 0)
+        {
+            bench_fail("fmt.int", "differs_from_snprintf");
+            return;
+        }
+    }
+
+    fmt_ns = time_calls([](uint32_t v) {
+        char buf[TEXT_SIZE];
+
+        return fmt_format(buf, sizeof(buf), FMT("{} {:08x}"),
+                          static_cast<int32_t>(v), v);
+    }, &fmt_allocs);
+    libc_ns = time_calls([](uint32_t v) {
+        char buf[TEXT_SIZE];
+
+        return static_cast<size_t>(snprintf(buf, sizeof(buf), "%d %08x",
+                                            static_cast<int32_t>(v), v));
+    }, &unused);
+    ios_ns = time_calls([](uint32_t v) {
+        std::ostringstream out;
+
+        out << static_cast<int32_t>(v) << ' ' << std::hex << std::setw(8)
+            << std::setfill('0') << v;
+        return out.str().size();
+    }, &ios_allocs);
+    report("fmt.int", fmt_ns, fmt_allocs, libc_ns, ios_ns, ios_allocs);
+}
+
+static void bench_float(void)
+{
+    uint32_t state = 2u;
+    char text[TEXT_SIZE];
+    char ref[TEXT_SIZE];
+    double fmt_ns;
+    double fmt_allocs;
+    double libc_ns;
+    double ios_ns;
+    double ios_allocs;
+    double unused;
+
+    for (uint32_t i = 0u; i < CHECK_VALUES; i++)
+    {
+        float v = random_float(&state);
+        char digits[16];
+        int32_t exp10;
+        size_t n = fmt_float_shortest(v, digits, &exp10);
+        int shortest;
+
+        (void)fmt_format(text, sizeof(text), FMT("{}"), v);
+        if (!same_float(strtof(text, NULL), v) && v != 0.0f)
+        {
+            bench_fail("fmt.float", "no_round_trip");
+            return;
+        }
+        for (shortest = 1; shortest < 9; shortest++)
+        {
+            (void)snprintf(ref, sizeof(ref), "%.*e", shortest - 1,
+                           static_cast<double>(v));
+            if (strtof(ref, NULL) == v)
+            {
+                break;
+            }
+        }
+        if (v != 0.0f && n != static_cast<size_t>(shortest))
+        {
+            bench_fail("fmt.float", "not_shortest");
+            return;
+        }
+        if (fabsf(v) < FIXED_LIMIT)
+        {
+            (void)fmt_format(text, sizeof(text), FMT("{:.3f}"), v);
+            (void)snprintf(ref, sizeof(ref), "%.3f", static_cast<double>(v));
+            if (strcmp(text, ref) != 0)
+            {
+                bench_fail("fmt.float", "fixed_differs_from_snprintf");
+                return;
+            }
+        }
+    }
+
+    fmt_ns = time_calls([](uint32_t v) {
+        char buf[TEXT_SIZE];
+        float f = static_cast<float>(v) * 1e-3f;
+
+        return fmt_format(buf, sizeof(buf), FMT("{}"), f);
+    }, &fmt_allocs);
+    libc_ns = time_calls([](uint32_t v) {
+        char buf[TEXT_SIZE];
+        float f = static_cast<float>(v) * 1e-3f;
+
+        return static_cast<size_t>(snprintf(buf, sizeof(buf), "%.9g",
+                                            static_cast<double>(f)));
+    }, &unused);
+    ios_ns = time_calls([](uint32_t v) {
+        std::ostringstream out;
+        float f = static_cast<float>(v) * 1e-3f;
+
+        out << std::setprecision(9) << f;
+        return out.str().size();
+    }, &ios_allocs);
+    report("fmt.float", fmt_ns, fmt_allocs, libc_ns, ios_ns, ios_allocs);
+}
+
+static void bench_scan(void)
+{
+    uint32_t state = 3u;
+    char text[TEXT_SIZE];
+    double fmt_ns;
+    double fmt_allocs;
+    double libc_ns;
+    double ios_ns;
+    double ios_allocs;
+    double unused;
+
+    for (uint32_t i = 0u; i < CHECK_VALUES; i++)
+    {
+        float v = random_float(&state);
+        float back = 0.0f;
+
+        (void)snprintf(text, sizeof(text), "%.9g", static_cast<double>(v));
+        if (fmt_scan(text, FMT("{}"), back) != 1u || !same_float(back, v))
+        {
+            bench_fail("fmt.scan", "not_exact");
+            return;
+        }
+    }
+
+    for (uint32_t i = 0u; i < SCAN_INPUTS; i++)
+    {
+        uint32_t v = next_random(&state);
+
+        (void)snprintf(s_inputs[i], sizeof(s_inputs[i]), "%u.%03u",
+                       v % 100000u, v % 1000u);
+    }
+    fmt_ns = time_calls([](uint32_t v) {
+        float f = 0.0f;
+
+        (void)fmt_scan(s_inputs[v % SCAN_INPUTS], FMT("{}"), f);
+        return static_cast<size_t>(f);
+    }, &fmt_allocs);
+    libc_ns = time_calls([](uint32_t v) {
+        return static_cast<size_t>(strtof(s_inputs[v % SCAN_INPUTS], NULL));
+    }, &unused);
+    ios_ns = time_calls([](uint32_t v) {
+        std::istringstream in(s_inputs[v % SCAN_INPUTS]);
+        float f = 0.0f;
+
+        in >> f;
+        return static_cast<size_t>(f);
+    }, &ios_allocs);
+    report("fmt.scan", fmt_ns, fmt_allocs, libc_ns, ios_ns, ios_allocs);
+}
+
+void bench_fmt(void)
+{
+    bench_int();
+    bench_float();
+    bench_scan();
+}
@@ -0,0 +1,311 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_fpu.cpp
+ * @author   insert authors names here
+ * @brief    common/fpu_ctx.h policies with handlers marked in a
+ *           vector_table.h binding list. \n
+ *           "fpu.<policy>" triggers an integer-only handler (Fpu::Free) and
+ *           a floating-point one (Fpu::Uses) from thread code that has
+ *           FPU state (CONTROL.FPCA) and from code that has none, and
+ *           reports the entry plus exit cycles of each (the trigger store
+ *           is subtracted). Lazy stacking must give the integer handler the
+ *           cost it has from integer code; "saved" is what that is worth
+ *           per interrupt against eager stacking. Under FPU_CTX_OFF the
+ *           floating-point handler overwrites the interrupted registers;
+ *           the simulator counts those as clobbers, which must stay 0 for
+ *           the other two policies.\n
+ *           "fpu.exc" raises FPU exception flags: only the trapped ones
+ *           must reach fpu_ctx_isr() and the hook, once each.\n
+ *           "fpu.kernel" switches between a floating-point task and an
+ *           integer task (K_FPU_NONE): only the first may have its FPU
+ *           state saved. The cycles are the simulator's model, see
+ *           irq_bench for the same figures measured on the board.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "driverlib/interrupt.h"
+#include "common/fpu_ctx.h"
+#include "common/kernel.h"
+#include "common/vector_table.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define RUN_CYCLES          10000000ull
+#define SAMPLES             16u
+#define YIELDS              100u
+#define POLICIES            3u
+
+#define PRIO_TASK           4u
+
+/** Budgets: the figures of the model. */
+#define BUDGET_LAZY_INT     22.0
+#define BUDGET_LAZY_FP      56.0
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static void int_isr(void)
+{
+}
+
+static void fp_isr(void)
+{
+}
+
+static void on_reset(void)
+{
+}
+
+static constexpr Binding kBindings[] =
+{
+    bind<Irq::TIMER0A, 2>(int_isr),
+    bind<Irq::TIMER1A, 2, Fpu::Uses>(fp_isr),
+    bind<Irq::SYSEXC, 1, Fpu::Uses>(fpu_ctx_isr),
+};
+
+static constexpr VectorHandlers kHandlers =
+    vector_handlers(on_reset, kBindings);
+static constexpr VectorPriorities kPriorities = vector_priorities(kBindings);
+
+static_assert(vector_fpu_users(kBindings) == 2u, "two Fpu::Uses handlers");
+
+static const fpu_ctx_policy_t s_policies[POLICIES] =
+    { FPU_CTX_EAGER, FPU_CTX_LAZY, FPU_CTX_OFF };
+static const char *const s_names[POLICIES] =
+    { "fpu.eager", "fpu.lazy", "fpu.off" };
+
+/** [policy][handler: int, fp][thread FPCA: no, yes] */
+static double   s_cycles[POLICIES][2][2];
+static uint64_t s_clobbers[POLICIES];
+static uint32_t s_hookFlags;
+static uint32_t s_hookCalls;
+
+K_STACK(s_fpStack, 256u);
+K_STACK(s_intStack, 256u);
+static k_task_t s_fpTask;
+static k_task_t s_intTask;
+static uint32_t s_tasksDone;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_flags(uint32_t flags)
+{
+    s_hookFlags |= flags;
+    s_hookCalls++;
+}
+
+static void install(void)
+{
+    vector_table_install(kHandlers);
+    vector_fpu_install(kBindings);
+    vector_priorities_apply(kPriorities);
+}
+
+/** @returns double - entry + exit cycles of @p irq, trigger excluded */
+static double entry_exit(uint32_t irq, bool fpca)
+{
+    uint64_t trigger;
+    uint64_t total = 0u;
+    uint64_t start;
+    uint32_t i;
+
+    IntDisable(irq);
+    start = g_sim.cycles;
+    IntTrigger(irq);
+    trigger = g_sim.cycles - start;
+    IntPendClear(irq);
+    IntEnable(irq);
+
+    for (i = 0; i < SAMPLES; i++)
+    {
+        sim_set_fpca(fpca);
+        start = g_sim.cycles;
+        IntTrigger(irq);
+        total += g_sim.cycles - start - trigger;
+    }
+    sim_set_fpca(false);
+    return (double)total / SAMPLES;
+}
+
+static void run_policies(void)
+{
+    uint32_t p;
+
+    install();
+    for (p = 0; p < POLICIES; p++)
+    {
+        uint64_t clobbers = g_sim.fpu_clobbers;
+
+        fpu_ctx_init(s_policies[p], NULL);
+        s_cycles[p][0][0] = entry_exit(INT_TIMER0A, false);
+        s_cycles[p][0][1] = entry_exit(INT_TIMER0A, true);
+        s_cycles[p][1][0] = entry_exit(INT_TIMER1A, false);
+        s_cycles[p][1][1] = entry_exit(INT_TIMER1A, true);
+        s_clobbers[p] = g_sim.fpu_clobbers - clobbers;
+    }
+}
+
+static void run_exc(void)
+{
+    install();
+    fpu_ctx_init(FPU_CTX_LAZY, on_flags);
+    s_hookFlags = 0u;
+    s_hookCalls = 0u;
+
+    sim_fpu_raise(SYSEXC_INT_FP_DZC | SYSEXC_INT_FP_IXC);
+    IntMasterEnable();
+    sim_fpu_raise(SYSEXC_INT_FP_IXC | SYSEXC_INT_FP_UFC);
+    IntMasterEnable();
+    sim_fpu_raise(SYSEXC_INT_FP_IOC);
+    IntMasterEnable();
+}
+
+static void task_done(void)
+{
+    if (++s_tasksDone == 2u)
+    {
+        sim_stop();
+    }
+}
+
+static void fp_entry(void *arg)
+{
+    uint32_t i;
+
+    (void)arg;
+    for (i = 0; i < YIELDS; i++)
+    {
+        sim_set_fpca(true);             /* a floating-point instruction */
+        k_yield();
+    }
+    task_done();
+}
+
+static void int_entry(void *arg)
+{
+    uint32_t i;
+
+    (void)arg;
+    for (i = 0; i < YIELDS; i++)
+    {
+        k_yield();
+    }
+    task_done();
+}
+
+static void run_kernel(void)
+{
+    fpu_ctx_init(FPU_CTX_LAZY, NULL);
+    s_tasksDone = 0u;
+    k_init();
+    k_task_create(&s_fpTask, "fp", fp_entry, NULL, PRIO_TASK, s_fpStack,
+                  K_STACK_WORDS(s_fpStack));
+    k_task_create(&s_intTask, "int", int_entry, NULL, PRIO_TASK, s_intStack,
+                  K_STACK_WORDS(s_intStack));
+    k_task_fpu(&s_intTask, K_FPU_NONE);
+    k_start();
+}
+
+static bool run_case(const char *name, void (*entry)(void), bool stops)
+{
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(entry) != stops || g_sim.cycles >= RUN_CYCLES)
+    {
+        bench_fail(name, "did_not_finish");
+        return false;
+    }
+    return true;
+}
+
+static void bench_policies(void)
+{
+    uint32_t p;
+
+    if (!run_case("fpu", run_policies, false))
+    {
+        return;
+    }
+    for (p = 0; p < POLICIES; p++)
+    {
+        bool lazy = (s_policies[p] == FPU_CTX_LAZY);
+
+        bench_report(s_names[p], "int_isr_cycles", s_cycles[p][0][1],
+                     lazy ? BUDGET_LAZY_INT : BENCH_NO_BUDGET);
+        bench_report(s_names[p], "fp_isr_cycles", s_cycles[p][1][1],
+                     lazy ? BUDGET_LAZY_FP : BENCH_NO_BUDGET);
+        bench_report(s_names[p], "clobbers", (double)s_clobbers[p],
+                     BENCH_NO_BUDGET);
+        if (s_policies[p] != FPU_CTX_OFF && s_clobbers[p] != 0u)
+        {
+            bench_fail(s_names[p], "fpu_state_clobbered");
+        }
+    }
+    bench_report("fpu.lazy", "int_isr_saved_cycles",
+                 s_cycles[0][0][1] - s_cycles[1][0][1], BENCH_NO_BUDGET);
+    if (s_cycles[1][0][1] != s_cycles[1][0][0] ||
+        s_cycles[1][1][0] != s_cycles[1][0][0] || s_clobbers[2] == 0u)
+    {
+        bench_fail("fpu.lazy", "stacking_model");
+    }
+}
+
+void bench_fpu(void)
+{
+    bench_policies();
+
+    if (run_case("fpu.exc", run_exc, false))
+    {
+        if (g_fpu_ctx.interrupts != 2u ||
+            g_fpu_ctx.count[1] != 1u || g_fpu_ctx.count[2] != 1u ||
+            g_fpu_ctx.count[5] != 0u || s_hookCalls != 2u ||
+            s_hookFlags != (SYSEXC_INT_FP_DZC | SYSEXC_INT_FP_IOC))
+        {
+            bench_fail("fpu.exc", "wrong_flags");
+        }
+        else
+        {
+            bench_report("fpu.exc", "interrupts", g_fpu_ctx.interrupts,
+                         BENCH_NO_BUDGET);
+        }
+    }
+
+    if (run_case("fpu.kernel", run_kernel, true))
+    {
+        if (s_intTask.fpu_saves != 0u || s_fpTask.fpu_saves < YIELDS)
+        {
+            bench_fail("fpu.kernel", "fpu_owner");
+            return;
+        }
+        bench_report("fpu.kernel", "fp_task_fpu_saves", s_fpTask.fpu_saves,
+                     BENCH_NO_BUDGET);
+        bench_report("fpu.kernel", "int_task_fpu_saves", s_intTask.fpu_saves,
+                     BENCH_NO_BUDGET);
+    }
+}
@@ -0,0 +1,136 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_gpio.cpp
+ * @author   insert authors names here
+ * @brief    Cost of an LED toggle through GPIOPinWrite() against the pin
+ *           types of common/gpio_pin.h. \n
+ *           Each case alternates the two user LEDs of port N (as blinky.c
+ *           does) or toggles one of them, and checks the port data after
+ *           every write. Cycles and register accesses are those of the
+ *           simulated HAL.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "common/gpio_pin.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define TOGGLES                 1000u
+
+/** Budgets, slightly above the current model. */
+#define BUDGET_PINWRITE_CYCLES  10.0
+#define BUDGET_GROUP_CYCLES     3.0
+#define BUDGET_BITBAND_CYCLES   4.0
+#define BUDGET_TOGGLE_CYCLES    5.0
+
+/** User LEDs of the EK-TM4C1294XL, as in Lab2/src/blinky.c. */
+using Led1 = Pin<Port::N, 0>;
+using Led2 = Pin<Port::N, 1>;
+using Leds = PinGroup<Led1, Led2>;
+
+/** Offset of the fully unmasked GPIODATA alias. */
+#define GPIO_DATA_ALL           0x3FCu
+
+static_assert(Leds::data == GPIO_PORTN_BASE + 0x00Cu, "masked address");
+static_assert(Led1::bitband == 0x42C80080u, "bit-band alias");
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** @returns uint8_t - port N LED levels, read without being charged */
+static uint8_t leds(void)
+{
+    return static_cast<uint8_t>(*sim_reg32(GPIO_PORTN_BASE + GPIO_DATA_ALL) &
+                                (GPIO_PIN_0 | GPIO_PIN_1));
+}
+
+/**
+ * Runs @p toggle TOGGLES times and reports cycles and register writes per
+ * toggle.
+ *
+ * @param[in] bench  - benchmark name
+ * @param[in] toggle - does toggle i, returns the expected LED levels
+ * @param[in] budget - cycles per toggle
+ */
+template <typename F>
+static void run(const char *bench, F toggle, double budget)
+{
+    uint64_t cycles;
+    uint64_t writes;
+    uint32_t i;
+
+    sim_reset();
+    cycles = g_sim.cycles;
+    writes = g_sim.reg_writes;
+    for (i = 0; i < TOGGLES; i++)
+    {
+        uint64_t before = g_sim.cycles;
+        uint8_t expected = toggle(i);
+
+        if (leds() != expected || g_sim.cycles == before)
+        {
+            bench_fail(bench, "wrong_pin_state");
+            return;
+        }
+    }
+    bench_report(bench, "cycles/toggle",
+                 (double)(g_sim.cycles - cycles) / TOGGLES, budget);
+    bench_report(bench, "reg_writes/toggle",
+                 (double)(g_sim.reg_writes - writes) / TOGGLES,
+                 BENCH_NO_BUDGET);
+}
+
+void bench_gpio(void)
+{
+    run("gpio.pinwrite", [](uint32_t i) -> uint8_t {
+            uint8_t on = (i & 1u) ? GPIO_PIN_1 : GPIO_PIN_0;
+
+            GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_0 | GPIO_PIN_1, on);
+            return on;
+        }, BUDGET_PINWRITE_CYCLES);
+
+    run("gpio.group", [](uint32_t i) -> uint8_t {
+            if (i & 1u)
+            {
+                Leds::assign<Led2>();
+                return Led2::mask;
+            }
+            Leds::assign<Led1>();
+            return Led1::mask;
+        }, BUDGET_GROUP_CYCLES);
+
+    run("gpio.bitband", [](uint32_t i) -> uint8_t {
+            Led1::write_bb((i & 1u) == 0u);
+            return ((i & 1u) == 0u) ? Led1::mask : 0u;
+        }, BUDGET_BITBAND_CYCLES);
+
+    run("gpio.toggle", [](uint32_t i) -> uint8_t {
+            Led2::toggle();
+            return ((i & 1u) == 0u) ? Led2::mask : 0u;
+        }, BUDGET_TOGGLE_CYCLES);
+}
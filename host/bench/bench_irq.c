@@ -0,0 +1,128 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_irq.c
+ * @author   insert authors names here
+ * @brief    Runs common/irq_bench.c on the simulated NVIC. \n
+ *           The CSV output is captured to memory and replayed with
+ *           host/tools/irq_report.c, the code of the irq_replay tool; the
+ *           replay must agree with the statistics the suite kept itself.
+ *           Budgets are on the worst case of each case and FPU mode; with
+ *           the model's costs, eager FPU stacking must show in entry and
+ *           nesting, and lazy stacking must not.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "host/tools/irq_report.h"
+#include "common/irq_bench.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+
+/** Worst-case budgets in cycles, by case and FPU mode. */
+static const uint32_t s_budget[IRQ_CASES][IRQ_FPU_MODES] =
+{
+    /* nofpu lazy eager */
+    {  20,   20,  40 },     /* entry        */
+    {   8,    8,   8 },     /* tailchain    */
+    {  20,   20,  40 },     /* nested       */
+    {  32,   32,  50 },     /* systick_load */
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static char         s_capture[IRQ_CASES * IRQ_FPU_MODES * IRQ_BENCH_SAMPLES * 32u];
+static uint32_t     s_captured;
+static irq_report_t s_report;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void to_memory(const void *data, uint32_t length)
+{
+    if (s_captured + length <= sizeof(s_capture))
+    {
+        memcpy(&s_capture[s_captured], data, length);
+        s_captured += length;
+    }
+}
+
+static void run_suite(void)
+{
+    irq_bench_run(CLOCK_HZ, to_memory);
+}
+
+void bench_irq(void)
+{
+    uint32_t c;
+    uint32_t fpu;
+
+    sim_reset();
+    sim_set_clock(CLOCK_HZ);
+    s_captured = 0;
+    (void)sim_run(run_suite);
+    if (!g_irq_bench.done)
+    {
+        bench_fail("irq", "suite_stopped");
+        return;
+    }
+    if (!irq_report_parse(s_capture, s_captured, &s_report) ||
+        s_report.dropped != 0u)
+    {
+        bench_fail("irq", "bad_capture");
+        return;
+    }
+
+    for (c = 0; c < IRQ_CASES; c++)
+    {
+        for (fpu = 0; fpu < IRQ_FPU_MODES; fpu++)
+        {
+            const irq_bench_stat_t *stat = &g_irq_bench.stat[c][fpu];
+            const irq_row_t *row =
+                irq_report_find(&s_report, irq_bench_case_name((irq_case_t)c),
+                                irq_bench_fpu_name((irq_fpu_t)fpu));
+            char name[40];
+
+            snprintf(name, sizeof(name), "irq.%s.%s",
+                     irq_bench_case_name((irq_case_t)c),
+                     irq_bench_fpu_name((irq_fpu_t)fpu));
+            if (row == NULL || row->count != stat->count ||
+                row->min != stat->min || row->max != stat->max ||
+                row->total != stat->total)
+            {
+                bench_fail(name, "replay_mismatch");
+                continue;
+            }
+            bench_report(name, "cycles_max", row->max, s_budget[c][fpu]);
+            bench_report(name, "jitter", row->max - row->min, BENCH_NO_BUDGET);
+        }
+    }
+}
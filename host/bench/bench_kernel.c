@@ -0,0 +1,182 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_kernel.c
+ * @author   insert authors names here
+ * @brief    Runs common/kernel_bench.c on the simulated HAL. \n
+ *           Latencies are in modelled cycles: exception entry/exit, the
+ *           interrupt masking around kernel calls and the PendSV register
+ *           save/restore (host/sim/kernel_port_host.c). The code between
+ *           them is not charged, so on the board expect a few tens of cycles
+ *           more.\n
+ *           kernel.yield_locked checks k_yield() under k_sched_lock()
+ *           followed by k_sleep(): the task must really sleep and the other
+ *           task of its priority must run meanwhile.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "common/kernel.h"
+#include "common/kernel_bench.h"
+#include "common/timer_service.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Budgets, slightly above the current model. */
+#define BUDGET_SEM_WAKE_MAX     80.0
+#define BUDGET_YIELD_MAX        80.0
+
+/** Ends the run if the kernel never gets idle. */
+#define RUN_CYCLES              100000000ull
+
+#define LOCKED_PRIO             1u
+#define LOCKED_SLEEP_TICKS      2u
+#define LOCKED_STACK_WORDS      256u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static k_task_t s_sleeper;
+static k_task_t s_spinner;
+K_STACK(s_sleeperStack, LOCKED_STACK_WORDS);
+K_STACK(s_spinnerStack, LOCKED_STACK_WORDS);
+
+static volatile uint32_t s_spins;
+static uint32_t s_slept;            /**< ticks k_sleep() lasted */
+static uint32_t s_spinsAsleep;      /**< spinner runs during the sleep */
+static bool     s_woke;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void report(const char *bench, const kernel_bench_stat_t *stat,
+                   uint32_t expected, double budget)
+{
+    if (stat->count < expected)
+    {
+        bench_fail(bench, "missed_switches");
+        return;
+    }
+    bench_report(bench, "cycles_min", stat->min, BENCH_NO_BUDGET);
+    bench_report(bench, "cycles_avg", (double)stat->total / stat->count,
+                 BENCH_NO_BUDGET);
+    bench_report(bench, "cycles_max", stat->max, budget);
+}
+
+/** Yields with the scheduler locked, then sleeps. */
+static void sleeper_entry(void *arg)
+{
+    uint32_t start;
+    uint32_t spins;
+
+    (void)arg;
+    k_sched_lock();
+    k_yield();
+    k_sched_unlock();
+
+    start = timer_now();
+    spins = s_spins;
+    k_sleep(LOCKED_SLEEP_TICKS);
+    s_slept = timer_now() - start;
+    s_spinsAsleep = s_spins - spins;
+    s_woke = true;
+    sim_stop();
+}
+
+static void spinner_entry(void *arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        s_spins++;
+        k_yield();
+    }
+}
+
+static void run_yield_locked(void)
+{
+    s_spins = 0u;
+    s_slept = 0u;
+    s_spinsAsleep = 0u;
+    s_woke = false;
+    timer_service_init(g_sim.clock_hz, false);
+    k_init();
+    k_task_create(&s_sleeper, "sleeper", sleeper_entry, NULL, LOCKED_PRIO,
+                  s_sleeperStack, K_STACK_WORDS(s_sleeperStack));
+    k_task_create(&s_spinner, "spinner", spinner_entry, NULL, LOCKED_PRIO,
+                  s_spinnerStack, K_STACK_WORDS(s_spinnerStack));
+    k_start();
+}
+
+static void bench_yield_locked(void)
+{
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    (void)sim_run(run_yield_locked);
+
+    if (!s_woke)
+    {
+        bench_fail("kernel.yield_locked", "not_woken");
+        return;
+    }
+    if (s_slept < LOCKED_SLEEP_TICKS || s_spinsAsleep == 0u)
+    {
+        bench_fail("kernel.yield_locked", "ready_list_corrupt");
+        return;
+    }
+    bench_report("kernel.yield_locked", "spins_asleep", s_spinsAsleep,
+                 BENCH_NO_BUDGET);
+}
+
+void bench_kernel(void)
+{
+    uint64_t start;
+    uint64_t elapsed;
+
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    start = bench_now_ns();
+    (void)sim_run(kernel_bench_start);
+    elapsed = bench_now_ns() - start;
+
+    if (!g_kernel_bench.done)
+    {
+        bench_fail("kernel", "not_done");
+        return;
+    }
+    report("kernel.sem_wake", &g_kernel_bench.sem_wake,
+           KERNEL_BENCH_ITERATIONS, BUDGET_SEM_WAKE_MAX);
+    report("kernel.yield", &g_kernel_bench.yield,
+           KERNEL_BENCH_ITERATIONS, BUDGET_YIELD_MAX);
+    bench_report("kernel", "host_ns/switch",
+                 (double)elapsed / (g_kernel_bench.sem_wake.count +
+                                    g_kernel_bench.yield.count),
+                 BENCH_NO_BUDGET);
+
+    bench_yield_locked();
+}
@@ -0,0 +1,641 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_kv.c
+ * @author   insert authors names here
+ * @brief    common/kv_store.c on the flash model of host/sim/flash.c. \n
+ *           "kv.basic": on a blank chip, keys of 1 B to 3 KB are written
+ *           and read back, copied and in place (4-byte aligned), then
+ *           deleted and updated, with a reboot (kv_init() again) after each
+ *           step. Bad arguments must be refused, and filling the store must
+ *           end in KV_FULL with every earlier key intact.\n
+ *           "kv.wear": random puts (mostly up to 64 B, one in 16 up to
+ *           2 KB) and deletes on 40 keys, next to 8 keys written once,
+ *           checked against a RAM copy and after a reboot. Reported: compactions, flash bytes programmed
+ *           per byte of record written (write amplification), the modelled
+ *           flash stall per put, and the spread of the sector erase counts,
+ *           which must be at most 1 and match those of the flash model.\n
+ *           "kv.boot": on the store kv.wear leaves, the time of kv_init()
+ *           (headers, every record with its CRC, the index) and of a
+ *           lookup, as info since they are wall-clock figures of this
+ *           machine; the longest index search is checked.\n
+ *           "kv.power_cut": a sequence of puts and deletes that fills a
+ *           sector and compacts another is cut at each of its word programs
+ *           and erases in turn. After the reboot the store must hold the
+ *           values after the operations completed, or after one more, and
+ *           must still take a put.\n
+ *           "kv.file": the flash image written through to a file is read
+ *           back from it by a blank flash model.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "common/kv_store.h"
+#include "host/sim/sim.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ        120000000u
+
+/** Key space: "k000" to "k063". */
+#define KEYS            64u
+#define BASIC_KEYS      48u
+#define WEAR_KEYS       40u
+#define WEAR_OPS        6000u
+/** kv.wear: keys written once before the churn (calibration tables). */
+#define WEAR_STATIC_KEYS 8u
+#define WEAR_STATIC_LEN 256u
+#define FILE_KEYS       16u
+
+#define BOOT_REPEATS    20u
+#define LOOKUP_ROUNDS   2000u
+
+/** kv.power_cut: keys written once, and updates before the sequence. */
+#define CUT_STATIC_KEYS 10u
+#define CUT_STATIC_LEN  300u
+#define CUT_UPDATE_LEN  600u
+#define CUT_SETUP_PUTS  69u
+
+/** Bytes of a record with a 4-character key: header, key, value. */
+#define RECORD_BYTES(len)   (12u + (((len) + 3u) & ~3u))
+
+#define ABSENT          (-1)
+
+/** What a key holds: version and length of its value, or ABSENT. */
+typedef struct
+{
+    int32_t  ver;
+    uint32_t len;
+} shadow_t;
+
+/** A step of the power-cut sequence; ver ABSENT deletes. */
+typedef struct
+{
+    uint32_t key;
+    int32_t  ver;
+    uint32_t len;
+} op_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static shadow_t s_shadow[KEYS];
+static shadow_t s_setupShadow[KEYS];
+static uint8_t  s_value[KV_VALUE_MAX + 4u];
+static uint8_t  s_read[KV_VALUE_MAX];
+static char     s_names[KEYS][8];
+
+static const op_t s_sequence[] =
+{
+    { 10u, 100, CUT_UPDATE_LEN }, { 11u, 100, CUT_UPDATE_LEN },
+    { 0u, ABSENT, 0u },           { 12u, 100, CUT_UPDATE_LEN },
+    { 13u, 100, CUT_UPDATE_LEN }, { 1u, 100, 40u },
+    { 14u, 100, CUT_UPDATE_LEN }, { 15u, 100, CUT_UPDATE_LEN },
+    { 16u, 100, CUT_UPDATE_LEN }, { 17u, 100, CUT_UPDATE_LEN },
+};
+#define SEQUENCE_OPS    (sizeof(s_sequence) / sizeof(s_sequence[0]))
+
+static uint32_t s_done;         /**< operations of the sequence completed */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t next_random(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static void fill(uint32_t key, int32_t ver, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0u; i < len; i++)
+    {
+        s_value[i] = (uint8_t)(key * 31u + (uint32_t)ver * 7u + i * 13u +
+                               (i >> 8));
+    }
+}
+
+static int put_key(uint32_t key, int32_t ver, uint32_t len)
+{
+    int rc;
+
+    fill(key, ver, len);
+    rc = kv_put(s_names[key], s_value, len);
+    if (rc == KV_OK)
+    {
+        s_shadow[key].ver = ver;
+        s_shadow[key].len = len;
+    }
+    return rc;
+}
+
+static int delete_key(uint32_t key)
+{
+    int rc = kv_delete(s_names[key]);
+
+    if (rc == KV_OK)
+    {
+        s_shadow[key].ver = ABSENT;
+    }
+    return rc;
+}
+
+static void clear_shadow(shadow_t *shadow)
+{
+    uint32_t i;
+
+    for (i = 0u; i < KEYS; i++)
+    {
+        shadow[i].ver = ABSENT;
+        shadow[i].len = 0u;
+    }
+}
+
+/**
+ * @returns bool - true if @p key holds what @p expect says, read both in
+ *          place and copied
+ */
+static bool check_key(uint32_t key, const shadow_t *expect)
+{
+    uint32_t len = 0u;
+    const uint8_t *value = (const uint8_t *)kv_get_ptr(s_names[key], &len);
+
+    if (expect->ver == ABSENT)
+    {
+        return value == NULL && kv_get(s_names[key], s_read,
+                                       sizeof(s_read)) == KV_NOT_FOUND;
+    }
+    if (value == NULL || len != expect->len || ((uintptr_t)value & 3u) != 0u)
+    {
+        return false;
+    }
+    fill(key, expect->ver, len);
+    return memcmp(value, s_value, len) == 0 &&
+           kv_get(s_names[key], s_read, sizeof(s_read)) == (int32_t)len &&
+           memcmp(s_read, s_value, len) == 0;
+}
+
+static bool check_all(const shadow_t *expect)
+{
+    uint32_t i;
+
+    for (i = 0u; i < KEYS; i++)
+    {
+        if (!check_key(i, &expect[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Power-on: the simulator restarts, the flash keeps its contents. */
+static bool reboot(void)
+{
+    sim_reset();
+    sim_set_clock(CLOCK_HZ);
+    return kv_init() == KV_OK;
+}
+
+static bool erase_counts_match(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        if (g_kv.erase_count[i] !=
+            sim_flash_erase_count(KV_FLASH_BASE + i * KV_SECTOR_SIZE))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void run_basic(void)
+{
+    static const char name[] = "kv.basic";
+    char longKey[KV_KEY_MAX + 2u];
+    int rc = KV_OK;
+    uint32_t i;
+
+    (void)reboot();
+    sim_flash_erase_chip();
+    clear_shadow(s_shadow);
+    if (kv_init() != KV_OK || g_kv.keys != 0u)
+    {
+        bench_fail(name, "init_failed");
+        return;
+    }
+    for (i = 0u; i < BASIC_KEYS; i++)
+    {
+        uint32_t len = (i % 8u == 0u) ? 512u * (i / 8u + 1u)
+                                      : 1u + (i * 7u) % 60u;
+
+        if (put_key(i, 0, len) != KV_OK)
+        {
+            bench_fail(name, "put_failed");
+            return;
+        }
+    }
+    if (!check_all(s_shadow))
+    {
+        bench_fail(name, "wrong_read_back");
+        return;
+    }
+    if (!reboot() || g_kv.keys != BASIC_KEYS || !check_all(s_shadow))
+    {
+        bench_fail(name, "lost_on_reboot");
+        return;
+    }
+    for (i = 0u; i < BASIC_KEYS; i++)
+    {
+        if (i % 3u == 0u)
+        {
+            rc = delete_key(i);
+        }
+        else if (i % 5u == 0u)
+        {
+            rc = put_key(i, 1, s_shadow[i].len + 3u);
+        }
+        if (rc != KV_OK)
+        {
+            bench_fail(name, "update_failed");
+            return;
+        }
+    }
+    if (kv_delete(s_names[BASIC_KEYS]) != KV_NOT_FOUND || !check_all(s_shadow) ||
+        !reboot() || !check_all(s_shadow))
+    {
+        bench_fail(name, "wrong_after_updates");
+        return;
+    }
+
+    memset(longKey, 'k', sizeof(longKey) - 1u);
+    longKey[sizeof(longKey) - 1u] = '\0';
+    if (kv_put("", s_value, 1u) != KV_BAD_ARG ||
+        kv_put(longKey, s_value, 1u) != KV_BAD_ARG ||
+        kv_put(s_names[1], s_value, KV_VALUE_MAX + 1u) != KV_BAD_ARG ||
+        kv_put(s_names[1], NULL, 1u) != KV_BAD_ARG ||
+        kv_get(s_names[8], s_read, 4u) != KV_FULL)
+    {
+        bench_fail(name, "bad_argument_taken");
+        return;
+    }
+
+    for (i = BASIC_KEYS; i < KEYS && rc == KV_OK; i++)
+    {
+        rc = put_key(i, 0, KV_VALUE_MAX);
+    }
+    if (rc != KV_FULL)
+    {
+        bench_fail(name, "never_full");
+        return;
+    }
+    if (!reboot() || !check_all(s_shadow) || g_kv.live_bytes > KV_CAPACITY)
+    {
+        bench_fail(name, "wrong_when_full");
+        return;
+    }
+    bench_report(name, "keys_when_full", (double)g_kv.keys, BENCH_NO_BUDGET);
+    bench_report(name, "live_kb_when_full", g_kv.live_bytes / 1024.0,
+                 BENCH_NO_BUDGET);
+}
+
+static void run_wear(void)
+{
+    static const char name[] = "kv.wear";
+    uint32_t random = 4242u;
+    uint64_t delay;
+    uint64_t recordBytes = 0u;
+    uint32_t puts = 0u;
+    uint32_t low = UINT32_MAX;
+    uint32_t high = 0u;
+    uint32_t op;
+    uint32_t i;
+
+    if (!reboot() || kv_format() != KV_OK)
+    {
+        bench_fail(name, "format_failed");
+        return;
+    }
+    clear_shadow(s_shadow);
+    for (i = WEAR_KEYS; i < WEAR_KEYS + WEAR_STATIC_KEYS; i++)
+    {
+        if (put_key(i, 0, WEAR_STATIC_LEN) != KV_OK)
+        {
+            bench_fail(name, "put_failed");
+            return;
+        }
+    }
+    delay = g_sim.delay_cycles;
+    for (op = 0u; op < WEAR_OPS; op++)
+    {
+        uint32_t r = next_random(&random);
+        uint32_t key = r % WEAR_KEYS;
+        int rc = KV_OK;
+
+        if ((r >> 8) % 10u == 0u)
+        {
+            if (s_shadow[key].ver != ABSENT)
+            {
+                rc = delete_key(key);
+            }
+        }
+        else
+        {
+            uint32_t len = ((r >> 12) % 16u == 0u) ? 1u + (r >> 16) % 2048u
+                                                   : 1u + (r >> 16) % 64u;
+
+            rc = put_key(key, (int32_t)op, len);
+            recordBytes += RECORD_BYTES(len);
+            puts++;
+        }
+        if (rc != KV_OK)
+        {
+            bench_fail(name, "update_failed");
+            return;
+        }
+    }
+    delay = g_sim.delay_cycles - delay;
+    if (!check_all(s_shadow))
+    {
+        bench_fail(name, "wrong_values");
+        return;
+    }
+    bench_report(name, "compactions", (double)g_kv.compactions,
+                 BENCH_NO_BUDGET);
+    bench_report(name, "write_amplification",
+                 (double)(recordBytes + g_kv.moved_bytes) / (double)recordBytes,
+                 BENCH_NO_BUDGET);
+    bench_report(name, "flash_stall_ms/put",
+                 (double)delay / puts / (CLOCK_HZ / 1000u), BENCH_NO_BUDGET);
+    if (!reboot() || !check_all(s_shadow))
+    {
+        bench_fail(name, "lost_on_reboot");
+        return;
+    }
+    if (!erase_counts_match())
+    {
+        bench_fail(name, "erase_counts_differ");
+        return;
+    }
+    for (i = 0u; i < KV_SECTORS; i++)
+    {
+        low = (g_kv.erase_count[i] < low) ? g_kv.erase_count[i] : low;
+        high = (g_kv.erase_count[i] > high) ? g_kv.erase_count[i] : high;
+    }
+    bench_report(name, "erases_max", (double)high, BENCH_NO_BUDGET);
+    bench_report(name, "erase_spread", (double)(high - low), 1.0);
+}
+
+static void run_boot(void)
+{
+    static const char name[] = "kv.boot";
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t sink = 0u;
+    uint32_t len;
+    uint32_t round;
+    uint32_t i;
+
+    start = bench_now_ns();
+    for (round = 0u; round < BOOT_REPEATS; round++)
+    {
+        if (kv_init() != KV_OK || g_kv.erases != 0u)
+        {
+            bench_fail(name, "init_changed_flash");
+            return;
+        }
+    }
+    elapsed = bench_now_ns() - start;
+    bench_report(name, "records_read", (double)g_kv.boot_records,
+                 BENCH_NO_BUDGET);
+    bench_report(name, "keys", (double)g_kv.keys, BENCH_NO_BUDGET);
+    bench_report(name, "init_us", elapsed / 1000.0 / BOOT_REPEATS,
+                 BENCH_NO_BUDGET);
+
+    g_kv.max_probes = 0u;
+    start = bench_now_ns();
+    for (round = 0u; round < LOOKUP_ROUNDS; round++)
+    {
+        for (i = 0u; i < WEAR_KEYS; i++)
+        {
+            if (kv_get_ptr(s_names[i], &len) != NULL)
+            {
+                sink += len;
+            }
+        }
+    }
+    elapsed = bench_now_ns() - start;
+    if (sink == 0u)
+    {
+        bench_fail(name, "no_keys");
+        return;
+    }
+    bench_report(name, "lookup_ns",
+                 (double)elapsed / ((double)LOOKUP_ROUNDS * WEAR_KEYS),
+                 BENCH_NO_BUDGET);
+    bench_report(name, "max_probes", (double)g_kv.max_probes, 4.0);
+}
+
+/** Blank chip, then the state the power-cut sequence starts from. */
+static bool cut_setup(void)
+{
+    uint32_t i;
+    bool ok;
+
+    sim_flash_erase_chip();
+    clear_shadow(s_shadow);
+    ok = kv_init() == KV_OK;
+    for (i = 0u; ok && i < CUT_STATIC_KEYS; i++)
+    {
+        ok = put_key(i, 0, CUT_STATIC_LEN) == KV_OK;
+    }
+    for (i = 0u; ok && i < CUT_SETUP_PUTS; i++)
+    {
+        ok = put_key(CUT_STATIC_KEYS + i % 10u, (int32_t)i + 1,
+                     CUT_UPDATE_LEN) == KV_OK;
+    }
+    memcpy(s_setupShadow, s_shadow, sizeof(s_shadow));
+    return ok;
+}
+
+static void run_sequence(void)
+{
+    for (s_done = 0u; s_done < SEQUENCE_OPS; s_done++)
+    {
+        const op_t *op = &s_sequence[s_done];
+
+        if (((op->ver == ABSENT) ? delete_key(op->key)
+                                 : put_key(op->key, op->ver, op->len)) != KV_OK)
+        {
+            return;
+        }
+    }
+}
+
+/** @returns bool - true if the store holds the state after @p ops steps */
+static bool holds_state_after(uint32_t ops)
+{
+    shadow_t expect[KEYS];
+    uint32_t i;
+
+    memcpy(expect, s_setupShadow, sizeof(expect));
+    for (i = 0u; i < ops && i < SEQUENCE_OPS; i++)
+    {
+        expect[s_sequence[i].key].ver = s_sequence[i].ver;
+        expect[s_sequence[i].key].len = s_sequence[i].len;
+    }
+    return check_all(expect);
+}
+
+static void run_power_cut(void)
+{
+    static const char name[] = "kv.power_cut";
+    uint32_t operations;
+    uint32_t cut;
+    uint32_t wrong = 0u;
+    uint32_t unusable = 0u;
+    uint32_t recoveries = 0u;
+    uint32_t torn = 0u;
+
+    (void)reboot();
+    if (!cut_setup())
+    {
+        bench_fail(name, "setup_failed");
+        return;
+    }
+    operations = sim_flash_operations();
+    (void)sim_run(run_sequence);
+    operations = sim_flash_operations() - operations;
+    if (s_done != SEQUENCE_OPS || g_kv.compactions == 0u)
+    {
+        bench_fail(name, "sequence_without_compaction");
+        return;
+    }
+
+    for (cut = 1u; cut <= operations; cut++)
+    {
+        uint32_t done;
+
+        (void)reboot();
+        (void)cut_setup();
+        s_done = 0u;
+        sim_flash_cut_after(cut);
+        if (!sim_run(run_sequence))
+        {
+            wrong++;
+            continue;
+        }
+        done = s_done;
+        if (!reboot() ||
+            !(holds_state_after(done) || holds_state_after(done + 1u)))
+        {
+            wrong++;
+            continue;
+        }
+        recoveries += g_kv.recoveries;
+        torn += g_kv.torn;
+        if (put_key(KEYS - 1u, 1, 100u) != KV_OK || !reboot() ||
+            !check_key(KEYS - 1u, &s_shadow[KEYS - 1u]))
+        {
+            unusable++;
+        }
+    }
+    bench_report(name, "cut_points", (double)operations, BENCH_NO_BUDGET);
+    bench_report(name, "torn_records", (double)torn, BENCH_NO_BUDGET);
+    bench_report(name, "compactions_recovered", (double)recoveries,
+                 BENCH_NO_BUDGET);
+    if (wrong != 0u)
+    {
+        bench_fail(name, "not_atomic");
+    }
+    if (unusable != 0u)
+    {
+        bench_fail(name, "unusable_after_cut");
+    }
+}
+
+static void run_file(void)
+{
+    static const char name[] = "kv.file";
+    char path[] = "/tmp/tiva_kv_XXXXXX";
+    int fd = mkstemp(path);
+    bool ok;
+    uint32_t i;
+
+    if (fd < 0)
+    {
+        bench_fail(name, "no_temporary_file");
+        return;
+    }
+    (void)close(fd);
+    (void)reboot();
+    sim_flash_erase_chip();
+    clear_shadow(s_shadow);
+    ok = sim_flash_attach(path) && kv_init() == KV_OK;
+    for (i = 0u; ok && i < FILE_KEYS; i++)
+    {
+        ok = put_key(i, 3, 16u + i * 40u) == KV_OK;
+    }
+    sim_flash_detach();
+    /* a blank array: the keys can only come back from the file */
+    sim_flash_erase_chip();
+    ok = ok && reboot() && g_kv.keys == 0u;
+    ok = ok && sim_flash_attach(path) && reboot() && check_all(s_shadow);
+    sim_flash_detach();
+    (void)remove(path);
+    if (!ok)
+    {
+        bench_fail(name, "not_kept_in_file");
+        return;
+    }
+    bench_report(name, "keys", (double)g_kv.keys, BENCH_NO_BUDGET);
+}
+
+void bench_kv(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < KEYS; i++)
+    {
+        (void)snprintf(s_names[i], sizeof(s_names[i]), "k%03u", (unsigned)i);
+    }
+    run_basic();
+    run_wear();
+    run_boot();
+    run_power_cut();
+    run_file();
+    sim_flash_erase_chip();
+}
@@ -0,0 +1,161 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_main.c
+ * @author   insert authors names here
+ * @brief    Runs every benchmark and checks the reported metrics against
+ *           their budgets. \n
+ *           Usage: tiva_bench [name-prefix] \n
+ *           Output is one whitespace-separated line per metric:
+ *           bench, metric, value, budget, status. The exit code is 1 if any
+ *           metric is over budget or any benchmark failed, so CI can gate on
+ *           it. Only simulated counters (cycles, register accesses) carry
+ *           budgets; wall-clock figures vary between machines and are
+ *           informational.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+} bench_entry_t;
+
+static const bench_entry_t s_benches[] =
+{
+    { "blinky",      bench_blinky },
+    { "timer_wheel", bench_timer_wheel },
+    { "kernel",      bench_kernel },
+    { "sram",        bench_sram },
+    { "profile",     bench_profile },
+    { "irq",         bench_irq },
+    { "ring",        bench_ring },
+    { "uart",        bench_uart },
+    { "mem",         bench_mem },
+    { "stack",       bench_stack },
+    { "gpio",        bench_gpio },
+    { "boot",        bench_boot },
+    { "dsp",         bench_dsp },
+    { "adc",         bench_adc },
+    { "eth",         bench_eth },
+    { "power",       bench_power },
+    { "vectors",     bench_vectors },
+    { "fmt",         bench_fmt },
+    { "tlog",        bench_tlog },
+    { "dma",         bench_dma },
+    { "fpu",         bench_fpu },
+    { "crypto",      bench_crypto },
+    { "can",         bench_can    },
+    { "wave",        bench_wave   },
+    { "kv",          bench_kv     },
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static unsigned s_failures;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Prints one metric and checks it against its budget.
+ *
+ * @param[in] bench  - benchmark name
+ * @param[in] metric - metric name, including its unit
+ * @param[in] value  - measured value
+ * @param[in] budget - upper limit, or BENCH_NO_BUDGET
+ */
+void bench_report(const char *bench, const char *metric, double value,
+                  double budget)
+{
+    const char *status = "info";
+
+    if (budget != BENCH_NO_BUDGET)
+    {
+        status = (value <= budget) ? "ok" : "OVER";
+        if (value > budget)
+        {
+            s_failures++;
+        }
+    }
+    printf("%-24s %-32s %14.4f %14.4f  %s\n", bench, metric, value, budget,
+           status);
+}
+
+/**
+ * Records a benchmark that could not produce valid results.
+ *
+ * @param[in] bench  - benchmark name
+ * @param[in] reason - what went wrong
+ */
+void bench_fail(const char *bench, const char *reason)
+{
+    printf("%-24s %-32s %14s %14s  FAIL\n", bench, reason, "-", "-");
+    s_failures++;
+}
+
+/**
+ * Monotonic wall-clock time, for informational host timings.
+ *
+ * @returns uint64_t - nanoseconds
+ */
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Main function.
+ *
+ * @param[in] argc - 1, or 2 when a name prefix is given
+ * @param[in] argv - optional prefix selecting which benchmarks run
+ * @returns int    - 0 if all metrics are within budget, 1 otherwise
+ */
+int main(int argc, char **argv)
+{
+    const char *prefix = (argc > 1) ? argv[1] : "";
+    size_t i;
+
+    printf("%-24s %-32s %14s %14s  %s\n", "bench", "metric", "value",
+           "budget", "status");
+    for (i = 0; i < sizeof(s_benches) / sizeof(s_benches[0]); i++)
+    {
+        if (strncmp(s_benches[i].name, prefix, strlen(prefix)) == 0)
+        {
+            s_benches[i].run();
+        }
+    }
+    return (s_failures == 0) ? 0 : 1;
+}
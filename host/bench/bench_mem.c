@@ -0,0 +1,329 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_mem.c
+ * @author   insert authors names here
+ * @brief    Pools of common/mem_pool.c against the C library heap. \n
+ *           Both allocators run the same churn: random slots are freed or
+ *           filled with blocks of random size (mostly small, some up to
+ *           MEM_MAX_BLOCK). Every block is filled with a tag and checked on
+ *           release, which catches overlapping blocks. Reported: mean and
+ *           worst time per malloc/free, as info since they are wall-clock
+ *           figures of this machine and glibc rather than DLIB. Means have
+ *           the cost of reading the clock taken out; worst cases include it
+ *           and any host scheduling noise.\n
+ *           After the churn every class must be able to hand out all its
+ *           blocks again (pools do not fragment), and the pools must not
+ *           have failed a request: both are checked. mem.large checks the
+ *           blocks above MEM_MAX_BLOCK: freed space is reused, freed
+ *           neighbours merge back into the space shared with the arena, and
+ *           a double free is refused.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "common/mem_pool.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define SLOTS           256u
+#define OPS             200000u
+/** One request in LARGE_EVERY may be up to MEM_MAX_BLOCK, the rest <= 64. */
+#define LARGE_EVERY     16u
+
+typedef struct
+{
+    const char *name;
+    void     *(*alloc)(size_t size);
+    void      (*release)(void *ptr);
+} allocator_t;
+
+typedef struct
+{
+    uint8_t *ptr;
+    uint32_t size;
+} slot_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static slot_t   s_slots[SLOTS];
+static uint64_t s_clockNs;      /**< cost of one bench_now_ns() pair */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t next_random(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+/** Mean cost of timing an empty call, subtracted from the averages. */
+static uint64_t clock_overhead(void)
+{
+    uint64_t start = bench_now_ns();
+    uint32_t i;
+
+    for (i = 0; i < 1000u; i++)
+    {
+        (void)bench_now_ns();
+    }
+    return (bench_now_ns() - start) / 1000u;
+}
+
+static bool release_slot(const allocator_t *a, slot_t *slot, uint8_t tag,
+                         uint64_t *ns, uint64_t *worst)
+{
+    bool intact = true;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t i;
+
+    for (i = 0; i < slot->size; i++)
+    {
+        intact = intact && (slot->ptr[i] == tag);
+    }
+    start = bench_now_ns();
+    a->release(slot->ptr);
+    elapsed = bench_now_ns() - start;
+    *ns += elapsed;
+    *worst = (elapsed > *worst) ? elapsed : *worst;
+    slot->ptr = NULL;
+    return intact;
+}
+
+static void churn(const allocator_t *a)
+{
+    uint32_t random = 12345u;
+    uint64_t alloc_ns = 0;
+    uint64_t alloc_worst = 0;
+    uint64_t free_ns = 0;
+    uint64_t free_worst = 0;
+    uint32_t allocs = 0;
+    uint32_t frees = 0;
+    uint32_t failed = 0;
+    bool intact = true;
+    uint32_t op;
+    uint32_t i;
+
+    memset(s_slots, 0, sizeof(s_slots));
+    for (op = 0; op < OPS; op++)
+    {
+        uint32_t r = next_random(&random);
+        uint32_t index = r % SLOTS;
+        slot_t *slot = &s_slots[index];
+
+        if (slot->ptr != NULL)
+        {
+            intact = release_slot(a, slot, (uint8_t)index, &free_ns,
+                                  &free_worst) && intact;
+            frees++;
+        }
+        else
+        {
+            uint32_t size = ((r >> 8) % LARGE_EVERY == 0u)
+                                ? 1u + (r >> 12) % MEM_MAX_BLOCK
+                                : 1u + (r >> 12) % 64u;
+            uint64_t start = bench_now_ns();
+            uint64_t elapsed;
+
+            slot->ptr = (uint8_t *)a->alloc(size);
+            elapsed = bench_now_ns() - start;
+            alloc_ns += elapsed;
+            alloc_worst = (elapsed > alloc_worst) ? elapsed : alloc_worst;
+            allocs++;
+            if (slot->ptr == NULL)
+            {
+                failed++;
+                continue;
+            }
+            slot->size = size;
+            memset(slot->ptr, (uint8_t)index, size);
+        }
+    }
+    for (i = 0; i < SLOTS; i++)
+    {
+        if (s_slots[i].ptr != NULL)
+        {
+            intact = release_slot(a, &s_slots[i], (uint8_t)i, &free_ns,
+                                  &free_worst) && intact;
+            frees++;
+        }
+    }
+
+    if (!intact)
+    {
+        bench_fail(a->name, "blocks_overlap");
+        return;
+    }
+    if (failed != 0u)
+    {
+        bench_fail(a->name, "alloc_failed");
+        return;
+    }
+    bench_report(a->name, "alloc_ns_avg",
+                 (double)alloc_ns / allocs - (double)s_clockNs, BENCH_NO_BUDGET);
+    bench_report(a->name, "alloc_ns_max", (double)alloc_worst, BENCH_NO_BUDGET);
+    bench_report(a->name, "free_ns_avg",
+                 (double)free_ns / frees - (double)s_clockNs, BENCH_NO_BUDGET);
+    bench_report(a->name, "free_ns_max", (double)free_worst, BENCH_NO_BUDGET);
+}
+
+/**
+ * Every class hands out all of its blocks, exactly once.
+ */
+static bool refill_classes(void)
+{
+    static void *blocks[256];
+    bool ok = true;
+    uint32_t c;
+
+    for (c = 0; c < MEM_CLASSES && ok; c++)
+    {
+        uint32_t size = g_mem.cls[c].size;
+        uint32_t count = g_mem.cls[c].count;
+        uint32_t i;
+
+        for (i = 0; i < count; i++)
+        {
+            blocks[i] = mem_alloc(size);
+            ok = ok && blocks[i] != NULL && mem_block_size(blocks[i]) == size;
+        }
+        ok = ok && g_mem.cls[c].spills == 0u;
+        for (i = 0; i < count; i++)
+        {
+            mem_free(blocks[i]);
+        }
+    }
+    return ok;
+}
+
+/**
+ * Large blocks: three buffers with a hole freed between them, refilled;
+ * once all are freed the whole shared space is one block again.
+ */
+static bool large_blocks(void)
+{
+    static const uint32_t sizes[3] = { 4000u, 6000u, 3000u };
+    uint8_t *blocks[3];
+    uint8_t *refill;
+    void *whole;
+    bool ok = true;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < 3u; i++)
+    {
+        blocks[i] = (uint8_t *)mem_alloc(sizes[i]);
+        ok = ok && blocks[i] != NULL && mem_block_size(blocks[i]) >= sizes[i];
+        if (blocks[i] != NULL)
+        {
+            memset(blocks[i], (int)i + 1, sizes[i]);
+        }
+    }
+    if (!ok)
+    {
+        return false;
+    }
+    mem_free(blocks[1]);
+    refill = (uint8_t *)mem_alloc(5000u);
+    ok = refill != NULL && refill >= blocks[1] &&
+         refill + 5000u <= blocks[1] + sizes[1];
+    for (i = 0; i < 3u; i += 2u)
+    {
+        for (j = 0; j < sizes[i]; j++)
+        {
+            ok = ok && blocks[i][j] == (uint8_t)(i + 1u);
+        }
+    }
+    mem_free(refill);
+    mem_free(blocks[0]);
+    mem_free(blocks[2]);
+    mem_free(blocks[2]);
+    ok = ok && g_mem.bad_frees == 1u && g_mem.large_used == 0u;
+
+    whole = mem_alloc(g_mem.arena_size - 8u);
+    ok = ok && whole != NULL && mem_arena_alloc(8u) == NULL;
+    mem_free(whole);
+    return ok && mem_arena_alloc(g_mem.arena_size) != NULL;
+}
+
+static void *pool_alloc(size_t size)
+{
+    return mem_alloc(size);
+}
+
+static void pool_free(void *ptr)
+{
+    mem_free(ptr);
+}
+
+void bench_mem(void)
+{
+    static const allocator_t pools = { "mem.pool", pool_alloc, pool_free };
+    static const allocator_t heap = { "mem.malloc", malloc, free };
+    uint32_t peak = 0;
+    uint32_t spills = 0;
+    uint32_t mark;
+    uint32_t c;
+
+    s_clockNs = clock_overhead();
+    mem_init();
+    churn(&pools);
+    for (c = 0; c < MEM_CLASSES; c++)
+    {
+        peak += g_mem.cls[c].peak;
+        spills += g_mem.cls[c].spills;
+    }
+    bench_report("mem.pool", "peak_blocks", peak, BENCH_NO_BUDGET);
+    bench_report("mem.pool", "spills", spills, BENCH_NO_BUDGET);
+
+    mem_init();
+    if (!refill_classes())
+    {
+        bench_fail("mem.pool", "class_not_refillable");
+    }
+
+    mark = mem_arena_mark();
+    if (mem_arena_alloc(g_mem.arena_size - 8u) == NULL ||
+        mem_arena_alloc(16u) != NULL)
+    {
+        bench_fail("mem.arena", "wrong_capacity");
+    }
+    mem_arena_release(mark);
+    bench_report("mem.arena", "size_bytes", g_mem.arena_size, BENCH_NO_BUDGET);
+
+    mem_init();
+    if (!large_blocks())
+    {
+        bench_fail("mem.large", "not_reused_or_merged");
+    }
+    bench_report("mem.large", "peak_bytes", g_mem.large_peak, BENCH_NO_BUDGET);
+
+    churn(&heap);
+}
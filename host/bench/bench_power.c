@@ -0,0 +1,326 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_power.c
+ * @author   insert authors names here
+ * @brief    Power governor: common/power.c on the simulated HAL. \n
+ *           Energy comes from the model in host/sim/power.c: the figures
+ *           compare policies, they are not board measurements.\n
+ *           "power.governor": a task released every 20 ms by the timer
+ *           service, first with 12 ms of work at 120 MHz (60% load), then
+ *           with 1 ms (5%); no task may miss its 20 ms deadline. Reported:
+ *           clock switches, the final clock, and the energy per light task
+ *           against the same program sleeping at a pinned 120 MHz
+ *           ("power.pinned").\n
+ *           "power.veto": the same load with a client that allows 10 us of
+ *           latency: neither deep-sleep nor a clock switch may happen.
+ *           "power.min_clock": with a client that needs 60 MHz instead.\n
+ *           "power.wake_sleep", "power.wake_deep": time from a timer
+ *           deadline to its callback, waking up from sleep and from
+ *           deep-sleep (PLL relock, and the timer service running on PIOSC
+ *           meanwhile).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "common/timer_service.h"
+#include "common/power.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+/** Safety stop, in cycles of whatever clock runs. */
+#define RUN_CYCLES          2400000000ull
+
+#define TASK_PERIOD_MS      20u
+#define HEAVY_TASKS         50u
+#define LIGHT_TASKS         200u
+/** Work per task, in cycles (SysCtlDelay() loops of 3 cycles). */
+#define HEAVY_CYCLES        (CLOCK_HZ / 1000u * 12u)
+#define LIGHT_CYCLES        (CLOCK_HZ / 1000u * 1u)
+
+#define WAKE_DELAY_MS       50u
+#define VETO_LATENCY_US     10u
+#define MIN_CLOCK_HZ        60000000u
+
+/** Budgets, slightly above the current figures. */
+#define BUDGET_SWITCHES     3.0
+#define BUDGET_LIGHT_UJ     265.0
+#define BUDGET_WAKE_US      1.0
+#define BUDGET_DEEP_WAKE_US 110.0
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static tw_timer_t        s_timer;
+static volatile uint32_t s_due;
+static uint64_t          s_releasePs;
+static uint32_t          s_tasks;
+static uint32_t          s_missed;
+static double            s_lightStartUj;
+static double            s_lightEndUj;
+static bool              s_governed;
+static power_config_t    s_config;
+static power_client_t    s_client;
+static bool              s_useClient;
+
+/* power.wake */
+static uint64_t          s_armPs;
+static uint64_t          s_firePs;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_release(void *arg)
+{
+    (void)arg;
+
+    s_due++;
+}
+
+/** Sleeps unless a task is due; no release can slip in between. */
+static void idle(void)
+{
+    (void)IntMasterDisable();
+    if (s_due != 0u)
+    {
+        IntMasterEnable();
+    }
+    else if (s_governed)
+    {
+        power_idle();
+    }
+    else
+    {
+        SysCtlSleep();
+        IntMasterEnable();
+    }
+}
+
+static uint32_t start_clock(void)
+{
+    return SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                              SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240, CLOCK_HZ);
+}
+
+/** The periodic task, heavy then light. */
+static void run_tasks(void)
+{
+    uint32_t clock = start_clock();
+
+    timer_service_init(clock, true);
+    if (s_governed)
+    {
+        power_init(clock, &s_config);
+        if (s_useClient)
+        {
+            power_client_add(&s_client);
+        }
+    }
+    tw_timer_init(&s_timer, on_release, 0);
+    timer_start(&s_timer, TIMER_MS(TASK_PERIOD_MS), TIMER_MS(TASK_PERIOD_MS));
+    s_releasePs = g_sim.time_ps;
+
+    while (s_tasks < HEAVY_TASKS + LIGHT_TASKS)
+    {
+        if (s_due == 0u)
+        {
+            idle();
+            continue;
+        }
+        s_due--;
+        s_releasePs += (uint64_t)TASK_PERIOD_MS * 1000000000ull;
+        if (s_tasks == HEAVY_TASKS)
+        {
+            s_lightStartUj = g_sim.energy_uj;
+        }
+        SysCtlDelay(((s_tasks < HEAVY_TASKS) ? HEAVY_CYCLES : LIGHT_CYCLES) / 3u);
+        if (g_sim.time_ps - s_releasePs >
+            (uint64_t)TASK_PERIOD_MS * 1000000000ull)
+        {
+            s_missed++;
+        }
+        s_tasks++;
+    }
+    s_lightEndUj = g_sim.energy_uj;
+}
+
+/**
+ * @returns bool - false if the run did not complete
+ */
+static bool task_case(const char *name, bool governed)
+{
+    s_governed = governed;
+    s_due = 0u;
+    s_tasks = 0u;
+    s_missed = 0u;
+    s_lightEndUj = 0.0;
+
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(run_tasks) || s_lightEndUj == 0.0)
+    {
+        bench_fail(name, "did_not_finish");
+        return false;
+    }
+    return true;
+}
+
+static void governor_case(void)
+{
+    double pinned;
+    double governed;
+
+    s_config.window_ms = 100u;
+    s_config.up_pct = 80u;
+    s_config.down_pct = 30u;
+    s_config.deep_min_ms = 10u;
+    s_useClient = false;
+
+    if (!task_case("power.pinned", false))
+    {
+        return;
+    }
+    pinned = (s_lightEndUj - s_lightStartUj) / LIGHT_TASKS;
+    bench_report("power.pinned", "uJ/light_task", pinned, BENCH_NO_BUDGET);
+
+    if (!task_case("power.governor", true))
+    {
+        return;
+    }
+    if (s_missed != 0u)
+    {
+        bench_fail("power.governor", "deadline_missed");
+        return;
+    }
+    governed = (s_lightEndUj - s_lightStartUj) / LIGHT_TASKS;
+    bench_report("power.governor", "switches", g_power.switches,
+                 BUDGET_SWITCHES);
+    bench_report("power.governor", "final_mhz", g_power.hz / 1e6,
+                 BENCH_NO_BUDGET);
+    bench_report("power.governor", "deep_sleeps", g_power.deep_sleeps,
+                 BENCH_NO_BUDGET);
+    bench_report("power.governor", "uJ/light_task", governed, BUDGET_LIGHT_UJ);
+    bench_report("power.governor", "saving_%", 100.0 * (1.0 - governed / pinned),
+                 BENCH_NO_BUDGET);
+}
+
+static void client_case(const char *name, uint32_t latency_us,
+                        uint32_t min_hz)
+{
+    s_useClient = true;
+    s_client.max_latency_us = latency_us;
+    s_client.min_hz = min_hz;
+    s_client.on_clock = NULL;
+    if (!task_case(name, true))
+    {
+        return;
+    }
+    if ((latency_us < POWER_DEEP_WAKE_US && g_power.deep_sleeps != 0u) ||
+        (latency_us < POWER_SWITCH_US && g_power.switches != 0u) ||
+        g_power.hz < min_hz)
+    {
+        bench_fail(name, "constraint_ignored");
+        return;
+    }
+    bench_report(name, "vetoes", g_power.vetoes, BENCH_NO_BUDGET);
+    bench_report(name, "final_mhz", g_power.hz / 1e6, BENCH_NO_BUDGET);
+    bench_report(name, "uJ/light_task",
+                 (s_lightEndUj - s_lightStartUj) / LIGHT_TASKS, BENCH_NO_BUDGET);
+}
+
+static void on_wake(void *arg)
+{
+    (void)arg;
+
+    s_firePs = g_sim.time_ps;
+}
+
+/** Armed from a tick callback, so the delay starts on a tick boundary. */
+static void on_arm(void *arg)
+{
+    (void)arg;
+
+    s_armPs = g_sim.time_ps;
+    tw_timer_init(&s_timer, on_wake, 0);
+    timer_start(&s_timer, TIMER_MS(WAKE_DELAY_MS), 0);
+}
+
+static void run_wake(void)
+{
+    static tw_timer_t arm;
+    uint32_t clock = start_clock();
+
+    timer_service_init(clock, true);
+    power_init(clock, &s_config);
+    tw_timer_init(&arm, on_arm, 0);
+    timer_start(&arm, 1, 0);
+
+    /* busy until the arming callback, so it runs without a wake-up */
+    while (s_armPs == 0u)
+    {
+        SysCtlDelay(100);
+    }
+    while (s_firePs == 0u)
+    {
+        power_idle();
+    }
+}
+
+static void wake_case(const char *name, uint32_t deep_min_ms, double budget)
+{
+    s_config.window_ms = 100u;
+    s_config.up_pct = 80u;
+    s_config.down_pct = 30u;
+    s_config.deep_min_ms = deep_min_ms;
+    s_armPs = 0u;
+    s_firePs = 0u;
+
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(run_wake) || s_firePs == 0u)
+    {
+        bench_fail(name, "did_not_finish");
+        return;
+    }
+    bench_report(name, "wake_us",
+                 (double)(s_firePs - s_armPs) / 1e6 - WAKE_DELAY_MS * 1000.0,
+                 budget);
+    bench_report(name, "deep_sleeps", g_power.deep_sleeps, BENCH_NO_BUDGET);
+}
+
+void bench_power(void)
+{
+    governor_case();
+    client_case("power.veto", VETO_LATENCY_US, 0u);
+    client_case("power.min_clock", POWER_LATENCY_ANY, MIN_CLOCK_HZ);
+    wake_case("power.wake_sleep", UINT32_MAX / 1000u, BUDGET_WAKE_US);
+    wake_case("power.wake_deep", 10u, BUDGET_DEEP_WAKE_US);
+}
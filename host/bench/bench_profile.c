@@ -0,0 +1,153 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_profile.c
+ * @author   insert authors names here
+ * @brief    End-to-end check of common/profile.c on the simulated HAL. \n
+ *           Runs nested zones of known simulated length with a wrapped
+ *           SysTick handler firing among them, drains the ring to memory and
+ *           analyses it with host/tools/prof_report.c, the code of the
+ *           prof_hist tool. Probes cost no simulated cycles, so the
+ *           durations must come out exact. The host cost of a probe is
+ *           reported as info.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#define PROF_ENABLE 1
+
+#include <stdint.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "host/tools/prof_report.h"
+#include "common/profile.h"
+#include "common/vtable.h"
+#include "driverlib/systick.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define ZONE_OUTER          1u
+#define ZONE_INNER          2u
+#define OUTER_CYCLES        1000u   /* plus the inner zone */
+#define INNER_CYCLES        300u
+#define ISR_CYCLES          100u
+#define SYSTICK_PERIOD      5000u
+#define LOOPS               200u
+#define PROBES              1000000u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t       s_capture[sizeof(prof_header_t) +
+                               PROF_TRACE_ENTRIES * sizeof(prof_record_t)];
+static uint32_t      s_captured;
+static prof_report_t s_report;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void to_memory(const void *data, uint32_t length)
+{
+    if (s_captured + length <= sizeof(s_capture))
+    {
+        memcpy(&s_capture[s_captured], data, length);
+        s_captured += length;
+    }
+}
+
+static void on_systick(void)
+{
+    sim_charge(ISR_CYCLES, 0, 0);
+}
+
+static void run_zones(void)
+{
+    uint32_t i;
+
+    prof_reset();
+    prof_init(120000000u);
+    (void)register_isr(SIM_EXC_SYSTICK, on_systick);
+    prof_wrap_isr(SIM_EXC_SYSTICK);
+    SysTickPeriodSet(SYSTICK_PERIOD);
+    SysTickIntEnable();
+    SysTickEnable();
+
+    for (i = 0; i < LOOPS; i++)
+    {
+        PROF_BEGIN(ZONE_OUTER);
+        sim_delay(OUTER_CYCLES);
+        PROF_BEGIN(ZONE_INNER);
+        sim_delay(INNER_CYCLES);
+        PROF_END(ZONE_INNER);
+        PROF_END(ZONE_OUTER);
+    }
+    SysTickDisable();
+}
+
+static bool check(const prof_stat_t *stat, uint32_t count, uint32_t min)
+{
+    return stat != NULL && stat->count == count && stat->min == min;
+}
+
+void bench_profile(void)
+{
+    const prof_stat_t *outer;
+    const prof_stat_t *inner;
+    const prof_stat_t *isr;
+    uint64_t start;
+    uint32_t i;
+
+    sim_reset();
+    s_captured = 0;
+    (void)sim_run(run_zones);
+    (void)prof_drain(to_memory);
+
+    if (!prof_report_parse(s_capture, s_captured, &s_report))
+    {
+        bench_fail("profile", "bad_capture");
+        return;
+    }
+    outer = prof_report_find(&s_report, false, ZONE_OUTER);
+    inner = prof_report_find(&s_report, false, ZONE_INNER);
+    isr = prof_report_find(&s_report, true, SIM_EXC_SYSTICK);
+    if (s_report.unmatched != 0u || s_report.header.overhead != 0u ||
+        !check(outer, LOOPS, OUTER_CYCLES + INNER_CYCLES) ||
+        !check(inner, LOOPS, INNER_CYCLES) ||
+        isr == NULL || isr->min != ISR_CYCLES || isr->max != ISR_CYCLES)
+    {
+        bench_fail("profile", "wrong_durations");
+        return;
+    }
+    bench_report("profile", "isr_count", isr->count, BENCH_NO_BUDGET);
+    bench_report("profile", "outer_max_cycles", outer->max, BENCH_NO_BUDGET);
+
+    start = bench_now_ns();
+    for (i = 0; i < PROBES; i++)
+    {
+        prof_record(PROF_TAG(PROF_KIND_BEGIN, 3u));
+    }
+    bench_report("profile", "host_ns/probe",
+                 (double)(bench_now_ns() - start) / PROBES, BENCH_NO_BUDGET);
+    prof_reset();
+}
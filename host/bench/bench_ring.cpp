@@ -0,0 +1,235 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_ring.cpp
+ * @author   insert authors names here
+ * @brief    Stress test and throughput of Lab1/spsc_ring.h and
+ *           Lab1/mpsc_ring.h. \n
+ *           Producers and the consumer run on host threads, which is a
+ *           harsher test of the memory ordering than ISRs on one core. The
+ *           consumer checks that every element arrives once and in order
+ *           (per producer for the MPSC ring). The SPSC run mixes single
+ *           pushes/pops with in-place spans of varying size. Throughput
+ *           depends on the machine and is reported as info. A side that
+ *           finds the ring full or empty yields its CPU, otherwise a
+ *           single-CPU host would spin through whole time slices.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "Lab1/spsc_ring.h"
+#include "Lab1/mpsc_ring.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define RING_SIZE           1024u
+#define SPSC_ITEMS          (1024u * 1024u)
+#define MPSC_PRODUCERS      4u
+#define MPSC_ITEMS          (256u * 1024u)      /* per producer */
+#define MPSC_SEQ_BITS       24u
+#define MAX_BURST           64u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static SpscRing<uint32_t, RING_SIZE> s_spsc;
+static MpscRing<uint32_t, RING_SIZE> s_mpsc;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t next_random(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+static void spsc_producer(void)
+{
+    uint32_t random = 1u;
+    uint32_t next = 0u;
+
+    while (next < SPSC_ITEMS)
+    {
+        if ((next_random(&random) & 1u) != 0u)
+        {
+            if (s_spsc.push(next))
+            {
+                next++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+
+        RingSpan<uint32_t> span = s_spsc.push_n(1u + next_random(&random) % MAX_BURST);
+        uint32_t i;
+
+        for (i = 0u; i < span.size && next < SPSC_ITEMS; i++)
+        {
+            span.data[i] = next++;
+        }
+        s_spsc.commit_push(i);
+        if (span.size == 0u)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/** @returns uint32_t - elements out of order */
+static uint32_t spsc_consumer(void)
+{
+    uint32_t random = 2u;
+    uint32_t expected = 0u;
+    uint32_t errors = 0u;
+
+    while (expected < SPSC_ITEMS)
+    {
+        uint32_t value;
+
+        if ((next_random(&random) & 1u) != 0u)
+        {
+            if (s_spsc.pop(value))
+            {
+                errors += (value != expected++) ? 1u : 0u;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+
+        RingSpan<const uint32_t> span = s_spsc.pop_n(1u + next_random(&random) % MAX_BURST);
+
+        for (uint32_t i = 0u; i < span.size; i++)
+        {
+            errors += (span.data[i] != expected++) ? 1u : 0u;
+        }
+        s_spsc.commit_pop(span.size);
+        if (span.size == 0u)
+        {
+            std::this_thread::yield();
+        }
+    }
+    return errors;
+}
+
+static void bench_spsc(void)
+{
+    uint64_t start = bench_now_ns();
+    std::thread producer(spsc_producer);
+    uint32_t errors = spsc_consumer();
+    uint64_t elapsed;
+
+    producer.join();
+    elapsed = bench_now_ns() - start;
+    if (errors != 0u || !s_spsc.empty())
+    {
+        bench_fail("ring.spsc", "lost_or_reordered");
+        return;
+    }
+    bench_report("ring.spsc", "Mitems/s", SPSC_ITEMS * 1e3 / (double)elapsed,
+                 BENCH_NO_BUDGET);
+}
+
+static void mpsc_producer(uint32_t id)
+{
+    uint32_t seq = 0u;
+
+    while (seq < MPSC_ITEMS)
+    {
+        if (s_mpsc.push((id << MPSC_SEQ_BITS) | seq))
+        {
+            seq++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+static void bench_mpsc(void)
+{
+    std::vector<std::thread> producers;
+    uint32_t expected[MPSC_PRODUCERS] = { 0u };
+    uint32_t errors = 0u;
+    uint32_t received = 0u;
+    uint32_t burst[MAX_BURST];
+    uint64_t start = bench_now_ns();
+    uint64_t elapsed;
+
+    for (uint32_t id = 0u; id < MPSC_PRODUCERS; id++)
+    {
+        producers.emplace_back(mpsc_producer, id);
+    }
+    while (received < MPSC_PRODUCERS * MPSC_ITEMS)
+    {
+        uint32_t n = s_mpsc.pop(burst, MAX_BURST);
+
+        if (n == 0u)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint32_t i = 0u; i < n; i++)
+        {
+            uint32_t id = burst[i] >> MPSC_SEQ_BITS;
+            uint32_t seq = burst[i] & ((1u << MPSC_SEQ_BITS) - 1u);
+
+            if (id >= MPSC_PRODUCERS || seq != expected[id]++)
+            {
+                errors++;
+            }
+        }
+        received += n;
+    }
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+    elapsed = bench_now_ns() - start;
+    if (errors != 0u || s_mpsc.pop(burst[0]))
+    {
+        bench_fail("ring.mpsc", "lost_or_reordered");
+        return;
+    }
+    bench_report("ring.mpsc", "Mitems/s",
+                 MPSC_PRODUCERS * MPSC_ITEMS * 1e3 / (double)elapsed,
+                 BENCH_NO_BUDGET);
+}
+
+void bench_ring(void)
+{
+    bench_spsc();
+    bench_mpsc();
+}
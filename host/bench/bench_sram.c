@@ -0,0 +1,126 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_sram.c
+ * @author   insert authors names here
+ * @brief    Host side of the SRAM code / RAM vector table work. \n
+ *           "sram.kernel" runs common/ramfunc_bench.c: the flash and SRAM
+ *           copies must give the same, correct CRC. The cycle comparison is
+ *           only meaningful on the board (g_ramfunc_bench); here the
+ *           wall-clock time is reported as info.\n
+ *           "sram.vtable" installs a SysTick handler with register_isr() and
+ *           checks that the exceptions reach it instead of the weak one.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "common/ramfunc_bench.h"
+#include "common/vtable.h"
+#include "driverlib/systick.h"
+#include "driverlib/sysctl.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** CRC-32 check value of "123456789". */
+#define CRC32_CHECK         0xCBF43926u
+
+#define VTABLE_TICKS        10u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t s_ticks;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void bench_kernel_copies(void)
+{
+    static const uint8_t check[] = "123456789";
+    uint64_t start;
+    uint64_t elapsed;
+
+    if (ramfunc_crc32_flash(check, 9) != CRC32_CHECK ||
+        ramfunc_crc32_sram(check, 9) != CRC32_CHECK)
+    {
+        bench_fail("sram.kernel", "wrong_crc");
+        return;
+    }
+
+    start = bench_now_ns();
+    ramfunc_bench_run();
+    elapsed = bench_now_ns() - start;
+
+    if (g_ramfunc_bench.flash_crc != g_ramfunc_bench.sram_crc)
+    {
+        bench_fail("sram.kernel", "copies_differ");
+        return;
+    }
+    /* each run times both copies RAMFUNC_BENCH_RUNS times */
+    bench_report("sram.kernel", "host_ns/byte",
+                 (double)elapsed / (2.0 * RAMFUNC_BENCH_RUNS * RAMFUNC_BENCH_BYTES),
+                 BENCH_NO_BUDGET);
+}
+
+static void on_systick(void)
+{
+    if (++s_ticks == VTABLE_TICKS)
+    {
+        sim_stop();
+    }
+}
+
+static void run_vtable(void)
+{
+    (void)register_isr(SIM_EXC_SYSTICK, on_systick);
+    SysTickPeriodSet(1000);
+    SysTickIntEnable();
+    SysTickEnable();
+    while (1)
+    {
+        SysCtlSleep();
+    }
+}
+
+static void bench_vtable(void)
+{
+    sim_reset();
+    s_ticks = 0;
+    sim_stop_at_cycle(1000000ull);
+    (void)sim_run(run_vtable);
+    if (s_ticks != VTABLE_TICKS)
+    {
+        bench_fail("sram.vtable", "handler_not_called");
+        return;
+    }
+    bench_report("sram.vtable", "dispatched", s_ticks, BENCH_NO_BUDGET);
+}
+
+void bench_sram(void)
+{
+    bench_kernel_copies();
+    bench_vtable();
+}
@@ -0,0 +1,196 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_stack.c
+ * @author   insert authors names here
+ * @brief    Checks of common/stack_watch.c and host/tools/stack_report.c. \n
+ *           - stack.paint: the high-water mark of a painted buffer is found
+ *             at the exact word.
+ *           - stack.kernel: task stacks are painted by k_task_create(); the
+ *             report written after the kernel benchmark decodes back to its
+ *             four tasks. Peaks are those of the host (x86-64 frames and
+ *             ucontext), reported as info; size target stacks from a board
+ *             capture.
+ *           - stack.map: a STACK USAGE summary and the CSTACK/HEAP blocks
+ *             in the layout of an ILINK 9.x map are read back.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "host/tools/stack_report.h"
+#include "common/kernel_bench.h"
+#include "common/stack_watch.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define PAINT_WORDS         256u
+#define PAINT_TOUCHED       40u
+
+#define KERNEL_TASKS        4u
+#define RUN_CYCLES          100000000ull
+
+#define CAPTURE_SIZE        1024u
+
+/** Excerpt of an ILINK map: placement summary and stack usage summary. */
+static const char s_map[] =
+    "*******************************************************************************\n"
+    "*** PLACEMENT SUMMARY\n"
+    "***\n"
+    "\n"
+    "\"P2\", part 1 of 2:                         0x1'8c40\n"
+    "  RAM_bl                      0x2000'0000  0x1'8c40  <Block>\n"
+    "    VTABLE                    0x2000'0000     0x26c  <Block>\n"
+    "    CSTACK                    0x2000'0408    0x8000  <Block>\n"
+    "      CSTACK                  0x2000'0408    0x8000  <Block tail>\n"
+    "    HEAP                      0x2000'8408  0x1'0000  <Block>\n"
+    "\n"
+    "*******************************************************************************\n"
+    "*** STACK USAGE\n"
+    "***\n"
+    "\n"
+    "  Call Graph Root Category  Max Use  Total Use\n"
+    "  ------------------------  -------  ---------\n"
+    "  interrupt                    104        312\n"
+    "  Program entry                440        440\n"
+    "  Uncalled function             72         72\n"
+    "\n"
+    "\n"
+    "Program entry\n"
+    "  \"__iar_program_start\": 0x0000'0d4d\n";
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t        s_buffer[PAINT_WORDS];
+static char            s_text[CAPTURE_SIZE];
+static uint32_t        s_length;
+static stack_capture_t s_capture;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void capture_sink(const void *data, uint32_t length)
+{
+    if (length > sizeof(s_text) - s_length)
+    {
+        length = sizeof(s_text) - s_length;
+    }
+    memcpy(&s_text[s_length], data, length);
+    s_length += length;
+}
+
+static void bench_paint(void)
+{
+    uint32_t i;
+
+    stack_paint(s_buffer, PAINT_WORDS);
+    if (stack_used(s_buffer, PAINT_WORDS) != 0u)
+    {
+        bench_fail("stack.paint", "unused_not_zero");
+        return;
+    }
+    /* the stack grows down: the top PAINT_TOUCHED words were used */
+    for (i = PAINT_WORDS - PAINT_TOUCHED; i < PAINT_WORDS; i++)
+    {
+        s_buffer[i] = i;
+    }
+    if (stack_used(s_buffer, PAINT_WORDS) != PAINT_TOUCHED * 4u)
+    {
+        bench_fail("stack.paint", "wrong_high_water");
+        return;
+    }
+    bench_report("stack.paint", "peak_bytes", PAINT_TOUCHED * 4u,
+                 BENCH_NO_BUDGET);
+}
+
+static void bench_kernel_tasks(void)
+{
+    char metric[32];
+    uint32_t i;
+
+    sim_reset();
+    sim_stop_at_cycle(RUN_CYCLES);
+    (void)sim_run(kernel_bench_start);
+    if (!g_kernel_bench.done)
+    {
+        bench_fail("stack.kernel", "not_done");
+        return;
+    }
+
+    s_length = 0;
+    kernel_bench_stack_report(capture_sink);
+    stack_capture_init(&s_capture);
+    if (!stack_capture_parse(s_text, s_length, &s_capture) ||
+        s_capture.nrows != KERNEL_TASKS)
+    {
+        bench_fail("stack.kernel", "bad_capture");
+        return;
+    }
+    for (i = 0; i < s_capture.nrows; i++)
+    {
+        const stack_row_t *row = &s_capture.rows[i];
+
+        if (row->used == 0u || row->used > row->size)
+        {
+            bench_fail("stack.kernel", "bad_high_water");
+            return;
+        }
+        snprintf(metric, sizeof(metric), "%s_host_peak_bytes", row->name);
+        bench_report("stack.kernel", metric, row->used, BENCH_NO_BUDGET);
+    }
+}
+
+static void bench_map(void)
+{
+    stack_map_t map;
+
+    if (!stack_map_parse(s_map, sizeof(s_map) - 1u, &map) || !map.analysed ||
+        map.cstack_size != 0x8000u || map.heap_size != 0x10000u ||
+        map.entry_max != 440u || map.irq_total != 312u ||
+        map.uncalled_max != 72u)
+    {
+        bench_fail("stack.map", "misread_map");
+        return;
+    }
+    /* 440 + 312 bytes, plus 25 %, in steps of 256 bytes */
+    if (stack_map_worst_case(&map) != 752u ||
+        stack_suggest(0u, stack_map_worst_case(&map)) != 1024u)
+    {
+        bench_fail("stack.map", "wrong_estimate");
+        return;
+    }
+    bench_report("stack.map", "estimate_bytes", stack_map_worst_case(&map),
+                 BENCH_NO_BUDGET);
+}
+
+void bench_stack(void)
+{
+    bench_paint();
+    bench_kernel_tasks();
+    bench_map();
+}
@@ -0,0 +1,166 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_timer_wheel.c
+ * @author   insert authors names here
+ * @brief    Host timings of common/timer_wheel.c. \n
+ *           Arms a population of timers with random delays, cancels part of
+ *           them and runs the wheel both tick by tick and tickless (jumping by
+ *           tw_ticks_to_next()). Every expiry is checked against the tick it
+ *           was due on before any timing is reported.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "common/timer_wheel.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define BENCH_NAME      "timer_wheel"
+#define TIMERS          4096u
+#define MAX_DELAY       300000u     /* spans all four levels */
+#define PERIODIC_EVERY  8u          /* one timer in 8 is periodic */
+
+typedef struct
+{
+    tw_timer_t timer;
+    uint32_t   due;                 /* absolute tick of the next expiry */
+    uint32_t   fired;
+} bench_timer_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static tw_wheel_t    s_wheel;
+static bench_timer_t s_timers[TIMERS];
+static uint32_t      s_errors;
+static uint32_t      s_expiries;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_expiry(void *arg)
+{
+    bench_timer_t *t = (bench_timer_t *)arg;
+
+    if (s_wheel.now != t->due)
+    {
+        s_errors++;
+    }
+    t->due += t->timer.period;
+    t->fired++;
+    s_expiries++;
+}
+
+/**
+ * Arms all timers, cancels one in four and returns the arm+cancel time.
+ */
+static uint64_t populate(uint64_t *cancel_ns)
+{
+    uint64_t t0;
+    uint64_t t1;
+    uint32_t i;
+
+    srand(1);
+    tw_init(&s_wheel, 0xFFFFF000u);     /* exercise the tick counter wrap */
+    t0 = bench_now_ns();
+    for (i = 0; i < TIMERS; i++)
+    {
+        uint32_t delay = 1u + (uint32_t)rand() % MAX_DELAY;
+        uint32_t period = 0;
+
+        if (i % PERIODIC_EVERY == 0u)
+        {
+            period = 1u + (uint32_t)rand() % 5000u;
+        }
+
+        tw_timer_init(&s_timers[i].timer, on_expiry, &s_timers[i]);
+        s_timers[i].due = s_wheel.now + delay;
+        s_timers[i].fired = 0;
+        tw_arm(&s_wheel, &s_timers[i].timer, delay, period);
+    }
+    t1 = bench_now_ns();
+    for (i = 0; i < TIMERS; i += 4u)
+    {
+        tw_cancel(&s_wheel, &s_timers[i].timer);
+    }
+    *cancel_ns = bench_now_ns() - t1;
+    return t1 - t0;
+}
+
+void bench_timer_wheel(void)
+{
+    uint64_t arm_ns;
+    uint64_t cancel_ns;
+    uint64_t t0;
+    uint64_t tick_ns;
+    uint64_t tickless_ns;
+    uint32_t wakeups = 0;
+    uint32_t ticks;
+    uint32_t tick_expiries;
+
+    /* tick by tick */
+    arm_ns = populate(&cancel_ns);
+    s_errors = 0;
+    s_expiries = 0;
+    t0 = bench_now_ns();
+    for (ticks = 0; ticks < MAX_DELAY + 1u; ticks++)
+    {
+        tw_advance(&s_wheel, 1);
+    }
+    tick_ns = bench_now_ns() - t0;
+    tick_expiries = s_expiries;
+
+    /* tickless: same population, jump from deadline to deadline */
+    (void)populate(&cancel_ns);
+    s_expiries = 0;
+    t0 = bench_now_ns();
+    for (ticks = 0; ticks < MAX_DELAY + 1u; )
+    {
+        uint32_t n = tw_ticks_to_next(&s_wheel, MAX_DELAY + 1u - ticks);
+
+        tw_advance(&s_wheel, n);
+        ticks += n;
+        wakeups++;
+    }
+    tickless_ns = bench_now_ns() - t0;
+
+    if (s_errors != 0u || s_expiries != tick_expiries)
+    {
+        bench_fail(BENCH_NAME, "expiry_on_wrong_tick");
+        return;
+    }
+    bench_report(BENCH_NAME, "arm_ns", (double)arm_ns / TIMERS,
+                 BENCH_NO_BUDGET);
+    bench_report(BENCH_NAME, "cancel_ns", (double)cancel_ns / (TIMERS / 4u),
+                 BENCH_NO_BUDGET);
+    bench_report(BENCH_NAME, "tick_ns", (double)tick_ns / (MAX_DELAY + 1u),
+                 BENCH_NO_BUDGET);
+    bench_report(BENCH_NAME, "tickless_wakeups/expiry",
+                 (double)wakeups / s_expiries, BENCH_NO_BUDGET);
+    bench_report(BENCH_NAME, "tickless_ns/expiry",
+                 (double)tickless_ns / s_expiries, BENCH_NO_BUDGET);
+}
@@ -0,0 +1,359 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_tlog.cpp
+ * @author   insert authors names here
+ * @brief    common/tlog.h decoded by host/tools/tlog_report.c. \n
+ *           The runner logs into the ring, drains it to memory and decodes
+ *           the capture with the strings of its own executable, as
+ *           tlog_decode does with Lab2.out:
+ *           - format: every conversion must read as snprintf() prints it;
+ *           - drop: a ring filled without draining must report exactly the
+ *             records that did not fit;
+ *           - threads: paced producers log while a thread drains; each
+ *             producer's records must come out whole and in order, and
+ *             none may be lost unless counted as dropped.
+ *           Reported: host ns per TLOG2() and per drained record against an
+ *           snprintf() of the same line, and bytes per record against the
+ *           text (what the UART or SWO has to carry).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+
+#include "bench.h"
+#include "common/tlog.h"
+#include "host/tools/tlog_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CAPTURE_SIZE        (8u * 1024u * 1024u)
+#define DECODED_SIZE        (8u * 1024u * 1024u)
+#define THREAD_PRODUCERS    3u
+#define THREAD_RECORDS      50000u      /* per producer */
+#define DROP_RECORDS        100u
+#define TIMED_BATCHES       2000u
+/** Records per batch, below the ring size so that none is dropped. */
+#define TIMED_BATCH         64u
+#define TEXT_SIZE           64u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t           s_capture[CAPTURE_SIZE];
+static size_t            s_captured;
+static char              s_decoded[DECODED_SIZE];
+static tlog_strings_t    s_strings;
+static uint8_t          *s_elf;
+static volatile size_t   s_sink;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void capture_sink(const void *data, uint32_t length)
+{
+    if (s_captured + length <= CAPTURE_SIZE)
+    {
+        memcpy(s_capture + s_captured, data, length);
+    }
+    s_captured += length;
+}
+
+static void null_sink(const void *data, uint32_t length)
+{
+    (void)data;
+    s_sink = s_sink + length;
+}
+
+/** Loads the strings of this executable, once. */
+static bool load_strings(void)
+{
+    FILE *file;
+    long size;
+
+    if (s_elf != NULL)
+    {
+        return true;
+    }
+    file = fopen("/proc/self/exe", "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    s_elf = static_cast<uint8_t *>(malloc((size > 0) ? static_cast<size_t>(size) : 1u));
+    if (s_elf == NULL ||
+        fread(s_elf, 1, static_cast<size_t>(size), file) != static_cast<size_t>(size) ||
+        !tlog_strings_load(s_elf, static_cast<size_t>(size), &s_strings))
+    {
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+/** Decodes s_capture into s_decoded. */
+static bool decode(tlog_stats_t *stats)
+{
+    FILE *out = fmemopen(s_decoded, sizeof(s_decoded), "w");
+
+    if (out == NULL || s_captured > CAPTURE_SIZE)
+    {
+        return false;
+    }
+    tlog_report_print(out, &s_strings, s_capture, s_captured, stats);
+    fputc('\0', out);
+    fclose(out);
+    return true;
+}
+
+static void bench_format(void)
+{
+    char expected[1024];
+    size_t used = 0u;
+    tlog_stats_t stats;
+    float third = 1.0f / 3.0f;
+
+    tlog_reset();
+    s_captured = 0u;
+
+    TLOG0("no arguments, 100%% literal");
+    TLOG1("negative %d", -123456);
+    TLOG2("hex %08x and %#X", 0xBEEFu, 0xC0FFEEu);
+    TLOG3("char '%c', padded [%-6u] [%5d]", 'k', 42u, -7);
+    TLOG3("float %f %.3e %g", TLOG_FLOAT(third), TLOG_FLOAT(-1234.5f),
+          TLOG_FLOAT(6.25e-5f));
+    TLOG4("four %u %u %u %lu", 1u, 2u, 3u, 4u);
+    TLOG1("missing %u %u", 9u);
+
+    used += snprintf(expected + used, sizeof(expected) - used,
+                     "no arguments, 100%% literal\n");
+    used += snprintf(expected + used, sizeof(expected) - used,
+                     "negative %d\n", -123456);
+    used += snprintf(expected + used, sizeof(expected) - used,
+                     "hex %08x and %#X\n", 0xBEEFu, 0xC0FFEEu);
+    used += snprintf(expected + used, sizeof(expected) - used,
+                     "char '%c', padded [%-6u] [%5d]\n", 'k', 42u, -7);
+    used += snprintf(expected + used, sizeof(expected) - used,
+                     "float %f %.3e %g\n", static_cast<double>(third),
+                     -1234.5, static_cast<double>(6.25e-5f));
+    used += snprintf(expected + used, sizeof(expected) - used,
+                     "four 1 2 3 4\n");
+    (void)snprintf(expected + used, sizeof(expected) - used,
+                   "missing 9 <?>\n");
+
+    if (tlog_drain(capture_sink) != 7u || !decode(&stats))
+    {
+        bench_fail("tlog.format", "drain");
+        return;
+    }
+    if (strcmp(s_decoded, expected) != 0 || stats.records != 7u ||
+        stats.errors != 0u)
+    {
+        bench_fail("tlog.format", "differs_from_snprintf");
+        return;
+    }
+
+    /* a capture joined in the middle of a record: skipped up to the next batch */
+    memmove(s_capture, s_capture + 6u, s_captured - 6u);
+    s_captured -= 6u;
+    TLOG1("after %u", 1u);
+    (void)tlog_drain(capture_sink);
+    if (!decode(&stats) || strcmp(s_decoded, "after 1\n") != 0)
+    {
+        bench_fail("tlog.format", "no_resync");
+        return;
+    }
+    bench_report("tlog.format", "records", 8.0, BENCH_NO_BUDGET);
+}
+
+static void bench_drop(void)
+{
+    const uint32_t fit = TLOG_RING_WORDS / 3u;
+    tlog_stats_t stats;
+    uint32_t i;
+
+    tlog_reset();
+    s_captured = 0u;
+    for (i = 0u; i < DROP_RECORDS; i++)
+    {
+        TLOG2("fill %u of %u", i, DROP_RECORDS);
+    }
+    (void)tlog_drain(capture_sink);
+    if (!decode(&stats) || stats.records != fit ||
+        stats.dropped != DROP_RECORDS - fit ||
+        strncmp(s_decoded, "tlog: ", 6u) != 0)
+    {
+        bench_fail("tlog.drop", "dropped_count");
+        return;
+    }
+    bench_report("tlog.drop", "dropped", stats.dropped, BENCH_NO_BUDGET);
+}
+
+static void bench_threads(void)
+{
+    std::atomic<uint32_t> running(THREAD_PRODUCERS);
+    std::thread producers[THREAD_PRODUCERS];
+    uint32_t next[THREAD_PRODUCERS] = { 0u };
+    tlog_stats_t stats;
+    uint32_t errors = 0u;
+    char *line;
+
+    tlog_reset();
+    s_captured = 0u;
+    for (uint32_t t = 0u; t < THREAD_PRODUCERS; t++)
+    {
+        producers[t] = std::thread([t, &running]() {
+            for (uint32_t seq = 0u; seq < THREAD_RECORDS; seq++)
+            {
+                TLOG3("thread %u seq %u check %u", t, seq, seq * 7u + t);
+                /* a paced source: the drain keeps up, apart from bursts */
+                while (g_tlog.head - g_tlog.tail > TLOG_RING_WORDS / 2u)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            running--;
+        });
+    }
+    while (running.load() != 0u)
+    {
+        if (tlog_drain(capture_sink) == 0u)
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (uint32_t t = 0u; t < THREAD_PRODUCERS; t++)
+    {
+        producers[t].join();
+    }
+    (void)tlog_drain(capture_sink);
+
+    if (!decode(&stats) || stats.errors != 0u ||
+        stats.records + stats.dropped != THREAD_PRODUCERS * THREAD_RECORDS)
+    {
+        bench_fail("tlog.threads", "lost_records");
+        return;
+    }
+    for (line = s_decoded; *line != '\0'; line = strchr(line, '\n') + 1)
+    {
+        unsigned int t;
+        unsigned int seq;
+        unsigned int check;
+
+        if (strncmp(line, "tlog: ", 6u) == 0)
+        {
+            continue;
+        }
+        if (sscanf(line, "thread %u seq %u check %u", &t, &seq, &check) != 3 ||
+            t >= THREAD_PRODUCERS || seq < next[t] || check != seq * 7u + t)
+        {
+            errors++;
+            break;
+        }
+        next[t] = seq + 1u;
+    }
+    if (errors != 0u)
+    {
+        bench_fail("tlog.threads", "torn_or_out_of_order");
+        return;
+    }
+    bench_report("tlog.threads", "records", stats.records, BENCH_NO_BUDGET);
+    bench_report("tlog.threads", "dropped", stats.dropped, BENCH_NO_BUDGET);
+}
+
+static void bench_cost(void)
+{
+    uint64_t logged = 0u;
+    uint64_t drained = 0u;
+    uint64_t printed = 0u;
+    char text[TEXT_SIZE];
+    size_t textBytes = 0u;
+    uint32_t value = 12345u;
+
+    tlog_reset();
+    for (uint32_t batch = 0u; batch < TIMED_BATCHES; batch++)
+    {
+        uint64_t start = bench_now_ns();
+
+        for (uint32_t i = 0u; i < TIMED_BATCH; i++)
+        {
+            TLOG2("adc block %u mean %u", i, value);
+        }
+        logged += bench_now_ns() - start;
+
+        start = bench_now_ns();
+        (void)tlog_drain(null_sink);
+        drained += bench_now_ns() - start;
+
+        start = bench_now_ns();
+        for (uint32_t i = 0u; i < TIMED_BATCH; i++)
+        {
+            textBytes = static_cast<size_t>(snprintf(text, sizeof(text),
+                                                     "adc block %u mean %u\n",
+                                                     i, value));
+            s_sink = s_sink + textBytes;
+        }
+        printed += bench_now_ns() - start;
+    }
+    if (g_tlog.dropped != 0u)
+    {
+        bench_fail("tlog.cost", "dropped");
+        return;
+    }
+    bench_report("tlog.cost", "host_ns/call",
+                 static_cast<double>(logged) / (TIMED_BATCHES * TIMED_BATCH),
+                 BENCH_NO_BUDGET);
+    bench_report("tlog.cost", "drain_host_ns/record",
+                 static_cast<double>(drained) / (TIMED_BATCHES * TIMED_BATCH),
+                 BENCH_NO_BUDGET);
+    bench_report("tlog.cost", "snprintf_host_ns/call",
+                 static_cast<double>(printed) / (TIMED_BATCHES * TIMED_BATCH),
+                 BENCH_NO_BUDGET);
+    bench_report("tlog.cost", "bytes/record", 3.0 * sizeof(uint32_t),
+                 BENCH_NO_BUDGET);
+    bench_report("tlog.cost", "text_bytes/record",
+                 static_cast<double>(textBytes), BENCH_NO_BUDGET);
+}
+
+void bench_tlog(void)
+{
+    if (!load_strings())
+    {
+        bench_fail("tlog", "no_strings_section");
+        return;
+    }
+    bench_format();
+    bench_drop();
+    bench_threads();
+    bench_cost();
+}
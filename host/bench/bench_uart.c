@@ -0,0 +1,289 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_uart.c
+ * @author   insert authors names here
+ * @brief    Console output through common/uart_stdio.c against the blocking
+ *           path it replaces. \n
+ *           Both cases stream the same text at 115200 baud and 120 MHz:
+ *           "uart.polled" puts every byte with UARTCharPut(), spinning while
+ *           the TX FIFO is full; "uart.dma" writes it line by line with
+ *           uart_stdio_write() and flushes. Reported per case: throughput,
+ *           elapsed time over the time the bytes take on the wire (1.0 is a
+ *           line that never idles) and the CPU occupancy, i.e. cycles not
+ *           spent asleep. The transmitted bytes are checked against the
+ *           text.\n
+ *           The simulator charges HAL calls and exceptions only; the copy
+ *           loops of uart_stdio.c cost nothing here, so the CPU figure of
+ *           the DMA case is a lower bound. "uart.rx" feeds a line into the
+ *           RX pin and checks what uart_stdio_read() returns and echoes; its
+ *           CPU figure covers the read, which sleeps until the line ends.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "common/uart_stdio.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+#define BAUD                115200u
+/** 8N1 frame. */
+#define FRAME_BITS          10u
+#define LINES               300u
+#define LINE_MAX            64u
+/** Room for the text with "\r\n" line ends. */
+#define TEXT_MAX            (LINES * LINE_MAX)
+/** Safety stop: 10 s of simulated time. */
+#define RUN_CYCLES          1200000000ull
+
+/** Budgets, slightly above the current figures. */
+#define BUDGET_LINE_RATIO   1.02
+#define BUDGET_DMA_CPU_PCT  0.15
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static char     s_text[TEXT_MAX];
+static uint32_t s_textLen;
+static uint32_t s_lineLen[LINES];
+
+static char     s_wire[TEXT_MAX];
+static uint32_t s_wireLen;
+
+static uint64_t s_startCycles;
+static uint64_t s_startSleep;
+static uint64_t s_endCycles;
+static uint64_t s_endSleep;
+
+static char     s_read[16];
+static uint32_t s_readLen;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_tx(uint32_t base, uint8_t byte)
+{
+    (void)base;
+
+    if (s_wireLen < TEXT_MAX)
+    {
+        s_wire[s_wireLen] = (char)byte;
+    }
+    s_wireLen++;
+}
+
+static void make_text(void)
+{
+    uint32_t i;
+
+    s_textLen = 0;
+    for (i = 0; i < LINES; i++)
+    {
+        s_lineLen[i] = (uint32_t)snprintf(&s_text[s_textLen], LINE_MAX,
+            "line %03u: the quick brown fox jumps over the lazy dog\n", i);
+        s_textLen += s_lineLen[i];
+    }
+}
+
+static void mark_start(void)
+{
+    s_startCycles = g_sim.cycles;
+    s_startSleep = g_sim.sleep_cycles;
+}
+
+static void mark_end(void)
+{
+    s_endCycles = g_sim.cycles;
+    s_endSleep = g_sim.sleep_cycles;
+}
+
+/**
+ * The blocking path: every byte waits for room in the TX FIFO.
+ */
+static void run_polled(void)
+{
+    uint32_t clock = SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                                        SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240,
+                                        CLOCK_HZ);
+    uint32_t i;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+    GPIOPinConfigure(GPIO_PA0_U0RX);
+    GPIOPinConfigure(GPIO_PA1_U0TX);
+    GPIOPinTypeUART(GPIO_PORTA_AHB_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+    UARTConfigSetExpClk(UART0_BASE, clock, BAUD,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
+                        UART_CONFIG_PAR_NONE);
+    UARTEnable(UART0_BASE);
+
+    mark_start();
+    for (i = 0; i < s_textLen; i++)
+    {
+        if (s_text[i] == '\n')
+        {
+            UARTCharPut(UART0_BASE, '\r');
+        }
+        UARTCharPut(UART0_BASE, (unsigned char)s_text[i]);
+    }
+    while (UARTBusy(UART0_BASE))
+    {
+    }
+    mark_end();
+}
+
+static void run_dma(void)
+{
+    uint32_t clock = SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                                        SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240,
+                                        CLOCK_HZ);
+    const char *line = s_text;
+    uint32_t i;
+
+    uart_stdio_init(clock, NULL);
+
+    mark_start();
+    for (i = 0; i < LINES; i++)
+    {
+        (void)uart_stdio_write(line, s_lineLen[i]);
+        line += s_lineLen[i];
+    }
+    uart_stdio_flush();
+    mark_end();
+}
+
+static void run_rx(void)
+{
+    static const char input[] = "3.14\r";
+    uint32_t clock = SysCtlClockFreqSet(SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                                        SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240,
+                                        CLOCK_HZ);
+
+    uart_stdio_init(clock, NULL);
+    sim_uart_receive(UART0_BASE, (const uint8_t *)input, sizeof(input) - 1u);
+
+    mark_start();
+    s_readLen = (uint32_t)uart_stdio_read(s_read, sizeof(s_read));
+    mark_end();
+    uart_stdio_flush();
+}
+
+/** @returns bool - true if the wire carried the text with "\r\n" line ends */
+static bool wire_matches(void)
+{
+    uint32_t w = 0;
+    uint32_t i;
+
+    for (i = 0; i < s_textLen; i++)
+    {
+        if (s_text[i] == '\n' && (w >= s_wireLen || s_wire[w++] != '\r'))
+        {
+            return false;
+        }
+        if (w >= s_wireLen || s_wire[w++] != s_text[i])
+        {
+            return false;
+        }
+    }
+    return w == s_wireLen;
+}
+
+static bool run_case(const char *name, void (*entry)(void))
+{
+    sim_reset();
+    s_wireLen = 0;
+    s_endCycles = 0;
+    sim_uart_set_tx_hook(on_tx);
+    sim_stop_at_cycle(RUN_CYCLES);
+    if (sim_run(entry) || s_endCycles == 0)
+    {
+        bench_fail(name, "did_not_finish");
+        return false;
+    }
+    return true;
+}
+
+static void bench_tx(const char *name, void (*entry)(void), double cpu_budget)
+{
+    double cycles;
+    double wire_cycles;
+
+    if (!run_case(name, entry))
+    {
+        return;
+    }
+    if (!wire_matches())
+    {
+        bench_fail(name, "content_mismatch");
+        return;
+    }
+    cycles = (double)(s_endCycles - s_startCycles);
+    wire_cycles = (double)s_wireLen * FRAME_BITS * CLOCK_HZ / BAUD;
+
+    bench_report(name, "bytes/s", s_wireLen * (double)CLOCK_HZ / cycles,
+                 BENCH_NO_BUDGET);
+    bench_report(name, "time/wire_time", cycles / wire_cycles,
+                 BUDGET_LINE_RATIO);
+    bench_report(name, "cpu_busy_%",
+                 100.0 * (cycles - (double)(s_endSleep - s_startSleep)) / cycles,
+                 cpu_budget);
+}
+
+void bench_uart(void)
+{
+    make_text();
+
+    bench_tx("uart.polled", run_polled, BENCH_NO_BUDGET);
+    bench_tx("uart.dma", run_dma, BUDGET_DMA_CPU_PCT);
+    bench_report("uart.dma", "dma_starts", g_uart_stdio.dma_starts,
+                 BENCH_NO_BUDGET);
+    bench_report("uart.dma", "tx_waits", g_uart_stdio.tx_waits,
+                 BENCH_NO_BUDGET);
+
+    if (!run_case("uart.rx", run_rx))
+    {
+        return;
+    }
+    if (s_readLen != 5u || memcmp(s_read, "3.14\n", 5u) != 0 ||
+        s_wireLen != 6u || memcmp(s_wire, "3.14\r\n", 6u) != 0)
+    {
+        bench_fail("uart.rx", "wrong_line_or_echo");
+        return;
+    }
+    bench_report("uart.rx", "cpu_busy_%",
+                 100.0 * (double)((s_endCycles - s_startCycles) -
+                                  (s_endSleep - s_startSleep)) /
+                     (double)(s_endCycles - s_startCycles),
+                 BENCH_NO_BUDGET);
+}
@@ -0,0 +1,172 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_vectors.cpp
+ * @author   insert authors names here
+ * @brief    Vector table built by common/vector_table.h. \n
+ *           The table of kBindings is checked by the compiler (static_assert
+ *           below), then installed in the simulator: every bound vector must
+ *           reach its handler with the priority of its binding, an unbound
+ *           one must reach vector_trap(). Reported: cycles to apply the
+ *           priorities with the batched word stores against one
+ *           IntPrioritySet() per binding, and the number of words.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "driverlib/interrupt.h"
+#include "common/vector_table.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Budget, slightly above the current model. */
+#define BUDGET_APPLY_CYCLES     34.0
+
+/** Bound to nothing below: must trap. */
+#define UNBOUND_IRQ             INT_UART3
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static volatile uint32_t s_hits[VTABLE_ENTRIES];
+static bool              s_ok;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void on_irq(void)
+{
+    s_hits[sim_active_exception()]++;
+}
+
+static void on_reset(void)
+{
+}
+
+/** A driver set: UART, Ethernet, uDMA, timers, CAN, SysTick, PendSV. */
+static constexpr Binding kBindings[] =
+{
+    bind<Irq::UART0, 2>(on_irq),
+    bind<Irq::EMAC0, 3>(on_irq),
+    bind<Irq::UDMA, 3>(on_irq),
+    bind<Irq::UDMAERR, 1>(on_irq),
+    bind<Irq::TIMER0A, 4>(on_irq),
+    bind<Irq::TIMER0B, 4>(on_irq),
+    bind<Irq::CAN0, 5>(on_irq),
+    bind<Irq::GPIOQ0, 5>(on_irq),
+    bind<Irq::SysTick, 6>(on_irq),
+    bind<Irq::PendSV, 7>(on_irq),
+    bind<Irq::HardFault>(on_irq),
+};
+
+static constexpr VectorHandlers kHandlers =
+    vector_handlers(on_reset, kBindings);
+static constexpr VectorPriorities kPriorities = vector_priorities(kBindings);
+
+static_assert(kHandlers.fn[0] == on_reset, "reset entry");
+static_assert(kHandlers.fn[INT_UART0 - 1u] == on_irq, "bound vector");
+static_assert(kHandlers.fn[UNBOUND_IRQ - 1u] == vector_trap, "unbound vector");
+static_assert(kHandlers.fn[13u - 1u] == nullptr, "reserved vector");
+/* SYS_PRI3 (PendSV, SysTick), PRI1 (UART0), PRI4 (TIMER0A), PRI5 (TIMER0B),
+   PRI9 (CAN0), PRI10 (EMAC0), PRI11 (uDMA, uDMA error), PRI21 (GPIOQ0) */
+static_assert(kPriorities.count == 8u, "one word per group of 4 vectors");
+static_assert(kPriorities.write[0].addr == NVIC_SYS_PRI_BASE + 8u &&
+              kPriorities.write[0].value == 0xC0E00000u, "SYS_PRI3");
+
+/**
+ * Checks every binding's priority and that each IRQ reaches its handler.
+ */
+static void run_vectors(void)
+{
+    uint64_t start;
+    uint64_t batched;
+    uint64_t each;
+    size_t i;
+
+    vector_table_install(kHandlers);
+
+    start = g_sim.cycles;
+    vector_priorities_apply(kPriorities);
+    batched = g_sim.cycles - start;
+
+    start = g_sim.cycles;
+    for (i = 0; i < sizeof(kBindings) / sizeof(kBindings[0]); i++)
+    {
+        if (kBindings[i].priority != IRQ_PRIO_NONE)
+        {
+            IntPrioritySet(kBindings[i].vector,
+                           kBindings[i].priority << IRQ_PRIO_SHIFT);
+        }
+    }
+    each = g_sim.cycles - start;
+
+    for (i = 0; i < sizeof(kBindings) / sizeof(kBindings[0]); i++)
+    {
+        uint32_t v = kBindings[i].vector;
+
+        if (kBindings[i].priority != IRQ_PRIO_NONE &&
+            sim_get_priority(v) != kBindings[i].priority << IRQ_PRIO_SHIFT)
+        {
+            return;
+        }
+        if (v >= INT_GPIOA)
+        {
+            IntEnable(v);
+            IntTrigger(v);
+            if (s_hits[v] != 1u)
+            {
+                return;
+            }
+        }
+    }
+
+    IntEnable(UNBOUND_IRQ);
+    IntTrigger(UNBOUND_IRQ);
+    if (g_vector_trap != UNBOUND_IRQ)
+    {
+        return;
+    }
+
+    bench_report("vectors.priorities", "cycles_batched", (double)batched,
+                 BUDGET_APPLY_CYCLES);
+    bench_report("vectors.priorities", "cycles_intpriorityset", (double)each,
+                 BENCH_NO_BUDGET);
+    bench_report("vectors.priorities", "words", kPriorities.count,
+                 BENCH_NO_BUDGET);
+    s_ok = true;
+}
+
+void bench_vectors(void)
+{
+    s_ok = false;
+    g_vector_trap = 0u;
+    sim_reset();
+    (void)sim_run(run_vectors);
+    if (!s_ok)
+    {
+        bench_fail("vectors.priorities", "wrong_dispatch");
+    }
+}
@@ -0,0 +1,395 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - benchmark runner
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     bench_wave.c
+ * @author   insert authors names here
+ * @brief    common/wave.c on the timer and uDMA models. \n
+ *           Every case starts its output, then sleeps in WFI until the end
+ *           of the run; the edges are taken from the GPIO observer.
+ *           Reported: the core cycles spent after the start call returned
+ *           and the interrupts taken (both should be about 0: the output
+ *           runs by itself), and the timing of the edges.\n
+ *           "wave.pwm" runs T2CCP0 (PM0) at 20 kHz, 25 %, and changes to
+ *           75 % halfway: every period must be 6000 cycles and each high
+ *           time exactly 25 % or 75 % of it, the old value before the
+ *           change and the new one after, never cut. "wave.pwm.slow" runs
+ *           T3CCP0 (PM2) at 2 Hz, which needs PIOSC as the timer clock.\n
+ *           "wave.pattern" plays four steps of different lengths on PN0-PN2
+ *           with a 100 us tick, "wave.pattern.halved" two one-tick steps,
+ *           which take the halved tick. Each change of the pins must come
+ *           with the value and at the tick the steps give, from the first
+ *           step, written by the start call, on.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bench.h"
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "common/wave.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CLOCK_HZ            120000000u
+
+/** Edges kept per run. */
+#define MAX_EDGES           4096u
+
+#define PWM_FREQ_HZ         20000u
+#define PWM_DUTY            250u
+#define PWM_DUTY_AFTER      750u
+/** 20 ms of the fast output; the duty changes at half of it. */
+#define PWM_RUN_CYCLES      2400000ull
+
+#define SLOW_FREQ_HZ        2u
+#define SLOW_DUTY           100u
+/** 5 s: ten periods. */
+#define SLOW_RUN_CYCLES     600000000ull
+
+#define PATTERN_TICK_US     100u
+#define PATTERN_PINS        (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2)
+/** 200 ms: 2000 ticks. */
+#define PATTERN_RUN_CYCLES  24000000ull
+
+typedef struct
+{
+    uint64_t cycle;
+    uint8_t  value;
+} edge_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const wave_pin_t s_fastPin =
+{
+    TIMER2_BASE, TIMER_A, GPIO_PORTM_BASE, GPIO_PIN_0, GPIO_PM0_T2CCP0
+};
+
+static const wave_pin_t s_slowPin =
+{
+    TIMER3_BASE, TIMER_A, GPIO_PORTM_BASE, GPIO_PIN_2, GPIO_PM2_T3CCP0
+};
+
+static const wave_step_t s_steps[] =
+{
+    { 0x1u, 3u }, { 0x2u, 1u }, { 0x4u, 2u }, { 0x0u, 1u },
+};
+
+static const wave_step_t s_halvedSteps[] =
+{
+    { 0x1u, 1u }, { 0x2u, 1u },
+};
+
+static uint32_t s_port;
+static uint8_t  s_pins;
+static edge_t   s_edges[MAX_EDGES];
+static uint32_t s_edgeCount;
+static uint8_t  s_level;
+
+static const wave_step_t *s_patternSteps;
+static uint32_t s_patternCount;
+
+static bool     s_started;
+static uint64_t s_setupWork;
+static uint64_t s_setupIsrs;
+static uint64_t s_dutyChange;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint64_t work_cycles(void)
+{
+    return g_sim.cycles - g_sim.sleep_cycles - g_sim.delay_cycles;
+}
+
+/** Keeps the changes of the observed pins. */
+static void on_gpio(uint32_t port, uint8_t pins, uint8_t value)
+{
+    uint8_t level;
+
+    if (port != s_port || (pins & s_pins) == 0u)
+    {
+        return;
+    }
+    level = (uint8_t)((s_level & ~pins) | (value & pins)) & s_pins;
+    if ((level == s_level && s_edgeCount != 0u) || s_edgeCount == MAX_EDGES)
+    {
+        return;
+    }
+    s_level = level;
+    s_edges[s_edgeCount].cycle = g_sim.cycles;
+    s_edges[s_edgeCount].value = level;
+    s_edgeCount++;
+}
+
+static void clock_and_ports(void)
+{
+    (void)SysCtlClockFreqSet((SYSCTL_XTAL_25MHZ | SYSCTL_OSC_MAIN |
+                              SYSCTL_USE_PLL | SYSCTL_CFG_VCO_240), CLOCK_HZ);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOM);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPION);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOM) ||
+           !SysCtlPeripheralReady(SYSCTL_PERIPH_GPION))
+    {
+    }
+}
+
+static void setup_done(bool started)
+{
+    s_started = started;
+    s_setupWork = work_cycles();
+    s_setupIsrs = g_sim.isr_count;
+}
+
+static void run_pwm(void)
+{
+    clock_and_ports();
+    setup_done(wave_pwm_start(&s_fastPin, CLOCK_HZ, PWM_FREQ_HZ, PWM_DUTY));
+    /* nothing wakes the core from sleep here: wait with the CPU instead */
+    SysCtlDelay((uint32_t)((PWM_RUN_CYCLES / 2u - g_sim.cycles) / 3u));
+    s_dutyChange = g_sim.cycles;
+    wave_pwm_duty(&s_fastPin, PWM_DUTY_AFTER);
+    s_setupWork = work_cycles();
+    while (1)
+    {
+        SysCtlSleep();
+    }
+}
+
+static void run_slow(void)
+{
+    clock_and_ports();
+    setup_done(wave_pwm_start(&s_slowPin, CLOCK_HZ, SLOW_FREQ_HZ, SLOW_DUTY));
+    while (1)
+    {
+        SysCtlSleep();
+    }
+}
+
+static void run_pattern(void)
+{
+    clock_and_ports();
+    GPIOPinTypeGPIOOutput(GPIO_PORTN_BASE, PATTERN_PINS);
+    setup_done(wave_pattern_start(TIMER0_BASE, CLOCK_HZ, GPIO_PORTN_BASE,
+                                  PATTERN_PINS, s_patternSteps,
+                                  s_patternCount, PATTERN_TICK_US));
+    while (1)
+    {
+        SysCtlSleep();
+    }
+}
+
+/**
+ * Runs @p entry until @p cycles, observing @p pins of @p port.
+ *
+ * @returns bool - false (and the case failed) if the output did not start
+ */
+static bool run(const char *name, void (*entry)(void), uint64_t cycles,
+                uint32_t port, uint8_t pins)
+{
+    sim_reset();
+    s_port = port;
+    s_pins = pins;
+    s_edgeCount = 0u;
+    s_level = 0u;
+    s_started = false;
+    s_dutyChange = UINT64_MAX;
+    sim_set_gpio_hook(on_gpio);
+    sim_stop_at_cycle(cycles);
+    (void)sim_run(entry);
+    sim_set_gpio_hook(NULL);
+    if (!s_started)
+    {
+        bench_fail(name, "not_started");
+        return false;
+    }
+    bench_report(name, "cpu_cycles_after_start",
+                 (double)(work_cycles() - s_setupWork), 40.0);
+    bench_report(name, "irqs_after_start",
+                 (double)(g_sim.isr_count - s_setupIsrs), BENCH_NO_BUDGET);
+    if (g_sim.isr_count != s_setupIsrs)
+    {
+        bench_fail(name, "interrupts_taken");
+    }
+    return true;
+}
+
+/**
+ * Checks the PWM edges: periods of @p period cycles, high for the duty in
+ * force (the old one before @p change, the new one from the next period).
+ */
+static void check_pwm(const char *name, uint32_t period, uint32_t before,
+                      uint32_t after, uint64_t change)
+{
+    uint32_t periods = 0u;
+    uint32_t wrongPeriods = 0u;
+    uint32_t wrongDuty = 0u;
+    uint32_t i;
+
+    for (i = 0; i + 2u < s_edgeCount; i++)
+    {
+        const edge_t *rise = &s_edges[i];
+        uint64_t high;
+        uint64_t expect;
+
+        if (rise->value == 0u || i == 0u)
+        {
+            continue;
+        }
+        high = s_edges[i + 1u].cycle - rise->cycle;
+        expect = (uint64_t)period * ((rise->cycle > change) ? after : before) /
+                 WAVE_DUTY_FULL;
+        periods++;
+        if (s_edges[i + 2u].cycle - rise->cycle != period)
+        {
+            wrongPeriods++;
+        }
+        if (high != expect)
+        {
+            wrongDuty++;
+        }
+    }
+    bench_report(name, "periods", periods, BENCH_NO_BUDGET);
+    bench_report(name, "wrong_periods", wrongPeriods, BENCH_NO_BUDGET);
+    bench_report(name, "wrong_high_times", wrongDuty, BENCH_NO_BUDGET);
+    if (periods < 2u)
+    {
+        bench_fail(name, "no_edges");
+    }
+    else if (wrongPeriods != 0u || wrongDuty != 0u)
+    {
+        bench_fail(name, "wrong_waveform");
+    }
+}
+
+static void bench_pwm(void)
+{
+    if (run("wave.pwm", run_pwm, PWM_RUN_CYCLES, GPIO_PORTM_BASE, GPIO_PIN_0))
+    {
+        check_pwm("wave.pwm", CLOCK_HZ / PWM_FREQ_HZ, PWM_DUTY, PWM_DUTY_AFTER,
+                  s_dutyChange);
+    }
+    wave_pwm_stop(&s_fastPin);
+
+    /* PIOSC counts: 8 Mcounts a period, 7.5 core cycles each */
+    if (run("wave.pwm.slow", run_slow, SLOW_RUN_CYCLES, GPIO_PORTM_BASE,
+            GPIO_PIN_2))
+    {
+        check_pwm("wave.pwm.slow", CLOCK_HZ / SLOW_FREQ_HZ, SLOW_DUTY,
+                  SLOW_DUTY, UINT64_MAX);
+    }
+    wave_pwm_stop(&s_slowPin);
+}
+
+/** @returns uint8_t - pin levels at @p tick of the pattern */
+static uint8_t pattern_value(uint32_t tick, uint32_t total)
+{
+    uint32_t i;
+
+    tick %= total;
+    for (i = 0; i < s_patternCount; i++)
+    {
+        if (tick < s_patternSteps[i].ticks)
+        {
+            break;
+        }
+        tick -= s_patternSteps[i].ticks;
+    }
+    return s_patternSteps[i].value;
+}
+
+/**
+ * Every change after the first write must be the next one the steps give,
+ * at its tick from that write.
+ */
+static void bench_pattern(const char *name, const wave_step_t *steps,
+                          uint32_t count)
+{
+    uint64_t tick = (uint64_t)CLOCK_HZ / 1000000u * PATTERN_TICK_US;
+    uint64_t worst = 0u;
+    uint32_t wrongValues = 0u;
+    uint32_t total = 0u;
+    uint32_t k = 0u;
+    uint32_t i;
+
+    s_patternSteps = steps;
+    s_patternCount = count;
+    for (i = 0; i < count; i++)
+    {
+        total += steps[i].ticks;
+    }
+    if (run(name, run_pattern, PATTERN_RUN_CYCLES, GPIO_PORTN_BASE,
+            PATTERN_PINS))
+    {
+        /* the start call writes step 0 a few cycles before the timer runs */
+        for (i = 1; i < s_edgeCount; i++)
+        {
+            uint64_t at;
+            uint64_t error;
+
+            do
+            {
+                k++;
+            } while (pattern_value(k, total) == pattern_value(k - 1u, total));
+            at = s_edges[0].cycle + k * tick;
+            error = (s_edges[i].cycle > at) ? s_edges[i].cycle - at
+                                            : at - s_edges[i].cycle;
+            if (error > worst)
+            {
+                worst = error;
+            }
+            if (s_edges[i].value != pattern_value(k, total))
+            {
+                wrongValues++;
+            }
+        }
+        bench_report(name, "changes", s_edgeCount, BENCH_NO_BUDGET);
+        bench_report(name, "edge_error_cycles", (double)worst, 40.0);
+        bench_report(name, "wrong_values", wrongValues, BENCH_NO_BUDGET);
+        if (s_edgeCount < 2u * count)
+        {
+            bench_fail(name, "no_changes");
+        }
+        else if (wrongValues != 0u)
+        {
+            bench_fail(name, "wrong_values");
+        }
+    }
+    wave_pattern_stop(TIMER0_BASE);
+}
+
+void bench_wave(void)
+{
+    bench_pwm();
+    bench_pattern("wave.pattern", s_steps,
+                  sizeof(s_steps) / sizeof(s_steps[0]));
+    bench_pattern("wave.pattern.halved", s_halvedSteps,
+                  sizeof(s_halvedSteps) / sizeof(s_halvedSteps[0]));
+}
@@ -0,0 +1,134 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - network stand-ins
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_loop.c
+ * @author   insert authors names here
+ * @brief    Software loopback transport (see net_loop.h). Single-threaded:
+ *           send() and poll() must come from the same thread.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "host/net/net_loop.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static bool loop_send(net_if_t *netif, net_buf_t *buf)
+{
+    net_loop_t *loop = (net_loop_t *)netif->priv;
+
+    if (loop->count == loop->depth)
+    {
+        netif->stats.tx_full++;
+        return false;
+    }
+    if (buf->len < NET_FRAME_MIN)
+    {
+        memset(&buf->data[buf->len], 0, NET_FRAME_MIN - buf->len);
+        buf->len = NET_FRAME_MIN;
+    }
+    if (loop->pcap != NULL)
+    {
+        (void)net_pcap_write(loop->pcap, now_ns(), buf->data, buf->len);
+    }
+    netif->stats.tx_frames++;
+    netif->stats.tx_bytes += buf->len;
+
+    buf->next = NULL;
+    if (loop->tail != NULL)
+    {
+        loop->tail->next = buf;
+    }
+    else
+    {
+        loop->head = buf;
+    }
+    loop->tail = buf;
+    loop->count++;
+    return true;
+}
+
+/** Delivers the frames queued before the call; rx() may send more. */
+static void loop_poll(net_if_t *netif)
+{
+    net_loop_t *loop = (net_loop_t *)netif->priv;
+    uint32_t n = loop->count;
+
+    while (n-- > 0u)
+    {
+        net_buf_t *buf = loop->head;
+
+        loop->head = buf->next;
+        if (loop->head == NULL)
+        {
+            loop->tail = NULL;
+        }
+        loop->count--;
+        buf->next = NULL;
+
+        netif->stats.rx_frames++;
+        netif->stats.rx_bytes += buf->len;
+        if (netif->rx != NULL)
+        {
+            netif->rx(netif, buf);
+        }
+        else
+        {
+            net_buf_free(buf);
+        }
+    }
+}
+
+static const net_if_ops_t s_ops = { loop_send, loop_poll };
+
+/**
+ * Sets up a loopback transport.
+ *
+ * @param[out] loop  - queue state, referenced by @p netif
+ * @param[out] netif - filled in; set netif->rx before polling
+ * @param[in]  mac   - station address
+ * @param[in]  depth - frames queued at most
+ * @param[in]  pcap  - capture of the sent frames, or NULL
+ */
+void net_loop_init(net_loop_t *loop, net_if_t *netif,
+                   const uint8_t mac[NET_MAC_LEN], uint32_t depth,
+                   net_pcap_t *pcap)
+{
+    memset(loop, 0, sizeof(*loop));
+    loop->depth = depth;
+    loop->pcap = pcap;
+
+    memset(netif, 0, sizeof(*netif));
+    netif->ops = &s_ops;
+    netif->priv = loop;
+    memcpy(netif->mac, mac, NET_MAC_LEN);
+}
@@ -0,0 +1,68 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - network stand-ins
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_loop.h
+ * @author   insert authors names here
+ * @brief    Software loopback transport for the host. \n
+ *           send() pads the frame to NET_FRAME_MIN, records it in a pcap
+ *           capture if one is attached and queues it; poll() hands the
+ *           frames queued so far to rx(). No checksum offload: the protocol
+ *           code does that work itself, as it would on a MAC without it.
+ *           The queue holds at most `depth` frames, so a sender that outruns
+ *           poll() sees send() refuse frames, as with a full TX ring.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _NET_LOOP_H_
+#define _NET_LOOP_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common/net_if.h"
+#include "host/net/net_pcap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+typedef struct
+{
+    net_buf_t  *head;
+    net_buf_t  *tail;
+    uint32_t    count;
+    uint32_t    depth;
+    net_pcap_t *pcap;       /**< NULL: no capture */
+} net_loop_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void net_loop_init(net_loop_t *loop, net_if_t *netif,
+                   const uint8_t mac[NET_MAC_LEN], uint32_t depth,
+                   net_pcap_t *pcap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
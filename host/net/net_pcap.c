@@ -0,0 +1,161 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - network stand-ins
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_pcap.c
+ * @author   insert authors names here
+ * @brief    pcap writer and replayer (see net_pcap.h). Files are written
+ *           little-endian whatever the host; only that byte order and the
+ *           nanosecond magic are read back.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "host/net/net_pcap.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define PCAP_MAGIC_NS       0xA1B23C4Du
+#define PCAP_VERSION_MAJOR  2u
+#define PCAP_VERSION_MINOR  4u
+#define PCAP_LINKTYPE_ETH   1u
+#define PCAP_HEADER         24u
+#define PCAP_RECORD         16u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(&p[2], v >> 16);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Starts a capture: writes the file header.
+ *
+ * @param[out] pcap - writer
+ * @param[in]  file - opened for binary writing
+ * @returns bool    - false on a write error
+ */
+bool net_pcap_open(net_pcap_t *pcap, FILE *file)
+{
+    uint8_t h[PCAP_HEADER] = { 0 };
+
+    pcap->file = file;
+    pcap->frames = 0u;
+    put32(&h[0], PCAP_MAGIC_NS);
+    put16(&h[4], PCAP_VERSION_MAJOR);
+    put16(&h[6], PCAP_VERSION_MINOR);
+    put32(&h[16], NET_BUF_SIZE);
+    put32(&h[20], PCAP_LINKTYPE_ETH);
+    return fwrite(h, 1, sizeof(h), file) == sizeof(h);
+}
+
+/**
+ * Appends a frame.
+ *
+ * @param[in] pcap    - writer
+ * @param[in] time_ns - time stamp
+ * @param[in] frame   - destination address first, FCS excluded
+ * @param[in] len     - bytes in @p frame
+ * @returns bool      - false on a write error
+ */
+bool net_pcap_write(net_pcap_t *pcap, uint64_t time_ns, const uint8_t *frame,
+                    uint32_t len)
+{
+    uint8_t r[PCAP_RECORD];
+
+    put32(&r[0], (uint32_t)(time_ns / 1000000000u));
+    put32(&r[4], (uint32_t)(time_ns % 1000000000u));
+    put32(&r[8], len);
+    put32(&r[12], len);
+    if (fwrite(r, 1, sizeof(r), pcap->file) != sizeof(r) ||
+        fwrite(frame, 1, len, pcap->file) != len)
+    {
+        return false;
+    }
+    pcap->frames++;
+    return true;
+}
+
+/**
+ * Feeds every frame of a capture to netif->rx, which must be set. Frames
+ * longer than NET_BUF_SIZE, or arriving with the pool empty, are counted
+ * in netif->stats.rx_dropped.
+ *
+ * @param[in] file  - positioned at the file header
+ * @param[in] netif - receiver
+ * @returns int32_t - frames delivered, -1 if the file is not a nanosecond
+ *                    little-endian Ethernet capture or is truncated
+ */
+int32_t net_pcap_replay(FILE *file, net_if_t *netif)
+{
+    uint8_t h[PCAP_HEADER];
+    uint8_t r[PCAP_RECORD];
+    int32_t delivered = 0;
+
+    if (fread(h, 1, sizeof(h), file) != sizeof(h) ||
+        get32(&h[0]) != PCAP_MAGIC_NS || get32(&h[20]) != PCAP_LINKTYPE_ETH)
+    {
+        return -1;
+    }
+    while (fread(r, 1, sizeof(r), file) == sizeof(r))
+    {
+        uint32_t len = get32(&r[8]);
+        net_buf_t *buf = (len <= NET_BUF_SIZE) ? net_buf_alloc() : NULL;
+
+        if (buf == NULL)
+        {
+            netif->stats.rx_dropped++;
+            if (fseek(file, (long)len, SEEK_CUR) != 0)
+            {
+                return -1;
+            }
+            continue;
+        }
+        if (fread(buf->data, 1, len, file) != len)
+        {
+            net_buf_free(buf);
+            return -1;
+        }
+        buf->len = (uint16_t)len;
+        netif->stats.rx_frames++;
+        netif->stats.rx_bytes += len;
+        netif->rx(netif, buf);
+        delivered++;
+    }
+    return delivered;
+}
@@ -0,0 +1,64 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - network stand-ins
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     net_pcap.h
+ * @author   insert authors names here
+ * @brief    pcap capture files (Ethernet link type, nanosecond time
+ *           stamps), readable by Wireshark and tcpdump. \n
+ *           The writer records the frames a host transport sends; the
+ *           replayer feeds the frames of a capture, in order, to a
+ *           net_if_t's rx callback, each in a buffer from net_buf.h.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _NET_PCAP_H_
+#define _NET_PCAP_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "common/net_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+typedef struct
+{
+    FILE    *file;
+    uint32_t frames;        /**< records written */
+} net_pcap_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool net_pcap_open(net_pcap_t *pcap, FILE *file);
+bool net_pcap_write(net_pcap_t *pcap, uint64_t time_ns, const uint8_t *frame,
+                    uint32_t len);
+int32_t net_pcap_replay(FILE *file, net_if_t *netif);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
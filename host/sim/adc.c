@@ -0,0 +1,326 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     adc.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/adc.c, with a model of the sample
+ *           sequencers of ADC0 and ADC1. \n
+ *           A sequencer configured for ADC_TRIGGER_TIMER converts all its
+ *           steps at every timer trigger (host/sim/timer.c); the values come
+ *           from the source of sim_adc_set_source(), by default a 12-bit
+ *           ramp per ADC. Results enter the sequencer FIFO (8, 4, 4 and 1
+ *           entries); a result that finds the FIFO full is lost and sets the
+ *           overflow flag. With uDMA enabled the FIFO is emptied into the
+ *           sequencer's channel (14-17, 24-27) as 16-bit items after every
+ *           sequence; a completed transfer sets ADC_INT_DMA_SSn. Conversion
+ *           time is not modelled: the results are ready at the trigger.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/adc.h"
+#include "driverlib/udma.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define ADC_COUNT                  2u
+#define ADC_SEQUENCERS             4u
+#define ADC_STEPS_MAX              8u
+#define ADC_RESULT_MASK            0x0FFFu
+
+/** ADCSequenceConfigure(): read-modify-write of EMUX and SSPRI.          */
+#define COST_CONFIG_CYCLES         24u
+/** ADCSequenceStepConfigure(): SSMUX, SSEMUX, SSCTL, SSOP, SSTSH.        */
+#define COST_STEP_CYCLES           48u
+/** Read-modify-write of ACTSS, IM or the DMA enable bit.                 */
+#define COST_REG_RMW_CYCLES        10u
+/** Single register access behind a call (ISC, OSTAT, RIS).               */
+#define COST_REG_CYCLES            8u
+/** ADCClockConfigSet(): CC and PC written.                               */
+#define COST_CLOCK_CYCLES          16u
+
+typedef struct
+{
+    uint32_t trigger;
+    bool     enabled;
+    bool     dma;
+    bool     interrupt;             /**< IE on the last step */
+    bool     overflow;
+    uint32_t steps;
+    uint32_t inputs[ADC_STEPS_MAX];
+    uint16_t fifo[ADC_STEPS_MAX];
+    uint32_t fifoCount;
+} sim_sequencer_t;
+
+typedef struct
+{
+    sim_sequencer_t seq[ADC_SEQUENCERS];
+    uint32_t        im;
+    uint32_t        ris;
+    uint32_t        lost;           /**< results dropped on a full FIFO */
+    uint32_t        ramp;
+} sim_adc_t;
+
+static const uint32_t s_depth[ADC_SEQUENCERS] = { 8u, 4u, 4u, 1u };
+
+static const uint32_t s_channels[ADC_COUNT][ADC_SEQUENCERS] =
+{
+    { UDMA_CHANNEL_ADC0, UDMA_CHANNEL_ADC1, UDMA_CHANNEL_ADC2, UDMA_CHANNEL_ADC3 },
+    { UDMA_SEC_CHANNEL_ADC10, UDMA_SEC_CHANNEL_ADC11, UDMA_SEC_CHANNEL_ADC12,
+      UDMA_SEC_CHANNEL_ADC13 },
+};
+
+static const uint32_t s_ints[ADC_COUNT][ADC_SEQUENCERS] =
+{
+    { INT_ADC0SS0, INT_ADC0SS1, INT_ADC0SS2, INT_ADC0SS3 },
+    { INT_ADC1SS0, INT_ADC1SS1, INT_ADC1SS2, INT_ADC1SS3 },
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static sim_adc_t        s_adcs[ADC_COUNT];
+static sim_adc_source_t s_source;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t adc_index(uint32_t base)
+{
+    return ((base - ADC0_BASE) >> 12) % ADC_COUNT;
+}
+
+/** Sets interrupt sources and pends the lines of the unmasked ones. */
+static void adc_raise(uint32_t index, uint32_t flags)
+{
+    sim_adc_t *a = &s_adcs[index];
+    uint32_t active;
+    uint32_t ss;
+
+    a->ris |= flags;
+    active = a->ris & a->im;
+    for (ss = 0; ss < ADC_SEQUENCERS; ss++)
+    {
+        if ((active & ((ADC_INT_SS0 | ADC_INT_DMA_SS0) << ss)) != 0u)
+        {
+            sim_pend(s_ints[index][ss]);
+        }
+    }
+}
+
+static uint16_t ramp_source(uint32_t adc, uint32_t channel)
+{
+    (void)channel;
+
+    return (uint16_t)(s_adcs[adc].ramp++ & ADC_RESULT_MASK);
+}
+
+/** Converts one sequence and hands the FIFO to the uDMA if enabled. */
+static void run_sequence(uint32_t index, uint32_t ss)
+{
+    sim_adc_t *a = &s_adcs[index];
+    sim_sequencer_t *q = &a->seq[ss];
+    uint32_t done;
+    uint32_t moved;
+    uint32_t i;
+
+    for (i = 0; i < q->steps; i++)
+    {
+        uint16_t value = (uint16_t)(s_source(index, q->inputs[i]) & ADC_RESULT_MASK);
+
+        if (q->fifoCount == s_depth[ss])
+        {
+            q->overflow = true;
+            a->lost++;
+        }
+        else
+        {
+            q->fifo[q->fifoCount++] = value;
+        }
+    }
+    if (q->dma)
+    {
+        moved = sim_udma_write(s_channels[index][ss], q->fifo, q->fifoCount,
+                               &done);
+        q->fifoCount -= moved;
+        memmove(q->fifo, &q->fifo[moved], q->fifoCount * sizeof(q->fifo[0]));
+        if (done != 0u)
+        {
+            adc_raise(index, ADC_INT_DMA_SS0 << ss);
+        }
+    }
+    else if (q->interrupt)
+    {
+        adc_raise(index, ADC_INT_SS0 << ss);
+    }
+}
+
+void sim_adc_reset(void)
+{
+    memset(s_adcs, 0, sizeof(s_adcs));
+    s_source = ramp_source;
+}
+
+/**
+ * Replaces the converted values (NULL restores the ramp).
+ */
+void sim_adc_set_source(sim_adc_source_t source)
+{
+    s_source = (source != NULL) ? source : ramp_source;
+}
+
+/**
+ * A timer trigger: runs every enabled sequencer set to ADC_TRIGGER_TIMER,
+ * in sequencer order.
+ */
+void sim_adc_timer_trigger(void)
+{
+    uint32_t index;
+    uint32_t ss;
+
+    for (index = 0; index < ADC_COUNT; index++)
+    {
+        for (ss = 0; ss < ADC_SEQUENCERS; ss++)
+        {
+            const sim_sequencer_t *q = &s_adcs[index].seq[ss];
+
+            if (q->enabled && q->trigger == ADC_TRIGGER_TIMER && q->steps != 0u)
+            {
+                run_sequence(index, ss);
+            }
+        }
+    }
+}
+
+/** @returns uint32_t - results lost to full FIFOs since sim_reset() */
+uint32_t sim_adc_lost(uint32_t base)
+{
+    return s_adcs[adc_index(base)].lost;
+}
+
+void ADCSequenceEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].enabled = true;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void ADCSequenceDisable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].enabled = false;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void ADCSequenceConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum,
+                          uint32_t ui32Trigger, uint32_t ui32Priority)
+{
+    (void)ui32Priority;
+
+    s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].trigger =
+        ui32Trigger;
+    sim_charge(COST_CONFIG_CYCLES, 2, 2);
+}
+
+void ADCSequenceStepConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum,
+                              uint32_t ui32Step, uint32_t ui32Config)
+{
+    sim_sequencer_t *q =
+        &s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS];
+    uint32_t step = ui32Step % ADC_STEPS_MAX;
+
+    q->inputs[step] = ui32Config & ~(uint32_t)(ADC_CTL_IE | ADC_CTL_END);
+    if ((ui32Config & ADC_CTL_END) != 0u)
+    {
+        q->steps = step + 1u;
+        q->interrupt = (ui32Config & ADC_CTL_IE) != 0u;
+    }
+    sim_charge(COST_STEP_CYCLES, 5, 5);
+}
+
+int32_t ADCSequenceOverflow(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    sim_charge(COST_REG_CYCLES, 1, 0);
+    return s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].overflow
+           ? (int32_t)(1u << ui32SequenceNum) : 0;
+}
+
+void ADCSequenceOverflowClear(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].overflow = false;
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+void ADCSequenceDMAEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].dma = true;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void ADCSequenceDMADisable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    s_adcs[adc_index(ui32Base)].seq[ui32SequenceNum % ADC_SEQUENCERS].dma = false;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void ADCIntEnableEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    uint32_t index = adc_index(ui32Base);
+
+    s_adcs[index].im |= ui32IntFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    adc_raise(index, 0u);
+}
+
+void ADCIntDisableEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    s_adcs[adc_index(ui32Base)].im &= ~ui32IntFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+uint32_t ADCIntStatusEx(uint32_t ui32Base, bool bMasked)
+{
+    const sim_adc_t *a = &s_adcs[adc_index(ui32Base)];
+
+    sim_charge(COST_REG_CYCLES, 1, 0);
+    return bMasked ? (a->ris & a->im) : a->ris;
+}
+
+void ADCIntClearEx(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    s_adcs[adc_index(ui32Base)].ris &= ~ui32IntFlags;
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+void ADCClockConfigSet(uint32_t ui32Base, uint32_t ui32Config,
+                       uint32_t ui32ClockDiv)
+{
+    (void)ui32Base;
+    (void)ui32Config;
+    (void)ui32ClockDiv;
+
+    sim_charge(COST_CLOCK_CYCLES, 0, 2);
+}
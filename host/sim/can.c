@@ -0,0 +1,755 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     can.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/can.c: CAN0 and CAN1 with their 32
+ *           message objects, on one virtual bus. \n
+ *           Bus: when it is idle, the pending frames arbitrate - the
+ *           lowest-numbered object with TXRQST of each enabled controller,
+ *           and the frames of sim_can_inject() whose time has come - and
+ *           the lowest identifier wins (a standard frame beats an extended
+ *           one of the same base identifier; equal identifiers go in
+ *           injection order). A frame takes its real length in bits: CRC-15
+ *           and bit stuffing are computed, then CRC delimiter, ACK, EOF
+ *           and intermission are added. At the end of the frame every other
+ *           enabled controller receives it, the sender gets TXOK, and the
+ *           next arbitration starts at once, so a bus with frames waiting
+ *           never idles.\n
+ *           Receive: the lowest-numbered valid receive object whose filter
+ *           matches takes the frame; an object of a FIFO block
+ *           (MSG_OBJ_FIFO) that still holds new data passes it on to the
+ *           next object, and the last object of the block (or an object
+ *           outside a block) is overwritten, setting MSGLST. Unmatched
+ *           frames vanish. The interrupt line follows INTPND of the objects
+ *           with RXIE/TXIE and, with CAN_INT_STATUS, the TXOK/RXOK status
+ *           interrupt.\n
+ *           Not modelled: remote frames, error frames, error counters and
+ *           bus-off, automatic retransmission (every frame is acknowledged
+ *           by the bus) and the bit timing registers: CANBitRateSet() sets
+ *           the rate of the whole bus.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_can.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/can.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define CAN_CONTROLLERS            2u
+#define CAN_OBJECTS                32u
+#define CAN_DEFAULT_BITRATE        500000u
+/** Frames sim_can_inject() holds until they are sent. */
+#define CAN_INJECT_MAX             64u
+
+/** CRC delimiter, ACK slot and delimiter, EOF and intermission. */
+#define CAN_TAIL_BITS              (1u + 2u + 7u + 3u)
+#define CAN_CRC15_POLY             0x4599u
+
+#define CAN_STD_MASK               0x000007FFu
+#define CAN_EXT_MASK               0x1FFFFFFFu
+#define CAN_STATUS_OK              (CAN_STATUS_RXOK | CAN_STATUS_TXOK |           \
+                                    CAN_STATUS_LEC_MSK)
+
+/** CANInit(): init mode and the MSGVAL clear of all 32 objects.          */
+#define COST_INIT_CYCLES           700u
+/** CANMessageSet(): IF1 busy poll, command mask, arbitration, control,
+    mask and data registers, command request.                            */
+#define COST_SET_CYCLES            80u
+/** CANMessageGet(): IF2 busy poll, command request, wait, the arbitration,
+    control, mask and data registers read back.                          */
+#define COST_GET_CYCLES            90u
+/** CANMessageClear(), CANIntClear(): IF1 busy poll and command request.  */
+#define COST_IF_CMD_CYCLES         40u
+/** CANBitRateSet(): divider search, init mode around the BIT write.      */
+#define COST_BITRATE_CYCLES        160u
+/** Single register read behind a call.                                   */
+#define COST_REG_READ_CYCLES       8u
+/** Two register halves read behind a call (INTPND1/2, TXRQ1/2, ...).     */
+#define COST_REG_PAIR_CYCLES       12u
+/** Read-modify-write of CTL.                                             */
+#define COST_REG_RMW_CYCLES        10u
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;
+    uint32_t flags;             /**< MSG_OBJ_x as given to CANMessageSet() */
+    uint32_t len;
+    uint8_t  data[8];
+} sim_can_obj_t;
+
+typedef struct
+{
+    sim_can_obj_t obj[CAN_OBJECTS];
+    uint32_t valid;             /**< MSGVAL, bit n for object n + 1        */
+    uint32_t tx;                /**< objects of type MSG_OBJ_TYPE_TX       */
+    uint32_t txrqst;
+    uint32_t newdat;
+    uint32_t intpnd;
+    uint32_t msglst;
+    uint32_t ie;                /**< CAN_INT_x                             */
+    uint32_t status;            /**< CAN_STATUS_x                          */
+    bool     statusInt;         /**< status interrupt pending              */
+    bool     enabled;           /**< out of init mode                      */
+    uint32_t lost;              /**< frames overwritten (MSGLST events)    */
+} sim_can_t;
+
+typedef struct
+{
+    sim_can_frame_t frame;
+    uint64_t        ready;
+} sim_can_inject_t;
+
+/** The stuffed region of a frame (SOF to CRC) as it is sent. */
+typedef struct
+{
+    uint32_t crc;
+    uint32_t bits;              /**< sent so far, stuff bits included      */
+    uint32_t run;               /**< equal bits in a row                   */
+    uint32_t last;
+} frame_bits_t;
+
+typedef struct
+{
+    bool            busy;
+    uint32_t        node;       /**< sender of the frame on the bus        */
+    uint32_t        obj;        /**< its object, 0-based                   */
+    sim_can_frame_t frame;
+    uint64_t        start;
+    uint32_t        bitrate;
+    sim_can_inject_t queue[CAN_INJECT_MAX];   /**< in injection order      */
+    uint32_t        queued;
+} sim_can_bus_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static sim_can_t      s_can[CAN_CONTROLLERS];
+static sim_can_bus_t  s_bus;
+static sim_can_hook_t s_txHook;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void arbitrate(uint64_t now);
+
+static uint32_t can_index(uint32_t base)
+{
+    return (base == CAN1_BASE) ? 1u : 0u;
+}
+
+/** Pends the NVIC line if an enabled source is set. */
+static void can_raise(uint32_t node)
+{
+    sim_can_t *c = &s_can[node];
+
+    if ((c->ie & CAN_INT_MASTER) != 0u &&
+        (c->intpnd != 0u ||
+         (c->statusInt && (c->ie & CAN_INT_STATUS) != 0u)))
+    {
+        sim_pend(node == 0u ? INT_CAN0 : INT_CAN1);
+    }
+}
+
+static void can_status(uint32_t node, uint32_t ok)
+{
+    sim_can_t *c = &s_can[node];
+
+    c->status = (c->status & ~CAN_STATUS_LEC_MSK) | ok;
+    if ((c->ie & CAN_INT_STATUS) != 0u)
+    {
+        c->statusInt = true;
+    }
+}
+
+/**
+ * Arbitration order: base identifier, then SRR/IDE (recessive for an
+ * extended frame), then the 18 low bits of an extended identifier.
+ */
+static uint32_t arb_key(const sim_can_frame_t *f)
+{
+    if (f->ext)
+    {
+        return ((f->id >> 18) << 19) | (1u << 18) | (f->id & 0x3FFFFu);
+    }
+    return (f->id & CAN_STD_MASK) << 19;
+}
+
+/** Appends a bit to the stuffed region, and to the CRC if @p crc. */
+static void put_bit(frame_bits_t *fb, uint32_t bit, bool crc)
+{
+    if (crc)
+    {
+        uint32_t next = ((fb->crc >> 14) ^ bit) & 1u;
+
+        fb->crc = (fb->crc << 1) & 0x7FFFu;
+        if (next != 0u)
+        {
+            fb->crc ^= CAN_CRC15_POLY;
+        }
+    }
+    fb->bits++;
+    if (fb->bits > 1u && bit == fb->last)
+    {
+        fb->run++;
+    }
+    else
+    {
+        fb->run = 1u;
+    }
+    fb->last = bit;
+    if (fb->run == 5u)
+    {
+        /* stuff bit of the opposite level, which starts a new run */
+        fb->bits++;
+        fb->last ^= 1u;
+        fb->run = 1u;
+    }
+}
+
+static void put_field(frame_bits_t *fb, uint32_t value, uint32_t n, bool crc)
+{
+    while (n-- > 0u)
+    {
+        put_bit(fb, (value >> n) & 1u, crc);
+    }
+}
+
+/**
+ * @returns uint32_t - bits @p frame takes on the bus, stuff bits and
+ *                     intermission included
+ */
+uint32_t sim_can_frame_bits(const sim_can_frame_t *frame)
+{
+    frame_bits_t fb = { 0u, 0u, 0u, 0u };
+    uint32_t len = (frame->len > 8u) ? 8u : frame->len;
+    uint32_t i;
+
+    put_bit(&fb, 0u, true);                                 /* SOF */
+    if (frame->ext)
+    {
+        put_field(&fb, frame->id >> 18, 11u, true);
+        put_field(&fb, 3u, 2u, true);                       /* SRR, IDE */
+        put_field(&fb, frame->id & 0x3FFFFu, 18u, true);
+        put_field(&fb, 0u, 3u, true);                       /* RTR, r1, r0 */
+    }
+    else
+    {
+        put_field(&fb, frame->id & CAN_STD_MASK, 11u, true);
+        put_field(&fb, 0u, 3u, true);                       /* RTR, IDE, r0 */
+    }
+    put_field(&fb, len, 4u, true);
+    for (i = 0; i < len; i++)
+    {
+        put_field(&fb, frame->data[i], 8u, true);
+    }
+    put_field(&fb, fb.crc, 15u, false);
+    return fb.bits + CAN_TAIL_BITS;
+}
+
+/** @returns bool - true if receive object @p o takes @p f */
+static bool obj_match(const sim_can_obj_t *o, const sim_can_frame_t *f)
+{
+    bool objExt = (o->flags & MSG_OBJ_EXTENDED_ID) != 0u;
+    uint32_t mask = objExt ? CAN_EXT_MASK : CAN_STD_MASK;
+
+    if ((o->flags & MSG_OBJ_USE_ID_FILTER) != 0u)
+    {
+        mask &= o->mask;
+        /* without MXTD the IDE bit does not take part in the filter */
+        if ((o->flags & MSG_OBJ_USE_EXT_FILTER) == MSG_OBJ_USE_EXT_FILTER &&
+            objExt != f->ext)
+        {
+            return false;
+        }
+    }
+    else if (objExt != f->ext)
+    {
+        return false;
+    }
+    return ((f->id ^ o->id) & mask) == 0u;
+}
+
+/** Stores @p f in the first receive object of @p node that takes it. */
+static void can_deliver(uint32_t node, const sim_can_frame_t *f)
+{
+    sim_can_t *c = &s_can[node];
+    uint32_t rx = c->valid & ~c->tx;
+    uint32_t i;
+
+    for (i = 0; i < CAN_OBJECTS; i++)
+    {
+        uint32_t bit = 1u << i;
+        sim_can_obj_t *o = &c->obj[i];
+
+        if ((rx & bit) == 0u || !obj_match(o, f))
+        {
+            continue;
+        }
+        if ((o->flags & MSG_OBJ_FIFO) != 0u && (c->newdat & bit) != 0u)
+        {
+            continue;
+        }
+        if ((c->newdat & bit) != 0u)
+        {
+            c->msglst |= bit;
+            c->lost++;
+        }
+        /* the received arbitration fields replace those of the object */
+        o->id = f->id;
+        o->flags = (o->flags & ~MSG_OBJ_EXTENDED_ID) |
+                   (f->ext ? MSG_OBJ_EXTENDED_ID : 0u);
+        o->len = f->len;
+        memcpy(o->data, f->data, sizeof(o->data));
+        c->newdat |= bit;
+        if ((o->flags & MSG_OBJ_RX_INT_ENABLE) != 0u)
+        {
+            c->intpnd |= bit;
+        }
+        can_status(node, CAN_STATUS_RXOK);
+        can_raise(node);
+        return;
+    }
+}
+
+/** End of the frame on the bus. */
+static void bus_done(uint64_t cycle)
+{
+    sim_can_frame_t f = s_bus.frame;
+    uint32_t node = s_bus.node;
+    uint32_t n;
+
+    s_bus.busy = false;
+    if (node < CAN_CONTROLLERS)
+    {
+        sim_can_t *c = &s_can[node];
+        uint32_t bit = 1u << s_bus.obj;
+
+        c->txrqst &= ~bit;
+        if ((c->obj[s_bus.obj].flags & MSG_OBJ_TX_INT_ENABLE) != 0u)
+        {
+            c->intpnd |= bit;
+        }
+        can_status(node, CAN_STATUS_TXOK);
+        can_raise(node);
+    }
+    for (n = 0; n < CAN_CONTROLLERS; n++)
+    {
+        if (n != node && s_can[n].enabled)
+        {
+            can_deliver(n, &f);
+        }
+    }
+    if (s_txHook != NULL)
+    {
+        s_txHook(node, &f, s_bus.start, cycle);
+    }
+    arbitrate(cycle);
+}
+
+static void bus_wake(uint64_t cycle)
+{
+    arbitrate(cycle);
+}
+
+/**
+ * Starts the winner of the frames pending at @p now, or waits for the
+ * first injected frame still to come.
+ */
+static void arbitrate(uint64_t now)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t bestNode = 0u;
+    uint32_t bestObj = 0u;
+    uint64_t wake = UINT64_MAX;
+    sim_can_frame_t win;
+    uint32_t n;
+    uint32_t i;
+    uint64_t bits;
+
+    if (s_bus.busy)
+    {
+        return;
+    }
+    for (n = 0; n < CAN_CONTROLLERS; n++)
+    {
+        sim_can_t *c = &s_can[n];
+        uint32_t pend = c->txrqst & c->valid;
+
+        if (c->enabled && pend != 0u)
+        {
+            uint32_t obj = (uint32_t)__builtin_ctz(pend);
+            const sim_can_obj_t *o = &c->obj[obj];
+            sim_can_frame_t f;
+            uint32_t key;
+
+            f.ext = (o->flags & MSG_OBJ_EXTENDED_ID) != 0u;
+            f.id = o->id & (f.ext ? CAN_EXT_MASK : CAN_STD_MASK);
+            key = arb_key(&f);
+            if (key < best)
+            {
+                best = key;
+                bestNode = n;
+                bestObj = obj;
+            }
+        }
+    }
+    for (i = 0; i < s_bus.queued; i++)
+    {
+        const sim_can_inject_t *q = &s_bus.queue[i];
+
+        if (q->ready > now)
+        {
+            wake = (q->ready < wake) ? q->ready : wake;
+        }
+        else if (arb_key(&q->frame) < best)
+        {
+            best = arb_key(&q->frame);
+            bestNode = SIM_CAN_EXTERNAL;
+            bestObj = i;
+        }
+    }
+    if (best == UINT32_MAX)
+    {
+        if (wake != UINT64_MAX)
+        {
+            sim_schedule(SIM_EVENT_CAN, wake, bus_wake);
+        }
+        return;
+    }
+
+    if (bestNode == SIM_CAN_EXTERNAL)
+    {
+        win = s_bus.queue[bestObj].frame;
+        s_bus.queued--;
+        memmove(&s_bus.queue[bestObj], &s_bus.queue[bestObj + 1u],
+                (s_bus.queued - bestObj) * sizeof(s_bus.queue[0]));
+    }
+    else
+    {
+        const sim_can_obj_t *o = &s_can[bestNode].obj[bestObj];
+
+        win.ext = (o->flags & MSG_OBJ_EXTENDED_ID) != 0u;
+        win.id = o->id & (win.ext ? CAN_EXT_MASK : CAN_STD_MASK);
+        win.len = (uint8_t)((o->len > 8u) ? 8u : o->len);
+        memcpy(win.data, o->data, sizeof(win.data));
+    }
+    s_bus.busy = true;
+    s_bus.node = bestNode;
+    s_bus.obj = bestObj;
+    s_bus.frame = win;
+    s_bus.start = now;
+    bits = sim_can_frame_bits(&win);
+    sim_schedule(SIM_EVENT_CAN,
+                 now + (bits * g_sim.clock_hz + s_bus.bitrate - 1u) /
+                           s_bus.bitrate,
+                 bus_done);
+}
+
+void sim_can_reset(void)
+{
+    memset(s_can, 0, sizeof(s_can));
+    memset(&s_bus, 0, sizeof(s_bus));
+    s_bus.bitrate = CAN_DEFAULT_BITRATE;
+    s_txHook = NULL;
+}
+
+/**
+ * Installs an observer for the frames that complete on the bus, sent by
+ * CAN0, CAN1 or sim_can_inject() (NULL removes it). It may inject frames.
+ */
+void sim_can_set_tx_hook(sim_can_hook_t hook)
+{
+    s_txHook = hook;
+}
+
+/**
+ * Puts a frame from another node in the queue of the bus. It arbitrates
+ * with the others from cycle @p ready on.
+ *
+ * @param[in] frame - the frame, copied
+ * @param[in] ready - absolute value of g_sim.cycles
+ * @returns bool    - false if CAN_INJECT_MAX frames are already waiting
+ */
+bool sim_can_inject(const sim_can_frame_t *frame, uint64_t ready)
+{
+    if (s_bus.queued == CAN_INJECT_MAX)
+    {
+        return false;
+    }
+    s_bus.queue[s_bus.queued].frame = *frame;
+    s_bus.queue[s_bus.queued].ready = ready;
+    s_bus.queued++;
+    if (!s_bus.busy)
+    {
+        arbitrate(g_sim.cycles);
+    }
+    return true;
+}
+
+/** @returns uint32_t - frames overwritten in the objects of @p base */
+uint32_t sim_can_lost(uint32_t base)
+{
+    return s_can[can_index(base)].lost;
+}
+
+void CANInit(uint32_t ui32Base)
+{
+    sim_can_t *c = &s_can[can_index(ui32Base)];
+
+    sim_charge(COST_INIT_CYCLES, 34, 100);
+    memset(c, 0, sizeof(*c));
+}
+
+uint32_t CANBitRateSet(uint32_t ui32Base, uint32_t ui32SourceClock,
+                       uint32_t ui32BitRate)
+{
+    (void)ui32Base;
+    (void)ui32SourceClock;
+
+    sim_charge(COST_BITRATE_CYCLES, 2, 4);
+    s_bus.bitrate = (ui32BitRate == 0u) ? CAN_DEFAULT_BITRATE : ui32BitRate;
+    return s_bus.bitrate;
+}
+
+void CANEnable(uint32_t ui32Base)
+{
+    uint32_t node = can_index(ui32Base);
+
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    s_can[node].enabled = true;
+    arbitrate(g_sim.cycles);
+}
+
+void CANDisable(uint32_t ui32Base)
+{
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    s_can[can_index(ui32Base)].enabled = false;
+}
+
+void CANRetrySet(uint32_t ui32Base, bool bAutoRetry)
+{
+    (void)ui32Base;
+    (void)bAutoRetry;
+
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+bool CANErrCntrGet(uint32_t ui32Base, uint32_t *pui32RxCount,
+                   uint32_t *pui32TxCount)
+{
+    (void)ui32Base;
+
+    sim_charge(COST_REG_READ_CYCLES, 1, 0);
+    *pui32RxCount = 0u;
+    *pui32TxCount = 0u;
+    return false;
+}
+
+void CANIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    uint32_t node = can_index(ui32Base);
+
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    s_can[node].ie |= ui32IntFlags;
+    can_raise(node);
+}
+
+void CANIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    s_can[can_index(ui32Base)].ie &= ~ui32IntFlags;
+}
+
+uint32_t CANIntStatus(uint32_t ui32Base, tCANIntStsReg eIntStsReg)
+{
+    sim_can_t *c = &s_can[can_index(ui32Base)];
+
+    if (eIntStsReg == CAN_INT_STS_OBJECT)
+    {
+        sim_charge(COST_REG_PAIR_CYCLES, 2, 0);
+        return c->intpnd;
+    }
+    sim_charge(COST_REG_READ_CYCLES, 1, 0);
+    if (c->statusInt)
+    {
+        return CAN_INT_INTID_STATUS;
+    }
+    return (c->intpnd == 0u) ? 0u : (uint32_t)__builtin_ctz(c->intpnd) + 1u;
+}
+
+void CANIntClear(uint32_t ui32Base, uint32_t ui32IntClr)
+{
+    sim_can_t *c = &s_can[can_index(ui32Base)];
+
+    if (ui32IntClr == CAN_INT_INTID_STATUS)
+    {
+        sim_charge(COST_REG_READ_CYCLES, 1, 0);
+        c->statusInt = false;
+        return;
+    }
+    sim_charge(COST_IF_CMD_CYCLES, 2, 2);
+    if (ui32IntClr >= 1u && ui32IntClr <= CAN_OBJECTS)
+    {
+        c->intpnd &= ~(1u << (ui32IntClr - 1u));
+    }
+}
+
+uint32_t CANStatusGet(uint32_t ui32Base, tCANStsReg eStatusReg)
+{
+    sim_can_t *c = &s_can[can_index(ui32Base)];
+    uint32_t status;
+
+    switch (eStatusReg)
+    {
+    case CAN_STS_CONTROL:
+        sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+        status = c->status;
+        /* reading STS clears the status interrupt; software clears RXOK,
+           TXOK and sets LEC to "no change" */
+        c->status &= ~CAN_STATUS_OK;
+        c->status |= CAN_STATUS_LEC_MSK;
+        c->statusInt = false;
+        return status;
+    case CAN_STS_TXREQUEST:
+        status = c->txrqst;
+        break;
+    case CAN_STS_NEWDAT:
+        status = c->newdat;
+        break;
+    case CAN_STS_MSGVAL:
+    default:
+        status = c->valid;
+        break;
+    }
+    sim_charge(COST_REG_PAIR_CYCLES, 2, 0);
+    return status;
+}
+
+void CANMessageSet(uint32_t ui32Base, uint32_t ui32ObjID,
+                   tCANMsgObject *psMsgObject, tMsgObjType eMsgType)
+{
+    uint32_t node = can_index(ui32Base);
+    sim_can_t *c = &s_can[node];
+    sim_can_obj_t *o;
+    uint32_t bit;
+
+    sim_charge(COST_SET_CYCLES, 1, 10);
+    if (ui32ObjID < 1u || ui32ObjID > CAN_OBJECTS)
+    {
+        return;
+    }
+    o = &c->obj[ui32ObjID - 1u];
+    bit = 1u << (ui32ObjID - 1u);
+    o->id = psMsgObject->ui32MsgID;
+    o->mask = psMsgObject->ui32MsgIDMask;
+    o->flags = psMsgObject->ui32Flags;
+    o->len = (psMsgObject->ui32MsgLen > 8u) ? 8u : psMsgObject->ui32MsgLen;
+    c->valid |= bit;
+    c->newdat &= ~bit;
+    c->msglst &= ~bit;
+    c->intpnd &= ~bit;
+    if (eMsgType == MSG_OBJ_TYPE_TX)
+    {
+        if (o->len != 0u)
+        {
+            memcpy(o->data, psMsgObject->pui8MsgData, o->len);
+        }
+        c->tx |= bit;
+        c->txrqst |= bit;
+        arbitrate(g_sim.cycles);
+    }
+    else
+    {
+        c->tx &= ~bit;
+        c->txrqst &= ~bit;
+    }
+}
+
+void CANMessageGet(uint32_t ui32Base, uint32_t ui32ObjID,
+                   tCANMsgObject *psMsgObject, bool bClrPendingInt)
+{
+    sim_can_t *c = &s_can[can_index(ui32Base)];
+    sim_can_obj_t *o;
+    uint32_t bit;
+    uint32_t flags;
+
+    sim_charge(COST_GET_CYCLES, 10, 3);
+    if (ui32ObjID < 1u || ui32ObjID > CAN_OBJECTS)
+    {
+        return;
+    }
+    o = &c->obj[ui32ObjID - 1u];
+    bit = 1u << (ui32ObjID - 1u);
+    flags = o->flags & ~(MSG_OBJ_NEW_DATA | MSG_OBJ_DATA_LOST);
+    if ((c->newdat & bit) != 0u)
+    {
+        flags |= MSG_OBJ_NEW_DATA;
+    }
+    if (o->len != 0u)
+    {
+        memcpy(psMsgObject->pui8MsgData, o->data, o->len);
+    }
+    if ((c->msglst & bit) != 0u)
+    {
+        flags |= MSG_OBJ_DATA_LOST;
+    }
+    psMsgObject->ui32MsgID = o->id;
+    psMsgObject->ui32MsgIDMask = o->mask;
+    psMsgObject->ui32Flags = flags;
+    psMsgObject->ui32MsgLen = o->len;
+    c->newdat &= ~bit;
+    c->msglst &= ~bit;
+    if (bClrPendingInt)
+    {
+        c->intpnd &= ~bit;
+    }
+}
+
+void CANMessageClear(uint32_t ui32Base, uint32_t ui32ObjID)
+{
+    sim_can_t *c = &s_can[can_index(ui32Base)];
+    uint32_t bit;
+
+    sim_charge(COST_IF_CMD_CYCLES, 1, 3);
+    if (ui32ObjID < 1u || ui32ObjID > CAN_OBJECTS)
+    {
+        return;
+    }
+    bit = 1u << (ui32ObjID - 1u);
+    c->valid &= ~bit;
+    c->tx &= ~bit;
+    c->txrqst &= ~bit;
+    c->newdat &= ~bit;
+    c->msglst &= ~bit;
+    c->intpnd &= ~bit;
+}
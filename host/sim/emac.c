@@ -0,0 +1,640 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     emac.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/emac.c: EMAC0 with its DMA, on chained
+ *           descriptor lists. \n
+ *           TX: a poll demand starts the DMA on the current descriptor if
+ *           software owns it no more; each frame takes its wire time at
+ *           100 (or 10) Mbit/s - preamble, FCS and inter-frame gap included -
+ *           and is then given back, with the transmit interrupt if the
+ *           descriptor asked for it. DES0_TX_CTRL_IP_ALL_CKHSUMS fills in the
+ *           IPv4 header and UDP checksums. With EMAC_CONFIG_LOOPBACK the frame
+ *           comes back into the receive path instead of leaving.\n
+ *           RX: sim_emac_receive() delivers a frame from the wire. Frames the
+ *           address filter refuses vanish; with no descriptor to take the
+ *           frame the DMA raises RX_NO_BUFFER and suspends until
+ *           EMACRxDMAPollDemand(), dropping frames meanwhile. With
+ *           DES1_RX_CTRL_DISABLE_INT the receive interrupt waits for the
+ *           watchdog (EMACRxWatchdogTimerSet()) or a later descriptor.\n
+ *           Only whole frames in a single buffer, checksum offload of IPv4
+ *           and UDP, and the interrupt sources in emac.h are modelled; the
+ *           DMA itself takes no bus time from the core.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_ints.h"
+#include "driverlib/emac.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Largest frame the model carries, FCS excluded. */
+#define EMAC_FRAME_MAX             1522u
+#define EMAC_FRAME_MIN             60u
+/** Preamble + SFD, FCS and inter-frame gap, in bytes. */
+#define EMAC_WIRE_OVERHEAD         (8u + 4u + 12u)
+#define EMAC_FCS                   4u
+/** Unit of the receive watchdog, in system clock cycles. */
+#define EMAC_RIWT_CYCLES           256u
+
+/** Sources behind the NIS and AIS summary bits. */
+#define SUMMARY_NORMAL             (EMAC_INT_RECEIVE | EMAC_INT_TRANSMIT |       \
+                                    EMAC_INT_TX_NO_BUFFER)
+#define SUMMARY_ABNORMAL           (EMAC_INT_RX_NO_BUFFER | EMAC_INT_RX_STOPPED | \
+                                    EMAC_INT_RX_OVERFLOW | EMAC_INT_TX_STOPPED)
+
+/** EMACInit(): bus mode, burst lengths, MDIO clock, DMA interrupt mask.  */
+#define COST_INIT_CYCLES           60u
+/** EMACReset(): software reset and the poll until it completes.         */
+#define COST_RESET_CYCLES          120u
+/** EMACPHYConfigSet(): PC register, EPHY peripheral reset and the wait. */
+#define COST_PHY_CYCLES            400u
+/** EMACConfigSet(): CFG, DMAOPMODE and the watchdog register.            */
+#define COST_CONFIG_CYCLES         40u
+/** EMACAddrSet(): both address halves.                                   */
+#define COST_ADDR_CYCLES           20u
+/** Single register write behind a call (poll demand, clear, list base).  */
+#define COST_REG_WRITE_CYCLES      8u
+/** Single register read behind a call.                                   */
+#define COST_REG_READ_CYCLES       8u
+/** Read-modify-write of CFG, DMAOPMODE or DMAIM.                         */
+#define COST_REG_RMW_CYCLES        10u
+
+typedef struct
+{
+    uint32_t config;            /**< EMAC_CONFIG_x                          */
+    uint32_t filter;            /**< EMAC_FRMFILTER_x                       */
+    uint32_t riwt;              /**< receive watchdog, in 256 cycles        */
+    uint32_t ris;               /**< raw EMAC_INT_x, summary bits excluded  */
+    uint32_t im;
+    uint8_t  mac[6];
+    bool     txOn;
+    bool     rxOn;
+    bool     txBusy;            /**< a frame is on the wire                 */
+    bool     rxSuspended;       /**< stopped on a descriptor it did not own */
+    bool     watchdog;          /**< receive watchdog running               */
+    tEMACDMADescriptor *txDesc;
+    tEMACDMADescriptor *rxDesc;
+    uint32_t missed;            /**< frames dropped for want of a descriptor */
+} sim_emac_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static sim_emac_t      s_emac;
+static sim_emac_hook_t s_txHook;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** @returns uint32_t - raw status with the NIS/AIS summary bits */
+static uint32_t emac_status(void)
+{
+    uint32_t status = s_emac.ris;
+
+    if ((status & SUMMARY_NORMAL) != 0u)
+    {
+        status |= EMAC_INT_NORMAL_INT;
+    }
+    if ((status & SUMMARY_ABNORMAL) != 0u)
+    {
+        status |= EMAC_INT_ABNORMAL_INT;
+    }
+    return status;
+}
+
+/** Sets interrupt sources and pends the NVIC line if any is unmasked. */
+static void emac_raise(uint32_t flags)
+{
+    s_emac.ris |= flags;
+    if ((emac_status() & s_emac.im) != 0u)
+    {
+        sim_pend(INT_EMAC0);
+    }
+}
+
+/** Adds big-endian 16-bit words to a one's complement sum. */
+static uint32_t csum_add(uint32_t sum, const uint8_t *p, uint32_t n)
+{
+    while (n > 1u)
+    {
+        sum += ((uint32_t)p[0] << 8) | p[1];
+        p += 2;
+        n -= 2u;
+    }
+    if (n != 0u)
+    {
+        sum += (uint32_t)p[0] << 8;
+    }
+    return sum;
+}
+
+static uint16_t csum_fold(uint32_t sum)
+{
+    while ((sum >> 16) != 0u)
+    {
+        sum = (sum & 0xFFFFu) + (sum >> 16);
+    }
+    return (uint16_t)sum;
+}
+
+/**
+ * Finds the IPv4 header and UDP datagram of an unfragmented frame.
+ * @returns uint32_t - UDP length, 0 if the frame is not IPv4 (*udp NULL
+ *                     then) or not UDP
+ */
+static uint32_t ipv4_parse(uint8_t *frame, uint32_t len, uint8_t **ip,
+                           uint8_t **udp)
+{
+    uint32_t ihl;
+    uint32_t total;
+
+    *ip = NULL;
+    *udp = NULL;
+    if (len < 14u + 20u || frame[12] != 0x08u || frame[13] != 0x00u ||
+        (frame[14] >> 4) != 4u)
+    {
+        return 0u;
+    }
+    ihl = (frame[14] & 0x0Fu) * 4u;
+    total = ((uint32_t)frame[16] << 8) | frame[17];
+    if (ihl < 20u || total < ihl || 14u + total > len)
+    {
+        return 0u;
+    }
+    *ip = &frame[14];
+    if (frame[14 + 9] != 17u || (((frame[20] & 0x3Fu) << 8) | frame[21]) != 0u ||
+        total - ihl < 8u)
+    {
+        return 0u;
+    }
+    *udp = &frame[14 + ihl];
+    return total - ihl;
+}
+
+static uint32_t udp_pseudo_sum(const uint8_t *ip, uint32_t udp_len)
+{
+    uint32_t sum = csum_add(0u, &ip[12], 8u);
+
+    return sum + 17u + udp_len;
+}
+
+/** Checksum insertion, DES0_TX_CTRL_IP_ALL_CKHSUMS. */
+static void csum_insert(uint8_t *frame, uint32_t len)
+{
+    uint8_t *ip;
+    uint8_t *udp;
+    uint32_t udp_len = ipv4_parse(frame, len, &ip, &udp);
+    uint16_t sum;
+
+    if (ip == NULL)
+    {
+        return;
+    }
+    ip[10] = 0u;
+    ip[11] = 0u;
+    sum = (uint16_t)~csum_fold(csum_add(0u, ip, (ip[0] & 0x0Fu) * 4u));
+    ip[10] = (uint8_t)(sum >> 8);
+    ip[11] = (uint8_t)sum;
+    if (udp != NULL)
+    {
+        udp[6] = 0u;
+        udp[7] = 0u;
+        sum = (uint16_t)~csum_fold(csum_add(udp_pseudo_sum(ip, udp_len), udp,
+                                            udp_len));
+        if (sum == 0u)
+        {
+            sum = 0xFFFFu;
+        }
+        udp[6] = (uint8_t)(sum >> 8);
+        udp[7] = (uint8_t)sum;
+    }
+}
+
+/** Checksum checking, EMAC_CONFIG_CHECKSUM_OFFLOAD. */
+static bool csum_ok(uint8_t *frame, uint32_t len)
+{
+    uint8_t *ip;
+    uint8_t *udp;
+    uint32_t udp_len = ipv4_parse(frame, len, &ip, &udp);
+
+    if (ip == NULL)
+    {
+        return true;
+    }
+    if (csum_fold(csum_add(0u, ip, (ip[0] & 0x0Fu) * 4u)) != 0xFFFFu)
+    {
+        return false;
+    }
+    return udp == NULL || (udp[6] == 0u && udp[7] == 0u) ||
+           csum_fold(csum_add(udp_pseudo_sum(ip, udp_len), udp, udp_len)) ==
+               0xFFFFu;
+}
+
+static bool address_match(const uint8_t *frame)
+{
+    static const uint8_t broadcast[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+    if ((s_emac.filter & (EMAC_FRMFILTER_RX_ALL |
+                          EMAC_FRMFILTER_PROMISCUOUS)) != 0u ||
+        memcmp(frame, s_emac.mac, 6u) == 0)
+    {
+        return true;
+    }
+    return (s_emac.filter & EMAC_FRMFILTER_BROADCAST) == 0u &&
+           memcmp(frame, broadcast, 6u) == 0;
+}
+
+/** Event: the receive watchdog expired. */
+static void rx_watchdog(uint64_t cycle)
+{
+    (void)cycle;
+
+    s_emac.watchdog = false;
+    emac_raise(EMAC_INT_RECEIVE);
+}
+
+/** Receive path: a frame, FCS excluded, reached the RX DMA. */
+static bool rx_frame(uint8_t *frame, uint32_t len)
+{
+    tEMACDMADescriptor *d = s_emac.rxDesc;
+    uint32_t size;
+    uint32_t stored;
+    uint32_t status;
+
+    if (!s_emac.rxOn || d == NULL || len < 14u || !address_match(frame))
+    {
+        return false;
+    }
+    if (s_emac.rxSuspended || (d->ui32CtrlStatus & DES0_RX_CTRL_OWN) == 0u)
+    {
+        s_emac.rxSuspended = true;
+        s_emac.missed++;
+        emac_raise(EMAC_INT_RX_NO_BUFFER);
+        return false;
+    }
+
+    stored = len + (((s_emac.config & EMAC_CONFIG_STRIP_CRC) != 0u) ? 0u
+                                                                   : EMAC_FCS);
+    size = (d->ui32Count & DES1_RX_CTRL_BUFF1_SIZE_M) >> DES1_RX_CTRL_BUFF1_SIZE_S;
+    status = DES0_RX_STAT_FIRST_DESC | DES0_RX_STAT_LAST_DESC |
+             ((stored << DES0_RX_STAT_FRAME_LENGTH_S) &
+              DES0_RX_STAT_FRAME_LENGTH_M);
+    if (stored > size)
+    {
+        /* would span descriptors: not modelled, reported as an error */
+        status |= DES0_RX_STAT_ERR;
+    }
+    else
+    {
+        memcpy(d->pvBuffer1, frame, len);
+        if ((s_emac.config & EMAC_CONFIG_CHECKSUM_OFFLOAD) != 0u &&
+            !csum_ok(frame, len))
+        {
+            status |= DES0_RX_STAT_ERR;
+        }
+    }
+    d->ui32CtrlStatus = status;
+    s_emac.rxDesc = d->DES3.pLink;
+
+    if ((d->ui32Count & DES1_RX_CTRL_DISABLE_INT) == 0u)
+    {
+        s_emac.watchdog = false;
+        sim_cancel(SIM_EVENT_EMAC_RX);
+        emac_raise(EMAC_INT_RECEIVE);
+    }
+    else if (!s_emac.watchdog && s_emac.riwt != 0u)
+    {
+        s_emac.watchdog = true;
+        sim_schedule(SIM_EVENT_EMAC_RX,
+                     g_sim.cycles + (uint64_t)s_emac.riwt * EMAC_RIWT_CYCLES,
+                     rx_watchdog);
+    }
+    return true;
+}
+
+/** @returns uint64_t - cycles a frame of @p len bytes occupies the wire */
+static uint64_t wire_cycles(uint32_t len)
+{
+    uint64_t bits = (uint64_t)((len < EMAC_FRAME_MIN) ? EMAC_FRAME_MIN : len) *
+                    8u + EMAC_WIRE_OVERHEAD * 8u;
+    uint64_t rate = ((s_emac.config & EMAC_CONFIG_100MBPS) != 0u) ? 100000000u
+                                                                 : 10000000u;
+
+    return (bits * g_sim.clock_hz + rate - 1u) / rate;
+}
+
+static void tx_start(void);
+
+/** Event: the frame of the current TX descriptor has left the MAC. */
+static void tx_done(uint64_t cycle)
+{
+    tEMACDMADescriptor *d = s_emac.txDesc;
+    uint8_t frame[EMAC_FRAME_MAX];
+    uint32_t len = (d->ui32Count & DES1_TX_CTRL_BUFF1_SIZE_M) >>
+                   DES1_TX_CTRL_BUFF1_SIZE_S;
+    uint32_t ctrl = d->ui32CtrlStatus;
+
+    (void)cycle;
+
+    if (len > EMAC_FRAME_MAX)
+    {
+        len = EMAC_FRAME_MAX;
+    }
+    memcpy(frame, d->pvBuffer1, len);
+    if (len < EMAC_FRAME_MIN && (ctrl & DES0_TX_CTRL_DISABLE_PADDING) == 0u)
+    {
+        memset(&frame[len], 0, EMAC_FRAME_MIN - len);
+        len = EMAC_FRAME_MIN;
+    }
+    if ((ctrl & DES0_TX_CTRL_IP_ALL_CKHSUMS) == DES0_TX_CTRL_IP_ALL_CKHSUMS)
+    {
+        csum_insert(frame, len);
+    }
+
+    d->ui32CtrlStatus = ctrl & ~DES0_TX_CTRL_OWN;
+    s_emac.txDesc = d->DES3.pLink;
+    s_emac.txBusy = false;
+    if ((ctrl & DES0_TX_CTRL_INTERRUPT) != 0u)
+    {
+        emac_raise(EMAC_INT_TRANSMIT);
+    }
+
+    if (s_txHook != NULL)
+    {
+        s_txHook(frame, len);
+    }
+    if ((s_emac.config & EMAC_CONFIG_LOOPBACK) != 0u)
+    {
+        (void)rx_frame(frame, len);
+    }
+    tx_start();
+}
+
+/** Starts the next frame if the DMA owns the current descriptor. */
+static void tx_start(void)
+{
+    tEMACDMADescriptor *d = s_emac.txDesc;
+
+    if (!s_emac.txOn || s_emac.txBusy || d == NULL)
+    {
+        return;
+    }
+    if ((d->ui32CtrlStatus & DES0_TX_CTRL_OWN) == 0u)
+    {
+        /* TX DMA suspended until the next poll demand */
+        s_emac.ris |= EMAC_INT_TX_NO_BUFFER;
+        return;
+    }
+    s_emac.txBusy = true;
+    sim_schedule(SIM_EVENT_EMAC_TX,
+                 g_sim.cycles +
+                     wire_cycles((d->ui32Count & DES1_TX_CTRL_BUFF1_SIZE_M) >>
+                                 DES1_TX_CTRL_BUFF1_SIZE_S),
+                 tx_done);
+}
+
+void sim_emac_reset(void)
+{
+    memset(&s_emac, 0, sizeof(s_emac));
+    s_txHook = NULL;
+}
+
+/**
+ * Installs an observer for the frames EMAC0 transmits, checksums filled in
+ * and padded, FCS excluded (NULL removes it). Frames sent in loopback are
+ * observed too.
+ */
+void sim_emac_set_tx_hook(sim_emac_hook_t hook)
+{
+    s_txHook = hook;
+}
+
+/**
+ * Makes a frame arrive from the wire now.
+ *
+ * @param[in] frame - destination address first, FCS excluded
+ * @param[in] len   - bytes in @p frame, at most 1522
+ * @returns bool    - true if a descriptor took it; false if it was filtered
+ *                    out or dropped
+ */
+bool sim_emac_receive(const uint8_t *frame, uint32_t len)
+{
+    uint8_t copy[EMAC_FRAME_MAX];
+
+    if (len > EMAC_FRAME_MAX)
+    {
+        return false;
+    }
+    memcpy(copy, frame, len);
+    return rx_frame(copy, len);
+}
+
+/** @returns uint32_t - frames dropped because the RX ring was exhausted */
+uint32_t sim_emac_missed(void)
+{
+    return s_emac.missed;
+}
+
+void EMACInit(uint32_t ui32Base, uint32_t ui32SysClk, uint32_t ui32BusConfig,
+              uint32_t ui32RxBurst, uint32_t ui32TxBurst,
+              uint32_t ui32DescSkipSize)
+{
+    (void)ui32Base;
+    (void)ui32SysClk;
+    (void)ui32BusConfig;
+    (void)ui32RxBurst;
+    (void)ui32TxBurst;
+    (void)ui32DescSkipSize;
+
+    s_emac.im = 0u;
+    sim_charge(COST_INIT_CYCLES, 1, 4);
+}
+
+void EMACReset(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    sim_cancel(SIM_EVENT_EMAC_TX);
+    sim_cancel(SIM_EVENT_EMAC_RX);
+    memset(&s_emac, 0, sizeof(s_emac));
+    sim_charge(COST_RESET_CYCLES, 4, 1);
+}
+
+void EMACPHYConfigSet(uint32_t ui32Base, uint32_t ui32Config)
+{
+    (void)ui32Base;
+    (void)ui32Config;
+
+    sim_charge(COST_PHY_CYCLES, 4, 3);
+}
+
+void EMACConfigSet(uint32_t ui32Base, uint32_t ui32Config,
+                   uint32_t ui32ModeFlags, uint32_t ui32RxMaxFrameSize)
+{
+    (void)ui32Base;
+    (void)ui32ModeFlags;
+    (void)ui32RxMaxFrameSize;
+
+    s_emac.config = ui32Config;
+    sim_charge(COST_CONFIG_CYCLES, 3, 3);
+}
+
+void EMACAddrSet(uint32_t ui32Base, uint32_t ui32Index,
+                 const uint8_t *pui8MACAddr)
+{
+    (void)ui32Base;
+
+    if (ui32Index == 0u)
+    {
+        memcpy(s_emac.mac, pui8MACAddr, 6u);
+    }
+    sim_charge(COST_ADDR_CYCLES, 0, 2);
+}
+
+void EMACFrameFilterSet(uint32_t ui32Base, uint32_t ui32FilterOpts)
+{
+    (void)ui32Base;
+
+    s_emac.filter = ui32FilterOpts;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void EMACRxDMADescriptorListSet(uint32_t ui32Base,
+                                tEMACDMADescriptor *pDescriptor)
+{
+    (void)ui32Base;
+
+    s_emac.rxDesc = pDescriptor;
+    s_emac.rxSuspended = false;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void EMACTxDMADescriptorListSet(uint32_t ui32Base,
+                                tEMACDMADescriptor *pDescriptor)
+{
+    (void)ui32Base;
+
+    s_emac.txDesc = pDescriptor;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void EMACRxWatchdogTimerSet(uint32_t ui32Base, uint8_t ui8Timeout)
+{
+    (void)ui32Base;
+
+    s_emac.riwt = ui8Timeout;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void EMACTxEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    s_emac.txOn = true;
+    sim_charge(2u * COST_REG_RMW_CYCLES, 2, 2);
+    tx_start();
+}
+
+void EMACTxDisable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    s_emac.txOn = false;
+    sim_charge(2u * COST_REG_RMW_CYCLES, 2, 2);
+}
+
+void EMACRxEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    s_emac.rxOn = true;
+    sim_charge(2u * COST_REG_RMW_CYCLES, 2, 2);
+}
+
+void EMACRxDisable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    s_emac.rxOn = false;
+    sim_charge(2u * COST_REG_RMW_CYCLES, 2, 2);
+}
+
+void EMACTxDMAPollDemand(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+    tx_start();
+}
+
+void EMACRxDMAPollDemand(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    s_emac.rxSuspended = false;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void EMACIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    (void)ui32Base;
+
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    s_emac.im |= ui32IntFlags;
+    emac_raise(0u);
+}
+
+void EMACIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    (void)ui32Base;
+
+    s_emac.im &= ~ui32IntFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+uint32_t EMACIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    uint32_t status = emac_status();
+
+    (void)ui32Base;
+
+    sim_charge(bMasked ? 2u * COST_REG_READ_CYCLES : COST_REG_READ_CYCLES,
+               bMasked ? 2u : 1u, 0);
+    return bMasked ? (status & s_emac.im) : status;
+}
+
+void EMACIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    (void)ui32Base;
+
+    s_emac.ris &= ~ui32IntFlags;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
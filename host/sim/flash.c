@@ -0,0 +1,324 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     flash.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/flash.c: the 1 MB of on-chip flash of the
+ *           TM4C1294, in 16 KB erase sectors. \n
+ *           FlashErase() sets a sector to 0xFF; FlashProgram() can only
+ *           clear bits (the stored word becomes old & new), like the real
+ *           array. Both stall the core for the operation time, counted as
+ *           delay cycles; the times are of the order of the data sheet
+ *           figures, a model rather than a measurement. Software reads the
+ *           array through sim_flash_ptr(), where the target would use the
+ *           address itself.\n
+ *           The contents are non-volatile: sim_reset() keeps them. With
+ *           sim_flash_attach() they are also kept in a file, written
+ *           through on every change, so that a later run starts from them.
+ *           sim_flash_cut_after() cuts the power in the middle of a later
+ *           operation - a word half programmed, a sector half erased - and
+ *           ends the run with sim_stop(); the flash then ignores everything
+ *           until the next sim_reset().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "driverlib/flash.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define FLASH_SECTORS              (SIM_FLASH_SIZE / SIM_FLASH_SECTOR)
+/** Words of the write buffer (FWBn): FlashProgram() programs a row at once. */
+#define FLASH_ROW_WORDS            32u
+
+/** Sector erase and buffered row program times.                         */
+#define FLASH_ERASE_US             10000u
+#define FLASH_ROW_PROGRAM_US       40u
+
+/** FlashErase(): FMA, FMC with the key, FCRIS check.                     */
+#define COST_ERASE_CYCLES          30u
+/** FlashProgram(): per row, FMA and FMC2 with the key, FCRIS check.      */
+#define COST_ROW_CYCLES            30u
+/** FlashProgram(): per word, the FWBn write.                             */
+#define COST_WORD_CYCLES           4u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t  s_flash[SIM_FLASH_SIZE];
+static bool     s_ready;
+static uint32_t s_erases[FLASH_SECTORS];
+static FILE    *s_file;
+static uint32_t s_cutAfter;     /**< operations left before the cut, 0: none */
+static bool     s_off;          /**< power cut: everything is ignored        */
+static uint32_t s_operations;   /**< word programs and erases                */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static void ensure_ready(void)
+{
+    if (!s_ready)
+    {
+        memset(s_flash, 0xFF, sizeof(s_flash));
+        s_ready = true;
+    }
+}
+
+static void write_through(uint32_t addr, uint32_t length)
+{
+    if (s_file != NULL)
+    {
+        (void)fseek(s_file, (long)addr, SEEK_SET);
+        (void)fwrite(&s_flash[addr], 1u, length, s_file);
+        (void)fflush(s_file);
+    }
+}
+
+static void stall_us(uint32_t us)
+{
+    sim_delay((uint64_t)g_sim.clock_hz * us / 1000000u);
+}
+
+/**
+ * Counts one operation towards the power cut.
+ *
+ * @returns bool - true if the power goes in the middle of this one
+ */
+static bool cut_now(void)
+{
+    s_operations++;
+    if (s_cutAfter == 0u)
+    {
+        return false;
+    }
+    s_cutAfter--;
+    if (s_cutAfter != 0u)
+    {
+        return false;
+    }
+    s_off = true;
+    return true;
+}
+
+/**
+ * Power-on: a pending cut is dropped and the flash works again. The
+ * contents are kept.
+ */
+void sim_flash_reset(void)
+{
+    ensure_ready();
+    s_cutAfter = 0u;
+    s_off = false;
+}
+
+/**
+ * Erases the whole array (a new chip) and its erase counts.
+ */
+void sim_flash_erase_chip(void)
+{
+    ensure_ready();
+    memset(s_flash, 0xFF, sizeof(s_flash));
+    memset(s_erases, 0, sizeof(s_erases));
+    write_through(0u, SIM_FLASH_SIZE);
+}
+
+/**
+ * Keeps the contents in @p path from now on: an existing image is loaded,
+ * otherwise (no file, or an empty one) the current contents are written.
+ *
+ * @param[in] path - image file, SIM_FLASH_SIZE bytes
+ * @returns bool - false if the file could not be opened or created, or has
+ *          another size
+ */
+bool sim_flash_attach(const char *path)
+{
+    FILE *file;
+
+    ensure_ready();
+    sim_flash_detach();
+    file = fopen(path, "r+b");
+    if (file != NULL)
+    {
+        size_t got = fread(s_flash, 1u, SIM_FLASH_SIZE, file);
+
+        if (got != SIM_FLASH_SIZE && got != 0u)
+        {
+            (void)fclose(file);
+            return false;
+        }
+        s_file = file;
+        if (got == 0u)
+        {
+            /* an empty file, e.g. made by mkstemp(): a new image */
+            write_through(0u, SIM_FLASH_SIZE);
+        }
+        return true;
+    }
+    file = fopen(path, "w+b");
+    if (file == NULL)
+    {
+        return false;
+    }
+    s_file = file;
+    write_through(0u, SIM_FLASH_SIZE);
+    return true;
+}
+
+/**
+ * Stops writing to the image file; the contents stay in memory.
+ */
+void sim_flash_detach(void)
+{
+    if (s_file != NULL)
+    {
+        (void)fclose(s_file);
+        s_file = NULL;
+    }
+}
+
+/**
+ * Cuts the power in the middle of the @p operations-th word program or
+ * sector erase from now on; 0 cancels.
+ */
+void sim_flash_cut_after(uint32_t operations)
+{
+    s_cutAfter = operations;
+}
+
+/**
+ * @returns bool - true if a cut has happened since the last sim_reset()
+ */
+bool sim_flash_cut(void)
+{
+    return s_off;
+}
+
+/**
+ * @returns uint32_t - word programs and sector erases since the start of
+ *          the program, to place cuts with sim_flash_cut_after()
+ */
+uint32_t sim_flash_operations(void)
+{
+    return s_operations;
+}
+
+/**
+ * @returns const uint8_t* - the byte at flash address @p addr, NULL past
+ *          the end of the array
+ */
+const uint8_t *sim_flash_ptr(uint32_t addr)
+{
+    ensure_ready();
+    return addr < SIM_FLASH_SIZE ? &s_flash[addr] : NULL;
+}
+
+/**
+ * @returns uint32_t - times the sector holding @p addr has been erased
+ */
+uint32_t sim_flash_erase_count(uint32_t addr)
+{
+    return addr < SIM_FLASH_SIZE ? s_erases[addr / SIM_FLASH_SECTOR] : 0u;
+}
+
+int32_t FlashErase(uint32_t ui32Address)
+{
+    uint32_t sector = ui32Address & ~(SIM_FLASH_SECTOR - 1u);
+
+    ensure_ready();
+    sim_charge(COST_ERASE_CYCLES, 1u, 2u);
+    if (s_off || ui32Address >= SIM_FLASH_SIZE ||
+        (ui32Address & (SIM_FLASH_SECTOR - 1u)) != 0u)
+    {
+        return -1;
+    }
+    if (cut_now())
+    {
+        memset(&s_flash[sector], 0xFF, SIM_FLASH_SECTOR / 2u);
+        write_through(sector, SIM_FLASH_SECTOR / 2u);
+        sim_stop();
+        return -1;
+    }
+    stall_us(FLASH_ERASE_US);
+    memset(&s_flash[sector], 0xFF, SIM_FLASH_SECTOR);
+    s_erases[sector / SIM_FLASH_SECTOR]++;
+    write_through(sector, SIM_FLASH_SECTOR);
+    return 0;
+}
+
+int32_t FlashProgram(uint32_t *pui32Data, uint32_t ui32Address,
+                     uint32_t ui32Count)
+{
+    uint32_t done = 0u;
+
+    ensure_ready();
+    if (s_off || (ui32Address & 3u) != 0u || (ui32Count & 3u) != 0u ||
+        ui32Address > SIM_FLASH_SIZE ||
+        ui32Count > SIM_FLASH_SIZE - ui32Address)
+    {
+        sim_charge(COST_ROW_CYCLES, 1u, 1u);
+        return -1;
+    }
+    while (done < ui32Count)
+    {
+        uint32_t addr = ui32Address + done;
+        uint32_t rowEnd = (addr | (FLASH_ROW_WORDS * 4u - 1u)) + 1u;
+        uint32_t length = rowEnd - addr;
+        uint32_t i;
+
+        if (length > ui32Count - done)
+        {
+            length = ui32Count - done;
+        }
+        sim_charge(COST_ROW_CYCLES + COST_WORD_CYCLES * (length / 4u),
+                   1u, 2u + length / 4u);
+        stall_us(FLASH_ROW_PROGRAM_US);
+        for (i = 0u; i < length; i += 4u)
+        {
+            uint32_t word;
+            uint32_t data = pui32Data[(done + i) / 4u];
+
+            memcpy(&word, &s_flash[addr + i], 4u);
+            if (cut_now())
+            {
+                /* only some of the bits were programmed */
+                word &= data | 0xFFFF0000u;
+                memcpy(&s_flash[addr + i], &word, 4u);
+                write_through(ui32Address, done + i + 4u);
+                sim_stop();
+                return -1;
+            }
+            word &= data;
+            memcpy(&s_flash[addr + i], &word, 4u);
+        }
+        done += length;
+    }
+    write_through(ui32Address, ui32Count);
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     fpu.c
+ * @author   insert authors names here
+ * @brief    Stand-ins for driverlib/fpu.c and driverlib/sysexc.c. \n
+ *           Only the FPCCR stacking mode is modelled (nvic.c); the FPU is
+ *           always usable on the host. Host floating point never sets the
+ *           SYSEXC flags: sim_fpu_raise() does, as an FPU instruction that
+ *           sets FPSCR flags would, and pends INT_SYSEXC for the enabled
+ *           ones.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdbool.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_ints.h"
+#include "driverlib/fpu.h"
+#include "driverlib/sysexc.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** call, read-modify-write of CPACR or FPCCR, return */
+#define COST_FPU_CYCLES        8u
+/** call, one SYSEXC register access, return */
+#define COST_SYSEXC_CYCLES     6u
+
+#define SYSEXC_INT_ALL         0x3Fu
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t s_sysexcRis;
+static uint32_t s_sysexcIm;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void FPUEnable(void)
+{
+    sim_charge(COST_FPU_CYCLES, 1, 1);
+}
+
+void FPUDisable(void)
+{
+    sim_charge(COST_FPU_CYCLES, 1, 1);
+}
+
+void FPUStackingEnable(void)
+{
+    sim_charge(COST_FPU_CYCLES, 1, 1);
+    sim_set_fpu_stacking(true, false);
+}
+
+void FPULazyStackingEnable(void)
+{
+    sim_charge(COST_FPU_CYCLES, 1, 1);
+    sim_set_fpu_stacking(true, true);
+}
+
+void FPUStackingDisable(void)
+{
+    sim_charge(COST_FPU_CYCLES, 1, 1);
+    sim_set_fpu_stacking(false, false);
+}
+
+void sim_fpu_reset(void)
+{
+    s_sysexcRis = 0u;
+    s_sysexcIm = 0u;
+}
+
+/**
+ * An FPU instruction raised @p flags (SYSEXC_INT_FP_x).
+ */
+void sim_fpu_raise(uint32_t flags)
+{
+    s_sysexcRis |= flags & SYSEXC_INT_ALL;
+    if ((s_sysexcRis & s_sysexcIm) != 0u)
+    {
+        sim_pend(INT_SYSEXC);
+    }
+}
+
+void SysExcIntEnable(uint32_t ui32IntFlags)
+{
+    s_sysexcIm |= ui32IntFlags & SYSEXC_INT_ALL;
+    sim_charge(COST_SYSEXC_CYCLES, 1, 1);
+}
+
+void SysExcIntDisable(uint32_t ui32IntFlags)
+{
+    s_sysexcIm &= ~ui32IntFlags;
+    sim_charge(COST_SYSEXC_CYCLES, 1, 1);
+}
+
+uint32_t SysExcIntStatus(bool bMasked)
+{
+    sim_charge(COST_SYSEXC_CYCLES, 1, 0);
+    return bMasked ? (s_sysexcRis & s_sysexcIm) : s_sysexcRis;
+}
+
+void SysExcIntClear(uint32_t ui32IntFlags)
+{
+    s_sysexcRis &= ~ui32IntFlags;
+    sim_charge(COST_SYSEXC_CYCLES, 0, 1);
+}
@@ -0,0 +1,248 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     gpio.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/gpio.c. \n
+ *           Costs are modelled on the TivaWare 2.2.0.295 implementation.
+ *           The port data value is kept in the HWREG() backing store at
+ *           GPIO_O_DATA + 0x3FC, so GPIOPinRead() returns what was written.
+ *           GPIOPinConfigure() with one of the timer CCP functions of
+ *           driverlib/pin_map.h routes that PWM output to the pin
+ *           (host/sim/timer.c).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Offset of the fully unmasked GPIODATA alias. */
+#define GPIO_DATA_ALL              0x3FCu
+/** Port base of a GPIODATA alias address. */
+#define GPIO_PORT_MASK             0xFFFFF000u
+
+/** GPIOPinTypeGPIOOutput(): GPIODirModeSet() + GPIOPadConfigSet().        */
+#define COST_TYPE_OUTPUT_CYCLES    96u
+#define COST_TYPE_OUTPUT_READS     12u
+#define COST_TYPE_OUTPUT_WRITES    12u
+
+/** GPIOPinTypeUART(): GPIODirModeSet(HW) + GPIOPadConfigSet().          */
+#define COST_TYPE_PERIPH_CYCLES    90u
+/** GPIOPinConfigure(): read-modify-write of one GPIOPCTL nibble.         */
+#define COST_PIN_CONFIGURE_CYCLES  20u
+
+/** GPIOPinWrite(): call, address computation and one masked store.       */
+#define COST_PIN_WRITE_CYCLES      9u
+/** GPIOPinRead(): call, address computation and one masked load.         */
+#define COST_PIN_READ_CYCLES       9u
+
+/**
+ * Direct access to a constant address (common/gpio_pin.h): the address is
+ * in a register (literal load hoisted out of loops), then one STR/LDR.
+ */
+#define COST_STORE_CYCLES          2u
+#define COST_LOAD_CYCLES           2u
+/** Bit-band store: the bus performs a read-modify-write of the word.     */
+#define COST_BITBAND_STORE_CYCLES  3u
+
+/** Peripheral bit-band region and its alias. */
+#define BITBAND_BASE               0x40000000u
+#define BITBAND_ALIAS              0x42000000u
+#define BITBAND_ALIAS_END          0x44000000u
+
+/** GPIOPinConfigure() value: port index, pin shift and function fields. */
+#define PIN_CONFIG_PORT(c)         (((c) >> 16) & 0xFFu)
+#define PIN_CONFIG_PIN(c)          ((uint8_t)(1u << ((((c) >> 8) & 0xFFu) / 4u)))
+
+typedef struct
+{
+    uint32_t config;        /**< GPIO_Pxn_TmCCPk */
+    uint32_t timer;         /**< TIMERm_BASE */
+    uint32_t half;          /**< k: 0 timer A, 1 timer B */
+} ccp_pin_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+/** Port bases by the port index of a pin configuration (A = 0). */
+static const uint32_t s_ports[] =
+{
+    GPIO_PORTA_AHB_BASE, GPIO_PORTB_AHB_BASE, GPIO_PORTC_AHB_BASE,
+    GPIO_PORTD_AHB_BASE, GPIO_PORTE_AHB_BASE, GPIO_PORTF_AHB_BASE,
+    GPIO_PORTG_AHB_BASE, GPIO_PORTH_AHB_BASE, GPIO_PORTJ_AHB_BASE,
+    GPIO_PORTK_BASE, GPIO_PORTL_BASE, GPIO_PORTM_BASE, GPIO_PORTN_BASE,
+    GPIO_PORTP_BASE, GPIO_PORTQ_BASE,
+};
+
+/** The CCP functions of driverlib/pin_map.h. */
+static const ccp_pin_t s_ccpPins[] =
+{
+    { GPIO_PM0_T2CCP0, TIMER2_BASE, 0u },
+    { GPIO_PM1_T2CCP1, TIMER2_BASE, 1u },
+    { GPIO_PM2_T3CCP0, TIMER3_BASE, 0u },
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+
+    sim_charge(COST_TYPE_OUTPUT_CYCLES, COST_TYPE_OUTPUT_READS,
+               COST_TYPE_OUTPUT_WRITES);
+}
+
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+
+    sim_charge(COST_TYPE_PERIPH_CYCLES, COST_TYPE_OUTPUT_READS,
+               COST_TYPE_OUTPUT_WRITES);
+}
+
+void GPIOPinTypeTimer(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+
+    sim_charge(COST_TYPE_PERIPH_CYCLES, COST_TYPE_OUTPUT_READS,
+               COST_TYPE_OUTPUT_WRITES);
+}
+
+void GPIOPinConfigure(uint32_t ui32PinConfig)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_ccpPins) / sizeof(s_ccpPins[0]); i++)
+    {
+        if (s_ccpPins[i].config == ui32PinConfig)
+        {
+            sim_timer_ccp(s_ccpPins[i].timer, s_ccpPins[i].half,
+                          s_ports[PIN_CONFIG_PORT(ui32PinConfig)],
+                          PIN_CONFIG_PIN(ui32PinConfig));
+        }
+    }
+    sim_charge(COST_PIN_CONFIGURE_CYCLES, 1, 1);
+}
+
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+    volatile uint32_t *data = sim_reg32(ui32Port + GPIO_DATA_ALL);
+
+    *data = (*data & ~(uint32_t)ui8Pins) | (ui8Val & ui8Pins);
+    sim_gpio_notify(ui32Port, ui8Pins, ui8Val);
+    sim_charge(COST_PIN_WRITE_CYCLES, 0, 1);
+}
+
+int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    sim_charge(COST_PIN_READ_CYCLES, 1, 0);
+    return (int32_t)(*sim_reg32(ui32Port + GPIO_DATA_ALL) & ui8Pins);
+}
+
+/**
+ * Writes the pins a GPIODATA alias selects and tells the observer.
+ *
+ * @returns bool - true for a bit-band store
+ */
+static bool store(uint32_t addr, uint32_t value)
+{
+    bool bitband = (addr >= BITBAND_ALIAS && addr < BITBAND_ALIAS_END);
+    uint32_t reg = addr;
+    uint32_t port;
+    uint8_t pins;
+    volatile uint32_t *data;
+
+    if (bitband)
+    {
+        uint32_t bit = ((addr - BITBAND_ALIAS) >> 2) & 31u;
+
+        reg = BITBAND_BASE + ((addr - BITBAND_ALIAS) >> 5);
+        value = (value & 1u) << bit;
+        pins = (uint8_t)(((reg & GPIO_DATA_ALL) >> 2) & (1u << bit));
+    }
+    else
+    {
+        pins = (uint8_t)((reg & GPIO_DATA_ALL) >> 2);
+    }
+    port = reg & GPIO_PORT_MASK;
+    data = sim_reg32(port + GPIO_DATA_ALL);
+    *data = (*data & ~(uint32_t)pins) | (value & pins);
+    sim_gpio_notify(port, pins, (uint8_t)(value & pins));
+    return bitband;
+}
+
+/**
+ * Store of @p value to a GPIODATA alias, as done by common/gpio_pin.h: the
+ * masked address (bits 9:2 select the pins) or the bit-band alias of one.
+ * A bit-band store changes one bit of the masked word, i.e. one pin if it
+ * is in the mask.
+ *
+ * @param[in] addr  - masked GPIODATA address or its bit-band alias
+ * @param[in] value - word stored
+ */
+void sim_gpio_store(uint32_t addr, uint32_t value)
+{
+    if (store(addr, value))
+    {
+        sim_charge(COST_BITBAND_STORE_CYCLES, 1, 1);
+    }
+    else
+    {
+        sim_charge(COST_STORE_CYCLES, 0, 1);
+    }
+}
+
+/**
+ * The same store made by another bus master (the uDMA): no core cycles.
+ *
+ * @param[in] addr  - masked GPIODATA address
+ * @param[in] value - word stored
+ */
+void sim_gpio_bus_store(uint32_t addr, uint32_t value)
+{
+    (void)store(addr, value);
+}
+
+/**
+ * Load from a masked GPIODATA address: the pins outside the mask read 0.
+ *
+ * @param[in] addr     - masked GPIODATA address
+ * @returns uint32_t   - pin levels
+ */
+uint32_t sim_gpio_load(uint32_t addr)
+{
+    uint32_t pins = (addr & GPIO_DATA_ALL) >> 2;
+
+    sim_charge(COST_LOAD_CYCLES, 1, 0);
+    return *sim_reg32((addr & GPIO_PORT_MASK) + GPIO_DATA_ALL) & pins;
+}
@@ -0,0 +1,129 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     interrupt.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/interrupt.c. \n
+ *           The master enable maps onto the simulated PRIMASK, the rest onto
+ *           the NVIC model of nvic.c. IntRegister() installs the handler
+ *           directly; the target version needs the table in SRAM first
+ *           (common/vtable.c).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "host/sim/sim.h"
+#include "driverlib/interrupt.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** call, MRS PRIMASK, CPSID/CPSIE, return */
+#define COST_MASTER_CYCLES     5u
+/** call, register lookup in a table, store, return */
+#define COST_ENABLE_CYCLES     8u
+/** call, read-modify-write of one NVIC_PRIn byte lane, return */
+#define COST_PRIORITY_CYCLES   12u
+/** call, store of the IRQ number to NVIC_SW_TRIG, return */
+#define COST_TRIGGER_CYCLES    4u
+/** call, store to the vector table, return */
+#define COST_REGISTER_CYCLES   4u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+bool IntMasterEnable(void)
+{
+    sim_charge(COST_MASTER_CYCLES, 0, 0);
+    return sim_set_primask(false);
+}
+
+bool IntMasterDisable(void)
+{
+    sim_charge(COST_MASTER_CYCLES, 0, 0);
+    return sim_set_primask(true);
+}
+
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void))
+{
+    sim_charge(COST_REGISTER_CYCLES, 0, 0);
+    (void)sim_set_vector(ui32Interrupt, pfnHandler);
+}
+
+void IntUnregister(uint32_t ui32Interrupt)
+{
+    sim_charge(COST_REGISTER_CYCLES, 0, 0);
+    (void)sim_set_vector(ui32Interrupt, NULL);
+}
+
+void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority)
+{
+    sim_charge(COST_PRIORITY_CYCLES, 1, 1);
+    sim_set_priority(ui32Interrupt, ui8Priority);
+}
+
+int32_t IntPriorityGet(uint32_t ui32Interrupt)
+{
+    sim_charge(COST_PRIORITY_CYCLES, 1, 0);
+    return sim_get_priority(ui32Interrupt);
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+    sim_charge(COST_ENABLE_CYCLES, 0, 1);
+    sim_irq_enable(ui32Interrupt, true);
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+    sim_charge(COST_ENABLE_CYCLES, 0, 1);
+    sim_irq_enable(ui32Interrupt, false);
+}
+
+uint32_t IntIsEnabled(uint32_t ui32Interrupt)
+{
+    sim_charge(COST_ENABLE_CYCLES, 1, 0);
+    return sim_irq_is_enabled(ui32Interrupt) ? 1u : 0u;
+}
+
+void IntPendSet(uint32_t ui32Interrupt)
+{
+    sim_pend(ui32Interrupt);
+    sim_charge(COST_ENABLE_CYCLES, 0, 1);
+}
+
+void IntPendClear(uint32_t ui32Interrupt)
+{
+    sim_charge(COST_ENABLE_CYCLES, 0, 1);
+    sim_unpend(ui32Interrupt);
+}
+
+/**
+ * The exception is pending from the store on; it is taken once the call
+ * returns, like on the core where the store completes before the entry.
+ */
+void IntTrigger(uint32_t ui32Interrupt)
+{
+    sim_pend(ui32Interrupt);
+    sim_charge(COST_TRIGGER_CYCLES, 0, 1);
+}
@@ -0,0 +1,134 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     kernel_port_host.c
+ * @author   insert authors names here
+ * @brief    Host port of common/kernel.c. \n
+ *           Each task runs on its own K_STACK() with ucontext; the switch is
+ *           done by the simulated PendSV exception, so tasks are preempted at
+ *           the same points the simulated SysTick could interrupt them.
+ *           PORT_SWITCH_CYCLES stands for the register save/restore of the
+ *           Cortex-M4 PendSV_Handler (kernel_port_cm4.s); PORT_FPU_CYCLES is
+ *           added for each of S16-S31 save and restore, when the task left
+ *           (or comes back to) an exception frame with FPU state.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <ucontext.h>
+
+#include "host/sim/sim.h"
+#include "common/kernel.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** MRS/STMDB r4-r11,lr/STR sp + LDR sp/LDMIA/MSR/BX; k_switch() is C code. */
+#define PORT_SWITCH_CYCLES      28u
+
+/** VSTMDB or VLDMIA of S16-S31. */
+#define PORT_FPU_CYCLES         17u
+
+/** Write of PENDSVSET to NVIC_INT_CTRL. */
+#define PORT_PEND_CYCLES        2u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+/** Context of sim_run()'s caller; never resumed, sim_stop() unwinds to it. */
+static ucontext_t s_mainContext;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * First code run by a task: it is entered from the PendSV_Handler below (or
+ * from port_start()), so it performs that handler's exception return.
+ */
+static void task_trampoline(void)
+{
+    k_task_t *self = k_current_task;
+
+    sim_handler_exit();
+    (void)sim_set_primask(false);
+    self->entry(self->arg);
+    k_task_exit();
+}
+
+void port_stack_init(k_task_t *task)
+{
+    if (getcontext(&task->ctx.uc) != 0)
+    {
+        abort();
+    }
+    task->ctx.uc.uc_stack.ss_sp = task->stack;
+    task->ctx.uc.uc_stack.ss_size = task->stack_words * sizeof(uint32_t);
+    task->ctx.uc.uc_link = NULL;
+    task->ctx.fpu = false;
+    makecontext(&task->ctx.uc, task_trampoline, 0);
+}
+
+void port_start(void)
+{
+    /* as kernel_port_cm4.c: PendSV at the lowest priority */
+    sim_set_priority(SIM_EXC_PENDSV, 0xE0u);
+    k_switch();
+    (void)swapcontext(&s_mainContext, &k_current_task->ctx.uc);
+    abort();
+}
+
+void port_request_switch(void)
+{
+    sim_pend(SIM_EXC_PENDSV);
+    sim_charge(PORT_PEND_CYCLES, 0, 1);
+}
+
+/**
+ * @returns bool - true if the switch saves FPU state for @p task, the
+ *                 running one
+ */
+bool port_fpu_saved(k_task_t *task)
+{
+    (void)task;
+    return sim_fpu_stacked();
+}
+
+/** The simulator does not model CPACR. */
+void port_fpu_access(bool enable)
+{
+    (void)enable;
+}
+
+void PendSV_Handler(void)
+{
+    k_task_t *previous = k_current_task;
+
+    previous->ctx.fpu = sim_fpu_stacked();
+    k_switch();
+    if (k_current_task != previous)
+    {
+        sim_charge(PORT_SWITCH_CYCLES +
+                   (previous->ctx.fpu ? PORT_FPU_CYCLES : 0u) +
+                   (k_current_task->ctx.fpu ? PORT_FPU_CYCLES : 0u), 0, 0);
+        (void)swapcontext(&previous->ctx.uc, &k_current_task->ctx.uc);
+    }
+}
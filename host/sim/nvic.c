@@ -0,0 +1,482 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     nvic.c
+ * @author   insert authors names here
+ * @brief    Exception model of the simulator: NVIC and system exceptions. \n
+ *           Pending exceptions are taken when PRIMASK is clear and their
+ *           priority is higher (numerically lower) than the current execution
+ *           priority, so handlers nest; equal priorities go by exception
+ *           number. A handler that returns while another can be taken
+ *           tail-chains into it. Costs: entry SIM_ISR_ENTRY_CYCLES, exit
+ *           SIM_ISR_EXIT_CYCLES, tail-chain SIM_TAILCHAIN_CYCLES, plus
+ *           SIM_FPU_FRAME_CYCLES each way when the interrupted context has
+ *           FPU state (FPCA) and lazy stacking is off. With lazy stacking
+ *           only handlers marked with sim_set_vector_fpu() pay it, as their
+ *           first floating-point instruction stacks the state; with no
+ *           automatic stacking at all such a handler corrupts the
+ *           interrupted state, counted in g_sim.fpu_clobbers.\n
+ *           Handlers are the target's own (e.g. SysTick_Handler), resolved as
+ *           weak symbols unless installed with sim_set_vector() (the host's
+ *           register_isr() and IntRegister()).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <string.h>
+
+#include "sim.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Interrupt Control and State register, mirrored in the HWREG() store. */
+#define SIM_NVIC_INT_CTRL       0xE000ED04u
+#define SIM_INT_CTRL_PEND_SYST  0x04000000u
+#define SIM_INT_CTRL_PEND_SV    0x10000000u
+
+#define WORDS                   (SIM_VECTORS / 32u)
+
+/** Priority registers: IRQ 0..3 and vectors 4..7. */
+#define NVIC_PRI0               0xE000E400u
+#define NVIC_SYS_PRI1           0xE000ED18u
+/** A word from a precomputed table stored to a priority register (loop). */
+#define COST_PRIORITY_STORE_CYCLES 4u
+
+/** Execution priority of thread mode, below every exception. */
+#define THREAD_PRIORITY         0x100u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t      s_pending[WORDS];
+static uint32_t      s_enabled[WORDS];
+static uint8_t       s_priority[SIM_VECTORS];
+static sim_handler_t s_vectors[SIM_VECTORS];
+static uint32_t      s_execPriority;
+static uint32_t      s_active;
+static bool          s_primask;
+static bool          s_tailChain;
+static bool          s_fpca;
+static bool          s_fpuStacking;
+static bool          s_fpuLazy;
+static uint32_t      s_fpuHandlers[WORDS];
+static bool          s_fpuStacked;
+
+/** Target exception handlers; absent ones behave as not implemented. */
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void PendSV_Handler(void) __attribute__((weak));
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void sim_nvic_reset(void)
+{
+    memset(s_pending, 0, sizeof(s_pending));
+    memset(s_enabled, 0, sizeof(s_enabled));
+    memset(s_priority, 0, sizeof(s_priority));
+    memset(s_vectors, 0, sizeof(s_vectors));
+    s_enabled[0] = 0x0000FFFFu;         /* system exceptions */
+    s_execPriority = THREAD_PRIORITY;
+    s_active = 0;
+    s_primask = false;
+    s_tailChain = false;
+    s_fpca = false;
+    s_fpuStacking = true;               /* FPCCR reset value: ASPEN, LSPEN */
+    s_fpuLazy = true;
+    memset(s_fpuHandlers, 0, sizeof(s_fpuHandlers));
+    s_fpuStacked = false;
+}
+
+/**
+ * Back to thread mode without an exception return, for sim_run() after a
+ * program was stopped inside a handler.
+ */
+void sim_nvic_thread_mode(void)
+{
+    s_execPriority = THREAD_PRIORITY;
+    s_active = 0;
+    s_tailChain = false;
+}
+
+/**
+ * Pending-bit mirror in NVIC_INT_CTRL of an exception, 0 if none.
+ */
+static uint32_t pend_bit(uint32_t exception)
+{
+    switch (exception)
+    {
+    case SIM_EXC_SYSTICK:
+        return SIM_INT_CTRL_PEND_SYST;
+    case SIM_EXC_PENDSV:
+        return SIM_INT_CTRL_PEND_SV;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Drops pending exceptions the target cleared through NVIC_INT_CTRL.
+ */
+static void sync_pending(void)
+{
+    uint32_t intCtrl = *sim_reg32(SIM_NVIC_INT_CTRL);
+
+    if ((intCtrl & SIM_INT_CTRL_PEND_SYST) == 0u)
+    {
+        s_pending[0] &= ~(1u << SIM_EXC_SYSTICK);
+    }
+    if ((intCtrl & SIM_INT_CTRL_PEND_SV) == 0u)
+    {
+        s_pending[0] &= ~(1u << SIM_EXC_PENDSV);
+    }
+}
+
+/**
+ * Highest-priority pending and enabled exception above @p priority.
+ *
+ * @returns uint32_t - exception number, SIM_VECTORS if none
+ */
+static uint32_t highest_pending(uint32_t priority)
+{
+    uint32_t best = SIM_VECTORS;
+    uint32_t w;
+
+    for (w = 0; w < WORDS; w++)
+    {
+        uint32_t bits = s_pending[w] & s_enabled[w];
+
+        while (bits != 0u)
+        {
+            uint32_t v = w * 32u + (uint32_t)__builtin_ctz(bits);
+
+            bits &= bits - 1u;
+            if (s_priority[v] < priority)
+            {
+                best = v;
+                priority = s_priority[v];
+            }
+        }
+    }
+    return best;
+}
+
+static sim_handler_t handler_of(uint32_t exception)
+{
+    if (s_vectors[exception] != NULL)
+    {
+        return s_vectors[exception];
+    }
+    switch (exception)
+    {
+    case SIM_EXC_SYSTICK:
+        return SysTick_Handler;
+    case SIM_EXC_PENDSV:
+        return PendSV_Handler;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Takes one exception: stacking (or tail-chaining), handler, unstacking
+ * unless another exception tail-chains.
+ */
+static void take(uint32_t exception)
+{
+    uint32_t savedPriority = s_execPriority;
+    uint32_t savedActive = s_active;
+    bool savedFpca = s_fpca;
+    bool savedStacked = s_fpuStacked;
+    bool handlerFpu = ((s_fpuHandlers[exception / 32u] >> (exception % 32u)) &
+                       1u) != 0u;
+    uint32_t fpuCycles = (s_fpca && s_fpuStacking && (!s_fpuLazy || handlerFpu))
+                             ? SIM_FPU_FRAME_CYCLES
+                             : 0u;
+    sim_handler_t handler = handler_of(exception);
+
+    sim_unpend(exception);
+    g_sim.isr_count++;
+    sim_power_set_mode(SIM_POWER_RUN);
+    s_execPriority = s_priority[exception];
+    s_active = exception;
+    if (s_fpca && !s_fpuStacking && handlerFpu)
+    {
+        g_sim.fpu_clobbers++;
+    }
+    s_fpuStacked = s_fpca && s_fpuStacking;
+    s_fpca = handlerFpu;
+    if (s_tailChain)
+    {
+        s_tailChain = false;
+        sim_charge(SIM_TAILCHAIN_CYCLES, 0, 0);
+    }
+    else
+    {
+        sim_charge(SIM_ISR_ENTRY_CYCLES + fpuCycles, 0, 0);
+    }
+
+    /* a PendSV handler may return here on another task's stack */
+    if (handler != NULL)
+    {
+        handler();
+    }
+
+    s_execPriority = savedPriority;
+    s_active = savedActive;
+    s_fpca = savedFpca;
+    s_fpuStacked = savedStacked;
+    if (!s_primask && highest_pending(s_execPriority) != SIM_VECTORS)
+    {
+        s_tailChain = true;
+    }
+    else
+    {
+        sim_charge(SIM_ISR_EXIT_CYCLES + fpuCycles, 0, 0);
+    }
+}
+
+/**
+ * Runs the handlers of the exceptions that can be taken now.
+ */
+void sim_nvic_deliver(void)
+{
+    uint32_t exception;
+
+    sync_pending();
+    while (!s_primask)
+    {
+        exception = highest_pending(s_execPriority);
+        if (exception == SIM_VECTORS)
+        {
+            break;
+        }
+        take(exception);
+    }
+    s_tailChain = false;
+}
+
+/**
+ * @returns bool - true if @p exception would be taken if it became pending
+ */
+bool sim_nvic_can_take(uint32_t exception)
+{
+    return !s_primask && s_priority[exception] < s_execPriority &&
+           (s_enabled[exception / 32u] & (1u << (exception % 32u))) != 0u;
+}
+
+/**
+ * @returns bool - true if an enabled exception is pending (wakes up WFI,
+ *                 even with PRIMASK set)
+ */
+bool sim_nvic_wakeup_pending(void)
+{
+    uint32_t w;
+
+    sync_pending();
+    for (w = 0; w < WORDS; w++)
+    {
+        if ((s_pending[w] & s_enabled[w]) != 0u)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Sets an exception pending; it is taken at the next HAL call boundary.
+ *
+ * @param[in] exception - exception number (SIM_EXC_x or INT_x)
+ */
+void sim_pend(uint32_t exception)
+{
+    s_pending[exception / 32u] |= 1u << (exception % 32u);
+    *sim_reg32(SIM_NVIC_INT_CTRL) |= pend_bit(exception);
+}
+
+void sim_unpend(uint32_t exception)
+{
+    s_pending[exception / 32u] &= ~(1u << (exception % 32u));
+    *sim_reg32(SIM_NVIC_INT_CTRL) &= ~pend_bit(exception);
+}
+
+bool sim_is_pending(uint32_t exception)
+{
+    sync_pending();
+    return (s_pending[exception / 32u] & (1u << (exception % 32u))) != 0u;
+}
+
+/**
+ * Enables or disables an interrupt (INT_x); system exceptions are always
+ * enabled.
+ */
+void sim_irq_enable(uint32_t exception, bool enable)
+{
+    if (exception < 16u)
+    {
+        return;
+    }
+    if (enable)
+    {
+        s_enabled[exception / 32u] |= 1u << (exception % 32u);
+    }
+    else
+    {
+        s_enabled[exception / 32u] &= ~(1u << (exception % 32u));
+    }
+}
+
+bool sim_irq_is_enabled(uint32_t exception)
+{
+    return (s_enabled[exception / 32u] & (1u << (exception % 32u))) != 0u;
+}
+
+/**
+ * Sets the priority of an exception (0x00 highest .. 0xE0 lowest, the top 3
+ * bits are implemented).
+ */
+void sim_set_priority(uint32_t exception, uint8_t priority)
+{
+    s_priority[exception] = priority & 0xE0u;
+}
+
+uint8_t sim_get_priority(uint32_t exception)
+{
+    return s_priority[exception];
+}
+
+/**
+ * A word store to NVIC_PRIn or SYS_PRIn: four priorities at once.
+ *
+ * @param[in] addr  - word address, 0xE000E400.. or 0xE000ED18..
+ * @param[in] value - priority bytes, lowest vector in bits 7:0
+ */
+void sim_nvic_store_priorities(uint32_t addr, uint32_t value)
+{
+    uint32_t vector = (addr >= NVIC_SYS_PRI1) ? 4u + (addr - NVIC_SYS_PRI1)
+                                              : 16u + (addr - NVIC_PRI0);
+    uint32_t lane;
+
+    for (lane = 0; lane < 4u && vector + lane < SIM_VECTORS; lane++)
+    {
+        sim_set_priority(vector + lane, (uint8_t)(value >> (lane * 8u)));
+    }
+    sim_charge(COST_PRIORITY_STORE_CYCLES, 0, 1);
+}
+
+/**
+ * Sets PRIMASK; pending exceptions are taken as soon as it is cleared.
+ *
+ * @param[in] masked - new PRIMASK value
+ * @returns bool     - previous PRIMASK value
+ */
+bool sim_set_primask(bool masked)
+{
+    bool previous = s_primask;
+
+    s_primask = masked;
+    sim_nvic_deliver();
+    return previous;
+}
+
+/**
+ * Marks the current context as using the FPU (CONTROL.FPCA), which is what
+ * the first floating-point instruction does on the target.
+ */
+void sim_set_fpca(bool active)
+{
+    s_fpca = active;
+}
+
+/**
+ * FPCCR: automatic FPU state preservation (ASPEN) and lazy stacking (LSPEN).
+ */
+void sim_set_fpu_stacking(bool automatic, bool lazy)
+{
+    s_fpuStacking = automatic;
+    s_fpuLazy = lazy;
+}
+
+/**
+ * Marks the handler of @p exception as using the FPU (common/vector_table.h
+ * Fpu::Uses), for the lazy stacking cost.
+ */
+void sim_set_vector_fpu(uint32_t exception, bool uses)
+{
+    if (uses)
+    {
+        s_fpuHandlers[exception / 32u] |= 1u << (exception % 32u);
+    }
+    else
+    {
+        s_fpuHandlers[exception / 32u] &= ~(1u << (exception % 32u));
+    }
+}
+
+/**
+ * @returns bool - true if the running handler's exception frame holds the
+ *                 FPU state of the context it interrupted (EXC_RETURN bit 4
+ *                 clear on the target)
+ */
+bool sim_fpu_stacked(void)
+{
+    return s_fpuStacked;
+}
+
+/**
+ * Exception return for a handler that does not return to its caller: a
+ * context switch that starts a new task instead (kernel_port_host.c).
+ */
+void sim_handler_exit(void)
+{
+    if (s_execPriority != THREAD_PRIORITY)
+    {
+        s_execPriority = THREAD_PRIORITY;
+        s_active = 0;
+        s_fpca = false;
+        sim_charge(SIM_ISR_EXIT_CYCLES, 0, 0);
+    }
+}
+
+/**
+ * Installs the handler of an exception, replacing the target's weak symbol.
+ *
+ * @param[in] exception - exception number (SIM_EXC_x), < SIM_VECTORS
+ * @param[in] handler   - new handler, NULL restores the weak symbol
+ * @returns sim_handler_t - previously installed handler, NULL if none
+ */
+sim_handler_t sim_set_vector(uint32_t exception, sim_handler_t handler)
+{
+    sim_handler_t previous = s_vectors[exception];
+
+    s_vectors[exception] = handler;
+    return previous;
+}
+
+/**
+ * IPSR: number of the exception being handled, 0 in thread mode.
+ */
+uint32_t sim_active_exception(void)
+{
+    return s_active;
+}
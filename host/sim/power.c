@@ -0,0 +1,120 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     power.c
+ * @author   insert authors names here
+ * @brief    Energy model of the simulated MCU. \n
+ *           Supply current is a function of the power state, the system
+ *           clock and the number of peripherals clocked in that state
+ *           (RCGC running, SCGC asleep, DCGC in deep-sleep when clock
+ *           gating is on; see host/sim/sysctl.c); g_sim.energy_uj integrates
+ *           it at VDD over simulated time. The coefficients are of the
+ *           order of the TM4C1294 datasheet figures, not taken from it: the
+ *           model is meant for comparing policies, not for predicting the
+ *           current of a board.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host/sim/sim.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define MODEL_VDD_V             3.3
+
+/** Regulator, PIOSC and leakage, any state but deep-sleep. */
+#define MODEL_BASE_MA           2.5
+/** Core, flash and buses running. */
+#define MODEL_RUN_MA_PER_MHZ    0.25
+/** Buses, NVIC and SRAM with the core clock stopped. */
+#define MODEL_SLEEP_MA_PER_MHZ  0.06
+/** Each peripheral whose clock runs. */
+#define MODEL_PERIPH_MA_PER_MHZ 0.01
+/** Deep-sleep: regulator in low-power mode, SRAM retention. */
+#define MODEL_DEEP_BASE_MA      1.0
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t s_mode;
+static bool     s_dirty;
+static double   s_ma;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void sim_power_reset(void)
+{
+    s_mode = SIM_POWER_RUN;
+    s_dirty = true;
+}
+
+/** Enters a power state (SIM_POWER_x). */
+void sim_power_set_mode(uint32_t mode)
+{
+    if (mode != s_mode)
+    {
+        s_mode = mode;
+        s_dirty = true;
+    }
+}
+
+/** The clock or the clock gating changed: the current is recomputed. */
+void sim_power_changed(void)
+{
+    s_dirty = true;
+}
+
+/** @returns double - modelled supply current now, in mA */
+double sim_power_current_ma(void)
+{
+    if (s_dirty)
+    {
+        double mhz = g_sim.clock_hz / 1e6;
+        double periph = sim_sysctl_clocked(s_mode) * MODEL_PERIPH_MA_PER_MHZ;
+
+        switch (s_mode)
+        {
+        case SIM_POWER_SLEEP:
+            s_ma = MODEL_BASE_MA + mhz * (MODEL_SLEEP_MA_PER_MHZ + periph);
+            break;
+        case SIM_POWER_DEEP_SLEEP:
+            s_ma = MODEL_DEEP_BASE_MA + mhz * periph;
+            break;
+        default:
+            s_ma = MODEL_BASE_MA + mhz * (MODEL_RUN_MA_PER_MHZ + periph);
+            break;
+        }
+        s_dirty = false;
+    }
+    return s_ma;
+}
+
+/** Accounts @p ps picoseconds in the current state. */
+void sim_power_account(uint64_t ps)
+{
+    /* mA * V * ps = 1e-15 J */
+    g_sim.energy_uj += sim_power_current_ma() * MODEL_VDD_V * (double)ps * 1e-9;
+}
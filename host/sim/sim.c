@@ -0,0 +1,437 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     sim.c
+ * @author   insert authors names here
+ * @brief    Cycle/register-access accounting and run control of the
+ *           simulated HAL. \n
+ *           Target programs never return from main(); sim_run() executes them
+ *           until the simulated time reaches the limit set with
+ *           sim_stop_at_cycle() (or until sim_stop() is called) and then
+ *           unwinds back to the caller with longjmp.\n
+ *           Exceptions are delivered at HAL call boundaries: a busy-wait or a
+ *           sleep is split at the exception time, any other call completes
+ *           first. Priorities, nesting and the handlers themselves are
+ *           modelled in nvic.c. Peripheral models schedule their own timed
+ *           events (a byte shifted out, a DMA transfer done) with
+ *           sim_schedule().
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <setjmp.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "sim.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Number of distinct register addresses the HWREG() backing store can hold. */
+#define SIM_REG_SLOTS   4096u
+
+typedef struct
+{
+    uint32_t addr;
+    bool     used;
+    uint32_t value;
+} sim_reg_slot_t;
+
+typedef struct
+{
+    uint64_t        cycle;
+    sim_event_fn_t  fn;
+} sim_event_slot_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+sim_counters_t g_sim;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static jmp_buf         s_exit;
+static bool            s_running;
+static uint64_t        s_stopCycle;
+static sim_gpio_hook_t s_gpioHook;
+static uint64_t        s_clockBaseCycles;
+static uint64_t        s_clockBasePs;
+static bool            s_holdExceptions;   /**< core stopped: none taken */
+static sim_reg_slot_t  s_regs[SIM_REG_SLOTS];
+static sim_event_slot_t s_events[SIM_EVENT_SLOTS];
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Clears all counters and state; the core restarts at the PIOSC clock.
+ */
+void sim_reset(void)
+{
+    memset(&g_sim, 0, sizeof(g_sim));
+    memset(s_regs, 0, sizeof(s_regs));
+    memset(s_events, 0, sizeof(s_events));
+    s_stopCycle = UINT64_MAX;
+    s_holdExceptions = false;
+    s_gpioHook = NULL;
+    sim_nvic_reset();
+    sim_fpu_reset();
+    sim_systick_reset();
+    sim_udma_reset();
+    sim_uart_reset();
+    sim_adc_reset();
+    sim_timer_reset();
+    sim_emac_reset();
+    sim_can_reset();
+    sim_flash_reset();
+    sim_sysctl_reset();
+    sim_power_reset();
+    sim_set_clock(SIM_RESET_CLOCK_HZ);
+}
+
+/**
+ * Changes the core clock used to convert cycles into simulated time.
+ *
+ * @param[in] hz - new core clock in Hz
+ */
+void sim_set_clock(uint32_t hz)
+{
+    s_clockBaseCycles = g_sim.cycles;
+    s_clockBasePs = g_sim.time_ps;
+    g_sim.clock_hz = hz;
+    sim_power_changed();
+}
+
+/**
+ * Stops the running program once the cycle counter reaches @p cycle.
+ *
+ * @param[in] cycle - absolute value of g_sim.cycles
+ */
+void sim_stop_at_cycle(uint64_t cycle)
+{
+    s_stopCycle = cycle;
+}
+
+/**
+ * Unwinds the program started by sim_run(). No effect outside sim_run().
+ */
+void sim_stop(void)
+{
+    if (s_running)
+    {
+        s_running = false;
+        longjmp(s_exit, 1);
+    }
+}
+
+/**
+ * Schedules a peripheral event, replacing the one in the same slot.
+ *
+ * @param[in] slot  - SIM_EVENT_x, one per peripheral model
+ * @param[in] cycle - absolute value of g_sim.cycles at which it happens
+ * @param[in] fn    - called with @p cycle once simulated time reaches it
+ */
+void sim_schedule(uint32_t slot, uint64_t cycle, sim_event_fn_t fn)
+{
+    s_events[slot].cycle = cycle;
+    s_events[slot].fn = fn;
+}
+
+void sim_cancel(uint32_t slot)
+{
+    s_events[slot].fn = NULL;
+}
+
+/**
+ * @returns bool - true if an event is scheduled; *cycle is the earliest
+ */
+static bool next_event(uint64_t *cycle)
+{
+    bool found = false;
+    uint32_t i;
+
+    for (i = 0; i < SIM_EVENT_SLOTS; i++)
+    {
+        if (s_events[i].fn != NULL && (!found || s_events[i].cycle < *cycle))
+        {
+            *cycle = s_events[i].cycle;
+            found = true;
+        }
+    }
+    return found;
+}
+
+/**
+ * Runs the events that fell due, earliest first. An event may schedule
+ * another one, in its own slot or not.
+ */
+static void run_events(void)
+{
+    for (;;)
+    {
+        sim_event_fn_t fn;
+        uint64_t cycle;
+        uint32_t first = SIM_EVENT_SLOTS;
+        uint32_t i;
+
+        for (i = 0; i < SIM_EVENT_SLOTS; i++)
+        {
+            if (s_events[i].fn != NULL && s_events[i].cycle <= g_sim.cycles &&
+                (first == SIM_EVENT_SLOTS ||
+                 s_events[i].cycle < s_events[first].cycle))
+            {
+                first = i;
+            }
+        }
+        if (first == SIM_EVENT_SLOTS)
+        {
+            return;
+        }
+        fn = s_events[first].fn;
+        cycle = s_events[first].cycle;
+        s_events[first].fn = NULL;
+        fn(cycle);
+    }
+}
+
+/**
+ * Moves simulated time forward, raising the exceptions that fall due.
+ */
+static void advance(uint64_t cycles)
+{
+    uint64_t before = g_sim.time_ps;
+
+    g_sim.cycles += cycles;
+    g_sim.time_ps = s_clockBasePs +
+        (uint64_t)((double)(g_sim.cycles - s_clockBaseCycles) * 1e12 /
+                   g_sim.clock_hz);
+    sim_power_account(g_sim.time_ps - before);
+    if (sim_systick_expired(g_sim.cycles))
+    {
+        sim_pend(SIM_EXC_SYSTICK);
+    }
+    run_events();
+    if (g_sim.cycles >= s_stopCycle)
+    {
+        sim_stop();
+    }
+    if (!s_holdExceptions)
+    {
+        sim_nvic_deliver();
+    }
+}
+
+/**
+ * Cycles until the next peripheral event or the next exception that could
+ * be taken right now.
+ *
+ * @param[in] limit   - value returned when there is none closer
+ * @returns uint64_t  - cycles, at most @p limit
+ */
+static uint64_t cycles_to_event(uint64_t limit)
+{
+    uint64_t at;
+
+    if (sim_nvic_can_take(SIM_EXC_SYSTICK) && sim_systick_next(&at) &&
+        at - g_sim.cycles < limit)
+    {
+        limit = at - g_sim.cycles;
+    }
+    if (next_event(&at) && at - g_sim.cycles < limit)
+    {
+        limit = at - g_sim.cycles;
+    }
+    return limit;
+}
+
+/**
+ * Accounts the cost of one HAL operation.
+ *
+ * @param[in] cycles - core cycles spent
+ * @param[in] reads  - peripheral register reads performed
+ * @param[in] writes - peripheral register writes performed
+ */
+void sim_charge(uint32_t cycles, uint32_t reads, uint32_t writes)
+{
+    g_sim.reg_reads += reads;
+    g_sim.reg_writes += writes;
+    advance(cycles);
+}
+
+/**
+ * Accounts a busy-wait of @p cycles cycles.
+ *
+ * @param[in] cycles - core cycles spent spinning
+ */
+void sim_delay(uint64_t cycles)
+{
+    while (cycles != 0u)
+    {
+        uint64_t step = cycles_to_event(cycles);
+
+        g_sim.delay_cycles += step;
+        cycles -= step;
+        advance(step);
+    }
+}
+
+/**
+ * Lets time pass until an exception wakes the core up: one is pending, or
+ * a handler has run (only possible with exceptions not held).
+ */
+static void sleep_until_wakeup(void)
+{
+    uint64_t taken = g_sim.isr_count;
+
+    while (!sim_nvic_wakeup_pending() && g_sim.isr_count == taken)
+    {
+        uint64_t at = UINT64_MAX;
+        uint64_t event;
+        uint64_t step;
+
+        (void)sim_systick_next(&at);
+        if (next_event(&event) && event < at)
+        {
+            at = event;
+        }
+        if (at == UINT64_MAX)
+        {
+            sim_stop();
+            return;
+        }
+        /* events may be due already, e.g. one scheduled for now */
+        step = (at > g_sim.cycles) ? at - g_sim.cycles : 0u;
+        if (s_stopCycle - g_sim.cycles < step)
+        {
+            step = s_stopCycle - g_sim.cycles;
+        }
+        g_sim.sleep_cycles += step;
+        advance(step);
+    }
+}
+
+/**
+ * WFI: sleeps until the next exception. Returns at once if one is pending;
+ * with PRIMASK set the core wakes up without running the handler, otherwise
+ * it returns once a handler has run. Sleeping with nothing left to wake the
+ * core up stops the program.
+ */
+void sim_sleep(void)
+{
+    sim_power_set_mode(SIM_POWER_SLEEP);
+    sleep_until_wakeup();
+    sim_power_set_mode(SIM_POWER_RUN);
+    sim_nvic_deliver();
+}
+
+/**
+ * WFI with SLEEPDEEP: the system runs from the deep-sleep clock until an
+ * exception is pending, and stays on it for the @p wake_us the run clock
+ * takes to come back (oscillator start, PLL lock); the exception is taken
+ * after that. Asleep, the core takes no exception at all, and SysTick and
+ * the peripherals count cycles of the deep-sleep clock.
+ *
+ * @param[in] ds_hz   - deep-sleep clock
+ * @param[in] wake_us - time from the wake-up event to the run clock
+ */
+void sim_deep_sleep(uint32_t ds_hz, uint32_t wake_us)
+{
+    uint32_t run_hz = g_sim.clock_hz;
+    uint64_t wake = (uint64_t)wake_us * ds_hz / 1000000u;
+
+    s_holdExceptions = true;
+    sim_set_clock(ds_hz);
+    sim_power_set_mode(SIM_POWER_DEEP_SLEEP);
+    sleep_until_wakeup();
+
+    sim_power_set_mode(SIM_POWER_SLEEP);
+    g_sim.sleep_cycles += wake;
+    advance(wake);
+    sim_set_clock(run_hz);
+
+    s_holdExceptions = false;
+    sim_power_set_mode(SIM_POWER_RUN);
+    sim_nvic_deliver();
+}
+
+/**
+ * Installs an observer for GPIO data writes (NULL removes it).
+ */
+void sim_set_gpio_hook(sim_gpio_hook_t hook)
+{
+    s_gpioHook = hook;
+}
+
+/**
+ * Reports a GPIO data write to the installed observer.
+ */
+void sim_gpio_notify(uint32_t port, uint8_t pins, uint8_t value)
+{
+    if (s_gpioHook != NULL)
+    {
+        s_gpioHook(port, pins, value);
+    }
+}
+
+/**
+ * Runs a target entry point until it is stopped.
+ *
+ * @param[in] entry - target code, usually a renamed main()
+ * @returns bool    - true if the program was stopped, false if it returned
+ */
+bool sim_run(void (*entry)(void))
+{
+    if (setjmp(s_exit) != 0)
+    {
+        return true;
+    }
+    s_running = true;
+    s_holdExceptions = false;
+    sim_nvic_thread_mode();
+    entry();
+    s_running = false;
+    return false;
+}
+
+/**
+ * Backing store for HWREG() on the host: maps a peripheral address onto a
+ * 32-bit cell. Accesses through it are not accounted; the stand-in driverlib
+ * functions charge their own register accesses.
+ *
+ * @param[in] addr            - peripheral register address
+ * @returns volatile uint32_t* - storage for that register
+ */
+volatile uint32_t *sim_reg32(uint32_t addr)
+{
+    uint32_t i = (addr >> 2) % SIM_REG_SLOTS;
+
+    while (s_regs[i].used && s_regs[i].addr != addr)
+    {
+        i = (i + 1u) % SIM_REG_SLOTS;
+    }
+    s_regs[i].used = true;
+    s_regs[i].addr = addr;
+    return &s_regs[i].value;
+}
@@ -0,0 +1,262 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     sim.h
+ * @author   insert authors names here
+ * @brief    Core of the host-side TivaWare stand-in. \n
+ *           The stand-in driverlib functions in host/sim do not touch any
+ *           hardware; each call charges a modelled number of core cycles and
+ *           peripheral register accesses to the counters declared here, so
+ *           that host benchmarks can put a budget on them.\n
+ *           Cycle costs are a model of the TM4C1294 at zero wait states, not
+ *           a measurement; use them to compare code paths, not to predict
+ *           absolute timing on the board.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _SIM_H_
+#define _SIM_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Clock of the core out of reset (PIOSC). */
+#define SIM_RESET_CLOCK_HZ     16000000u
+
+/** Counters accumulated by the simulated HAL. */
+typedef struct
+{
+    uint64_t cycles;        /**< core cycles, all kinds                     */
+    uint64_t delay_cycles;  /**< subset of cycles spent in SysCtlDelay()    */
+    uint64_t sleep_cycles;  /**< subset of cycles spent asleep in WFI       */
+    uint64_t isr_count;     /**< exception handlers executed                */
+    uint64_t reg_reads;     /**< peripheral register reads                  */
+    uint64_t reg_writes;    /**< peripheral register writes                 */
+    uint64_t time_ps;       /**< simulated time since sim_reset()           */
+    uint64_t fpu_clobbers;  /**< FPU handlers over unsaved FPU state        */
+    uint32_t clock_hz;      /**< current core clock                         */
+    double   energy_uj;     /**< modelled energy used, host/sim/power.c     */
+} sim_counters_t;
+
+/** Exception entry/exit cost (no tail-chaining, no FPU context). */
+#define SIM_ISR_ENTRY_CYCLES   12u
+#define SIM_ISR_EXIT_CYCLES    10u
+/** Entry of an exception taken straight after the return of another one. */
+#define SIM_TAILCHAIN_CYCLES   6u
+/** Extra cost, each way, of stacking S0-S15/FPSCR eagerly. */
+#define SIM_FPU_FRAME_CYCLES   17u
+
+/** On-chip flash and its erase sector (host/sim/flash.c). */
+#define SIM_FLASH_SIZE         0x00100000u
+#define SIM_FLASH_SECTOR       0x00004000u
+
+/** Power states of the energy model. */
+#define SIM_POWER_RUN          0u
+#define SIM_POWER_SLEEP        1u
+#define SIM_POWER_DEEP_SLEEP   2u
+
+/** Exception numbers modelled by the simulator. */
+#define SIM_EXC_PENDSV         14u
+#define SIM_EXC_SYSTICK        15u
+
+/** Size of the simulated vector table (that of startup_ewarm.c). */
+#define SIM_VECTORS            128u
+
+typedef void (*sim_handler_t)(void);
+
+/** Timed peripheral events, one slot per peripheral model. */
+#define SIM_EVENT_UART_TX      0u
+#define SIM_EVENT_UART_RX      1u
+#define SIM_EVENT_TIMER        2u
+#define SIM_EVENT_EMAC_TX      3u
+#define SIM_EVENT_EMAC_RX      4u
+#define SIM_EVENT_UDMA         5u
+#define SIM_EVENT_CAN          6u
+#define SIM_EVENT_SLOTS        8u
+
+typedef void (*sim_event_fn_t)(uint64_t cycle);
+
+/** Peripheral side of a uDMA channel: called when software enables it. */
+typedef void (*sim_udma_start_fn_t)(uint32_t channel);
+
+/** Value converted by the simulated ADCs: @p adc 0/1, @p channel ADC_CTL_CHn. */
+typedef uint16_t (*sim_adc_source_t)(uint32_t adc, uint32_t channel);
+
+/** Observer called for every byte a simulated UART transmits. */
+typedef void (*sim_uart_hook_t)(uint32_t base, uint8_t byte);
+
+/** Observer called for every frame the simulated EMAC transmits. */
+typedef void (*sim_emac_hook_t)(const uint8_t *frame, uint32_t len);
+
+/** A frame on the simulated CAN bus; data frames only. */
+typedef struct
+{
+    uint32_t id;            /**< 11 or 29 bits                              */
+    bool     ext;           /**< 29-bit identifier                          */
+    uint8_t  len;           /**< 0 to 8                                     */
+    uint8_t  data[8];
+} sim_can_frame_t;
+
+/** Node of the frames sim_can_inject() puts on the bus (0/1: CAN0/CAN1). */
+#define SIM_CAN_EXTERNAL       2u
+
+/** Observer called for every frame that completes on the CAN bus. */
+typedef void (*sim_can_hook_t)(uint32_t node, const sim_can_frame_t *frame,
+                               uint64_t start, uint64_t end);
+
+/** Observer called after every simulated GPIO data write. */
+typedef void (*sim_gpio_hook_t)(uint32_t port, uint8_t pins, uint8_t value);
+
+/*------------------------------------------------------------------------------
+ *
+ *      Gloval vars declarations
+ *
+ *------------------------------------------------------------------------------*/
+extern sim_counters_t g_sim;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void sim_reset(void);
+void sim_charge(uint32_t cycles, uint32_t reads, uint32_t writes);
+void sim_delay(uint64_t cycles);
+void sim_set_clock(uint32_t hz);
+void sim_sleep(void);
+void sim_deep_sleep(uint32_t ds_hz, uint32_t wake_us);
+void sim_schedule(uint32_t slot, uint64_t cycle, sim_event_fn_t fn);
+void sim_cancel(uint32_t slot);
+
+/* Exception model, host/sim/nvic.c */
+void sim_pend(uint32_t exception);
+void sim_unpend(uint32_t exception);
+bool sim_is_pending(uint32_t exception);
+void sim_irq_enable(uint32_t exception, bool enable);
+bool sim_irq_is_enabled(uint32_t exception);
+void sim_set_priority(uint32_t exception, uint8_t priority);
+uint8_t sim_get_priority(uint32_t exception);
+void sim_nvic_store_priorities(uint32_t addr, uint32_t value);
+bool sim_set_primask(bool masked);
+void sim_set_fpca(bool active);
+void sim_set_fpu_stacking(bool automatic, bool lazy);
+void sim_set_vector_fpu(uint32_t exception, bool uses);
+bool sim_fpu_stacked(void);
+void sim_handler_exit(void);
+sim_handler_t sim_set_vector(uint32_t exception, sim_handler_t handler);
+uint32_t sim_active_exception(void);
+void sim_nvic_reset(void);
+void sim_nvic_thread_mode(void);
+void sim_nvic_deliver(void);
+bool sim_nvic_can_take(uint32_t exception);
+bool sim_nvic_wakeup_pending(void);
+
+void sim_set_gpio_hook(sim_gpio_hook_t hook);
+void sim_gpio_notify(uint32_t port, uint8_t pins, uint8_t value);
+/* direct GPIODATA accesses (common/gpio_pin.h), host/sim/gpio.c */
+void sim_gpio_store(uint32_t addr, uint32_t value);
+uint32_t sim_gpio_load(uint32_t addr);
+void sim_gpio_bus_store(uint32_t addr, uint32_t value);
+
+void sim_stop_at_cycle(uint64_t cycle);
+void sim_stop(void);
+bool sim_run(void (*entry)(void));
+
+volatile uint32_t *sim_reg32(uint32_t addr);
+
+/* FPU exception flags (SYSEXC), host/sim/fpu.c */
+void sim_fpu_reset(void);
+void sim_fpu_raise(uint32_t flags);
+
+/* uDMA model, host/sim/udma.c */
+void sim_udma_reset(void);
+void sim_udma_attach(uint32_t channel, sim_udma_start_fn_t start);
+uint32_t sim_udma_read(uint32_t channel, void *out, uint32_t max);
+uint32_t sim_udma_write(uint32_t channel, const void *in, uint32_t count,
+                        uint32_t *done);
+void sim_udma_done(uint32_t channel);
+void sim_udma_request(uint32_t channel);
+
+/* UART model, host/sim/uart.c */
+void sim_uart_reset(void);
+void sim_uart_set_tx_hook(sim_uart_hook_t hook);
+void sim_uart_receive(uint32_t base, const uint8_t *data, uint32_t length);
+uint32_t sim_uart_overruns(uint32_t base);
+
+/* ADC model, host/sim/adc.c */
+void sim_adc_reset(void);
+void sim_adc_set_source(sim_adc_source_t source);
+void sim_adc_timer_trigger(void);
+uint32_t sim_adc_lost(uint32_t base);
+
+/* Ethernet MAC model, host/sim/emac.c */
+void sim_emac_reset(void);
+void sim_emac_set_tx_hook(sim_emac_hook_t hook);
+bool sim_emac_receive(const uint8_t *frame, uint32_t len);
+uint32_t sim_emac_missed(void);
+
+/* CAN controllers and the bus between them, host/sim/can.c */
+void sim_can_reset(void);
+void sim_can_set_tx_hook(sim_can_hook_t hook);
+bool sim_can_inject(const sim_can_frame_t *frame, uint64_t ready);
+uint32_t sim_can_frame_bits(const sim_can_frame_t *frame);
+uint32_t sim_can_lost(uint32_t base);
+
+/* general-purpose timer model, host/sim/timer.c */
+void sim_timer_reset(void);
+void sim_timer_ccp(uint32_t base, uint32_t half, uint32_t port, uint8_t pin);
+
+/* on-chip flash, kept across sim_reset(), host/sim/flash.c */
+void sim_flash_reset(void);
+void sim_flash_erase_chip(void);
+bool sim_flash_attach(const char *path);
+void sim_flash_detach(void);
+void sim_flash_cut_after(uint32_t operations);
+bool sim_flash_cut(void);
+uint32_t sim_flash_operations(void);
+const uint8_t *sim_flash_ptr(uint32_t addr);
+uint32_t sim_flash_erase_count(uint32_t addr);
+
+/* clock set-up without driverlib (common/boot.c), host/sim/sysctl.c */
+void sim_clock_direct(uint32_t hz);
+void sim_sysctl_reset(void);
+uint32_t sim_sysctl_clocked(uint32_t mode);
+
+/* energy model, host/sim/power.c */
+void sim_power_reset(void);
+void sim_power_set_mode(uint32_t mode);
+void sim_power_changed(void);
+void sim_power_account(uint64_t ps);
+double sim_power_current_ma(void);
+
+/* SysTick model, host/sim/systick.c */
+void sim_systick_reset(void);
+bool sim_systick_next(uint64_t *cycle);
+bool sim_systick_expired(uint64_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,243 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     sysctl.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/sysctl.c. \n
+ *           Costs are modelled on the TivaWare 2.2.0.295 implementation:
+ *           the number of register accesses each function performs and an
+ *           estimate of the instructions executed around them.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host/sim/sim.h"
+#include "driverlib/sysctl.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** SysCtlClockFreqSet(): table search for the PLL/MEMTIM settings.        */
+#define COST_CLOCK_SEARCH_CYCLES   1400u
+/** SysCtlClockFreqSet(): MOSC start-up + PLL lock polling, at PIOSC rate.  */
+#define COST_CLOCK_LOCK_CYCLES     32000u
+#define COST_CLOCK_READS           14u
+#define COST_CLOCK_WRITES          9u
+/** boot_clock_120mhz(): the same register writes, values precomputed.     */
+#define COST_CLOCK_DIRECT_CYCLES   40u
+#define COST_CLOCK_DIRECT_READS    4u
+#define COST_CLOCK_DIRECT_WRITES   7u
+
+/** SysCtlPeripheralEnable(): call + bit-band write to RCGCx.              */
+#define COST_PERIPH_ENABLE_CYCLES  14u
+/** SysCtlPeripheralReady(): call + bit-band read of PRx.                  */
+#define COST_PERIPH_READY_CYCLES   12u
+
+/** SysCtlDelay(): three cycles per loop iteration (subs + bne).           */
+#define COST_DELAY_LOOP_CYCLES     3u
+
+/** SysCtlDeepSleep(): SLEEPDEEP set and cleared around the WFI.           */
+#define COST_DEEPSLEEP_CYCLES      8u
+/** SysCtlDeepSleepClockConfigSet(), SysCtlPeripheralClockGating().        */
+#define COST_REG_RMW_CYCLES        10u
+
+/**
+ * Wake-up from deep-sleep to the run clock: PLL relock when running from
+ * it, PIOSC start otherwise. Modelled values.
+ */
+#define DSLP_WAKE_PLL_US           100u
+#define DSLP_WAKE_OSC_US           2u
+
+#define PIOSC_HZ                   16000000u
+#define MOSC_HZ                    25000000u
+#define LFIOSC_HZ                  33000u
+#define XOSC_HZ                    32768u
+
+/** RCGCx/SCGCx/DCGCx register and bit selected by a SYSCTL_PERIPH_x value. */
+#define SYSCTL_RCGC_BASE           0x400FE600u
+#define SYSCTL_SCGC_BASE           0x400FE700u
+#define SYSCTL_DCGC_BASE           0x400FE800u
+#define PERIPH_REG(base, p)        ((base) + (((p) >> 8) & 0xffu) * 4u)
+#define PERIPH_RCGC(p)             PERIPH_REG(SYSCTL_RCGC_BASE, p)
+#define PERIPH_BIT(p)              (1u << ((p) & 0x1fu))
+/** RCGCGPIO .. RCGCOWIRE, the registers a SYSCTL_PERIPH_x can select.      */
+#define PERIPH_REGS                0x27u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static bool     s_gating;       /**< SCGC/DCGC apply asleep           */
+static bool     s_pll;          /**< run clock from the PLL           */
+static uint32_t s_dslpHz;       /**< deep-sleep clock                 */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+uint32_t SysCtlClockFreqSet(uint32_t ui32Config, uint32_t ui32SysClock)
+{
+    sim_charge(COST_CLOCK_SEARCH_CYCLES + COST_CLOCK_LOCK_CYCLES,
+               COST_CLOCK_READS, COST_CLOCK_WRITES);
+    s_pll = (ui32Config & SYSCTL_USE_OSC) != SYSCTL_USE_OSC;
+    sim_set_clock(ui32SysClock);
+    return ui32SysClock;
+}
+
+/**
+ * Clock switch done by writing the PLL/MEMTIM registers directly
+ * (common/boot.c): the crystal start-up and PLL lock take as long as in
+ * SysCtlClockFreqSet(), the table search is not done.
+ *
+ * @param[in] hz - new core clock in Hz
+ */
+void sim_clock_direct(uint32_t hz)
+{
+    sim_charge(COST_CLOCK_DIRECT_CYCLES + COST_CLOCK_LOCK_CYCLES,
+               COST_CLOCK_DIRECT_READS, COST_CLOCK_DIRECT_WRITES);
+    s_pll = true;
+    sim_set_clock(hz);
+}
+
+void sim_sysctl_reset(void)
+{
+    s_gating = false;
+    s_pll = false;
+    s_dslpHz = PIOSC_HZ;
+}
+
+/**
+ * @param[in] mode     - SIM_POWER_x
+ * @returns uint32_t   - peripherals whose clock runs in that state
+ */
+uint32_t sim_sysctl_clocked(uint32_t mode)
+{
+    uint32_t base = SYSCTL_RCGC_BASE;
+    uint32_t count = 0u;
+    uint32_t i;
+
+    if (s_gating && mode == SIM_POWER_SLEEP)
+    {
+        base = SYSCTL_SCGC_BASE;
+    }
+    else if (s_gating && mode == SIM_POWER_DEEP_SLEEP)
+    {
+        base = SYSCTL_DCGC_BASE;
+    }
+    for (i = 0; i < PERIPH_REGS; i++)
+    {
+        uint32_t bits = *sim_reg32(base + i * 4u);
+
+        while (bits != 0u)
+        {
+            bits &= bits - 1u;
+            count++;
+        }
+    }
+    return count;
+}
+
+/** Sets or clears a peripheral's bit in RCGC, SCGC or DCGC. */
+static void periph_clock(uint32_t base, uint32_t periph, bool on)
+{
+    volatile uint32_t *reg = sim_reg32(PERIPH_REG(base, periph));
+
+    *reg = on ? (*reg | PERIPH_BIT(periph)) : (*reg & ~PERIPH_BIT(periph));
+    sim_power_changed();
+    sim_charge(COST_PERIPH_ENABLE_CYCLES, 0, 1);
+}
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral)
+{
+    periph_clock(SYSCTL_RCGC_BASE, ui32Peripheral, true);
+}
+
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral)
+{
+    periph_clock(SYSCTL_RCGC_BASE, ui32Peripheral, false);
+}
+
+void SysCtlPeripheralSleepEnable(uint32_t ui32Peripheral)
+{
+    periph_clock(SYSCTL_SCGC_BASE, ui32Peripheral, true);
+}
+
+void SysCtlPeripheralSleepDisable(uint32_t ui32Peripheral)
+{
+    periph_clock(SYSCTL_SCGC_BASE, ui32Peripheral, false);
+}
+
+void SysCtlPeripheralDeepSleepEnable(uint32_t ui32Peripheral)
+{
+    periph_clock(SYSCTL_DCGC_BASE, ui32Peripheral, true);
+}
+
+void SysCtlPeripheralDeepSleepDisable(uint32_t ui32Peripheral)
+{
+    periph_clock(SYSCTL_DCGC_BASE, ui32Peripheral, false);
+}
+
+void SysCtlPeripheralClockGating(bool bEnable)
+{
+    s_gating = bEnable;
+    sim_power_changed();
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void SysCtlDeepSleepClockConfigSet(uint32_t ui32Div, uint32_t ui32Config)
+{
+    uint32_t hz;
+
+    switch (ui32Config & 0x70u)
+    {
+    case SYSCTL_DSLP_OSC_INT:   hz = PIOSC_HZ;  break;
+    case SYSCTL_DSLP_OSC_INT30: hz = LFIOSC_HZ; break;
+    case SYSCTL_DSLP_OSC_EXT32: hz = XOSC_HZ;   break;
+    default:                    hz = MOSC_HZ;   break;
+    }
+    s_dslpHz = hz / ((ui32Div != 0u) ? ui32Div : 1u);
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral)
+{
+    sim_charge(COST_PERIPH_READY_CYCLES, 1, 0);
+    return (*sim_reg32(PERIPH_RCGC(ui32Peripheral)) &
+            PERIPH_BIT(ui32Peripheral)) != 0;
+}
+
+void SysCtlDelay(uint32_t ui32Count)
+{
+    sim_delay((uint64_t)ui32Count * COST_DELAY_LOOP_CYCLES);
+}
+
+void SysCtlSleep(void)
+{
+    sim_sleep();
+}
+
+void SysCtlDeepSleep(void)
+{
+    sim_charge(COST_DEEPSLEEP_CYCLES / 2u, 1, 1);
+    sim_deep_sleep(s_dslpHz, s_pll ? DSLP_WAKE_PLL_US : DSLP_WAKE_OSC_US);
+    sim_charge(COST_DEEPSLEEP_CYCLES / 2u, 1, 1);
+}
@@ -0,0 +1,142 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     systick.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/systick.c and model of the SysTick timer. \n
+ *           The counter is derived from the cycle count: it reloads when it
+ *           is enabled and at every wrap, as the Cortex-M4 one does.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host/sim/sim.h"
+#include "driverlib/systick.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** Each API call: call/return plus one load or store to the SysTick block. */
+#define COST_SYSTICK_CALL_CYCLES   6u
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static bool     s_enabled;
+static bool     s_intEnabled;
+static uint32_t s_reload;       /**< RELOAD register                   */
+static uint64_t s_start;        /**< cycle at which the counter loaded */
+static uint32_t s_period;       /**< RELOAD + 1 latched at that load   */
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void sim_systick_reset(void)
+{
+    s_enabled = false;
+    s_intEnabled = false;
+    s_reload = 0;
+    s_start = 0;
+    s_period = 1;
+}
+
+/**
+ * Cycle of the next SysTick interrupt, if it would raise one.
+ */
+bool sim_systick_next(uint64_t *cycle)
+{
+    if (!s_enabled || !s_intEnabled)
+    {
+        return false;
+    }
+    *cycle = s_start + s_period;
+    return true;
+}
+
+/**
+ * Accounts for the wraps up to @p now.
+ *
+ * @returns bool - true if the counter wrapped with its interrupt enabled
+ */
+bool sim_systick_expired(uint64_t now)
+{
+    bool wrapped = false;
+
+    while (s_enabled && now >= s_start + s_period)
+    {
+        s_start += s_period;
+        s_period = s_reload + 1u;
+        wrapped = true;
+    }
+    return wrapped && s_intEnabled;
+}
+
+void SysTickEnable(void)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 1, 1);
+    s_enabled = true;
+    s_start = g_sim.cycles;
+    s_period = s_reload + 1u;
+}
+
+void SysTickDisable(void)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 1, 1);
+    s_enabled = false;
+}
+
+void SysTickIntEnable(void)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 1, 1);
+    s_intEnabled = true;
+}
+
+void SysTickIntDisable(void)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 1, 1);
+    s_intEnabled = false;
+}
+
+void SysTickPeriodSet(uint32_t ui32Period)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 0, 1);
+    s_reload = (ui32Period - 1u) & 0x00FFFFFFu;
+}
+
+uint32_t SysTickPeriodGet(void)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 1, 0);
+    return s_reload + 1u;
+}
+
+uint32_t SysTickValueGet(void)
+{
+    sim_charge(COST_SYSTICK_CALL_CYCLES, 1, 0);
+    if (!s_enabled)
+    {
+        return 0;
+    }
+    /* counts down from RELOAD: one step per cycle since the last load */
+    return (uint32_t)(s_period - 1u - (g_sim.cycles - s_start) % s_period);
+}
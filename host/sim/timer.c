@@ -0,0 +1,488 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     timer.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/timer.c: timeouts that trigger the ADCs
+ *           or the uDMA, and PWM outputs. \n
+ *           A periodic timer times out every load + 1 clocks of the system
+ *           clock, or of PIOSC after TimerClockSourceSet(TIMER_CLOCK_PIOSC),
+ *           from TimerEnable() on; a split half counts load + 1 with the
+ *           prescaler as bits 23:16. As on the TM4C129, a timeout of timer A
+ *           triggers the ADCs only when both the trigger output
+ *           (TimerControlTrigger()) and the ADC timeout event
+ *           (TimerADCEventSet()) are enabled; it then starts every ADC
+ *           sequencer configured for ADC_TRIGGER_TIMER. With
+ *           TimerDMAEventSet() a timeout requests the uDMA channel of the
+ *           half (encoding 0: timers 0 and 1 only).\n
+ *           A PWM half drives its CCP pin (routed by GPIOPinConfigure())
+ *           high at each reload and low when the count equals the match
+ *           value; the edges reach the GPIO observer.\n
+ *           New load and match values take effect at the next timeout, as
+ *           with TimerUpdateMode(TIMER_UP_LOAD_TIMEOUT |
+ *           TIMER_UP_MATCH_TIMEOUT); the immediate modes are not modelled,
+ *           nor are timer interrupts.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/timer.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define TIMER_COUNT                8u
+#define TIMER_HALVES               2u
+
+/** Alternate clock of the timers (TimerClockSourceSet()): PIOSC. */
+#define TIMER_PIOSC_HZ             16000000u
+
+/** uDMA channel of a timer half, where encoding 0 has one. */
+#define TIMER_NO_DMA               0xFFu
+
+/** TimerConfigure(): disable, CFG, TAMR and TBMR written.                */
+#define COST_CONFIG_CYCLES         30u
+/** Single register write behind a call (TAILR, ADCEV).                   */
+#define COST_REG_WRITE_CYCLES      8u
+/** Read-modify-write of CTL (enable, disable, trigger output).           */
+#define COST_REG_RMW_CYCLES        10u
+
+/** What a half does (TnMR). */
+#define HALF_OFF                   0u
+#define HALF_ONE_SHOT              1u
+#define HALF_PERIODIC              2u
+#define HALF_PWM                   3u
+
+typedef struct
+{
+    uint32_t mode;          /**< HALF_x */
+    uint32_t load;          /**< TnILR */
+    uint32_t prescale;      /**< TnPR: bits 23:16 of a split count */
+    uint32_t match;         /**< TnMATCHR */
+    uint32_t prescaleMatch; /**< TnPMR */
+    bool     running;
+    bool     dmaEvent;      /**< DMAEV timeout */
+    bool     high;          /**< level of the PWM output */
+    uint32_t port;          /**< CCP pin the PWM output is routed to */
+    uint8_t  pin;           /**< 0: not routed */
+    uint64_t start;         /**< cycle the count was enabled */
+    uint32_t coreHz;        /**< core clock at that time */
+    uint32_t timerHz;       /**< clock the half counts */
+    uint64_t periodTicks;   /**< timer clocks from start to this period */
+    uint32_t period;        /**< timer clocks of this period */
+    uint32_t width;         /**< timer clocks the PWM output is high */
+    uint64_t next;          /**< cycle of the next timeout or edge */
+} sim_half_t;
+
+typedef struct
+{
+    sim_half_t half[TIMER_HALVES];
+    bool     split;         /**< CFG: two half-width timers */
+    bool     piosc;         /**< CC: alternate clock */
+    bool     trigger;       /**< TAOTE  */
+    bool     adcEvent;      /**< ADCEV timeout A */
+} sim_timer_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static sim_timer_t s_timers[TIMER_COUNT];
+
+/** Timer A and B channels of uDMA encoding 0 (UDMA_CH18_TIMER0A...). */
+static const uint8_t s_dmaChannel[TIMER_COUNT][TIMER_HALVES] =
+{
+    { 18u, 19u }, { 20u, 21u },
+    { TIMER_NO_DMA, TIMER_NO_DMA }, { TIMER_NO_DMA, TIMER_NO_DMA },
+    { TIMER_NO_DMA, TIMER_NO_DMA }, { TIMER_NO_DMA, TIMER_NO_DMA },
+    { TIMER_NO_DMA, TIMER_NO_DMA }, { TIMER_NO_DMA, TIMER_NO_DMA },
+};
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t timer_index(uint32_t base)
+{
+    return (base >= TIMER6_BASE) ? 6u + ((base - TIMER6_BASE) >> 12) % 2u
+                                 : ((base - TIMER0_BASE) >> 12) % 6u;
+}
+
+/** Points @p h at each half selected by TIMER_A, TIMER_B or TIMER_BOTH. */
+#define FOR_HALVES(t, timer, h)                                              \
+    for ((h) = &(t)->half[((timer) & TIMER_A) ? 0u : 1u];                    \
+         (h) <= &(t)->half[((timer) & TIMER_B) ? 1u : 0u]; (h)++)
+
+static bool triggers_adc(const sim_timer_t *t)
+{
+    return t->half[0].running && t->half[0].mode != HALF_PWM &&
+           t->trigger && t->adcEvent;
+}
+
+/** @returns bool - true if the half needs events: it acts on something */
+static bool has_events(const sim_timer_t *t, uint32_t i, uint32_t h)
+{
+    const sim_half_t *half = &t->half[h];
+
+    if (!half->running)
+    {
+        return false;
+    }
+    if (half->mode == HALF_PWM)
+    {
+        return half->pin != 0u;
+    }
+    return (h == 0u && triggers_adc(t)) ||
+           (half->dmaEvent && s_dmaChannel[i][h] != TIMER_NO_DMA);
+}
+
+/** @returns uint64_t - core cycle at @p ticks timer clocks from the start */
+static uint64_t tick_cycle(const sim_half_t *half, uint64_t ticks)
+{
+    return half->start + ticks * half->coreHz / half->timerHz;
+}
+
+/**
+ * Starts a new period from the load and match values written so far:
+ * they take effect at the timeout, as with TimerUpdateMode(*_TIMEOUT).
+ */
+static void begin_period(const sim_timer_t *t, sim_half_t *half)
+{
+    uint32_t load = half->load;
+    uint32_t match = half->match;
+
+    if (t->split)
+    {
+        load = ((half->prescale & 0xFFu) << 16) | (load & 0xFFFFu);
+        match = ((half->prescaleMatch & 0xFFu) << 16) | (match & 0xFFFFu);
+    }
+    half->period = load + 1u;
+    /* asserted at the load value, deasserted when the count equals match */
+    half->width = (match > load) ? half->period : load - match;
+}
+
+static void pwm_output(sim_half_t *half, bool high)
+{
+    half->high = high;
+    sim_gpio_notify(half->port, half->pin, high ? half->pin : 0u);
+}
+
+static void timer_event(uint64_t cycle);
+
+/** Schedules the earliest timeout or PWM edge that has an effect. */
+static void schedule_next(void)
+{
+    uint64_t first = UINT64_MAX;
+    uint32_t i;
+    uint32_t h;
+
+    for (i = 0; i < TIMER_COUNT; i++)
+    {
+        for (h = 0; h < TIMER_HALVES; h++)
+        {
+            if (has_events(&s_timers[i], i, h) &&
+                s_timers[i].half[h].next < first)
+            {
+                first = s_timers[i].half[h].next;
+            }
+        }
+    }
+    if (first == UINT64_MAX)
+    {
+        sim_cancel(SIM_EVENT_TIMER);
+    }
+    else
+    {
+        sim_schedule(SIM_EVENT_TIMER, first, timer_event);
+    }
+}
+
+/** A PWM output reached its match value or reloaded. */
+static void pwm_event(const sim_timer_t *t, sim_half_t *half)
+{
+    if (half->high && half->width < half->period)
+    {
+        pwm_output(half, false);
+        half->next = tick_cycle(half, half->periodTicks + half->period);
+        return;
+    }
+    half->periodTicks += half->period;
+    begin_period(t, half);
+    if ((half->width != 0u) != half->high)
+    {
+        pwm_output(half, half->width != 0u);
+    }
+    half->next = tick_cycle(half, half->periodTicks +
+                                  ((half->width != 0u &&
+                                    half->width < half->period)
+                                       ? half->width : half->period));
+}
+
+/** A one-shot or periodic half timed out. */
+static void timeout_event(sim_timer_t *t, uint32_t i, uint32_t h)
+{
+    sim_half_t *half = &t->half[h];
+
+    if (h == 0u && triggers_adc(t))
+    {
+        sim_adc_timer_trigger();
+    }
+    if (half->dmaEvent && s_dmaChannel[i][h] != TIMER_NO_DMA)
+    {
+        sim_udma_request(s_dmaChannel[i][h]);
+    }
+    half->periodTicks += half->period;
+    if (half->mode == HALF_ONE_SHOT)
+    {
+        half->running = false;
+        return;
+    }
+    begin_period(t, half);
+    half->next = tick_cycle(half, half->periodTicks + half->period);
+}
+
+/** Event: one or more timers timed out or changed a PWM output. */
+static void timer_event(uint64_t cycle)
+{
+    uint32_t i;
+    uint32_t h;
+
+    for (i = 0; i < TIMER_COUNT; i++)
+    {
+        for (h = 0; h < TIMER_HALVES; h++)
+        {
+            sim_timer_t *t = &s_timers[i];
+            sim_half_t *half = &t->half[h];
+
+            while (has_events(t, i, h) && half->next <= cycle)
+            {
+                if (half->mode == HALF_PWM)
+                {
+                    pwm_event(t, half);
+                }
+                else
+                {
+                    timeout_event(t, i, h);
+                }
+            }
+        }
+    }
+    schedule_next();
+}
+
+void sim_timer_reset(void)
+{
+    memset(s_timers, 0, sizeof(s_timers));
+}
+
+/**
+ * Routes the PWM output of a timer half to a pin, as GPIOPinConfigure()
+ * with a TnCCPm function does.
+ *
+ * @param[in] base - TIMERn_BASE
+ * @param[in] half - 0: timer A (CCP0), 1: timer B (CCP1)
+ * @param[in] port - GPIO port base
+ * @param[in] pin  - GPIO_PIN_n
+ */
+void sim_timer_ccp(uint32_t base, uint32_t half, uint32_t port, uint8_t pin)
+{
+    sim_half_t *h = &s_timers[timer_index(base)].half[half % TIMER_HALVES];
+
+    h->port = port;
+    h->pin = pin;
+    schedule_next();
+}
+
+static uint32_t half_mode(uint32_t config)
+{
+    if ((config & 0x08u) != 0u)
+    {
+        return HALF_PWM;
+    }
+    switch (config & 0x03u)
+    {
+    case 1u:
+        return HALF_ONE_SHOT;
+    case 2u:
+        return HALF_PERIODIC;
+    default:
+        return HALF_OFF;
+    }
+}
+
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+
+    t->split = (ui32Config & TIMER_CFG_SPLIT_PAIR) != 0u;
+    t->half[0].running = false;
+    t->half[1].running = false;
+    t->half[0].mode = half_mode(ui32Config);
+    t->half[1].mode = t->split ? half_mode(ui32Config >> 8) : HALF_OFF;
+    sim_charge(COST_CONFIG_CYCLES, 0, 4);
+    schedule_next();
+}
+
+void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+    sim_half_t *h;
+
+    FOR_HALVES(t, ui32Timer, h)
+    {
+        h->load = ui32Value;
+    }
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void TimerMatchSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+    sim_half_t *h;
+
+    FOR_HALVES(t, ui32Timer, h)
+    {
+        h->match = ui32Value;
+    }
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void TimerPrescaleSet(uint32_t ui32Base, uint32_t ui32Timer,
+                      uint32_t ui32Value)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+    sim_half_t *h;
+
+    FOR_HALVES(t, ui32Timer, h)
+    {
+        h->prescale = ui32Value;
+    }
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void TimerPrescaleMatchSet(uint32_t ui32Base, uint32_t ui32Timer,
+                           uint32_t ui32Value)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+    sim_half_t *h;
+
+    FOR_HALVES(t, ui32Timer, h)
+    {
+        h->prescaleMatch = ui32Value;
+    }
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void TimerClockSourceSet(uint32_t ui32Base, uint32_t ui32Source)
+{
+    s_timers[timer_index(ui32Base)].piosc = (ui32Source == TIMER_CLOCK_PIOSC);
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void TimerUpdateMode(uint32_t ui32Base, uint32_t ui32Timer,
+                     uint32_t ui32Config)
+{
+    (void)ui32Base;
+    (void)ui32Timer;
+    (void)ui32Config;
+
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void TimerControlTrigger(uint32_t ui32Base, uint32_t ui32Timer, bool bEnable)
+{
+    (void)ui32Timer;
+
+    s_timers[timer_index(ui32Base)].trigger = bEnable;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    schedule_next();
+}
+
+void TimerADCEventSet(uint32_t ui32Base, uint32_t ui32ADCEvent)
+{
+    s_timers[timer_index(ui32Base)].adcEvent =
+        (ui32ADCEvent & TIMER_ADC_TIMEOUT_A) != 0u;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+    schedule_next();
+}
+
+void TimerDMAEventSet(uint32_t ui32Base, uint32_t ui32DMAEvent)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+
+    t->half[0].dmaEvent = (ui32DMAEvent & TIMER_DMA_TIMEOUT_A) != 0u;
+    t->half[1].dmaEvent = (ui32DMAEvent & TIMER_DMA_TIMEOUT_B) != 0u;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+    schedule_next();
+}
+
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+    sim_half_t *h;
+
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    FOR_HALVES(t, ui32Timer, h)
+    {
+        if (h->mode == HALF_OFF || h->running)
+        {
+            continue;
+        }
+        h->running = true;
+        h->start = g_sim.cycles;
+        h->coreHz = g_sim.clock_hz;
+        h->timerHz = t->piosc ? TIMER_PIOSC_HZ : g_sim.clock_hz;
+        h->periodTicks = 0u;
+        begin_period(t, h);
+        if (h->mode == HALF_PWM)
+        {
+            /* the count starts at the load value: output asserted */
+            if (h->pin != 0u)
+            {
+                pwm_output(h, h->width != 0u);
+            }
+            h->next = tick_cycle(h, (h->width != 0u && h->width < h->period)
+                                        ? h->width : h->period);
+        }
+        else
+        {
+            h->next = tick_cycle(h, h->period);
+        }
+    }
+    schedule_next();
+}
+
+void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    sim_timer_t *t = &s_timers[timer_index(ui32Base)];
+    sim_half_t *h;
+
+    FOR_HALVES(t, ui32Timer, h)
+    {
+        h->running = false;
+    }
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    schedule_next();
+}
@@ -0,0 +1,449 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     uart.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/uart.c, with a line-rate model of the
+ *           UARTs. \n
+ *           Each UART has a 16-byte TX FIFO that drains at one frame per
+ *           (start + data + parity + stop bits) * clock / baud cycles, and a
+ *           16-byte RX FIFO fed by sim_uart_receive(). UARTCharPut() spins
+ *           (counted as delay cycles) while the TX FIFO is full. The RX, RT
+ *           (32 bit-times of silence) and DMATX interrupt sources set RIS and
+ *           pend the UART's NVIC line when unmasked.\n
+ *           uDMA is modelled for UART0 TX (channel 9): the transfer is read
+ *           out when the channel is enabled and completes when its last byte
+ *           enters the FIFO. Bytes go to the hook of sim_uart_set_tx_hook()
+ *           when they are queued for transmission.\n
+ *           Only one sim_uart_receive() stream and one DMA transfer are in
+ *           flight at a time (one event slot each).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define UART_COUNT                 8u
+#define UART_FIFO_DEPTH            16u
+/** Receive timeout: bit periods of silence with data left in the RX FIFO. */
+#define UART_RT_BITS               32u
+/** Bytes sim_uart_receive() can hold. */
+#define UART_FEED_SIZE             1024u
+/** Bytes read out of a DMA transfer at a time. */
+#define UART_DMA_CHUNK             64u
+
+/** UARTConfigSetExpClk(): disable, divisor computation, IBRD/FBRD/LCRH. */
+#define COST_CONFIG_CYCLES         80u
+/** UARTEnable()/UARTDisable(): read-modify-write of LCRH and CTL.       */
+#define COST_ENABLE_CYCLES         12u
+/** Single register write (IFLS, ICR) behind a call.                     */
+#define COST_REG_WRITE_CYCLES      8u
+/** Read-modify-write of IM or DMACTL.                                    */
+#define COST_REG_RMW_CYCLES        10u
+/** Flag register poll: UARTCharsAvail(), UARTSpaceAvail(), UARTBusy().  */
+#define COST_POLL_CYCLES           8u
+/** UARTCharPut()/UARTCharGet() and non-blocking variants: FR, then DR.  */
+#define COST_CHAR_CYCLES           12u
+
+typedef struct
+{
+    uint32_t byteCycles;        /**< one frame on the line, 0 before config */
+    uint32_t bitCycles;
+    uint32_t rxLevel;           /**< RX FIFO trigger level in bytes         */
+    uint64_t txEnd;             /**< cycle the last queued frame is out     */
+    uint8_t  rx[UART_FIFO_DEPTH];
+    uint32_t rxHead;
+    uint32_t rxCount;
+    uint32_t ris;
+    uint32_t im;
+    uint32_t dma;
+    uint32_t overruns;
+} sim_uart_t;
+
+/** NVIC line per UART. */
+static const uint32_t s_ints[UART_COUNT] =
+{
+    INT_UART0, INT_UART1, INT_UART2, INT_UART3,
+    INT_UART4, INT_UART5, INT_UART6, INT_UART7,
+};
+
+/** Trigger level in bytes per UART_FIFO_RXn_8 setting. */
+static const uint32_t s_rxLevels[] = { 2u, 4u, 8u, 12u, 14u };
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static sim_uart_t      s_uarts[UART_COUNT];
+static sim_uart_hook_t s_txHook;
+
+static uint8_t         s_feed[UART_FEED_SIZE];
+static uint32_t        s_feedUart;
+static uint32_t        s_feedPos;
+static uint32_t        s_feedLen;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t uart_index(uint32_t base)
+{
+    return ((base - UART0_BASE) >> 12) % UART_COUNT;
+}
+
+/** Sets interrupt sources and pends the NVIC line if any is unmasked. */
+static void uart_raise(uint32_t index, uint32_t flags)
+{
+    s_uarts[index].ris |= flags;
+    if ((s_uarts[index].ris & s_uarts[index].im) != 0u)
+    {
+        sim_pend(s_ints[index]);
+    }
+}
+
+/** @returns uint32_t - free TX FIFO entries right now */
+static uint32_t tx_room(const sim_uart_t *u)
+{
+    uint64_t queued;
+
+    if (u->byteCycles == 0u || u->txEnd <= g_sim.cycles)
+    {
+        return UART_FIFO_DEPTH;
+    }
+    queued = (u->txEnd - g_sim.cycles + u->byteCycles - 1u) / u->byteCycles;
+    return (queued >= UART_FIFO_DEPTH) ? 0u
+                                       : UART_FIFO_DEPTH - (uint32_t)queued;
+}
+
+/** @returns uint64_t - cycles until one TX FIFO entry frees up */
+static uint64_t tx_wait(const sim_uart_t *u)
+{
+    uint64_t full = (uint64_t)(UART_FIFO_DEPTH - 1u) * u->byteCycles;
+
+    return u->txEnd - g_sim.cycles - full;
+}
+
+static void tx_queue(uint32_t base, uint8_t byte)
+{
+    sim_uart_t *u = &s_uarts[uart_index(base)];
+    uint64_t start = (u->txEnd > g_sim.cycles) ? u->txEnd : g_sim.cycles;
+
+    u->txEnd = start + u->byteCycles;
+    if (s_txHook != NULL)
+    {
+        s_txHook(base, byte);
+    }
+}
+
+static void rx_update_level(sim_uart_t *u)
+{
+    if (u->rxCount < u->rxLevel)
+    {
+        u->ris &= ~(uint32_t)UART_INT_RX;
+    }
+}
+
+static int32_t rx_pop(sim_uart_t *u)
+{
+    uint8_t byte;
+
+    if (u->rxCount == 0u)
+    {
+        return -1;
+    }
+    byte = u->rx[u->rxHead];
+    u->rxHead = (u->rxHead + 1u) % UART_FIFO_DEPTH;
+    u->rxCount--;
+    rx_update_level(u);
+    return byte;
+}
+
+/** Event: next byte of the sim_uart_receive() stream, or the timeout. */
+static void rx_event(uint64_t cycle)
+{
+    sim_uart_t *u = &s_uarts[s_feedUart];
+
+    if (s_feedPos == s_feedLen)
+    {
+        if (u->rxCount != 0u)
+        {
+            uart_raise(s_feedUart, UART_INT_RT);
+        }
+        return;
+    }
+    if (u->rxCount == UART_FIFO_DEPTH)
+    {
+        u->overruns++;
+        s_feedPos++;
+        uart_raise(s_feedUart, UART_INT_OE);
+    }
+    else
+    {
+        u->rx[(u->rxHead + u->rxCount) % UART_FIFO_DEPTH] = s_feed[s_feedPos++];
+        u->rxCount++;
+        if (u->rxCount >= u->rxLevel)
+        {
+            uart_raise(s_feedUart, UART_INT_RX);
+        }
+    }
+    sim_schedule(SIM_EVENT_UART_RX,
+                 cycle + ((s_feedPos < s_feedLen) ? u->byteCycles
+                                                  : UART_RT_BITS * u->bitCycles),
+                 rx_event);
+}
+
+/** Event: the last byte of the UART0 TX DMA transfer entered the FIFO. */
+static void dma_tx_done(uint64_t cycle)
+{
+    (void)cycle;
+
+    sim_udma_done(UDMA_CH9_UART0TX);
+    uart_raise(0u, UART_INT_DMATX);
+}
+
+/** uDMA channel 9 enabled: queue the whole transfer on UART0. */
+static void dma_tx_start(uint32_t channel)
+{
+    sim_uart_t *u = &s_uarts[0];
+    uint8_t chunk[UART_DMA_CHUNK];
+    uint64_t done;
+    uint32_t n;
+    uint32_t i;
+
+    if ((u->dma & UART_DMA_TX) == 0u)
+    {
+        return;
+    }
+    while ((n = sim_udma_read(channel, chunk, UART_DMA_CHUNK)) != 0u)
+    {
+        for (i = 0; i < n; i++)
+        {
+            tx_queue(UART0_BASE, chunk[i]);
+        }
+    }
+    done = g_sim.cycles + (uint64_t)UART_FIFO_DEPTH * u->byteCycles;
+    sim_schedule(SIM_EVENT_UART_TX,
+                 (u->txEnd > done) ? u->txEnd - (uint64_t)UART_FIFO_DEPTH *
+                                                    u->byteCycles
+                                   : g_sim.cycles,
+                 dma_tx_done);
+}
+
+void sim_uart_reset(void)
+{
+    uint32_t i;
+
+    memset(s_uarts, 0, sizeof(s_uarts));
+    for (i = 0; i < UART_COUNT; i++)
+    {
+        s_uarts[i].rxLevel = s_rxLevels[UART_FIFO_RX4_8 >> 3];
+    }
+    s_txHook = NULL;
+    s_feedPos = 0u;
+    s_feedLen = 0u;
+    sim_udma_attach(UDMA_CH9_UART0TX, dma_tx_start);
+}
+
+/**
+ * Installs an observer for transmitted bytes (NULL removes it).
+ */
+void sim_uart_set_tx_hook(sim_uart_hook_t hook)
+{
+    s_txHook = hook;
+}
+
+/**
+ * Makes bytes arrive on a UART's RX line back to back, the first one a
+ * frame time from now. Replaces a stream still in progress.
+ *
+ * @param[in] base   - UARTn_BASE, configured with UARTConfigSetExpClk()
+ * @param[in] data   - bytes to receive
+ * @param[in] length - number of bytes, at most 1024
+ */
+void sim_uart_receive(uint32_t base, const uint8_t *data, uint32_t length)
+{
+    s_feedUart = uart_index(base);
+    s_feedLen = (length < UART_FEED_SIZE) ? length : UART_FEED_SIZE;
+    s_feedPos = 0u;
+    memcpy(s_feed, data, s_feedLen);
+    sim_schedule(SIM_EVENT_UART_RX,
+                 g_sim.cycles + s_uarts[s_feedUart].byteCycles, rx_event);
+}
+
+/** @returns uint32_t - bytes lost because the RX FIFO was full */
+uint32_t sim_uart_overruns(uint32_t base)
+{
+    return s_uarts[uart_index(base)].overruns;
+}
+
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk,
+                         uint32_t ui32Baud, uint32_t ui32Config)
+{
+    sim_uart_t *u = &s_uarts[uart_index(ui32Base)];
+    uint32_t bits = 1u + 5u + ((ui32Config & UART_CONFIG_WLEN_MASK) >> 5) +
+                    (((ui32Config & UART_CONFIG_STOP_MASK) != 0u) ? 2u : 1u) +
+                    (((ui32Config & UART_CONFIG_PAR_MASK) != 0u) ? 1u : 0u);
+
+    u->bitCycles = ui32UARTClk / ui32Baud;
+    u->byteCycles = (uint32_t)((uint64_t)ui32UARTClk * bits / ui32Baud);
+    sim_charge(COST_CONFIG_CYCLES, 4, 6);
+}
+
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel,
+                      uint32_t ui32RxLevel)
+{
+    (void)ui32TxLevel;
+
+    s_uarts[uart_index(ui32Base)].rxLevel = s_rxLevels[(ui32RxLevel >> 3) % 5u];
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+}
+
+void UARTEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    sim_charge(COST_ENABLE_CYCLES, 2, 2);
+}
+
+void UARTDisable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+
+    sim_charge(COST_ENABLE_CYCLES, 2, 2);
+}
+
+bool UARTCharsAvail(uint32_t ui32Base)
+{
+    sim_charge(COST_POLL_CYCLES, 1, 0);
+    return s_uarts[uart_index(ui32Base)].rxCount != 0u;
+}
+
+bool UARTSpaceAvail(uint32_t ui32Base)
+{
+    sim_charge(COST_POLL_CYCLES, 1, 0);
+    return tx_room(&s_uarts[uart_index(ui32Base)]) != 0u;
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base)
+{
+    sim_charge(COST_CHAR_CYCLES, 2, 0);
+    return rx_pop(&s_uarts[uart_index(ui32Base)]);
+}
+
+int32_t UARTCharGet(uint32_t ui32Base)
+{
+    uint32_t index = uart_index(ui32Base);
+
+    while (s_uarts[index].rxCount == 0u)
+    {
+        if (s_feedUart != index || s_feedPos == s_feedLen)
+        {
+            /* nothing will ever arrive */
+            sim_stop();
+        }
+        sim_delay(s_uarts[index].byteCycles);
+    }
+    sim_charge(COST_CHAR_CYCLES, 2, 0);
+    return rx_pop(&s_uarts[index]);
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    bool room = tx_room(&s_uarts[uart_index(ui32Base)]) != 0u;
+
+    sim_charge(COST_CHAR_CYCLES, 1, room ? 1 : 0);
+    if (room)
+    {
+        tx_queue(ui32Base, ucData);
+    }
+    return room;
+}
+
+void UARTCharPut(uint32_t ui32Base, unsigned char ucData)
+{
+    sim_uart_t *u = &s_uarts[uart_index(ui32Base)];
+
+    while (tx_room(u) == 0u)
+    {
+        sim_delay(tx_wait(u));
+    }
+    tx_queue(ui32Base, ucData);
+    sim_charge(COST_CHAR_CYCLES, 1, 1);
+}
+
+bool UARTBusy(uint32_t ui32Base)
+{
+    sim_charge(COST_POLL_CYCLES, 1, 0);
+    return s_uarts[uart_index(ui32Base)].txEnd > g_sim.cycles;
+}
+
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    uint32_t index = uart_index(ui32Base);
+
+    s_uarts[index].im |= ui32IntFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+    uart_raise(index, 0u);
+}
+
+void UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    s_uarts[uart_index(ui32Base)].im &= ~ui32IntFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    const sim_uart_t *u = &s_uarts[uart_index(ui32Base)];
+
+    sim_charge(COST_POLL_CYCLES, 1, 0);
+    return bMasked ? (u->ris & u->im) : u->ris;
+}
+
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    uint32_t index = uart_index(ui32Base);
+
+    s_uarts[index].ris &= ~ui32IntFlags;
+    sim_charge(COST_REG_WRITE_CYCLES, 0, 1);
+    /* sources still asserted keep the line active */
+    uart_raise(index, 0u);
+}
+
+void UARTDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    s_uarts[uart_index(ui32Base)].dma |= ui32DMAFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
+
+void UARTDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    s_uarts[uart_index(ui32Base)].dma &= ~ui32DMAFlags;
+    sim_charge(COST_REG_RMW_CYCLES, 1, 1);
+}
@@ -0,0 +1,741 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     udma.c
+ * @author   insert authors names here
+ * @brief    Stand-in for driverlib/udma.c. \n
+ *           The control table handed to uDMAControlBaseSet() is only kept for
+ *           reference; transfers are described by the model's own copy of the
+ *           primary and alternate structures. The uDMA has no timing of its
+ *           own here: the peripheral model attached to a channel
+ *           (sim_udma_attach()) is told when the channel is enabled, moves
+ *           the items with sim_udma_read() at its own pace and reports the end
+ *           of the transfer with sim_udma_done(). Peripheral-to-memory
+ *           channels are fed with sim_udma_write() instead, which also
+ *           follows ping-pong mode: when the active structure completes, the
+ *           channel switches to the other one, or stops if that one is in
+ *           UDMA_MODE_STOP. Peripheral addresses passed to
+ *           uDMAChannelTransferSet() are never dereferenced.\n
+ *           Software transfers (uDMAChannelRequest() on a channel in AUTO or
+ *           memory scatter-gather mode) are timed by the model: one channel
+ *           at a time, lowest number first, UDMA_ITEM_CYCLES per item plus
+ *           re-arbitration and task fetches. The items are moved when the
+ *           transfer ends; then the channel's bit is set in uDMAIntStatus()
+ *           and INT_UDMA is pended. A NULL source or destination ends the
+ *           transfer with a bus error instead: uDMAErrorStatusGet() and
+ *           INT_UDMAERR. Bus contention with the core is not modelled.\n
+ *           Peripherals that only raise requests, such as a timer timeout,
+ *           call sim_udma_request(): each request moves one arbitration
+ *           burst of the active structure, and in peripheral scatter-gather
+ *           mode first copies the next task to the alternate structure.
+ *           Items such a transfer stores to a GPIO data address go through
+ *           the GPIO model; stores into the control table given to
+ *           uDMAControlBaseSet() update the structure they land in, so a
+ *           task may re-arm its own channel. uDMAChannelScatterGatherSet()
+ *           writes the primary structure into that table, as driverlib
+ *           does.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <string.h>
+
+#include "host/sim/sim.h"
+#include "inc/hw_ints.h"
+#include "driverlib/udma.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define UDMA_CHANNELS              32u
+/** Primary structures 0..31, alternate 32..63 (UDMA_ALT_SELECT). */
+#define UDMA_STRUCTS               (2u * UDMA_CHANNELS)
+
+/** Register write behind uDMAEnable(), uDMAChannelEnable() and the like. */
+#define COST_REG_CYCLES            6u
+/** uDMAChannelAssign(): read-modify-write of one DMACHMAPn nibble.       */
+#define COST_ASSIGN_CYCLES         20u
+/** uDMAChannelAttributeEnable/Disable(): up to four set/clear registers. */
+#define COST_ATTR_CYCLES           30u
+/** uDMAChannelControlSet(): read-modify-write of the control word.       */
+#define COST_CONTROL_CYCLES        20u
+/** uDMAChannelTransferSet(): end pointers and transfer size computed.    */
+#define COST_TRANSFER_SET_CYCLES   60u
+/** uDMAChannelIsEnabled(), uDMAChannelSizeGet(), uDMAChannelModeGet().   */
+#define COST_QUERY_CYCLES          10u
+/** uDMAChannelScatterGatherSet(): primary structure written.             */
+#define COST_SG_SET_CYCLES         50u
+
+/** Software transfers: control structure read at the start, written back. */
+#define UDMA_START_CYCLES          8u
+/** One bus read and one bus write per item (SRAM, no wait states).        */
+#define UDMA_ITEM_CYCLES           2u
+/** Re-arbitration after every ARBSIZE items.                             */
+#define UDMA_ARB_CYCLES            4u
+/** Scatter-gather: four words of a task copied to the alternate structure. */
+#define UDMA_TASK_CYCLES           8u
+
+/** Peripheral space and bit-band alias: stores that reach a model. */
+#define UDMA_PERIPH_BASE           0x40000000u
+#define UDMA_PERIPH_END            0x44000000u
+/** GPIO ports A to Q on the AHB aperture. */
+#define UDMA_GPIO_BASE             0x40058000u
+#define UDMA_GPIO_END              0x40067000u
+
+/** No software transfer in progress. */
+#define UDMA_IDLE                  UDMA_CHANNELS
+
+typedef struct
+{
+    const uint8_t *src;
+    uint8_t       *dst;
+    uint32_t       control;
+    uint32_t       mode;
+    uint32_t       remaining;   /**< items still to move */
+    const tDMAControlTable *tasks;      /**< scatter-gather task list */
+    uint32_t       taskCount;
+} udma_struct_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static udma_struct_t        s_structs[UDMA_STRUCTS];
+static uint32_t             s_enabled;
+static void                *s_controlBase;
+static uint32_t             s_alt;      /**< bit n: channel n on its alternate */
+static sim_udma_start_fn_t  s_start[UDMA_CHANNELS];
+static uint32_t             s_swRequest;    /**< requested, not started */
+static uint32_t             s_swActive = UDMA_IDLE;
+static uint32_t             s_intStatus;
+static uint32_t             s_errStatus;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/** @returns uint32_t - bytes per item of a control word */
+static uint32_t item_bytes(uint32_t control)
+{
+    return 1u << ((control >> 28) & 3u);
+}
+
+/** @returns uint32_t - source increment in bytes, 0 for UDMA_SRC_INC_NONE */
+static uint32_t src_step(uint32_t control)
+{
+    uint32_t inc = (control >> 26) & 3u;
+
+    return (inc == 3u) ? 0u : (1u << inc);
+}
+
+/** @returns uint32_t - destination increment in bytes, 0 for UDMA_DST_INC_NONE */
+static uint32_t dst_step(uint32_t control)
+{
+    uint32_t inc = (control >> 30) & 3u;
+
+    return (inc == 3u) ? 0u : (1u << inc);
+}
+
+/** @returns uint32_t - items per arbitration of a control word */
+static uint32_t arb_items(uint32_t control)
+{
+    return 1u << ((control >> 14) & 0xFu);
+}
+
+/** @returns uint64_t - cycles the engine takes to move @p items */
+static uint64_t items_cycles(uint32_t control, uint32_t items)
+{
+    return (uint64_t)items * UDMA_ITEM_CYCLES +
+           (uint64_t)(items / arb_items(control)) * UDMA_ARB_CYCLES;
+}
+
+/**
+ * Decodes a task of a scatter-gather list: the end pointers address the
+ * last byte of the transfer (uDMATaskStructEntry()).
+ *
+ * @returns uint32_t - number of items
+ */
+static uint32_t task_decode(const tDMAControlTable *task, const uint8_t **src,
+                            uint8_t **dst)
+{
+    uint32_t control = task->ui32Control;
+    uint32_t items = ((control >> 4) & 0x3FFu) + 1u;
+    uint32_t sstep = src_step(control);
+    uint32_t dstep = dst_step(control);
+    const uint8_t *srcEnd = (const uint8_t *)task->pvSrcEndAddr;
+    uint8_t *dstEnd = (uint8_t *)task->pvDstEndAddr;
+
+    *src = (sstep == 0u || srcEnd == NULL) ? srcEnd : srcEnd + 1 - items * sstep;
+    *dst = (dstep == 0u || dstEnd == NULL) ? dstEnd : dstEnd + 1 - items * dstep;
+    return items;
+}
+
+/** Memory to memory, honouring item size and increments. */
+static bool move_items(const uint8_t *src, uint8_t *dst, uint32_t control,
+                       uint32_t items)
+{
+    uint32_t size = item_bytes(control);
+    uint32_t sstep = src_step(control);
+    uint32_t dstep = dst_step(control);
+    uint32_t i;
+
+    if (src == NULL || dst == NULL)
+    {
+        return false;
+    }
+    for (i = 0; i < items; i++)
+    {
+        memcpy(dst, src, size);
+        src += sstep;
+        dst += dstep;
+    }
+    return true;
+}
+
+static bool task_is_last(const tDMAControlTable *task)
+{
+    return (task->ui32Control & UDMA_MODE_M) !=
+           (UDMA_MODE_MEM_SCATTER_GATHER | UDMA_MODE_ALT_SELECT);
+}
+
+static void sw_start(void);
+
+/** Event: the software transfer of s_swActive ends. */
+static void sw_done(uint64_t cycle)
+{
+    uint32_t channel = s_swActive;
+    udma_struct_t *s = &s_structs[channel];
+    bool ok = true;
+
+    (void)cycle;
+
+    if (s->mode == UDMA_MODE_MEM_SCATTER_GATHER)
+    {
+        uint32_t i;
+
+        for (i = 0; i < s->taskCount && ok; i++)
+        {
+            const uint8_t *src;
+            uint8_t *dst;
+            uint32_t items = task_decode(&s->tasks[i], &src, &dst);
+
+            ok = move_items(src, dst, s->tasks[i].ui32Control, items);
+            if (task_is_last(&s->tasks[i]))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        ok = move_items(s->src, s->dst, s->control, s->remaining);
+    }
+
+    s->mode = UDMA_MODE_STOP;
+    s->remaining = 0u;
+    s_enabled &= ~(1u << channel);
+    s_swActive = UDMA_IDLE;
+    if (ok)
+    {
+        s_intStatus |= 1u << channel;
+        sim_pend(INT_UDMA);
+    }
+    else
+    {
+        s_errStatus = 1u;
+        sim_pend(INT_UDMAERR);
+    }
+    sw_start();
+}
+
+/** Starts the lowest requested channel, if the engine is free. */
+static void sw_start(void)
+{
+    udma_struct_t *s;
+    uint64_t cycles = UDMA_START_CYCLES;
+    uint32_t channel;
+
+    if (s_swActive != UDMA_IDLE || s_swRequest == 0u)
+    {
+        return;
+    }
+    for (channel = 0; (s_swRequest & (1u << channel)) == 0u; channel++)
+    {
+    }
+    s_swRequest &= ~(1u << channel);
+    s_swActive = channel;
+    s = &s_structs[channel];
+
+    if (s->mode == UDMA_MODE_MEM_SCATTER_GATHER)
+    {
+        uint32_t i;
+
+        for (i = 0; i < s->taskCount; i++)
+        {
+            const uint8_t *src;
+            uint8_t *dst;
+            uint32_t items = task_decode(&s->tasks[i], &src, &dst);
+
+            cycles += UDMA_TASK_CYCLES +
+                      items_cycles(s->tasks[i].ui32Control, items);
+            if (task_is_last(&s->tasks[i]))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        cycles += items_cycles(s->control, s->remaining);
+    }
+    sim_schedule(SIM_EVENT_UDMA, g_sim.cycles + cycles, sw_done);
+}
+
+/**
+ * A store landed in the control table: the structure it belongs to follows
+ * a new control word (transfer size and mode), as the controller would read
+ * it at its next request.
+ */
+static void table_written(const uint8_t *dst)
+{
+    const uint8_t *table = (const uint8_t *)s_controlBase;
+    const tDMAControlTable *entry;
+    udma_struct_t *s;
+    uint32_t index;
+
+    if (table == NULL || dst < table ||
+        dst >= table + UDMA_STRUCTS * sizeof(tDMAControlTable))
+    {
+        return;
+    }
+    index = (uint32_t)((dst - table) / sizeof(tDMAControlTable));
+    entry = &((const tDMAControlTable *)table)[index];
+    if (dst != (const uint8_t *)&entry->ui32Control)
+    {
+        return;
+    }
+    s = &s_structs[index];
+    s->control = entry->ui32Control;
+    s->mode = s->control & UDMA_MODE_M;
+    s->remaining = (s->mode == UDMA_MODE_STOP)
+                       ? 0u : ((s->control >> 4) & 0x3FFu) + 1u;
+}
+
+/** One item stored by the engine: to a peripheral model or to memory. */
+static void bus_store(uint8_t *dst, const uint8_t *src, uint32_t size)
+{
+    uintptr_t addr = (uintptr_t)dst;
+
+    if (addr >= UDMA_PERIPH_BASE && addr < UDMA_PERIPH_END)
+    {
+        uint32_t value = 0u;
+
+        memcpy(&value, src, size);
+        if (addr >= UDMA_GPIO_BASE && addr < UDMA_GPIO_END)
+        {
+            sim_gpio_bus_store((uint32_t)addr, value);
+        }
+        else
+        {
+            *sim_reg32((uint32_t)addr) = value;
+        }
+        return;
+    }
+    memcpy(dst, src, size);
+    table_written(dst);
+}
+
+/** Copies a task of a scatter-gather list into the alternate structure. */
+static void task_load(udma_struct_t *alt, const tDMAControlTable *task)
+{
+    const uint8_t *src;
+    uint8_t *dst;
+
+    alt->remaining = task_decode(task, &src, &dst);
+    alt->src = src;
+    alt->dst = dst;
+    alt->control = task->ui32Control;
+    alt->mode = alt->control & UDMA_MODE_M;
+}
+
+void sim_udma_reset(void)
+{
+    memset(s_structs, 0, sizeof(s_structs));
+    memset(s_start, 0, sizeof(s_start));
+    s_enabled = 0u;
+    s_alt = 0u;
+    /* s_controlBase is kept: dma_init() sets it once per program run */
+    s_swRequest = 0u;
+    s_swActive = UDMA_IDLE;
+    s_intStatus = 0u;
+    s_errStatus = 0u;
+    sim_cancel(SIM_EVENT_UDMA);
+}
+
+/**
+ * Connects a peripheral model to a channel.
+ *
+ * @param[in] channel - channel number, 0..31
+ * @param[in] start   - called when software enables the channel
+ */
+void sim_udma_attach(uint32_t channel, sim_udma_start_fn_t start)
+{
+    s_start[channel] = start;
+}
+
+/**
+ * Moves items of a memory-to-peripheral transfer out of the primary
+ * structure, as the peripheral requests them.
+ *
+ * @param[in]  channel - channel number
+ * @param[out] out     - receives the items, packed
+ * @param[in]  max     - most items to move
+ * @returns uint32_t   - items moved, 0 when the transfer is exhausted
+ */
+uint32_t sim_udma_read(uint32_t channel, void *out, uint32_t max)
+{
+    udma_struct_t *s = &s_structs[channel];
+    uint32_t size = item_bytes(s->control);
+    uint32_t step = src_step(s->control);
+    uint8_t *dst = (uint8_t *)out;
+    uint32_t n = (max < s->remaining) ? max : s->remaining;
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        memcpy(dst, s->src, size);
+        dst += size;
+        s->src += step;
+    }
+    s->remaining -= n;
+    return n;
+}
+
+/**
+ * Stores items of a peripheral-to-memory transfer, as the peripheral
+ * produces them, through the active structure of the channel.
+ *
+ * @param[in]  channel - channel number
+ * @param[in]  in      - the items, packed
+ * @param[in]  count   - number of items
+ * @param[out] done    - number of structures these items completed
+ * @returns uint32_t   - items stored; fewer than @p count if the channel is
+ *                       or became disabled
+ */
+uint32_t sim_udma_write(uint32_t channel, const void *in, uint32_t count,
+                        uint32_t *done)
+{
+    const uint8_t *src = (const uint8_t *)in;
+    uint32_t bit = 1u << channel;
+    uint32_t moved = 0;
+
+    *done = 0u;
+    while (moved < count && (s_enabled & bit) != 0u)
+    {
+        udma_struct_t *s = &s_structs[channel +
+                                      (((s_alt & bit) != 0u) ? UDMA_CHANNELS : 0u)];
+        uint32_t size = item_bytes(s->control);
+
+        if (s->mode == UDMA_MODE_STOP || s->remaining == 0u)
+        {
+            s_enabled &= ~bit;
+            break;
+        }
+        memcpy(s->dst, src, size);
+        s->dst += dst_step(s->control);
+        src += size;
+        moved++;
+        if (--s->remaining == 0u)
+        {
+            (*done)++;
+            if (s->mode == UDMA_MODE_PINGPONG)
+            {
+                s_alt ^= bit;
+            }
+            else
+            {
+                s_enabled &= ~bit;
+            }
+            s->mode = UDMA_MODE_STOP;
+        }
+    }
+    return moved;
+}
+
+/**
+ * Ends the transfer of a channel: the channel disables itself and its
+ * structure goes back to UDMA_MODE_STOP.
+ */
+void sim_udma_done(uint32_t channel)
+{
+    s_structs[channel].mode = UDMA_MODE_STOP;
+    s_structs[channel].remaining = 0u;
+    s_enabled &= ~(1u << channel);
+}
+
+/**
+ * A peripheral requests its channel (e.g. a timer timeout with
+ * TimerDMAEventSet()): the engine moves one arbitration burst of the
+ * active structure. In peripheral scatter-gather mode the primary structure
+ * first copies the next task to the alternate one; a task that ends in
+ * scatter-gather mode hands back to the primary structure, any other ends
+ * the transfer. Bus cycles are not charged to the core.
+ *
+ * @param[in] channel - channel number
+ */
+void sim_udma_request(uint32_t channel)
+{
+    uint32_t bit = 1u << channel;
+    udma_struct_t *pri = &s_structs[channel];
+    udma_struct_t *alt = &s_structs[channel + UDMA_CHANNELS];
+    udma_struct_t *s;
+    uint32_t items;
+    uint32_t i;
+
+    if ((s_enabled & bit) == 0u)
+    {
+        return;
+    }
+    if (pri->mode == UDMA_MODE_PER_SCATTER_GATHER && (s_alt & bit) == 0u)
+    {
+        if (pri->tasks == NULL || pri->remaining < 4u ||
+            pri->remaining / 4u > pri->taskCount)
+        {
+            sim_udma_done(channel);
+            return;
+        }
+        task_load(alt, &pri->tasks[pri->taskCount - pri->remaining / 4u]);
+        pri->remaining -= 4u;
+        s_alt |= bit;
+    }
+    s = ((s_alt & bit) != 0u) ? alt : pri;
+    if (s->mode == UDMA_MODE_STOP || s->remaining == 0u)
+    {
+        s_enabled &= ~bit;
+        return;
+    }
+
+    items = arb_items(s->control);
+    if (items > s->remaining)
+    {
+        items = s->remaining;
+    }
+    for (i = 0; i < items; i++)
+    {
+        bus_store(s->dst, s->src, item_bytes(s->control));
+        s->src += src_step(s->control);
+        s->dst += dst_step(s->control);
+    }
+    s->remaining -= items;
+    if (s->remaining != 0u)
+    {
+        return;
+    }
+
+    s->mode = UDMA_MODE_STOP;
+    if (s == alt && pri->mode == UDMA_MODE_PER_SCATTER_GATHER &&
+        (alt->control & UDMA_MODE_M) ==
+            (UDMA_MODE_PER_SCATTER_GATHER | UDMA_MODE_ALT_SELECT))
+    {
+        /* back to the primary structure: the channel ends with its list */
+        s_alt &= ~bit;
+        if (pri->remaining != 0u)
+        {
+            return;
+        }
+    }
+    s_alt &= ~bit;
+    sim_udma_done(channel);
+}
+
+void uDMAEnable(void)
+{
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+void uDMADisable(void)
+{
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+void uDMAControlBaseSet(void *pControlTable)
+{
+    s_controlBase = pControlTable;
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+void uDMAChannelAssign(uint32_t ui32Mapping)
+{
+    (void)ui32Mapping;
+
+    sim_charge(COST_ASSIGN_CYCLES, 1, 1);
+}
+
+void uDMAChannelAttributeEnable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+    if ((ui32Attr & UDMA_ATTR_ALTSELECT) != 0u)
+    {
+        s_alt |= 1u << (ui32ChannelNum % UDMA_CHANNELS);
+    }
+
+    sim_charge(COST_ATTR_CYCLES, 0, 4);
+}
+
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+    if ((ui32Attr & UDMA_ATTR_ALTSELECT) != 0u)
+    {
+        s_alt &= ~(1u << (ui32ChannelNum % UDMA_CHANNELS));
+    }
+
+    sim_charge(COST_ATTR_CYCLES, 0, 4);
+}
+
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex,
+                           uint32_t ui32Control)
+{
+    s_structs[ui32ChannelStructIndex % UDMA_STRUCTS].control = ui32Control;
+    sim_charge(COST_CONTROL_CYCLES, 0, 0);
+}
+
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex,
+                            uint32_t ui32Mode, void *pvSrcAddr,
+                            void *pvDstAddr, uint32_t ui32TransferSize)
+{
+    udma_struct_t *s = &s_structs[ui32ChannelStructIndex % UDMA_STRUCTS];
+
+    s->src = (const uint8_t *)pvSrcAddr;
+    s->dst = (uint8_t *)pvDstAddr;
+    s->mode = ui32Mode;
+    s->remaining = ui32TransferSize;
+    sim_charge(COST_TRANSFER_SET_CYCLES, 0, 0);
+}
+
+void uDMAChannelEnable(uint32_t ui32ChannelNum)
+{
+    uint32_t channel = ui32ChannelNum % UDMA_CHANNELS;
+
+    s_enabled |= 1u << channel;
+    sim_charge(COST_REG_CYCLES, 0, 1);
+    if (s_start[channel] != NULL)
+    {
+        s_start[channel](channel);
+    }
+}
+
+void uDMAChannelDisable(uint32_t ui32ChannelNum)
+{
+    uint32_t channel = ui32ChannelNum % UDMA_CHANNELS;
+
+    s_enabled &= ~(1u << channel);
+    s_swRequest &= ~(1u << channel);
+    if (s_swActive == channel)
+    {
+        sim_cancel(SIM_EVENT_UDMA);
+        s_swActive = UDMA_IDLE;
+        sw_start();
+    }
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum)
+{
+    sim_charge(COST_QUERY_CYCLES, 1, 0);
+    return (s_enabled & (1u << (ui32ChannelNum % UDMA_CHANNELS))) != 0u;
+}
+
+uint32_t uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex)
+{
+    sim_charge(COST_QUERY_CYCLES, 0, 0);
+    return s_structs[ui32ChannelStructIndex % UDMA_STRUCTS].remaining;
+}
+
+uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex)
+{
+    sim_charge(COST_QUERY_CYCLES, 0, 0);
+    return s_structs[ui32ChannelStructIndex % UDMA_STRUCTS].mode;
+}
+
+void uDMAChannelRequest(uint32_t ui32ChannelNum)
+{
+    uint32_t channel = ui32ChannelNum % UDMA_CHANNELS;
+    uint32_t mode = s_structs[channel].mode;
+
+    sim_charge(COST_REG_CYCLES, 0, 1);
+    if ((s_enabled & (1u << channel)) != 0u && s_swActive != channel &&
+        (mode == UDMA_MODE_AUTO || mode == UDMA_MODE_MEM_SCATTER_GATHER))
+    {
+        s_swRequest |= 1u << channel;
+        sw_start();
+    }
+}
+
+void uDMAChannelScatterGatherSet(uint32_t ui32ChannelNum,
+                                 uint32_t ui32TaskCount, void *pvTaskList,
+                                 uint32_t ui32IsPeriphSG)
+{
+    udma_struct_t *s = &s_structs[ui32ChannelNum % UDMA_CHANNELS];
+
+    s->tasks = (const tDMAControlTable *)pvTaskList;
+    s->taskCount = ui32TaskCount;
+    s->mode = ui32IsPeriphSG ? UDMA_MODE_PER_SCATTER_GATHER
+                             : UDMA_MODE_MEM_SCATTER_GATHER;
+    s->remaining = ui32TaskCount * 4u;
+    s->control = UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32 |
+                 UDMA_ARB_4 | ((s->remaining - 1u) << 4) | s->mode;
+    s_alt &= ~(1u << (ui32ChannelNum % UDMA_CHANNELS));
+    if (s_controlBase != NULL)
+    {
+        tDMAControlTable *entry =
+            &((tDMAControlTable *)s_controlBase)[ui32ChannelNum % UDMA_CHANNELS];
+
+        entry->pvSrcEndAddr =
+            &((tDMAControlTable *)pvTaskList)[ui32TaskCount - 1u].ui32Spare;
+        entry->pvDstEndAddr =
+            &((tDMAControlTable *)s_controlBase)[(ui32ChannelNum % UDMA_CHANNELS) +
+                                                 UDMA_CHANNELS].ui32Spare;
+        entry->ui32Control = s->control;
+    }
+    sim_charge(COST_SG_SET_CYCLES, 0, 0);
+}
+
+uint32_t uDMAIntStatus(void)
+{
+    sim_charge(COST_QUERY_CYCLES, 1, 0);
+    return s_intStatus;
+}
+
+void uDMAIntClear(uint32_t ui32ChanMask)
+{
+    s_intStatus &= ~ui32ChanMask;
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
+
+uint32_t uDMAErrorStatusGet(void)
+{
+    sim_charge(COST_QUERY_CYCLES, 1, 0);
+    return s_errStatus;
+}
+
+void uDMAErrorStatusClear(void)
+{
+    s_errStatus = 0u;
+    sim_charge(COST_REG_CYCLES, 0, 1);
+}
@@ -0,0 +1,70 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - simulated TivaWare HAL
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     vtable_host.c
+ * @author   insert authors names here
+ * @brief    Host side of common/vtable.h: handlers go to the simulator's
+ *           exception dispatch (sim_set_vector()). Unlike the target,
+ *           register_isr() returns NULL when the previous handler was the
+ *           weak default. \n
+ *           Also the host's vector_trap() (common/vector_table.h), which
+ *           records the vector and returns, so benches can check it.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stddef.h>
+
+#include "host/sim/sim.h"
+#include "common/vtable.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** STR to the RAM table + DSB */
+#define COST_REGISTER_CYCLES    4u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global vars
+ *
+ *------------------------------------------------------------------------------*/
+volatile uint32_t g_vector_trap;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+void vtable_init(void)
+{
+}
+
+vtable_handler_t register_isr(uint32_t irq, vtable_handler_t fn)
+{
+    if (irq >= VTABLE_ENTRIES || irq == 0u)
+    {
+        return NULL;
+    }
+    sim_charge(COST_REGISTER_CYCLES, 0, 0);
+    return sim_set_vector(irq, fn);
+}
+
+void vector_trap(void)
+{
+    g_vector_trap = sim_active_exception();
+}
@@ -0,0 +1,125 @@
+//*****************************************************************************
+//
+// can.h - Host stand-in for the TivaWare CAN controller API.
+//
+// Prototypes follow TivaWare 2.2.0.295; only the subset used by this
+// repository is provided.  The functions are implemented by the simulator in
+// host/sim/can.c.  Message objects are numbered 1 to 32.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_CAN_H__
+#define __DRIVERLIB_CAN_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Flags of tCANMsgObject.ui32Flags.
+//
+//*****************************************************************************
+#define MSG_OBJ_NO_FLAGS        0x00000000
+#define MSG_OBJ_TX_INT_ENABLE   0x00000001
+#define MSG_OBJ_RX_INT_ENABLE   0x00000002
+#define MSG_OBJ_EXTENDED_ID     0x00000004
+#define MSG_OBJ_USE_ID_FILTER   0x00000008
+#define MSG_OBJ_NEW_DATA        0x00000080
+#define MSG_OBJ_DATA_LOST       0x00000100
+#define MSG_OBJ_USE_DIR_FILTER  (0x00000010 | MSG_OBJ_USE_ID_FILTER)
+#define MSG_OBJ_USE_EXT_FILTER  (0x00000020 | MSG_OBJ_USE_ID_FILTER)
+#define MSG_OBJ_REMOTE_FRAME    0x00000040
+#define MSG_OBJ_FIFO            0x00000200
+
+//*****************************************************************************
+//
+// Interrupt sources of CANIntEnable()/CANIntDisable().
+//
+//*****************************************************************************
+#define CAN_INT_ERROR           0x00000008
+#define CAN_INT_STATUS          0x00000004
+#define CAN_INT_MASTER          0x00000002
+
+//*****************************************************************************
+//
+// Bits of CANStatusGet(CAN_STS_CONTROL).
+//
+//*****************************************************************************
+#define CAN_STATUS_BUS_OFF      0x00000080
+#define CAN_STATUS_EWARN        0x00000040
+#define CAN_STATUS_EPASS        0x00000020
+#define CAN_STATUS_RXOK         0x00000010
+#define CAN_STATUS_TXOK         0x00000008
+#define CAN_STATUS_LEC_MSK      0x00000007
+#define CAN_STATUS_LEC_NONE     0x00000000
+
+typedef struct
+{
+    uint32_t ui32MsgID;
+    uint32_t ui32MsgIDMask;
+    uint32_t ui32Flags;
+    uint32_t ui32MsgLen;
+    uint8_t *pui8MsgData;
+}
+tCANMsgObject;
+
+typedef enum
+{
+    CAN_INT_STS_CAUSE,
+    CAN_INT_STS_OBJECT
+}
+tCANIntStsReg;
+
+typedef enum
+{
+    CAN_STS_CONTROL,
+    CAN_STS_TXREQUEST,
+    CAN_STS_NEWDAT,
+    CAN_STS_MSGVAL
+}
+tCANStsReg;
+
+typedef enum
+{
+    MSG_OBJ_TYPE_TX,
+    MSG_OBJ_TYPE_TX_REMOTE,
+    MSG_OBJ_TYPE_RX,
+    MSG_OBJ_TYPE_RX_REMOTE,
+    MSG_OBJ_TYPE_RXTX_REMOTE
+}
+tMsgObjType;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void CANInit(uint32_t ui32Base);
+extern uint32_t CANBitRateSet(uint32_t ui32Base, uint32_t ui32SourceClock,
+                              uint32_t ui32BitRate);
+extern void CANEnable(uint32_t ui32Base);
+extern void CANDisable(uint32_t ui32Base);
+extern void CANRetrySet(uint32_t ui32Base, bool bAutoRetry);
+extern bool CANErrCntrGet(uint32_t ui32Base, uint32_t *pui32RxCount,
+                          uint32_t *pui32TxCount);
+extern void CANIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void CANIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern uint32_t CANIntStatus(uint32_t ui32Base, tCANIntStsReg eIntStsReg);
+extern void CANIntClear(uint32_t ui32Base, uint32_t ui32IntClr);
+extern uint32_t CANStatusGet(uint32_t ui32Base, tCANStsReg eStatusReg);
+extern void CANMessageSet(uint32_t ui32Base, uint32_t ui32ObjID,
+                          tCANMsgObject *psMsgObject, tMsgObjType eMsgType);
+extern void CANMessageGet(uint32_t ui32Base, uint32_t ui32ObjID,
+                          tCANMsgObject *psMsgObject, bool bClrPendingInt);
+extern void CANMessageClear(uint32_t ui32Base, uint32_t ui32ObjID);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_CAN_H__
@@ -0,0 +1,203 @@
+//*****************************************************************************
+//
+// emac.h - Host stand-in for the TivaWare Ethernet controller API.
+//
+// Prototypes follow TivaWare 2.2.0.295; only the subset used by this
+// repository is provided.  The functions are implemented by the simulator in
+// host/sim/emac.c.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_EMAC_H__
+#define __DRIVERLIB_EMAC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// DMA descriptor, in the 8-word (enhanced) layout used with
+// EMAC_BCONFIG_ALT_DESCRIPTORS clear and chained lists.
+//
+//*****************************************************************************
+typedef struct tEMACDMADescriptor tEMACDMADescriptor;
+
+typedef union
+{
+    void *pvBuffer2;
+    tEMACDMADescriptor *pLink;
+}
+tEMACDES3;
+
+struct tEMACDMADescriptor
+{
+    volatile uint32_t ui32CtrlStatus;
+    volatile uint32_t ui32Count;
+    void *pvBuffer1;
+    tEMACDES3 DES3;
+    volatile uint32_t ui32ExtRxStatus;
+    uint32_t ui32Reserved;
+    volatile uint32_t ui32IEEE1588TimeLo;
+    volatile uint32_t ui32IEEE1588TimeHi;
+};
+
+//*****************************************************************************
+//
+// Fields of the transmit descriptor words.
+//
+//*****************************************************************************
+#define DES0_TX_CTRL_OWN            0x80000000
+#define DES0_TX_CTRL_INTERRUPT      0x40000000
+#define DES0_TX_CTRL_LAST_SEG       0x20000000
+#define DES0_TX_CTRL_FIRST_SEG      0x10000000
+#define DES0_TX_CTRL_DISABLE_CRC    0x08000000
+#define DES0_TX_CTRL_DISABLE_PADDING \
+                                    0x04000000
+#define DES0_TX_CTRL_IP_ALL_CKHSUMS 0x00C00000
+#define DES0_TX_CTRL_END_OF_RING    0x00200000
+#define DES0_TX_CTRL_CHAINED        0x00100000
+#define DES0_TX_STAT_ERR            0x00008000
+
+#define DES1_TX_CTRL_BUFF1_SIZE_M   0x00001FFF
+#define DES1_TX_CTRL_BUFF1_SIZE_S   0
+
+//*****************************************************************************
+//
+// Fields of the receive descriptor words.
+//
+//*****************************************************************************
+#define DES0_RX_CTRL_OWN            0x80000000
+#define DES0_RX_STAT_DEST_ADDR_FAIL 0x40000000
+#define DES0_RX_STAT_FRAME_LENGTH_M 0x3FFF0000
+#define DES0_RX_STAT_FRAME_LENGTH_S 16
+#define DES0_RX_STAT_ERR            0x00008000
+#define DES0_RX_STAT_FIRST_DESC     0x00000200
+#define DES0_RX_STAT_LAST_DESC      0x00000100
+
+#define DES1_RX_CTRL_DISABLE_INT    0x80000000
+#define DES1_RX_CTRL_END_OF_RING    0x00008000
+#define DES1_RX_CTRL_CHAINED        0x00004000
+#define DES1_RX_CTRL_BUFF1_SIZE_M   0x00001FFF
+#define DES1_RX_CTRL_BUFF1_SIZE_S   0
+
+//*****************************************************************************
+//
+// Values that can be passed to EMACInit() as the ui32BusConfig parameter.
+//
+//*****************************************************************************
+#define EMAC_BCONFIG_MIXED_BURST    0x04000000
+#define EMAC_BCONFIG_ALT_DESCRIPTORS \
+                                    0x00000080
+#define EMAC_BCONFIG_PRIORITY_FIXED 0x00000002
+
+//*****************************************************************************
+//
+// Values that can be passed to EMACConfigSet() as the ui32Config parameter.
+//
+//*****************************************************************************
+#define EMAC_CONFIG_USE_MACADDR0    0x00000000
+#define EMAC_CONFIG_SA_FROM_DESCRIPTOR \
+                                    0x00000000
+#define EMAC_CONFIG_STRIP_CRC       0x02000000
+#define EMAC_CONFIG_IF_GAP_96BITS   0x00000000
+#define EMAC_CONFIG_100MBPS         0x00004000
+#define EMAC_CONFIG_LOOPBACK        0x00001000
+#define EMAC_CONFIG_FULL_DUPLEX     0x00000800
+#define EMAC_CONFIG_CHECKSUM_OFFLOAD \
+                                    0x00000400
+#define EMAC_CONFIG_AUTO_CRC_STRIPPING \
+                                    0x00000080
+#define EMAC_CONFIG_BO_LIMIT_1024   0x00000000
+#define EMAC_CONFIG_7BYTE_PREAMBLE  0x00000000
+
+//*****************************************************************************
+//
+// Values that can be passed to EMACConfigSet() as the ui32ModeFlags
+// parameter.
+//
+//*****************************************************************************
+#define EMAC_MODE_RX_STORE_FORWARD  0x02000000
+#define EMAC_MODE_TX_STORE_FORWARD  0x00200000
+#define EMAC_MODE_RX_THRESHOLD_64_BYTES \
+                                    0x00000000
+#define EMAC_MODE_TX_THRESHOLD_64_BYTES \
+                                    0x00000000
+
+//*****************************************************************************
+//
+// Values that can be passed to EMACFrameFilterSet().  With none of them the
+// MAC takes frames for its own address and broadcasts.
+//
+//*****************************************************************************
+#define EMAC_FRMFILTER_RX_ALL       0x80000000
+#define EMAC_FRMFILTER_BROADCAST    0x00000020  // Drop broadcasts
+#define EMAC_FRMFILTER_PROMISCUOUS  0x00000001
+
+//*****************************************************************************
+//
+// Values that can be passed to EMACPHYConfigSet().
+//
+//*****************************************************************************
+#define EMAC_PHY_TYPE_INTERNAL      0x00000000
+#define EMAC_PHY_INT_MDIX_EN        0x02000000
+#define EMAC_PHY_AN_100B_T_FULL_DUPLEX \
+                                    0x00000000
+
+//*****************************************************************************
+//
+// Interrupt sources, for EMACIntEnable(), EMACIntDisable(), EMACIntStatus()
+// and EMACIntClear().
+//
+//*****************************************************************************
+#define EMAC_INT_NORMAL_INT         0x00010000
+#define EMAC_INT_ABNORMAL_INT       0x00008000
+#define EMAC_INT_RX_STOPPED         0x00000100
+#define EMAC_INT_RX_NO_BUFFER       0x00000080
+#define EMAC_INT_RECEIVE            0x00000040
+#define EMAC_INT_RX_OVERFLOW        0x00000010
+#define EMAC_INT_TX_NO_BUFFER       0x00000004
+#define EMAC_INT_TX_STOPPED         0x00000002
+#define EMAC_INT_TRANSMIT           0x00000001
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void EMACInit(uint32_t ui32Base, uint32_t ui32SysClk,
+                     uint32_t ui32BusConfig, uint32_t ui32RxBurst,
+                     uint32_t ui32TxBurst, uint32_t ui32DescSkipSize);
+extern void EMACReset(uint32_t ui32Base);
+extern void EMACPHYConfigSet(uint32_t ui32Base, uint32_t ui32Config);
+extern void EMACConfigSet(uint32_t ui32Base, uint32_t ui32Config,
+                          uint32_t ui32ModeFlags,
+                          uint32_t ui32RxMaxFrameSize);
+extern void EMACAddrSet(uint32_t ui32Base, uint32_t ui32Index,
+                        const uint8_t *pui8MACAddr);
+extern void EMACFrameFilterSet(uint32_t ui32Base, uint32_t ui32FilterOpts);
+extern void EMACRxDMADescriptorListSet(uint32_t ui32Base,
+                                       tEMACDMADescriptor *pDescriptor);
+extern void EMACTxDMADescriptorListSet(uint32_t ui32Base,
+                                       tEMACDMADescriptor *pDescriptor);
+extern void EMACRxWatchdogTimerSet(uint32_t ui32Base, uint8_t ui8Timeout);
+extern void EMACTxEnable(uint32_t ui32Base);
+extern void EMACTxDisable(uint32_t ui32Base);
+extern void EMACRxEnable(uint32_t ui32Base);
+extern void EMACRxDisable(uint32_t ui32Base);
+extern void EMACTxDMAPollDemand(uint32_t ui32Base);
+extern void EMACRxDMAPollDemand(uint32_t ui32Base);
+extern void EMACIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern void EMACIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+extern uint32_t EMACIntStatus(uint32_t ui32Base, bool bMasked);
+extern void EMACIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_EMAC_H__
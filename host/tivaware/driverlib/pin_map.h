@@ -0,0 +1,24 @@
+//*****************************************************************************
+//
+// pin_map.h - Host stand-in for the TivaWare pin mux definitions.
+//
+// Values follow TivaWare 2.2.0.295 for PART_TM4C1294NCPDT; only the pins
+// used by this repository are provided.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_PIN_MAP_H__
+#define __DRIVERLIB_PIN_MAP_H__
+
+#ifdef PART_TM4C1294NCPDT
+
+#define GPIO_PA0_U0RX           0x00000001
+#define GPIO_PA1_U0TX           0x00000401
+
+#define GPIO_PM0_T2CCP0         0x000B0003
+#define GPIO_PM1_T2CCP1         0x000B0403
+#define GPIO_PM2_T3CCP0         0x000B0803
+
+#endif // PART_TM4C1294NCPDT
+
+#endif // __DRIVERLIB_PIN_MAP_H__
@@ -0,0 +1,118 @@
+//*****************************************************************************
+//
+// sysctl.h - Host stand-in for the TivaWare system control API.
+//
+// Prototypes and values follow TivaWare 2.2.0.295; only the subset used by
+// this repository is provided.  The functions are implemented by the
+// simulator in host/sim/sysctl.c.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SYSCTL_H__
+#define __DRIVERLIB_SYSCTL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The following are values that can be passed to the
+// SysCtlPeripheralEnable(), SysCtlPeripheralReady() and related APIs as the
+// ui32Peripheral parameter.
+//
+//*****************************************************************************
+#define SYSCTL_PERIPH_GPIOA     0xf0000800  // GPIO A
+#define SYSCTL_PERIPH_GPIOB     0xf0000801  // GPIO B
+#define SYSCTL_PERIPH_GPIOC     0xf0000802  // GPIO C
+#define SYSCTL_PERIPH_GPIOD     0xf0000803  // GPIO D
+#define SYSCTL_PERIPH_GPIOE     0xf0000804  // GPIO E
+#define SYSCTL_PERIPH_GPIOF     0xf0000805  // GPIO F
+#define SYSCTL_PERIPH_GPIOG     0xf0000806  // GPIO G
+#define SYSCTL_PERIPH_GPIOH     0xf0000807  // GPIO H
+#define SYSCTL_PERIPH_GPIOJ     0xf0000808  // GPIO J
+#define SYSCTL_PERIPH_GPIOK     0xf0000809  // GPIO K
+#define SYSCTL_PERIPH_GPIOL     0xf000080a  // GPIO L
+#define SYSCTL_PERIPH_GPIOM     0xf000080b  // GPIO M
+#define SYSCTL_PERIPH_GPION     0xf000080c  // GPIO N
+#define SYSCTL_PERIPH_GPIOP     0xf000080d  // GPIO P
+#define SYSCTL_PERIPH_GPIOQ     0xf000080e  // GPIO Q
+#define SYSCTL_PERIPH_TIMER0    0xf0000400  // Timer 0
+#define SYSCTL_PERIPH_TIMER1    0xf0000401  // Timer 1
+#define SYSCTL_PERIPH_TIMER2    0xf0000402  // Timer 2
+#define SYSCTL_PERIPH_TIMER3    0xf0000403  // Timer 3
+#define SYSCTL_PERIPH_TIMER4    0xf0000404  // Timer 4
+#define SYSCTL_PERIPH_TIMER5    0xf0000405  // Timer 5
+#define SYSCTL_PERIPH_TIMER6    0xf0000406  // Timer 6
+#define SYSCTL_PERIPH_TIMER7    0xf0000407  // Timer 7
+#define SYSCTL_PERIPH_UDMA      0xf0000c00  // uDMA
+#define SYSCTL_PERIPH_UART0     0xf0001800  // UART 0
+#define SYSCTL_PERIPH_UART1     0xf0001801  // UART 1
+#define SYSCTL_PERIPH_UART2     0xf0001802  // UART 2
+#define SYSCTL_PERIPH_UART3     0xf0001803  // UART 3
+#define SYSCTL_PERIPH_ADC0      0xf0003800  // ADC 0
+#define SYSCTL_PERIPH_ADC1      0xf0003801  // ADC 1
+#define SYSCTL_PERIPH_CAN0      0xf0003400  // CAN 0
+#define SYSCTL_PERIPH_CAN1      0xf0003401  // CAN 1
+#define SYSCTL_PERIPH_EPHY0     0xf0003000  // Ethernet PHY
+#define SYSCTL_PERIPH_EMAC0     0xf0009c00  // Ethernet Controller
+
+//*****************************************************************************
+//
+// The following are values that can be passed to the SysCtlClockFreqSet()
+// API as the ui32Config parameter.
+//
+//*****************************************************************************
+#define SYSCTL_XTAL_16MHZ       0x00000540  // External crystal is 16 MHz
+#define SYSCTL_XTAL_25MHZ       0x00000680  // External crystal is 25.0 MHz
+#define SYSCTL_USE_PLL          0x00000000  // System clock is the PLL clock
+#define SYSCTL_USE_OSC          0x00003800  // System clock is the osc clock
+#define SYSCTL_OSC_MAIN         0x00000000  // Osc source is main osc
+#define SYSCTL_OSC_INT          0x00000010  // Osc source is int. osc
+#define SYSCTL_CFG_VCO_480      0xF1000000  // VCO is 480 MHz
+#define SYSCTL_CFG_VCO_320      0xF0000000  // VCO is 320 MHz
+#define SYSCTL_CFG_VCO_240      0xF1000000  // VCO is 240 MHz (TM4C129 RA1)
+#define SYSCTL_CFG_VCO_160      0xF0000000  // VCO is 160 MHz (TM4C129 RA1)
+
+//*****************************************************************************
+//
+// The following are values that can be passed to the
+// SysCtlDeepSleepClockConfigSet() API as the ui32Config parameter.
+//
+//*****************************************************************************
+#define SYSCTL_DSLP_OSC_MAIN    0x00000000  // Osc source is main osc
+#define SYSCTL_DSLP_OSC_INT     0x00000010  // Osc source is int. osc
+#define SYSCTL_DSLP_OSC_INT30   0x00000030  // Osc source is int. 30 KHz
+#define SYSCTL_DSLP_OSC_EXT32   0x00000070  // Osc source is ext. 32 KHz
+#define SYSCTL_DSLP_PIOSC_PD    0x00000002  // Power down PIOSC in deep-sleep
+#define SYSCTL_DSLP_MOSC_PD     0x40000000  // Power down MOSC in deep-sleep
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern uint32_t SysCtlClockFreqSet(uint32_t ui32Config, uint32_t ui32SysClock);
+extern void SysCtlPeripheralEnable(uint32_t ui32Peripheral);
+extern void SysCtlPeripheralDisable(uint32_t ui32Peripheral);
+extern bool SysCtlPeripheralReady(uint32_t ui32Peripheral);
+extern void SysCtlDelay(uint32_t ui32Count);
+extern void SysCtlSleep(void);
+extern void SysCtlDeepSleep(void);
+extern void SysCtlDeepSleepClockConfigSet(uint32_t ui32Div,
+                                          uint32_t ui32Config);
+extern void SysCtlPeripheralSleepEnable(uint32_t ui32Peripheral);
+extern void SysCtlPeripheralSleepDisable(uint32_t ui32Peripheral);
+extern void SysCtlPeripheralDeepSleepEnable(uint32_t ui32Peripheral);
+extern void SysCtlPeripheralDeepSleepDisable(uint32_t ui32Peripheral);
+extern void SysCtlPeripheralClockGating(bool bEnable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_SYSCTL_H__
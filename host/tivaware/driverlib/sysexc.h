@@ -0,0 +1,50 @@
+//*****************************************************************************
+//
+// sysexc.h - Host stand-in for the TivaWare system exception API.
+//
+// Prototypes follow TivaWare 2.2.0.295; only the subset used by this
+// repository is provided.  The functions are implemented by the simulator in
+// host/sim/fpu.c.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SYSEXC_H__
+#define __DRIVERLIB_SYSEXC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values that can be passed to SysExcIntEnable, SysExcIntDisable, and
+// SysExcIntClear as the ui32IntFlags parameter, and returned from
+// SysExcIntStatus.
+//
+//*****************************************************************************
+#define SYSEXC_INT_FP_IXC       0x00000020  // FP Inexact exception interrupt
+#define SYSEXC_INT_FP_OFC       0x00000010  // FP Overflow exception interrupt
+#define SYSEXC_INT_FP_UFC       0x00000008  // FP Underflow exception interrupt
+#define SYSEXC_INT_FP_IOC       0x00000004  // FP Invalid operation interrupt
+#define SYSEXC_INT_FP_DZC       0x00000002  // FP Divide by zero exception int
+#define SYSEXC_INT_FP_IDC       0x00000001  // FP Input denormal exception int
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void SysExcIntEnable(uint32_t ui32IntFlags);
+extern void SysExcIntDisable(uint32_t ui32IntFlags);
+extern uint32_t SysExcIntStatus(bool bMasked);
+extern void SysExcIntClear(uint32_t ui32IntFlags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_SYSEXC_H__
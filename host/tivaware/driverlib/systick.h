@@ -0,0 +1,37 @@
+//*****************************************************************************
+//
+// systick.h - Host stand-in for the TivaWare SysTick API.
+//
+// Prototypes follow TivaWare 2.2.0.295.  The functions are implemented by
+// the simulator in host/sim/systick.c.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SYSTICK_H__
+#define __DRIVERLIB_SYSTICK_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void SysTickEnable(void);
+extern void SysTickDisable(void);
+extern void SysTickIntEnable(void);
+extern void SysTickIntDisable(void);
+extern void SysTickPeriodSet(uint32_t ui32Period);
+extern uint32_t SysTickPeriodGet(void);
+extern uint32_t SysTickValueGet(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_SYSTICK_H__
@@ -0,0 +1,113 @@
+//*****************************************************************************
+//
+// timer.h - Host stand-in for the TivaWare timer API.
+//
+// Prototypes follow TivaWare 2.2.0.295; only the subset used by this
+// repository is provided.  The functions are implemented by the simulator in
+// host/sim/timer.c.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_TIMER_H__
+#define __DRIVERLIB_TIMER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Values that can be passed to TimerConfigure as the ui32Config parameter.
+//
+//*****************************************************************************
+#define TIMER_CFG_ONE_SHOT      0x00000021  // Full-width one-shot timer
+#define TIMER_CFG_PERIODIC      0x00000022  // Full-width periodic timer
+#define TIMER_CFG_SPLIT_PAIR    0x04000000  // Two half-width timers
+#define TIMER_CFG_A_ONE_SHOT    0x00000021  // Timer A one-shot timer
+#define TIMER_CFG_A_PERIODIC    0x00000022  // Timer A periodic timer
+#define TIMER_CFG_A_PWM         0x0000000A  // Timer A PWM output
+#define TIMER_CFG_B_ONE_SHOT    0x00002100  // Timer B one-shot timer
+#define TIMER_CFG_B_PERIODIC    0x00002200  // Timer B periodic timer
+#define TIMER_CFG_B_PWM         0x00000A00  // Timer B PWM output
+
+//*****************************************************************************
+//
+// Values that can be passed to most of the timer APIs as the ui32Timer
+// parameter.
+//
+//*****************************************************************************
+#define TIMER_A                 0x000000ff  // Timer A
+#define TIMER_B                 0x0000ff00  // Timer B
+#define TIMER_BOTH              0x0000ffff  // Timer Both
+
+//*****************************************************************************
+//
+// Values that can be passed to TimerADCEventSet() and returned from
+// TimerADCEventGet().
+//
+//*****************************************************************************
+#define TIMER_ADC_TIMEOUT_A     0x00000001  // ADC trigger on timer A timeout
+#define TIMER_ADC_TIMEOUT_B     0x00000100  // ADC trigger on timer B timeout
+
+//*****************************************************************************
+//
+// Values that can be passed to TimerDMAEventSet() and returned from
+// TimerDMAEventGet().
+//
+//*****************************************************************************
+#define TIMER_DMA_TIMEOUT_A     0x00000001  // DMA trigger on timer A timeout
+#define TIMER_DMA_TIMEOUT_B     0x00000100  // DMA trigger on timer B timeout
+
+//*****************************************************************************
+//
+// Values that can be passed to TimerClockSourceSet() or returned from
+// TimerClockSourceGet().
+//
+//*****************************************************************************
+#define TIMER_CLOCK_SYSTEM      0x00000000
+#define TIMER_CLOCK_PIOSC       0x00000001
+
+//*****************************************************************************
+//
+// Values that can be passed to TimerUpdateMode().
+//
+//*****************************************************************************
+#define TIMER_UP_LOAD_IMMEDIATE 0x00000000  // Timer load immediate
+#define TIMER_UP_LOAD_TIMEOUT   0x00000100  // Timer load on timeout
+#define TIMER_UP_MATCH_IMMEDIATE                                              \
+                                0x00000000  // Timer match immediate
+#define TIMER_UP_MATCH_TIMEOUT  0x00000400  // Timer match on timeout
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer);
+extern void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer);
+extern void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config);
+extern void TimerControlTrigger(uint32_t ui32Base, uint32_t ui32Timer,
+                                bool bEnable);
+extern void TimerADCEventSet(uint32_t ui32Base, uint32_t ui32ADCEvent);
+extern void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer,
+                         uint32_t ui32Value);
+extern void TimerMatchSet(uint32_t ui32Base, uint32_t ui32Timer,
+                          uint32_t ui32Value);
+extern void TimerPrescaleSet(uint32_t ui32Base, uint32_t ui32Timer,
+                             uint32_t ui32Value);
+extern void TimerPrescaleMatchSet(uint32_t ui32Base, uint32_t ui32Timer,
+                                  uint32_t ui32Value);
+extern void TimerClockSourceSet(uint32_t ui32Base, uint32_t ui32Source);
+extern void TimerDMAEventSet(uint32_t ui32Base, uint32_t ui32DMAEvent);
+extern void TimerUpdateMode(uint32_t ui32Base, uint32_t ui32Timer,
+                            uint32_t ui32Config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_TIMER_H__
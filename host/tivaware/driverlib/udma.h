@@ -0,0 +1,200 @@
+//*****************************************************************************
+//
+// udma.h - Host stand-in for the TivaWare uDMA controller API.
+//
+// Prototypes follow TivaWare 2.2.0.295; only the subset used by this
+// repository is provided.  The functions are implemented by the simulator in
+// host/sim/udma.c.
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_UDMA_H__
+#define __DRIVERLIB_UDMA_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// A structure that defines an entry in the channel control table.
+//
+//*****************************************************************************
+typedef struct
+{
+    volatile void *pvSrcEndAddr;
+    volatile void *pvDstEndAddr;
+    volatile uint32_t ui32Control;
+    volatile uint32_t ui32Spare;
+} tDMAControlTable;
+
+//*****************************************************************************
+//
+// Flags that can be passed to uDMAChannelAttributeEnable(),
+// uDMAChannelAttributeDisable(), and returned from uDMAChannelAttributeGet().
+//
+//*****************************************************************************
+#define UDMA_ATTR_USEBURST      0x00000001
+#define UDMA_ATTR_ALTSELECT     0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK       0x00000008
+#define UDMA_ATTR_ALL           0x0000000F
+
+//*****************************************************************************
+//
+// DMA control modes that can be passed to uDMAChannelTransferSet() and
+// returned from uDMAChannelModeGet().
+//
+//*****************************************************************************
+#define UDMA_MODE_STOP          0x00000000
+#define UDMA_MODE_BASIC         0x00000001
+#define UDMA_MODE_AUTO          0x00000002
+#define UDMA_MODE_PINGPONG      0x00000003
+#define UDMA_MODE_MEM_SCATTER_GATHER                                          \
+                                0x00000004
+#define UDMA_MODE_PER_SCATTER_GATHER                                          \
+                                0x00000006
+#define UDMA_MODE_ALT_SELECT    0x00000001
+#define UDMA_MODE_M             0x00000007
+
+//*****************************************************************************
+//
+// Channel configuration values that can be passed to uDMAChannelControlSet().
+//
+//*****************************************************************************
+#define UDMA_DST_INC_8          0x00000000
+#define UDMA_DST_INC_16         0x40000000
+#define UDMA_DST_INC_32         0x80000000
+#define UDMA_DST_INC_NONE       0xc0000000
+#define UDMA_SRC_INC_8          0x00000000
+#define UDMA_SRC_INC_16         0x04000000
+#define UDMA_SRC_INC_32         0x08000000
+#define UDMA_SRC_INC_NONE       0x0c000000
+#define UDMA_SIZE_8             0x00000000
+#define UDMA_SIZE_16            0x11000000
+#define UDMA_SIZE_32            0x22000000
+#define UDMA_ARB_1              0x00000000
+#define UDMA_ARB_2              0x00004000
+#define UDMA_ARB_4              0x00008000
+#define UDMA_ARB_8              0x0000c000
+#define UDMA_ARB_16             0x00010000
+
+//*****************************************************************************
+//
+// Values that can be ORed with the channel ID to indicate the primary or
+// alternate control structure.
+//
+//*****************************************************************************
+#define UDMA_PRI_SELECT         0x00000000
+#define UDMA_ALT_SELECT         0x00000020
+
+//*****************************************************************************
+//
+// Channel assignments that can be passed to uDMAChannelAssign().
+//
+//*****************************************************************************
+#define UDMA_CH8_UART0RX        0x00000008
+#define UDMA_CH9_UART0TX        0x00000009
+#define UDMA_CH14_ADC0_0        0x0000000E
+#define UDMA_CH15_ADC0_1        0x0000000F
+#define UDMA_CH16_ADC0_2        0x00000010
+#define UDMA_CH17_ADC0_3        0x00000011
+#define UDMA_CH18_TIMER0A       0x00000012
+#define UDMA_CH20_TIMER1A       0x00000014
+#define UDMA_CH30_SW            0x0000001E
+#define UDMA_CH24_ADC1_0        0x00010018
+#define UDMA_CH25_ADC1_1        0x00010019
+#define UDMA_CH26_ADC1_2        0x0001001A
+#define UDMA_CH27_ADC1_3        0x0001001B
+
+//*****************************************************************************
+//
+// Channel numbers of the ADC sequencers and timers, for the other uDMA calls.
+//
+//*****************************************************************************
+#define UDMA_CHANNEL_ADC0       14
+#define UDMA_CHANNEL_ADC1       15
+#define UDMA_CHANNEL_ADC2       16
+#define UDMA_CHANNEL_ADC3       17
+#define UDMA_CHANNEL_TMR0A      18
+#define UDMA_CHANNEL_TMR1A      20
+#define UDMA_SEC_CHANNEL_ADC10  24
+#define UDMA_SEC_CHANNEL_ADC11  25
+#define UDMA_SEC_CHANNEL_ADC12  26
+#define UDMA_SEC_CHANNEL_ADC13  27
+
+//*****************************************************************************
+//
+// A helper macro for building scatter-gather task table entries.
+//
+// This macro is intended to be used to help populate a table of uDMA tasks
+// for a scatter-gather transfer.  This macro will calculate the values for
+// the fields of a task structure entry based on the input parameters.
+//
+//*****************************************************************************
+#define uDMATaskStructEntry(ui32TransferCount,                                \
+                            ui32ItemSize,                                     \
+                            ui32SrcIncrement,                                 \
+                            pvSrcAddr,                                        \
+                            ui32DstIncrement,                                 \
+                            pvDstAddr,                                        \
+                            ui32ArbSize,                                      \
+                            ui32Mode)                                         \
+    {                                                                         \
+        (((ui32SrcIncrement) == UDMA_SRC_INC_NONE) ? (void *)(pvSrcAddr) :    \
+            ((void *)(&((uint8_t *)(pvSrcAddr))[((ui32TransferCount) <<       \
+                                         ((ui32SrcIncrement) >> 26)) - 1]))), \
+        (((ui32DstIncrement) == UDMA_DST_INC_NONE) ? (void *)(pvDstAddr) :    \
+            ((void *)(&((uint8_t *)(pvDstAddr))[((ui32TransferCount) <<       \
+                                         ((ui32DstIncrement) >> 30)) - 1]))), \
+        (ui32SrcIncrement) | (ui32DstIncrement) | (ui32ItemSize) |            \
+            (ui32ArbSize) |                                                   \
+        (((ui32TransferCount) - 1) << 4) |                                    \
+        ((((ui32Mode) == UDMA_MODE_MEM_SCATTER_GATHER) ||                     \
+          ((ui32Mode) == UDMA_MODE_PER_SCATTER_GATHER)) ?                     \
+                (ui32Mode) | UDMA_MODE_ALT_SELECT : (ui32Mode)), 0            \
+    }
+
+//*****************************************************************************
+//
+// Prototypes for the APIs.
+//
+//*****************************************************************************
+extern void uDMAEnable(void);
+extern void uDMADisable(void);
+extern void uDMAControlBaseSet(void *pControlTable);
+extern void uDMAChannelAssign(uint32_t ui32Mapping);
+extern void uDMAChannelAttributeEnable(uint32_t ui32ChannelNum,
+                                       uint32_t ui32Attr);
+extern void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum,
+                                        uint32_t ui32Attr);
+extern void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex,
+                                  uint32_t ui32Control);
+extern void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex,
+                                   uint32_t ui32Mode, void *pvSrcAddr,
+                                   void *pvDstAddr,
+                                   uint32_t ui32TransferSize);
+extern void uDMAChannelEnable(uint32_t ui32ChannelNum);
+extern void uDMAChannelDisable(uint32_t ui32ChannelNum);
+extern bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum);
+extern uint32_t uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex);
+extern uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex);
+extern void uDMAChannelRequest(uint32_t ui32ChannelNum);
+extern void uDMAChannelScatterGatherSet(uint32_t ui32ChannelNum,
+                                        uint32_t ui32TaskCount,
+                                        void *pvTaskList,
+                                        uint32_t ui32IsPeriphSG);
+extern uint32_t uDMAIntStatus(void);
+extern void uDMAIntClear(uint32_t ui32ChanMask);
+extern uint32_t uDMAErrorStatusGet(void);
+extern void uDMAErrorStatusClear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_UDMA_H__
@@ -0,0 +1,22 @@
+//*****************************************************************************
+//
+// hw_can.h - Host stand-in for the TivaWare CAN register definitions.
+//
+// Values follow TivaWare 2.2.0.295; only the subset used by this repository
+// is provided.
+//
+//*****************************************************************************
+
+#ifndef __HW_CAN_H__
+#define __HW_CAN_H__
+
+//*****************************************************************************
+//
+// The following are defines for the bit fields in the CAN_O_INT register.
+//
+//*****************************************************************************
+#define CAN_INT_INTID_M         0x0000FFFF  // Interrupt Identifier
+#define CAN_INT_INTID_NONE      0x00000000  // No interrupt pending
+#define CAN_INT_INTID_STATUS    0x00008000  // Status Interrupt
+
+#endif // __HW_CAN_H__
@@ -0,0 +1,147 @@
+//*****************************************************************************
+//
+// hw_ints.h - Host stand-in for the TivaWare interrupt assignments.
+//
+// Vector numbers of the TM4C129 class, as in the __vector_table of
+// startup_ewarm.c (exception number, then IRQ number in the comment). Only the
+// vectors up to UART6 are provided.
+//
+//*****************************************************************************
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+//*****************************************************************************
+//
+// The following are defines for the fault assignments.
+//
+//*****************************************************************************
+#define FAULT_NMI               2           // NMI fault
+#define FAULT_HARD              3           // Hard fault
+#define FAULT_MPU               4           // MPU fault
+#define FAULT_BUS               5           // Bus fault
+#define FAULT_USAGE             6           // Usage fault
+#define FAULT_SVCALL            11          // SVCall
+#define FAULT_DEBUG             12          // Debug monitor
+#define FAULT_PENDSV            14          // PendSV
+#define FAULT_SYSTICK           15          // System Tick
+
+//*****************************************************************************
+//
+// The following are defines for the interrupt assignments.
+//
+//*****************************************************************************
+#define INT_GPIOA               16  // 0
+#define INT_GPIOB               17  // 1
+#define INT_GPIOC               18  // 2
+#define INT_GPIOD               19  // 3
+#define INT_GPIOE               20  // 4
+#define INT_UART0               21  // 5
+#define INT_UART1               22  // 6
+#define INT_SSI0                23  // 7
+#define INT_I2C0                24  // 8
+#define INT_PWM0_FAULT          25  // 9
+#define INT_PWM0_0              26  // 10
+#define INT_PWM0_1              27  // 11
+#define INT_PWM0_2              28  // 12
+#define INT_QEI0                29  // 13
+#define INT_ADC0SS0             30  // 14
+#define INT_ADC0SS1             31  // 15
+#define INT_ADC0SS2             32  // 16
+#define INT_ADC0SS3             33  // 17
+#define INT_WATCHDOG            34  // 18
+#define INT_TIMER0A             35  // 19
+#define INT_TIMER0B             36  // 20
+#define INT_TIMER1A             37  // 21
+#define INT_TIMER1B             38  // 22
+#define INT_TIMER2A             39  // 23
+#define INT_TIMER2B             40  // 24
+#define INT_COMP0               41  // 25
+#define INT_COMP1               42  // 26
+#define INT_COMP2               43  // 27
+#define INT_SYSCTL              44  // 28
+#define INT_FLASH               45  // 29
+#define INT_GPIOF               46  // 30
+#define INT_GPIOG               47  // 31
+#define INT_GPIOH               48  // 32
+#define INT_UART2               49  // 33
+#define INT_SSI1                50  // 34
+#define INT_TIMER3A             51  // 35
+#define INT_TIMER3B             52  // 36
+#define INT_I2C1                53  // 37
+#define INT_CAN0                54  // 38
+#define INT_CAN1                55  // 39
+#define INT_EMAC0               56  // 40
+#define INT_HIBERNATE           57  // 41
+#define INT_USB0                58  // 42
+#define INT_PWM0_3              59  // 43
+#define INT_UDMA                60  // 44
+#define INT_UDMAERR             61  // 45
+#define INT_ADC1SS0             62  // 46
+#define INT_ADC1SS1             63  // 47
+#define INT_ADC1SS2             64  // 48
+#define INT_ADC1SS3             65  // 49
+#define INT_EPI0                66  // 50
+#define INT_GPIOJ               67  // 51
+#define INT_GPIOK               68  // 52
+#define INT_GPIOL               69  // 53
+#define INT_SSI2                70  // 54
+#define INT_SSI3                71  // 55
+#define INT_UART3               72  // 56
+#define INT_UART4               73  // 57
+#define INT_UART5               74  // 58
+#define INT_UART6               75  // 59
+#define INT_UART7               76  // 60
+#define INT_I2C2                77  // 61
+#define INT_I2C3                78  // 62
+#define INT_TIMER4A             79  // 63
+#define INT_TIMER4B             80  // 64
+#define INT_TIMER5A             81  // 65
+#define INT_TIMER5B             82  // 66
+#define INT_SYSEXC              83  // 67
+#define INT_I2C4                86  // 70
+#define INT_I2C5                87  // 71
+#define INT_GPIOM               88  // 72
+#define INT_GPION               89  // 73
+#define INT_TAMPER0             91  // 75
+#define INT_GPIOP0              92  // 76
+#define INT_GPIOP1              93  // 77
+#define INT_GPIOP2              94  // 78
+#define INT_GPIOP3              95  // 79
+#define INT_GPIOP4              96  // 80
+#define INT_GPIOP5              97  // 81
+#define INT_GPIOP6              98  // 82
+#define INT_GPIOP7              99  // 83
+#define INT_GPIOQ0              100 // 84
+#define INT_GPIOQ1              101 // 85
+#define INT_GPIOQ2              102 // 86
+#define INT_GPIOQ3              103 // 87
+#define INT_GPIOQ4              104 // 88
+#define INT_GPIOQ5              105 // 89
+#define INT_GPIOQ6              106 // 90
+#define INT_GPIOQ7              107 // 91
+#define INT_GPIOR               108 // 92
+#define INT_GPIOS               109 // 93
+#define INT_SHA0                110 // 94
+#define INT_AES0                111 // 95
+#define INT_DES0                112 // 96
+#define INT_LCD0                113 // 97
+#define INT_TIMER6A             114 // 98
+#define INT_TIMER6B             115 // 99
+#define INT_TIMER7A             116 // 100
+#define INT_TIMER7B             117 // 101
+#define INT_I2C6                118 // 102
+#define INT_I2C7                119 // 103
+#define INT_ONEWIRE0            121 // 105
+#define INT_I2C8                125 // 109
+#define INT_I2C9                126 // 110
+#define INT_GPIOT               127 // 111
+
+//*****************************************************************************
+//
+// The following are defines for the total number of interrupts.
+//
+//*****************************************************************************
+#define NUM_INTERRUPTS          128
+
+#endif // __HW_INTS_H__
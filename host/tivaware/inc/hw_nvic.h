@@ -0,0 +1,35 @@
+//*****************************************************************************
+//
+// hw_nvic.h - Host stand-in for the TivaWare NVIC register definitions.
+//
+// Only the subset used by this repository is provided.
+//
+//*****************************************************************************
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+
+//*****************************************************************************
+//
+// The following are defines for the NVIC register addresses.
+//
+//*****************************************************************************
+#define NVIC_ST_CTRL            0xE000E010  // SysTick Control and Status
+                                            // Register
+#define NVIC_ST_RELOAD          0xE000E014  // SysTick Reload Value Register
+#define NVIC_ST_CURRENT         0xE000E018  // SysTick Current Value Register
+#define NVIC_INT_CTRL           0xE000ED04  // Interrupt Control and State
+
+//*****************************************************************************
+//
+// The following are defines for the bit fields in the NVIC_INT_CTRL
+// register.
+//
+//*****************************************************************************
+#define NVIC_INT_CTRL_PEND_SV   0x10000000  // PendSV Set Pending
+#define NVIC_INT_CTRL_UNPEND_SV 0x08000000  // PendSV Clear Pending
+#define NVIC_INT_CTRL_PEND_SYST 0x04000000  // SysTick Set Pending
+#define NVIC_INT_CTRL_UNPEND_SYST                                             \
+                                0x02000000  // SysTick Clear Pending
+
+#endif // __HW_NVIC_H__
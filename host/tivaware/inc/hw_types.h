@@ -0,0 +1,31 @@
+//*****************************************************************************
+//
+// hw_types.h - Host stand-in for the TivaWare common types and macros.
+//
+// Only the subset used by this repository is provided.  Register accesses
+// through HWREG() land in a backing store kept by the simulator (see
+// host/sim/sim.c) instead of the peripheral address space.
+//
+//*****************************************************************************
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#include "host/sim/sim.h"
+
+//*****************************************************************************
+//
+// Macros for hardware access, both direct and via the bit-band region.
+//
+//*****************************************************************************
+#define HWREG(x)                (*sim_reg32((uint32_t)(x)))
+
+//*****************************************************************************
+//
+// Helper macros for determining silicon revisions, etc.
+//
+//*****************************************************************************
+#define CLASS_IS_TM4C123        0
+#define CLASS_IS_TM4C129        1
+
+#endif // __HW_TYPES_H__
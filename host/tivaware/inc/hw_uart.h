@@ -0,0 +1,21 @@
+//*****************************************************************************
+//
+// hw_uart.h - Host stand-in for the TivaWare UART register definitions.
+//
+// Values follow TivaWare 2.2.0.295; only the subset used by this repository
+// is provided.
+//
+//*****************************************************************************
+
+#ifndef __HW_UART_H__
+#define __HW_UART_H__
+
+//*****************************************************************************
+//
+// The following are defines for the UART register offsets.
+//
+//*****************************************************************************
+#define UART_O_DR               0x00000000  // UART Data
+#define UART_O_FR               0x00000018  // UART Flag
+
+#endif // __HW_UART_H__
@@ -0,0 +1,92 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     irq_replay.c
+ * @author   insert authors names here
+ * @brief    Prints latency/jitter statistics of an interrupt benchmark
+ *           capture as CSV. \n
+ *               irq_replay capture.csv
+ *
+ *           capture.csv is what irq_bench_run() sent to its sink (e.g. the
+ *           SWO log of ITM port 0 saved by the debugger, or a UART capture).
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "irq_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static irq_report_t s_report;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static char *read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    char *data;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = malloc((size > 0) ? (size_t)size : 1u);
+    if (data != NULL)
+    {
+        *length = fread(data, 1, (size_t)size, file);
+    }
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    char *data;
+    size_t length = 0;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s capture.csv\n", argv[0]);
+        return 2;
+    }
+    data = read_file(argv[1], &length);
+    if (data == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    if (!irq_report_parse(data, length, &s_report))
+    {
+        fprintf(stderr, "%s: not a complete interrupt benchmark capture\n",
+                argv[1]);
+        return 1;
+    }
+    irq_report_print(stdout, &s_report);
+    free(data);
+    return 0;
+}
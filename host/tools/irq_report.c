@@ -0,0 +1,201 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     irq_report.c
+ * @author   insert authors names here
+ * @brief    Analysis of an interrupt latency capture (see irq_report.h).
+ *           Lines that are not part of the format (e.g. other output on the
+ *           same UART) are skipped.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <string.h>
+
+#include "irq_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define LINE_SIZE       96u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static irq_row_t *find_or_add(irq_report_t *report, const char *name,
+                              const char *fpu)
+{
+    irq_row_t *row = (irq_row_t *)irq_report_find(report, name, fpu);
+
+    if (row != NULL || report->nrows == IRQ_REPORT_MAX_ROWS)
+    {
+        return row;
+    }
+    row = &report->rows[report->nrows++];
+    memset(row, 0, sizeof(*row));
+    snprintf(row->name, sizeof(row->name), "%s", name);
+    snprintf(row->fpu, sizeof(row->fpu), "%s", fpu);
+    row->min = UINT32_MAX;
+    return row;
+}
+
+static int compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/** Nearest-rank percentile of sorted samples. */
+static uint32_t percentile(const irq_row_t *row, uint32_t pct)
+{
+    uint32_t rank = (row->count * pct + 99u) / 100u;
+
+    return row->samples[(rank == 0u) ? 0u : rank - 1u];
+}
+
+/**
+ * Decodes a capture.
+ *
+ * @param[in]  text   - CSV text as written by irq_bench_run()
+ * @param[in]  length - bytes in text
+ * @param[out] report - statistics
+ * @returns bool      - false without the header, or if the end line is
+ *                      missing or disagrees with the samples found
+ */
+bool irq_report_parse(const char *text, size_t length, irq_report_t *report)
+{
+    const char *end = text + length;
+    bool header = false;
+    bool complete = false;
+    uint32_t samples = 0;
+    uint32_t i;
+
+    memset(report, 0, sizeof(*report));
+    while (text < end && !complete)
+    {
+        const char *eol = memchr(text, '\n', (size_t)(end - text));
+        size_t n = (size_t)(((eol != NULL) ? eol : end) - text);
+        char line[LINE_SIZE];
+        char name[IRQ_REPORT_NAME_SIZE];
+        char fpu[IRQ_REPORT_NAME_SIZE];
+        unsigned a;
+        unsigned b;
+
+        if (n >= sizeof(line))
+        {
+            n = sizeof(line) - 1u;
+        }
+        memcpy(line, text, n);
+        line[n] = '\0';
+        text = (eol != NULL) ? eol + 1 : end;
+
+        if (sscanf(line, "irq_bench,%u,%u", &a, &b) == 2)
+        {
+            report->format = a;
+            report->clock_hz = b;
+            header = true;
+        }
+        else if (!header)
+        {
+            continue;
+        }
+        else if (sscanf(line, "end,%u", &a) == 1)
+        {
+            complete = (a == samples);
+        }
+        else if (sscanf(line, "%15[^,],%15[^,],%u", name, fpu, &a) == 3)
+        {
+            irq_row_t *row = find_or_add(report, name, fpu);
+
+            samples++;
+            if (row == NULL || row->count == IRQ_REPORT_MAX_SAMPLES)
+            {
+                report->dropped++;
+                continue;
+            }
+            row->samples[row->count++] = a;
+            row->total += a;
+            if (a < row->min)
+            {
+                row->min = a;
+            }
+            if (a > row->max)
+            {
+                row->max = a;
+            }
+        }
+    }
+
+    for (i = 0; i < report->nrows; i++)
+    {
+        irq_row_t *row = &report->rows[i];
+
+        qsort(row->samples, row->count, sizeof(row->samples[0]), compare);
+        row->p50 = percentile(row, 50u);
+        row->p99 = percentile(row, 99u);
+    }
+    return complete;
+}
+
+/**
+ * @returns const irq_row_t* - statistics of a case in an FPU mode, NULL if
+ *                             it does not appear in the capture
+ */
+const irq_row_t *irq_report_find(const irq_report_t *report, const char *name,
+                                 const char *fpu)
+{
+    uint32_t i;
+
+    for (i = 0; i < report->nrows; i++)
+    {
+        if (strcmp(report->rows[i].name, name) == 0 &&
+            strcmp(report->rows[i].fpu, fpu) == 0)
+        {
+            return &report->rows[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Prints the statistics as CSV, one line per case and FPU mode, cycles.
+ */
+void irq_report_print(FILE *out, const irq_report_t *report)
+{
+    uint32_t i;
+
+    fprintf(out, "# format %u, clock %u Hz, %u samples dropped\n",
+            report->format, report->clock_hz, report->dropped);
+    fprintf(out, "case,fpu,count,min,avg,max,jitter,p50,p99\n");
+    for (i = 0; i < report->nrows; i++)
+    {
+        const irq_row_t *row = &report->rows[i];
+
+        if (row->count == 0u)
+        {
+            continue;
+        }
+        fprintf(out, "%s,%s,%u,%u,%.2f,%u,%u,%u,%u\n", row->name, row->fpu,
+                row->count, row->min, (double)row->total / row->count,
+                row->max, row->max - row->min, row->p50, row->p99);
+    }
+}
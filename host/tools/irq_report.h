@@ -0,0 +1,85 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     irq_report.h
+ * @author   insert authors names here
+ * @brief    Analysis of the samples written by irq_bench_run()
+ *           (common/irq_bench.h). \n
+ *           Groups the samples by case and FPU mode and computes count,
+ *           min/avg/max, jitter (max - min) and the 50th/99th percentiles
+ *           (nearest rank). Shared by host/tools/irq_replay.c and the
+ *           benchmark runner.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _IRQ_REPORT_H_
+#define _IRQ_REPORT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define IRQ_REPORT_MAX_ROWS     32u
+#define IRQ_REPORT_MAX_SAMPLES  4096u   /**< per row */
+#define IRQ_REPORT_NAME_SIZE    16u
+
+typedef struct
+{
+    char     name[IRQ_REPORT_NAME_SIZE];    /**< case */
+    char     fpu[IRQ_REPORT_NAME_SIZE];
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t samples[IRQ_REPORT_MAX_SAMPLES];   /**< sorted after parsing */
+} irq_row_t;
+
+typedef struct
+{
+    uint32_t  format;
+    uint32_t  clock_hz;
+    uint32_t  dropped;      /**< samples beyond IRQ_REPORT_MAX_x */
+    uint32_t  nrows;
+    irq_row_t rows[IRQ_REPORT_MAX_ROWS];
+} irq_report_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool             irq_report_parse(const char *text, size_t length,
+                                  irq_report_t *report);
+const irq_row_t *irq_report_find(const irq_report_t *report, const char *name,
+                                 const char *fpu);
+void             irq_report_print(FILE *out, const irq_report_t *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     prof_hist.c
+ * @author   insert authors names here
+ * @brief    Prints min/avg/max tables and histograms of a profiling capture.
+ *           \n
+ *               prof_hist capture.bin [names.txt]
+ *
+ *           capture.bin is what prof_drain() sent (e.g. the SWO log of ITM
+ *           port 0 saved by the debugger, or a UART capture). names.txt
+ *           optionally names the zones, one "<id> <name>" per line.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "prof_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static const char *s_names[PROF_ID_MAX + 1u];
+static prof_report_t s_report;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t *read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t *data;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = malloc((size > 0) ? (size_t)size : 1u);
+    if (data != NULL)
+    {
+        *length = fread(data, 1, (size_t)size, file);
+    }
+    fclose(file);
+    return data;
+}
+
+static void read_names(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[128];
+
+    if (file == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        unsigned id;
+        char name[64];
+
+        if (sscanf(line, "%u %63s", &id, name) == 2 && id <= PROF_ID_MAX)
+        {
+            s_names[id] = strdup(name);
+        }
+    }
+    fclose(file);
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t *data;
+    size_t length = 0;
+
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "usage: %s capture.bin [names.txt]\n", argv[0]);
+        return 2;
+    }
+    data = read_file(argv[1], &length);
+    if (data == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    if (argc == 3)
+    {
+        read_names(argv[2]);
+    }
+    if (!prof_report_parse(data, length, &s_report))
+    {
+        fprintf(stderr, "%s: not a complete profiling capture\n", argv[1]);
+        return 1;
+    }
+    prof_report_print(stdout, &s_report, s_names);
+    free(data);
+    return 0;
+}
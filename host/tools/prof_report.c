@@ -0,0 +1,246 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     prof_report.c
+ * @author   insert authors names here
+ * @brief    Analysis of a drained trace (see prof_report.h). The capture is
+ *           the target's little-endian memory image, read as is.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <string.h>
+
+#include "prof_report.h"
+#include "common/bitops.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define BAR_WIDTH       40u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static prof_stat_t *find_or_add(prof_report_t *report, bool isr, uint32_t id)
+{
+    uint32_t i;
+    prof_stat_t *stat;
+
+    for (i = 0; i < report->nstats; i++)
+    {
+        if (report->stats[i].isr == isr && report->stats[i].id == id)
+        {
+            return &report->stats[i];
+        }
+    }
+    if (report->nstats == PROF_REPORT_MAX_STATS)
+    {
+        return NULL;
+    }
+    stat = &report->stats[report->nstats++];
+    memset(stat, 0, sizeof(*stat));
+    stat->isr = isr;
+    stat->id = id;
+    stat->min = UINT32_MAX;
+    return stat;
+}
+
+static void add_sample(prof_stat_t *stat, uint32_t cycles)
+{
+    uint32_t bucket = (cycles == 0u) ? 0u : 32u - clz32(cycles);
+
+    if (cycles < stat->min)
+    {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max)
+    {
+        stat->max = cycles;
+    }
+    stat->total += cycles;
+    stat->count++;
+    stat->hist[bucket]++;
+}
+
+/**
+ * Decodes a capture.
+ *
+ * @param[in]  data   - header followed by records, as written by prof_drain()
+ * @param[in]  length - bytes in data
+ * @param[out] report - statistics
+ * @returns bool      - false if data is not a complete capture
+ */
+bool prof_report_parse(const uint8_t *data, size_t length,
+                       prof_report_t *report)
+{
+    uint32_t i;
+
+    memset(report, 0, sizeof(*report));
+    if (length < sizeof(prof_header_t))
+    {
+        return false;
+    }
+    memcpy(&report->header, data, sizeof(prof_header_t));
+    if (report->header.magic != PROF_MAGIC ||
+        (length - sizeof(prof_header_t)) / sizeof(prof_record_t) <
+            report->header.count)
+    {
+        return false;
+    }
+
+    for (i = 0; i < report->header.count; i++)
+    {
+        prof_record_t record;
+        uint32_t kind;
+        prof_stat_t *stat;
+
+        memcpy(&record, data + sizeof(prof_header_t) + i * sizeof(record),
+               sizeof(record));
+        kind = record.tag >> 16;
+        stat = find_or_add(report,
+                           kind == PROF_KIND_ISR_ENTER || kind == PROF_KIND_ISR_EXIT,
+                           record.tag & 0xFFFFu);
+        if (stat == NULL)
+        {
+            report->unmatched++;
+        }
+        else if (kind == PROF_KIND_BEGIN || kind == PROF_KIND_ISR_ENTER)
+        {
+            if (stat->depth == PROF_REPORT_MAX_DEPTH)
+            {
+                report->unmatched++;
+            }
+            else
+            {
+                stat->open[stat->depth++] = record.cycles;
+            }
+        }
+        else if (stat->depth == 0u)
+        {
+            /* its begin was overwritten in the ring */
+            report->unmatched++;
+        }
+        else
+        {
+            uint32_t cycles = record.cycles - stat->open[--stat->depth];
+
+            cycles = (cycles > report->header.overhead)
+                         ? cycles - report->header.overhead
+                         : 0u;
+            add_sample(stat, cycles);
+        }
+    }
+    for (i = 0; i < report->nstats; i++)
+    {
+        report->unmatched += report->stats[i].depth;
+    }
+    return true;
+}
+
+/**
+ * @returns const prof_stat_t* - statistics of a zone or handler, NULL if
+ *                               it does not appear in the capture
+ */
+const prof_stat_t *prof_report_find(const prof_report_t *report, bool isr,
+                                    uint32_t id)
+{
+    uint32_t i;
+
+    for (i = 0; i < report->nstats; i++)
+    {
+        if (report->stats[i].isr == isr && report->stats[i].id == id)
+        {
+            return &report->stats[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Prints one table line and a histogram per zone and handler.
+ *
+ * @param[in] out   - destination
+ * @param[in] names - zone names indexed by id (NULL entries allowed), or NULL
+ */
+void prof_report_print(FILE *out, const prof_report_t *report,
+                       const char *const *names)
+{
+    double usPerCycle = (report->header.clock_hz != 0u)
+                            ? 1e6 / report->header.clock_hz
+                            : 0.0;
+    uint32_t i;
+
+    fprintf(out, "# %u records, clock %u Hz, probe overhead %u cycles, "
+                 "%u unmatched\n",
+            report->header.count, report->header.clock_hz,
+            report->header.overhead, report->unmatched);
+    fprintf(out, "%-24s %10s %12s %12s %12s %12s\n", "zone", "count",
+            "min_cyc", "avg_cyc", "max_cyc", "avg_us");
+
+    for (i = 0; i < report->nstats; i++)
+    {
+        const prof_stat_t *stat = &report->stats[i];
+        char name[32];
+        uint32_t peak = 0;
+        uint32_t b;
+        double avg;
+
+        if (stat->count == 0u)
+        {
+            continue;
+        }
+        if (stat->isr)
+        {
+            snprintf(name, sizeof(name), "isr %u", stat->id);
+        }
+        else if (names != NULL && names[stat->id] != NULL)
+        {
+            snprintf(name, sizeof(name), "%s", names[stat->id]);
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "zone %u", stat->id);
+        }
+        avg = (double)stat->total / stat->count;
+        fprintf(out, "%-24s %10u %12u %12.1f %12u %12.3f\n", name, stat->count,
+                stat->min, avg, stat->max, avg * usPerCycle);
+
+        for (b = 0; b < PROF_REPORT_BUCKETS; b++)
+        {
+            if (stat->hist[b] > peak)
+            {
+                peak = stat->hist[b];
+            }
+        }
+        for (b = 0; b < PROF_REPORT_BUCKETS; b++)
+        {
+            uint32_t width;
+
+            if (stat->hist[b] == 0u)
+            {
+                continue;
+            }
+            width = (uint32_t)(((uint64_t)stat->hist[b] * BAR_WIDTH + peak - 1u) / peak);
+            fprintf(out, "    < %-10llu %10u  %.*s\n",
+                    (b == 0u) ? 1ull : 1ull << b, stat->hist[b], (int)width,
+                    "########################################");
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     prof_report.h
+ * @author   insert authors names here
+ * @brief    Analysis of a trace drained by prof_drain() (common/profile.h). \n
+ *           Pairs begin/end (and handler entry/exit) records of the same id,
+ *           innermost first, and accumulates the durations, probe overhead
+ *           subtracted, into min/avg/max and a log2 histogram. Durations are
+ *           inclusive: a zone interrupted by a handler includes it.
+ *           Shared by host/tools/prof_hist.c and the benchmark runner.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _PROF_REPORT_H_
+#define _PROF_REPORT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "common/profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define PROF_REPORT_MAX_STATS   256u
+#define PROF_REPORT_MAX_DEPTH   16u
+#define PROF_REPORT_BUCKETS     33u     /**< 0, [1,2), [2,4), ... [2^31,2^32) */
+
+typedef struct
+{
+    bool     isr;
+    uint32_t id;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t hist[PROF_REPORT_BUCKETS];
+    uint32_t depth;                         /**< open begins */
+    uint32_t open[PROF_REPORT_MAX_DEPTH];   /**< their timestamps */
+} prof_stat_t;
+
+typedef struct
+{
+    prof_header_t header;
+    uint32_t      unmatched;    /**< ends without begin, begins never ended */
+    uint32_t      nstats;
+    prof_stat_t   stats[PROF_REPORT_MAX_STATS];
+} prof_report_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool               prof_report_parse(const uint8_t *data, size_t length,
+                                     prof_report_t *report);
+const prof_stat_t *prof_report_find(const prof_report_t *report, bool isr,
+                                    uint32_t id);
+void               prof_report_print(FILE *out, const prof_report_t *report,
+                                     const char *const *names);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     stack_map.c
+ * @author   insert authors names here
+ * @brief    Suggests stack sizes from the linker map and from measured
+ *           high-water marks, as CSV. \n
+ *               stack_map Lab2.map [capture.csv ...]
+ *               stack_map - capture.csv ...
+ *
+ *           The map is the one written by ILINK with stack usage analysis
+ *           on ("-" for none). Each capture is what stack_report() sent to
+ *           its sink, e.g. one file per build configuration.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stack_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      File scope vars
+ *
+ *------------------------------------------------------------------------------*/
+static stack_map_t     s_map;
+static stack_capture_t s_capture;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static char *read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    char *data;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = malloc((size > 0) ? (size_t)size : 1u);
+    if (data != NULL)
+    {
+        *length = fread(data, 1, (size_t)size, file);
+    }
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    bool useMap = false;
+    char *data;
+    size_t length = 0;
+    int i;
+
+    if (argc < 2 || (argc == 2 && strcmp(argv[1], "-") == 0))
+    {
+        fprintf(stderr, "usage: %s file.map|- [capture.csv ...]\n", argv[0]);
+        return 2;
+    }
+    if (strcmp(argv[1], "-") != 0)
+    {
+        data = read_file(argv[1], &length);
+        if (data == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+        if (!stack_map_parse(data, length, &s_map))
+        {
+            fprintf(stderr, "%s: no CSTACK block or stack usage summary\n",
+                    argv[1]);
+            free(data);
+            return 1;
+        }
+        free(data);
+        useMap = true;
+    }
+
+    stack_capture_init(&s_capture);
+    for (i = 2; i < argc; i++)
+    {
+        data = read_file(argv[i], &length);
+        if (data == NULL)
+        {
+            perror(argv[i]);
+            return 1;
+        }
+        if (!stack_capture_parse(data, length, &s_capture))
+        {
+            fprintf(stderr, "%s: not a complete stack capture\n", argv[i]);
+            free(data);
+            return 1;
+        }
+        free(data);
+    }
+    stack_report_print(stdout, useMap ? &s_map : NULL, &s_capture);
+    return 0;
+}
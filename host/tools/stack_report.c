@@ -0,0 +1,358 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     stack_report.c
+ * @author   insert authors names here
+ * @brief    Stack sizing from captures and map files (see stack_report.h).
+ *           Lines that are not part of a capture (e.g. other output on the
+ *           same UART) are skipped, as is everything in the map but the
+ *           CSTACK/HEAP blocks and the STACK USAGE summary.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stack_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+#define LINE_SIZE       256u
+#define MAX_TOKENS      8u
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+/**
+ * Copies the next line of @p *text into @p line, without the line ending.
+ *
+ * @returns bool - false at the end of the text
+ */
+static bool next_line(const char **text, const char *end, char *line,
+                      size_t size)
+{
+    const char *eol;
+    size_t n;
+
+    if (*text >= end)
+    {
+        return false;
+    }
+    eol = memchr(*text, '\n', (size_t)(end - *text));
+    n = (size_t)(((eol != NULL) ? eol : end) - *text);
+    if (n >= size)
+    {
+        n = size - 1u;
+    }
+    memcpy(line, *text, n);
+    line[n] = '\0';
+    if (n > 0u && line[n - 1u] == '\r')
+    {
+        line[n - 1u] = '\0';
+    }
+    *text = (eol != NULL) ? eol + 1 : end;
+    return true;
+}
+
+/** Splits @p line in place at white space. @returns uint32_t - tokens */
+static uint32_t tokenize(char *line, char **tokens)
+{
+    uint32_t n = 0;
+    char *token = strtok(line, " \t");
+
+    while (token != NULL && n < MAX_TOKENS)
+    {
+        tokens[n++] = token;
+        token = strtok(NULL, " \t");
+    }
+    return n;
+}
+
+/** Number as printed by ILINK: decimal or 0x, with ' digit separators. */
+static uint32_t map_number(const char *token)
+{
+    char digits[24];
+    size_t n = 0;
+
+    for (; *token != '\0' && n < sizeof(digits) - 1u; token++)
+    {
+        if (*token != '\'')
+        {
+            digits[n++] = *token;
+        }
+    }
+    digits[n] = '\0';
+    return (uint32_t)strtoul(digits, NULL, 0);
+}
+
+void stack_capture_init(stack_capture_t *capture)
+{
+    memset(capture, 0, sizeof(*capture));
+}
+
+/**
+ * Appends the stacks of every complete capture in @p text.
+ *
+ * @param[in]     text    - CSV text as written by stack_report()
+ * @param[in]     length  - bytes in text
+ * @param[in,out] capture - rows, from stack_capture_init() or a previous
+ *                          call
+ * @returns bool          - false if no complete capture was found
+ */
+bool stack_capture_parse(const char *text, size_t length,
+                         stack_capture_t *capture)
+{
+    const char *end = text + length;
+    char line[LINE_SIZE];
+    char config[STACK_REPORT_NAME_SIZE] = "";
+    bool header = false;
+    bool found = false;
+    uint32_t first = capture->nrows;
+    uint32_t rows = 0;
+
+    while (next_line(&text, end, line, sizeof(line)))
+    {
+        char name[STACK_REPORT_NAME_SIZE];
+        unsigned a;
+        unsigned b;
+
+        if (sscanf(line, "stack,%u,%15[^,]", &a, config) == 2)
+        {
+            /* a header without end discards the capture it started */
+            capture->nrows = first;
+            capture->format = a;
+            header = true;
+            rows = 0;
+        }
+        else if (!header)
+        {
+            continue;
+        }
+        else if (sscanf(line, "end,%u", &a) == 1)
+        {
+            if (a != rows)
+            {
+                capture->nrows = first;
+            }
+            found = found || (a == rows);
+            first = capture->nrows;
+            header = false;
+        }
+        else if (sscanf(line, "%15[^,],%u,%u", name, &a, &b) == 3)
+        {
+            stack_row_t *row = &capture->rows[capture->nrows];
+
+            rows++;
+            if (capture->nrows == STACK_REPORT_MAX_ROWS)
+            {
+                capture->dropped++;
+                continue;
+            }
+            snprintf(row->config, sizeof(row->config), "%s", config);
+            snprintf(row->name, sizeof(row->name), "%s", name);
+            row->size = a;
+            row->used = b;
+            capture->nrows++;
+        }
+    }
+    capture->nrows = first;
+    return found;
+}
+
+/**
+ * Reads the CSTACK/HEAP block sizes and the STACK USAGE summary of an IAR
+ * ILINK map file.
+ *
+ * @param[in]  text   - map file
+ * @param[in]  length - bytes in text
+ * @param[out] map    - what was found
+ * @returns bool      - false if the map has neither a CSTACK block nor a
+ *                      STACK USAGE summary
+ */
+bool stack_map_parse(const char *text, size_t length, stack_map_t *map)
+{
+    const char *end = text + length;
+    char line[LINE_SIZE];
+    bool table = false;
+
+    memset(map, 0, sizeof(*map));
+    while (next_line(&text, end, line, sizeof(line)))
+    {
+        char *tokens[MAX_TOKENS];
+        bool block = (strstr(line, "<Block>") != NULL);
+        bool header = (strstr(line, "Call Graph Root Category") != NULL);
+        uint32_t n = tokenize(line, tokens);
+        uint32_t k;
+        char name[LINE_SIZE] = "";
+
+        if (header)
+        {
+            table = true;
+            continue;
+        }
+        if (block && n >= 3u && strcmp(tokens[0], "CSTACK") == 0 &&
+            map->cstack_size == 0u)
+        {
+            map->cstack_size = map_number(tokens[2]);
+        }
+        if (block && n >= 3u && strcmp(tokens[0], "HEAP") == 0 &&
+            map->heap_size == 0u)
+        {
+            map->heap_size = map_number(tokens[2]);
+        }
+        if (!table)
+        {
+            continue;
+        }
+        if (n == 0u)
+        {
+            table = false;
+            continue;
+        }
+        if (tokens[0][0] == '-')
+        {
+            continue;
+        }
+
+        /* "<category words>  <max use>  <total use>" */
+        for (k = 0; k < n && !isdigit((unsigned char)tokens[k][0]); k++)
+        {
+            if (k != 0u)
+            {
+                strcat(name, " ");
+            }
+            strcat(name, tokens[k]);
+        }
+        if (k == 0u || k + 1u >= n)
+        {
+            continue;
+        }
+        map->analysed = true;
+        if (strcmp(name, "Program entry") == 0)
+        {
+            map->entry_max = map_number(tokens[k]);
+        }
+        else if (strcmp(name, "interrupt") == 0)
+        {
+            map->irq_max = map_number(tokens[k]);
+            map->irq_total = map_number(tokens[k + 1u]);
+        }
+        else if (strcmp(name, "Uncalled function") == 0)
+        {
+            map->uncalled_max = map_number(tokens[k]);
+        }
+    }
+    return map->cstack_size != 0u || map->analysed;
+}
+
+/** @returns uint32_t - worst-case CSTACK use in bytes, 0 if not analysed */
+uint32_t stack_map_worst_case(const stack_map_t *map)
+{
+    return map->analysed ? map->entry_max + map->irq_total : 0u;
+}
+
+/**
+ * @param[in] used       - measured peak, 0 if unknown
+ * @param[in] estimate   - worst case from the map, 0 if unknown
+ * @returns uint32_t     - suggested size in bytes, 0 if both are unknown
+ */
+uint32_t stack_suggest(uint32_t used, uint32_t estimate)
+{
+    uint32_t need = (used > estimate) ? used : estimate;
+
+    if (need == 0u)
+    {
+        return 0u;
+    }
+    need += need * STACK_REPORT_MARGIN_PCT / 100u;
+    return (need + STACK_REPORT_ROUND - 1u) / STACK_REPORT_ROUND *
+           STACK_REPORT_ROUND;
+}
+
+static void print_row(FILE *out, const char *name, const char *config,
+                      uint32_t size, uint32_t used, uint32_t estimate)
+{
+    fprintf(out, "%s,%s,%u,", name, config, size);
+    if (used != 0u)
+    {
+        fprintf(out, "%u,", used);
+    }
+    else
+    {
+        fprintf(out, "-,");
+    }
+    if (estimate != 0u)
+    {
+        fprintf(out, "%u,", estimate);
+    }
+    else
+    {
+        fprintf(out, "-,");
+    }
+    fprintf(out, "%u\n", stack_suggest(used, estimate));
+}
+
+/**
+ * Prints one line per stack and configuration as CSV: reserved size, peak
+ * use, worst case from the map (CSTACK only) and suggested size, in bytes.
+ *
+ * @param[in] out     - output stream
+ * @param[in] map     - map file figures, NULL if none
+ * @param[in] capture - measured figures, NULL if none
+ */
+void stack_report_print(FILE *out, const stack_map_t *map,
+                        const stack_capture_t *capture)
+{
+    uint32_t worst = (map != NULL) ? stack_map_worst_case(map) : 0u;
+    bool cstack = false;
+    uint32_t i;
+
+    if (map != NULL)
+    {
+        fprintf(out, "# map: CSTACK %u, HEAP %u bytes", map->cstack_size,
+                map->heap_size);
+        if (map->analysed)
+        {
+            fprintf(out, "; worst case %u = program entry %u + interrupts %u;"
+                    " uncalled functions (e.g. tasks) up to %u\n", worst,
+                    map->entry_max, map->irq_total, map->uncalled_max);
+        }
+        else
+        {
+            fprintf(out, "; no stack usage analysis\n");
+        }
+    }
+    fprintf(out, "stack,config,size,peak,estimate,suggested\n");
+    for (i = 0; capture != NULL && i < capture->nrows; i++)
+    {
+        const stack_row_t *row = &capture->rows[i];
+        bool is_main = (strcmp(row->name, "CSTACK") == 0);
+
+        cstack = cstack || is_main;
+        print_row(out, row->name, row->config, row->size, row->used,
+                  is_main ? worst : 0u);
+    }
+    if (!cstack && map != NULL && map->cstack_size != 0u)
+    {
+        print_row(out, "CSTACK", "map", map->cstack_size, 0u, worst);
+    }
+}
@@ -0,0 +1,102 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     stack_report.h
+ * @author   insert authors names here
+ * @brief    Stack sizing from measured high-water marks and from the linker
+ *           map. \n
+ *           - captures: what stack_report() (common/stack_watch.h) wrote,
+ *             one per build configuration; several may be appended.
+ *           - map: an IAR ILINK map file built with stack usage analysis on
+ *             (Linker > Advanced > Enable stack usage analysis). Its
+ *             "STACK USAGE" summary gives the deepest call chain of each
+ *             root category; the worst case of CSTACK is taken as that of
+ *             "Program entry" plus that of every interrupt nested at once
+ *             ("interrupt" Total Use), which is an upper bound.
+ *           Suggested sizes add STACK_REPORT_MARGIN_PCT to the larger of the
+ *           peak and the estimate. Shared by host/tools/stack_map.c and the
+ *           benchmark runner.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _STACK_REPORT_H_
+#define _STACK_REPORT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+#define STACK_REPORT_MAX_ROWS   64u
+#define STACK_REPORT_NAME_SIZE  16u
+#define STACK_REPORT_MARGIN_PCT 25u
+/** Granularity of suggested sizes, a multiple of the 8-byte alignment. */
+#define STACK_REPORT_ROUND      256u
+
+typedef struct
+{
+    char     config[STACK_REPORT_NAME_SIZE];
+    char     name[STACK_REPORT_NAME_SIZE];  /**< CSTACK or a task name */
+    uint32_t size;                          /**< bytes reserved */
+    uint32_t used;                          /**< peak bytes */
+} stack_row_t;
+
+typedef struct
+{
+    uint32_t    format;
+    uint32_t    dropped;        /**< rows beyond STACK_REPORT_MAX_ROWS */
+    uint32_t    nrows;
+    stack_row_t rows[STACK_REPORT_MAX_ROWS];
+} stack_capture_t;
+
+typedef struct
+{
+    uint32_t cstack_size;       /**< 0 if the map has no CSTACK block */
+    uint32_t heap_size;         /**< 0 if the map has no HEAP block */
+    bool     analysed;          /**< map has the STACK USAGE summary */
+    uint32_t entry_max;         /**< "Program entry" Max Use */
+    uint32_t irq_max;           /**< "interrupt" Max Use */
+    uint32_t irq_total;         /**< "interrupt" Total Use */
+    uint32_t uncalled_max;      /**< "Uncalled function" Max Use, e.g. tasks */
+} stack_map_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+void     stack_capture_init(stack_capture_t *capture);
+bool     stack_capture_parse(const char *text, size_t length,
+                             stack_capture_t *capture);
+bool     stack_map_parse(const char *text, size_t length, stack_map_t *map);
+uint32_t stack_map_worst_case(const stack_map_t *map);
+uint32_t stack_suggest(uint32_t used, uint32_t estimate);
+void     stack_report_print(FILE *out, const stack_map_t *map,
+                            const stack_capture_t *capture);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
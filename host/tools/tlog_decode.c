@@ -0,0 +1,104 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     tlog_decode.c
+ * @author   insert authors names here
+ * @brief    Prints a tokenized log capture as text. \n
+ *               tlog_decode Lab2.out capture.bin
+ *
+ *           Lab2.out is the ELF of the build that logged (Debug/Exe or
+ *           Release/Exe), capture.bin what tlog_drain() sent, e.g. the SWO
+ *           log of ITM port 1 saved by the debugger, or a UART capture.
+ *           The counts of records, dropped records and resyncs go to
+ *           stderr.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "tlog_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint8_t *read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t *data;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = malloc((size > 0) ? (size_t)size : 1u);
+    if (data != NULL)
+    {
+        *length = fread(data, 1, (size_t)size, file);
+    }
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    tlog_strings_t strings;
+    tlog_stats_t stats;
+    uint8_t *elf;
+    uint8_t *capture;
+    size_t elfLength = 0;
+    size_t length = 0;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s program.out capture.bin\n", argv[0]);
+        return 2;
+    }
+    elf = read_file(argv[1], &elfLength);
+    if (elf == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    if (!tlog_strings_load(elf, elfLength, &strings))
+    {
+        fprintf(stderr, "%s: not an ELF file with a .tlog_str section\n",
+                argv[1]);
+        free(elf);
+        return 1;
+    }
+    capture = read_file(argv[2], &length);
+    if (capture == NULL)
+    {
+        perror(argv[2]);
+        free(elf);
+        return 1;
+    }
+
+    tlog_report_print(stdout, &strings, capture, length, &stats);
+    fprintf(stderr, "%u records, %u dropped, %u resyncs\n",
+            (unsigned int)stats.records, (unsigned int)stats.dropped,
+            (unsigned int)stats.errors);
+    free(capture);
+    free(elf);
+    return 0;
+}
@@ -0,0 +1,411 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     tlog_report.c
+ * @author   insert authors names here
+ * @brief    Decoding of tokenized log captures, see tlog_report.h.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <elf.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "tlog_report.h"
+
+/*------------------------------------------------------------------------------
+ *
+ *      Typedefs and constants
+ *
+ *------------------------------------------------------------------------------*/
+/** "%", flags, width, precision and conversion of one field. */
+#define SPEC_SIZE           32u
+
+/** Section name of each tool chain. */
+static const char *const s_sections[] = { ".tlog_str", "tlog_str" };
+
+/** What a section header has for us, of either ELF class. */
+typedef struct
+{
+    uint32_t name;
+    uint32_t type;
+    uint64_t offset;
+    uint64_t size;
+} section_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions and Methods
+ *
+ *------------------------------------------------------------------------------*/
+static uint32_t read32(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+           ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static bool read_section(const uint8_t *elf, size_t length, bool is64,
+                         uint64_t at, section_t *section)
+{
+    if (is64)
+    {
+        Elf64_Shdr header;
+
+        if (at + sizeof(header) > length)
+        {
+            return false;
+        }
+        memcpy(&header, elf + at, sizeof(header));
+        section->name = header.sh_name;
+        section->type = header.sh_type;
+        section->offset = header.sh_offset;
+        section->size = header.sh_size;
+    }
+    else
+    {
+        Elf32_Shdr header;
+
+        if (at + sizeof(header) > length)
+        {
+            return false;
+        }
+        memcpy(&header, elf + at, sizeof(header));
+        section->name = header.sh_name;
+        section->type = header.sh_type;
+        section->offset = header.sh_offset;
+        section->size = header.sh_size;
+    }
+    return section->type == SHT_NOBITS ||
+           (section->offset <= length && section->size <= length - section->offset);
+}
+
+/**
+ * Finds the log strings in a little-endian ELF image, 32 or 64-bit.
+ *
+ * @param[in]  elf     - the whole file; *strings points into it
+ * @param[in]  length  - its size
+ * @param[out] strings - section contents
+ * @returns bool       - false if not an ELF or it has no strings section
+ */
+bool tlog_strings_load(const uint8_t *elf, size_t length,
+                       tlog_strings_t *strings)
+{
+    uint64_t shoff;
+    uint32_t shentsize;
+    uint32_t shnum;
+    uint32_t shstrndx;
+    section_t names;
+    bool is64;
+    uint32_t i;
+
+    if (length < EI_NIDENT || memcmp(elf, ELFMAG, SELFMAG) != 0 ||
+        elf[EI_DATA] != ELFDATA2LSB)
+    {
+        return false;
+    }
+    is64 = (elf[EI_CLASS] == ELFCLASS64);
+    if (is64)
+    {
+        Elf64_Ehdr header;
+
+        if (length < sizeof(header))
+        {
+            return false;
+        }
+        memcpy(&header, elf, sizeof(header));
+        shoff = header.e_shoff;
+        shentsize = header.e_shentsize;
+        shnum = header.e_shnum;
+        shstrndx = header.e_shstrndx;
+    }
+    else
+    {
+        Elf32_Ehdr header;
+
+        if (length < sizeof(header))
+        {
+            return false;
+        }
+        memcpy(&header, elf, sizeof(header));
+        shoff = header.e_shoff;
+        shentsize = header.e_shentsize;
+        shnum = header.e_shnum;
+        shstrndx = header.e_shstrndx;
+    }
+
+    if (shstrndx >= shnum ||
+        !read_section(elf, length, is64, shoff + (uint64_t)shstrndx * shentsize,
+                      &names) ||
+        names.type == SHT_NOBITS)
+    {
+        return false;
+    }
+    for (i = 0; i < shnum; i++)
+    {
+        section_t section;
+        const char *name;
+        size_t k;
+
+        if (!read_section(elf, length, is64, shoff + (uint64_t)i * shentsize,
+                          &section) ||
+            section.type == SHT_NOBITS || section.name >= names.size)
+        {
+            continue;
+        }
+        name = (const char *)elf + names.offset + section.name;
+        if (memchr(name, '\0', names.size - section.name) == NULL)
+        {
+            continue;
+        }
+        for (k = 0; k < sizeof(s_sections) / sizeof(s_sections[0]); k++)
+        {
+            if (strcmp(name, s_sections[k]) == 0)
+            {
+                strings->data = (const char *)elf + section.offset;
+                strings->size = (size_t)section.size;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/** The format string of a header, NULL if it does not point to one. */
+static const char *header_string(const tlog_strings_t *strings, uint32_t header)
+{
+    uint32_t offset = header & TLOG_OFFSET_MASK;
+
+    if ((header & TLOG_VALID) == 0u ||
+        (header & TLOG_NARGS_MASK) > TLOG_MAX_ARGS ||
+        offset >= strings->size ||
+        memchr(strings->data + offset, '\0', strings->size - offset) == NULL)
+    {
+        return NULL;
+    }
+    return strings->data + offset;
+}
+
+static void append(char *text, size_t size, size_t *used, const char *format, ...)
+{
+    va_list args;
+    int n;
+
+    if (*used + 1u >= size)
+    {
+        return;
+    }
+    va_start(args, format);
+    n = vsnprintf(text + *used, size - *used, format, args);
+    va_end(args);
+    if (n > 0)
+    {
+        *used += ((size_t)n < size - *used) ? (size_t)n : size - *used - 1u;
+    }
+}
+
+/** One conversion; spec is "%", flags, width, precision, then the letter. */
+static void append_field(char *text, size_t size, size_t *used, char *spec,
+                         size_t length, char conversion, uint32_t arg)
+{
+    float value;
+
+    spec[length] = conversion;
+    spec[length + 1u] = '\0';
+    switch (conversion)
+    {
+    case 'd':
+    case 'i':
+        append(text, size, used, spec, (int)(int32_t)arg);
+        break;
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        append(text, size, used, spec, (unsigned int)arg);
+        break;
+    case 'c':
+        append(text, size, used, spec, (int)(unsigned char)arg);
+        break;
+    case 'p':
+        append(text, size, used, "0x%08x", (unsigned int)arg);
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        memcpy(&value, &arg, sizeof(value));
+        append(text, size, used, spec, (double)value);
+        break;
+    default:
+        append(text, size, used, "<%%%c?>", conversion);
+        break;
+    }
+}
+
+/**
+ * Formats one record.
+ *
+ * @param[in]  strings - log strings of the build
+ * @param[in]  header  - record header
+ * @param[in]  args    - its (header & TLOG_NARGS_MASK) arguments
+ * @param[out] text    - the line, without newline, NUL-terminated
+ * @param[in]  size    - room in @p text
+ * @returns size_t     - length of the line, 0 if @p header is invalid
+ */
+size_t tlog_format(const tlog_strings_t *strings, uint32_t header,
+                   const uint32_t *args, char *text, size_t size)
+{
+    const char *format = header_string(strings, header);
+    uint32_t nargs = header & TLOG_NARGS_MASK;
+    uint32_t next = 0u;
+    size_t used = 0u;
+
+    if (size == 0u)
+    {
+        return 0u;
+    }
+    text[0] = '\0';
+    if (header == TLOG_DROPPED)
+    {
+        append(text, size, &used, "tlog: %u records dropped", (unsigned int)args[0]);
+        return used;
+    }
+    if (format == NULL)
+    {
+        return 0u;
+    }
+
+    while (*format != '\0')
+    {
+        char spec[SPEC_SIZE];
+        size_t length = 0u;
+
+        if (*format != '%')
+        {
+            append(text, size, &used, "%c", *format++);
+            continue;
+        }
+        format++;
+        if (*format == '%')
+        {
+            append(text, size, &used, "%%");
+            format++;
+            continue;
+        }
+        spec[length++] = '%';
+        while (*format != '\0' && strchr("-+ #0123456789.", *format) != NULL)
+        {
+            if (length < SPEC_SIZE - 2u)
+            {
+                spec[length++] = *format;
+            }
+            format++;
+        }
+        while (*format != '\0' && strchr("hljztL", *format) != NULL)
+        {
+            format++;
+        }
+        if (*format == '\0')
+        {
+            break;
+        }
+        if (next < nargs)
+        {
+            append_field(text, size, &used, spec, length, *format, args[next++]);
+        }
+        else
+        {
+            append(text, size, &used, "<?>");
+        }
+        format++;
+    }
+    return used;
+}
+
+/**
+ * Decodes a capture, one line per record.
+ *
+ * @param[in]  out     - text output
+ * @param[in]  strings - log strings of the build the capture came from
+ * @param[in]  data    - the capture
+ * @param[in]  length  - its size
+ * @param[out] stats   - counts, may be NULL
+ */
+void tlog_report_print(FILE *out, const tlog_strings_t *strings,
+                       const uint8_t *data, size_t length,
+                       tlog_stats_t *stats)
+{
+    tlog_stats_t counts = { 0u, 0u, 0u };
+    bool synced = false;
+    size_t at = 0u;
+
+    while (at + sizeof(uint32_t) <= length)
+    {
+        uint32_t header = read32(data + at);
+        uint32_t args[TLOG_MAX_ARGS];
+        char line[TLOG_REPORT_LINE_SIZE];
+        uint32_t nargs;
+        uint32_t i;
+
+        if (header == TLOG_MAGIC)
+        {
+            synced = true;
+            at += sizeof(uint32_t);
+            continue;
+        }
+        if (!synced)
+        {
+            at++;
+            continue;
+        }
+        nargs = header & TLOG_NARGS_MASK;
+        if (header != TLOG_DROPPED && header_string(strings, header) == NULL)
+        {
+            counts.errors++;
+            synced = false;
+            at++;
+            continue;
+        }
+        if (at + (1u + nargs) * sizeof(uint32_t) > length)
+        {
+            break;
+        }
+        for (i = 0; i < nargs; i++)
+        {
+            args[i] = read32(data + at + (1u + i) * sizeof(uint32_t));
+        }
+        at += (1u + nargs) * sizeof(uint32_t);
+
+        (void)tlog_format(strings, header, args, line, sizeof(line));
+        fprintf(out, "%s\n", line);
+        if (header == TLOG_DROPPED)
+        {
+            counts.dropped += args[0];
+        }
+        else
+        {
+            counts.records++;
+        }
+    }
+    if (stats != NULL)
+    {
+        *stats = counts;
+    }
+}
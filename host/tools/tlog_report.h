@@ -0,0 +1,86 @@
+/*__________________________________________________________________________________
+|       Disciplina de Sistemas Embarcados - 2023-1
+|       Prof. Douglas Renaux
+| __________________________________________________________________________________
+|
+|		Host build - tools
+| __________________________________________________________________________________
+*/
+
+/**
+ * @file     tlog_report.h
+ * @author   insert authors names here
+ * @brief    Decoding of tokenized log captures (common/tlog.h). \n
+ *           - strings: section .tlog_str of the ELF the capture came from,
+ *             the IAR Lab2.out (ELF32) or, for the host build, the GCC
+ *             executable (ELF64, section tlog_str). A header's offset points
+ *             into it.
+ *           - capture: what tlog_drain() sent, e.g. the SWO log of ITM port
+ *             TLOG_ITM_PORT or a UART capture. Decoding starts at the first
+ *             TLOG_MAGIC; after a word that is not a valid header it skips
+ *             to the next one, so a capture may start or break anywhere.
+ *           Conversions: d i u o x X c p, and f e g a (with F E G A) on
+ *           float bits; flags, width and precision as in printf, length
+ *           modifiers ignored (arguments are 32 bits). Shared by
+ *           host/tools/tlog_decode.c and the benchmark runner.
+ * @version  V1
+ * @date     Oct, 2026
+ ******************************************************************************/
+
+#ifndef _TLOG_REPORT_H_
+#define _TLOG_REPORT_H_
+/*------------------------------------------------------------------------------
+ *
+ *      File includes
+ *
+ *------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "common/tlog.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------------------------------------------------------------------
+ *
+ *      Global Typedefs, constants and defines
+ *
+ *------------------------------------------------------------------------------*/
+/** Longest decoded line; longer ones are cut. */
+#define TLOG_REPORT_LINE_SIZE   256u
+
+typedef struct
+{
+    const char *data;           /**< section contents, inside the ELF image */
+    size_t      size;
+} tlog_strings_t;
+
+typedef struct
+{
+    uint32_t records;           /**< decoded, dropped notices excluded */
+    uint32_t dropped;           /**< records the target could not log */
+    uint32_t errors;            /**< invalid headers, each one a resync */
+} tlog_stats_t;
+
+/*------------------------------------------------------------------------------
+ *
+ *      Functions
+ *
+ *------------------------------------------------------------------------------*/
+bool   tlog_strings_load(const uint8_t *elf, size_t length,
+                         tlog_strings_t *strings);
+size_t tlog_format(const tlog_strings_t *strings, uint32_t header,
+                   const uint32_t *args, char *text, size_t size);
+void   tlog_report_print(FILE *out, const tlog_strings_t *strings,
+                         const uint8_t *data, size_t length,
+                         tlog_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif